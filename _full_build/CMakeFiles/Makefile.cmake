@@ -0,0 +1,243 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/AUTHORS"
+  "/root/repo/CMakeLists.txt"
+  "/root/repo/COPYING"
+  "/root/repo/COPYING.LESSER"
+  "/root/repo/NEWS"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/builds/cmake/Modules/ClangFormat.cmake"
+  "/root/repo/builds/cmake/Modules/FindAsciiDoc.cmake"
+  "/root/repo/builds/cmake/Modules/FindSodium.cmake"
+  "/root/repo/builds/cmake/Modules/TestZMQVersion.cmake"
+  "/root/repo/builds/cmake/Modules/ZMQSourceRunChecks.cmake"
+  "/root/repo/builds/cmake/Modules/ZMQSupportMacros.cmake"
+  "/root/repo/builds/cmake/ZeroMQConfig.cmake.in"
+  "/root/repo/builds/cmake/clang-format-check.sh.in"
+  "/root/repo/builds/cmake/platform.hpp.in"
+  "/root/repo/src/libzmq.pc.in"
+  "/root/repo/src/version.rc.in"
+  "/root/repo/tests/CMakeLists.txt"
+  "/root/repo/unittests/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-AnyNewerVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDependentOption.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckTypeSize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceRuns.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "version.rc"
+  "platform.hpp"
+  "libzmq.pc"
+  "AUTHORS.txt"
+  "COPYING.txt"
+  "COPYING.LESSER.txt"
+  "NEWS.txt"
+  "ZeroMQConfig.cmake"
+  "ZeroMQConfigVersion.cmake"
+  "clang-format-check.sh"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "unittests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/objects.dir/DependInfo.cmake"
+  "CMakeFiles/libzmq.dir/DependInfo.cmake"
+  "CMakeFiles/libzmq-static.dir/DependInfo.cmake"
+  "CMakeFiles/local_lat.dir/DependInfo.cmake"
+  "CMakeFiles/remote_lat.dir/DependInfo.cmake"
+  "CMakeFiles/local_thr.dir/DependInfo.cmake"
+  "CMakeFiles/remote_thr.dir/DependInfo.cmake"
+  "CMakeFiles/inproc_lat.dir/DependInfo.cmake"
+  "CMakeFiles/inproc_thr.dir/DependInfo.cmake"
+  "CMakeFiles/proxy_thr.dir/DependInfo.cmake"
+  "CMakeFiles/zerocopy_thr.dir/DependInfo.cmake"
+  "CMakeFiles/router_thr.dir/DependInfo.cmake"
+  "CMakeFiles/fanin_thr.dir/DependInfo.cmake"
+  "CMakeFiles/shm_lat.dir/DependInfo.cmake"
+  "CMakeFiles/shm_thr.dir/DependInfo.cmake"
+  "CMakeFiles/numa_thr.dir/DependInfo.cmake"
+  "CMakeFiles/thread_safe_thr.dir/DependInfo.cmake"
+  "CMakeFiles/benchmark_msg_alloc.dir/DependInfo.cmake"
+  "CMakeFiles/benchmark_radix_tree.dir/DependInfo.cmake"
+  "CMakeFiles/benchmark_timers.dir/DependInfo.cmake"
+  "CMakeFiles/benchmark_ws_mask.dir/DependInfo.cmake"
+  "CMakeFiles/clang-format.dir/DependInfo.cmake"
+  "CMakeFiles/clang-format-check.dir/DependInfo.cmake"
+  "CMakeFiles/clang-format-diff.dir/DependInfo.cmake"
+  "tests/CMakeFiles/unity.dir/DependInfo.cmake"
+  "tests/CMakeFiles/testutil-static.dir/DependInfo.cmake"
+  "tests/CMakeFiles/testutil.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_ancillaries.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_system.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_pair_inproc.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_pair_tcp.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_reqrep_inproc.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_reqrep_tcp.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_hwm.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_hwm_pubsub.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_reqrep_device.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_sub_forward.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_invalid_rep.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_msg_flags.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_msg_ffn.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_connect_resolve.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_immediate.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_last_endpoint.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_term_endpoint.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_router_mandatory.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_probe_router.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_stream.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_stream_empty.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_stream_disconnect.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_disconnect_inproc.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_unbind_wildcard.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_ctx_options.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_ctx_destroy.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_security_no_zap_handler.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_security_null.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_security_plain.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_security_zap.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_iov.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_spec_req.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_spec_rep.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_spec_dealer.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_spec_router.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_spec_pushpull.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_req_correlate.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_req_relaxed.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_conflate.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_inproc_connect.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_issue_566.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_shutdown_stress.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_timeo.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_many_sockets.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_diffserv.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_connect_rid.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_xpub_nodrop.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_pub_invert_matching.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_setsockopt.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_sockopt_hwm.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_heartbeats.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_atomics.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_bind_src_address.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_capabilities.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_metadata.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_router_handover.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_srcfd.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_stream_timeout.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_xpub_manual.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_xpub_welcome_msg.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_xpub_verbose.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_base85.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_bind_after_connect_tcp.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_sodium.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_monitor.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_socket_null.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_reconnect_ivl.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_mock_pub_sub.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_security_gssapi.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_security_curve.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_ipc_wildcard.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_pair_ipc.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_reqrep_ipc.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_rebind_ipc.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_pair_shm.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_proxy.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_proxy_hwm.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_proxy_single_socket.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_proxy_terminate.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_getsockopt_memset.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_filter_ipc.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_stream_exceeds_buffer.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_router_mandatory_hwm.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_use_fd.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_zmq_poll_fd.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_fork.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_abstract_ipc.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_address_tipc.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_pair_tipc.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_reqrep_device_tipc.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_reqrep_tipc.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_router_mandatory_tipc.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_sub_forward_tipc.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_connect_delay_tipc.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_shutdown_stress_tipc.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_term_endpoint_tipc.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_poller.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_thread_safe.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_client_server.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_timers.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_radio_dish.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_scatter_gather.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_dgram.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_app_meta.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_router_notify.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_xpub_manual_last_value.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_batch.dir/DependInfo.cmake"
+  "unittests/CMakeFiles/unittest_ypipe.dir/DependInfo.cmake"
+  "unittests/CMakeFiles/unittest_mpsc_queue.dir/DependInfo.cmake"
+  "unittests/CMakeFiles/unittest_poller.dir/DependInfo.cmake"
+  "unittests/CMakeFiles/unittest_mtrie.dir/DependInfo.cmake"
+  "unittests/CMakeFiles/unittest_ip_resolver.dir/DependInfo.cmake"
+  "unittests/CMakeFiles/unittest_udp_address.dir/DependInfo.cmake"
+  "unittests/CMakeFiles/unittest_radix_tree.dir/DependInfo.cmake"
+  "unittests/CMakeFiles/unittest_timer_wheel.dir/DependInfo.cmake"
+  )
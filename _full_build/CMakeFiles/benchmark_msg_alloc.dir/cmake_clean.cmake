@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmark_msg_alloc.dir/perf/benchmark_msg_alloc.cpp.o"
+  "CMakeFiles/benchmark_msg_alloc.dir/perf/benchmark_msg_alloc.cpp.o.d"
+  "bin/benchmark_msg_alloc"
+  "bin/benchmark_msg_alloc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmark_msg_alloc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
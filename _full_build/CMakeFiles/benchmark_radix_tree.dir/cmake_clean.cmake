@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmark_radix_tree.dir/perf/benchmark_radix_tree.cpp.o"
+  "CMakeFiles/benchmark_radix_tree.dir/perf/benchmark_radix_tree.cpp.o.d"
+  "bin/benchmark_radix_tree"
+  "bin/benchmark_radix_tree.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmark_radix_tree.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmark_timers.dir/perf/benchmark_timers.cpp.o"
+  "CMakeFiles/benchmark_timers.dir/perf/benchmark_timers.cpp.o.d"
+  "bin/benchmark_timers"
+  "bin/benchmark_timers.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmark_timers.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmark_ws_mask.dir/perf/benchmark_ws_mask.cpp.o"
+  "CMakeFiles/benchmark_ws_mask.dir/perf/benchmark_ws_mask.cpp.o.d"
+  "bin/benchmark_ws_mask"
+  "bin/benchmark_ws_mask.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmark_ws_mask.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
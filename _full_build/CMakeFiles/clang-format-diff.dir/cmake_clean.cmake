@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/clang-format-diff"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/clang-format-diff.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
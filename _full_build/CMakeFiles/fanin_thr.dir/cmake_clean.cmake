@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/fanin_thr.dir/perf/fanin_thr.cpp.o"
+  "CMakeFiles/fanin_thr.dir/perf/fanin_thr.cpp.o.d"
+  "bin/fanin_thr"
+  "bin/fanin_thr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/fanin_thr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
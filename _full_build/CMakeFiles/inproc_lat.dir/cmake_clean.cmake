@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/inproc_lat.dir/perf/inproc_lat.cpp.o"
+  "CMakeFiles/inproc_lat.dir/perf/inproc_lat.cpp.o.d"
+  "bin/inproc_lat"
+  "bin/inproc_lat.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/inproc_lat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/inproc_thr.dir/perf/inproc_thr.cpp.o"
+  "CMakeFiles/inproc_thr.dir/perf/inproc_thr.cpp.o.d"
+  "bin/inproc_thr"
+  "bin/inproc_thr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/inproc_thr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "lib/libzmq.pdb"
+  "lib/libzmq.so"
+  "lib/libzmq.so.5"
+  "lib/libzmq.so.5.2.3"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/libzmq.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/local_lat.dir/perf/local_lat.cpp.o"
+  "CMakeFiles/local_lat.dir/perf/local_lat.cpp.o.d"
+  "bin/local_lat"
+  "bin/local_lat.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/local_lat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
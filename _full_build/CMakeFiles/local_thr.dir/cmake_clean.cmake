@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/local_thr.dir/perf/local_thr.cpp.o"
+  "CMakeFiles/local_thr.dir/perf/local_thr.cpp.o.d"
+  "bin/local_thr"
+  "bin/local_thr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/local_thr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/numa_thr.dir/perf/numa_thr.cpp.o"
+  "CMakeFiles/numa_thr.dir/perf/numa_thr.cpp.o.d"
+  "bin/numa_thr"
+  "bin/numa_thr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/numa_thr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
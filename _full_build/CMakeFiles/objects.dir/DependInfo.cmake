@@ -0,0 +1,140 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/external/sha1/sha1.c" "CMakeFiles/objects.dir/external/sha1/sha1.c.o" "gcc" "CMakeFiles/objects.dir/external/sha1/sha1.c.o.d"
+  "/root/repo/src/address.cpp" "CMakeFiles/objects.dir/src/address.cpp.o" "gcc" "CMakeFiles/objects.dir/src/address.cpp.o.d"
+  "/root/repo/src/allocator.cpp" "CMakeFiles/objects.dir/src/allocator.cpp.o" "gcc" "CMakeFiles/objects.dir/src/allocator.cpp.o.d"
+  "/root/repo/src/client.cpp" "CMakeFiles/objects.dir/src/client.cpp.o" "gcc" "CMakeFiles/objects.dir/src/client.cpp.o.d"
+  "/root/repo/src/clock.cpp" "CMakeFiles/objects.dir/src/clock.cpp.o" "gcc" "CMakeFiles/objects.dir/src/clock.cpp.o.d"
+  "/root/repo/src/ctx.cpp" "CMakeFiles/objects.dir/src/ctx.cpp.o" "gcc" "CMakeFiles/objects.dir/src/ctx.cpp.o.d"
+  "/root/repo/src/curve_client.cpp" "CMakeFiles/objects.dir/src/curve_client.cpp.o" "gcc" "CMakeFiles/objects.dir/src/curve_client.cpp.o.d"
+  "/root/repo/src/curve_mechanism_base.cpp" "CMakeFiles/objects.dir/src/curve_mechanism_base.cpp.o" "gcc" "CMakeFiles/objects.dir/src/curve_mechanism_base.cpp.o.d"
+  "/root/repo/src/curve_server.cpp" "CMakeFiles/objects.dir/src/curve_server.cpp.o" "gcc" "CMakeFiles/objects.dir/src/curve_server.cpp.o.d"
+  "/root/repo/src/dealer.cpp" "CMakeFiles/objects.dir/src/dealer.cpp.o" "gcc" "CMakeFiles/objects.dir/src/dealer.cpp.o.d"
+  "/root/repo/src/decoder_allocators.cpp" "CMakeFiles/objects.dir/src/decoder_allocators.cpp.o" "gcc" "CMakeFiles/objects.dir/src/decoder_allocators.cpp.o.d"
+  "/root/repo/src/devpoll.cpp" "CMakeFiles/objects.dir/src/devpoll.cpp.o" "gcc" "CMakeFiles/objects.dir/src/devpoll.cpp.o.d"
+  "/root/repo/src/dgram.cpp" "CMakeFiles/objects.dir/src/dgram.cpp.o" "gcc" "CMakeFiles/objects.dir/src/dgram.cpp.o.d"
+  "/root/repo/src/dish.cpp" "CMakeFiles/objects.dir/src/dish.cpp.o" "gcc" "CMakeFiles/objects.dir/src/dish.cpp.o.d"
+  "/root/repo/src/dist.cpp" "CMakeFiles/objects.dir/src/dist.cpp.o" "gcc" "CMakeFiles/objects.dir/src/dist.cpp.o.d"
+  "/root/repo/src/endpoint.cpp" "CMakeFiles/objects.dir/src/endpoint.cpp.o" "gcc" "CMakeFiles/objects.dir/src/endpoint.cpp.o.d"
+  "/root/repo/src/epoll.cpp" "CMakeFiles/objects.dir/src/epoll.cpp.o" "gcc" "CMakeFiles/objects.dir/src/epoll.cpp.o.d"
+  "/root/repo/src/err.cpp" "CMakeFiles/objects.dir/src/err.cpp.o" "gcc" "CMakeFiles/objects.dir/src/err.cpp.o.d"
+  "/root/repo/src/fq.cpp" "CMakeFiles/objects.dir/src/fq.cpp.o" "gcc" "CMakeFiles/objects.dir/src/fq.cpp.o.d"
+  "/root/repo/src/gather.cpp" "CMakeFiles/objects.dir/src/gather.cpp.o" "gcc" "CMakeFiles/objects.dir/src/gather.cpp.o.d"
+  "/root/repo/src/gather_buffer.cpp" "CMakeFiles/objects.dir/src/gather_buffer.cpp.o" "gcc" "CMakeFiles/objects.dir/src/gather_buffer.cpp.o.d"
+  "/root/repo/src/io_object.cpp" "CMakeFiles/objects.dir/src/io_object.cpp.o" "gcc" "CMakeFiles/objects.dir/src/io_object.cpp.o.d"
+  "/root/repo/src/io_thread.cpp" "CMakeFiles/objects.dir/src/io_thread.cpp.o" "gcc" "CMakeFiles/objects.dir/src/io_thread.cpp.o.d"
+  "/root/repo/src/io_uring.cpp" "CMakeFiles/objects.dir/src/io_uring.cpp.o" "gcc" "CMakeFiles/objects.dir/src/io_uring.cpp.o.d"
+  "/root/repo/src/ip.cpp" "CMakeFiles/objects.dir/src/ip.cpp.o" "gcc" "CMakeFiles/objects.dir/src/ip.cpp.o.d"
+  "/root/repo/src/ip_resolver.cpp" "CMakeFiles/objects.dir/src/ip_resolver.cpp.o" "gcc" "CMakeFiles/objects.dir/src/ip_resolver.cpp.o.d"
+  "/root/repo/src/ipc_address.cpp" "CMakeFiles/objects.dir/src/ipc_address.cpp.o" "gcc" "CMakeFiles/objects.dir/src/ipc_address.cpp.o.d"
+  "/root/repo/src/ipc_connecter.cpp" "CMakeFiles/objects.dir/src/ipc_connecter.cpp.o" "gcc" "CMakeFiles/objects.dir/src/ipc_connecter.cpp.o.d"
+  "/root/repo/src/ipc_listener.cpp" "CMakeFiles/objects.dir/src/ipc_listener.cpp.o" "gcc" "CMakeFiles/objects.dir/src/ipc_listener.cpp.o.d"
+  "/root/repo/src/kqueue.cpp" "CMakeFiles/objects.dir/src/kqueue.cpp.o" "gcc" "CMakeFiles/objects.dir/src/kqueue.cpp.o.d"
+  "/root/repo/src/lb.cpp" "CMakeFiles/objects.dir/src/lb.cpp.o" "gcc" "CMakeFiles/objects.dir/src/lb.cpp.o.d"
+  "/root/repo/src/mailbox.cpp" "CMakeFiles/objects.dir/src/mailbox.cpp.o" "gcc" "CMakeFiles/objects.dir/src/mailbox.cpp.o.d"
+  "/root/repo/src/mailbox_safe.cpp" "CMakeFiles/objects.dir/src/mailbox_safe.cpp.o" "gcc" "CMakeFiles/objects.dir/src/mailbox_safe.cpp.o.d"
+  "/root/repo/src/mechanism.cpp" "CMakeFiles/objects.dir/src/mechanism.cpp.o" "gcc" "CMakeFiles/objects.dir/src/mechanism.cpp.o.d"
+  "/root/repo/src/mechanism_base.cpp" "CMakeFiles/objects.dir/src/mechanism_base.cpp.o" "gcc" "CMakeFiles/objects.dir/src/mechanism_base.cpp.o.d"
+  "/root/repo/src/memfd.cpp" "CMakeFiles/objects.dir/src/memfd.cpp.o" "gcc" "CMakeFiles/objects.dir/src/memfd.cpp.o.d"
+  "/root/repo/src/metadata.cpp" "CMakeFiles/objects.dir/src/metadata.cpp.o" "gcc" "CMakeFiles/objects.dir/src/metadata.cpp.o.d"
+  "/root/repo/src/msg.cpp" "CMakeFiles/objects.dir/src/msg.cpp.o" "gcc" "CMakeFiles/objects.dir/src/msg.cpp.o.d"
+  "/root/repo/src/msg_pool.cpp" "CMakeFiles/objects.dir/src/msg_pool.cpp.o" "gcc" "CMakeFiles/objects.dir/src/msg_pool.cpp.o.d"
+  "/root/repo/src/mtrie.cpp" "CMakeFiles/objects.dir/src/mtrie.cpp.o" "gcc" "CMakeFiles/objects.dir/src/mtrie.cpp.o.d"
+  "/root/repo/src/norm_engine.cpp" "CMakeFiles/objects.dir/src/norm_engine.cpp.o" "gcc" "CMakeFiles/objects.dir/src/norm_engine.cpp.o.d"
+  "/root/repo/src/null_mechanism.cpp" "CMakeFiles/objects.dir/src/null_mechanism.cpp.o" "gcc" "CMakeFiles/objects.dir/src/null_mechanism.cpp.o.d"
+  "/root/repo/src/numa.cpp" "CMakeFiles/objects.dir/src/numa.cpp.o" "gcc" "CMakeFiles/objects.dir/src/numa.cpp.o.d"
+  "/root/repo/src/object.cpp" "CMakeFiles/objects.dir/src/object.cpp.o" "gcc" "CMakeFiles/objects.dir/src/object.cpp.o.d"
+  "/root/repo/src/options.cpp" "CMakeFiles/objects.dir/src/options.cpp.o" "gcc" "CMakeFiles/objects.dir/src/options.cpp.o.d"
+  "/root/repo/src/own.cpp" "CMakeFiles/objects.dir/src/own.cpp.o" "gcc" "CMakeFiles/objects.dir/src/own.cpp.o.d"
+  "/root/repo/src/pair.cpp" "CMakeFiles/objects.dir/src/pair.cpp.o" "gcc" "CMakeFiles/objects.dir/src/pair.cpp.o.d"
+  "/root/repo/src/pgm_receiver.cpp" "CMakeFiles/objects.dir/src/pgm_receiver.cpp.o" "gcc" "CMakeFiles/objects.dir/src/pgm_receiver.cpp.o.d"
+  "/root/repo/src/pgm_sender.cpp" "CMakeFiles/objects.dir/src/pgm_sender.cpp.o" "gcc" "CMakeFiles/objects.dir/src/pgm_sender.cpp.o.d"
+  "/root/repo/src/pgm_socket.cpp" "CMakeFiles/objects.dir/src/pgm_socket.cpp.o" "gcc" "CMakeFiles/objects.dir/src/pgm_socket.cpp.o.d"
+  "/root/repo/src/pipe.cpp" "CMakeFiles/objects.dir/src/pipe.cpp.o" "gcc" "CMakeFiles/objects.dir/src/pipe.cpp.o.d"
+  "/root/repo/src/plain_client.cpp" "CMakeFiles/objects.dir/src/plain_client.cpp.o" "gcc" "CMakeFiles/objects.dir/src/plain_client.cpp.o.d"
+  "/root/repo/src/plain_server.cpp" "CMakeFiles/objects.dir/src/plain_server.cpp.o" "gcc" "CMakeFiles/objects.dir/src/plain_server.cpp.o.d"
+  "/root/repo/src/poll.cpp" "CMakeFiles/objects.dir/src/poll.cpp.o" "gcc" "CMakeFiles/objects.dir/src/poll.cpp.o.d"
+  "/root/repo/src/poller_base.cpp" "CMakeFiles/objects.dir/src/poller_base.cpp.o" "gcc" "CMakeFiles/objects.dir/src/poller_base.cpp.o.d"
+  "/root/repo/src/polling_util.cpp" "CMakeFiles/objects.dir/src/polling_util.cpp.o" "gcc" "CMakeFiles/objects.dir/src/polling_util.cpp.o.d"
+  "/root/repo/src/pollset.cpp" "CMakeFiles/objects.dir/src/pollset.cpp.o" "gcc" "CMakeFiles/objects.dir/src/pollset.cpp.o.d"
+  "/root/repo/src/precompiled.cpp" "CMakeFiles/objects.dir/src/precompiled.cpp.o" "gcc" "CMakeFiles/objects.dir/src/precompiled.cpp.o.d"
+  "/root/repo/src/proxy.cpp" "CMakeFiles/objects.dir/src/proxy.cpp.o" "gcc" "CMakeFiles/objects.dir/src/proxy.cpp.o.d"
+  "/root/repo/src/pub.cpp" "CMakeFiles/objects.dir/src/pub.cpp.o" "gcc" "CMakeFiles/objects.dir/src/pub.cpp.o.d"
+  "/root/repo/src/pull.cpp" "CMakeFiles/objects.dir/src/pull.cpp.o" "gcc" "CMakeFiles/objects.dir/src/pull.cpp.o.d"
+  "/root/repo/src/push.cpp" "CMakeFiles/objects.dir/src/push.cpp.o" "gcc" "CMakeFiles/objects.dir/src/push.cpp.o.d"
+  "/root/repo/src/radio.cpp" "CMakeFiles/objects.dir/src/radio.cpp.o" "gcc" "CMakeFiles/objects.dir/src/radio.cpp.o.d"
+  "/root/repo/src/radix_tree.cpp" "CMakeFiles/objects.dir/src/radix_tree.cpp.o" "gcc" "CMakeFiles/objects.dir/src/radix_tree.cpp.o.d"
+  "/root/repo/src/random.cpp" "CMakeFiles/objects.dir/src/random.cpp.o" "gcc" "CMakeFiles/objects.dir/src/random.cpp.o.d"
+  "/root/repo/src/raw_decoder.cpp" "CMakeFiles/objects.dir/src/raw_decoder.cpp.o" "gcc" "CMakeFiles/objects.dir/src/raw_decoder.cpp.o.d"
+  "/root/repo/src/raw_encoder.cpp" "CMakeFiles/objects.dir/src/raw_encoder.cpp.o" "gcc" "CMakeFiles/objects.dir/src/raw_encoder.cpp.o.d"
+  "/root/repo/src/raw_engine.cpp" "CMakeFiles/objects.dir/src/raw_engine.cpp.o" "gcc" "CMakeFiles/objects.dir/src/raw_engine.cpp.o.d"
+  "/root/repo/src/reaper.cpp" "CMakeFiles/objects.dir/src/reaper.cpp.o" "gcc" "CMakeFiles/objects.dir/src/reaper.cpp.o.d"
+  "/root/repo/src/rep.cpp" "CMakeFiles/objects.dir/src/rep.cpp.o" "gcc" "CMakeFiles/objects.dir/src/rep.cpp.o.d"
+  "/root/repo/src/req.cpp" "CMakeFiles/objects.dir/src/req.cpp.o" "gcc" "CMakeFiles/objects.dir/src/req.cpp.o.d"
+  "/root/repo/src/router.cpp" "CMakeFiles/objects.dir/src/router.cpp.o" "gcc" "CMakeFiles/objects.dir/src/router.cpp.o.d"
+  "/root/repo/src/routing_table.cpp" "CMakeFiles/objects.dir/src/routing_table.cpp.o" "gcc" "CMakeFiles/objects.dir/src/routing_table.cpp.o.d"
+  "/root/repo/src/scatter.cpp" "CMakeFiles/objects.dir/src/scatter.cpp.o" "gcc" "CMakeFiles/objects.dir/src/scatter.cpp.o.d"
+  "/root/repo/src/select.cpp" "CMakeFiles/objects.dir/src/select.cpp.o" "gcc" "CMakeFiles/objects.dir/src/select.cpp.o.d"
+  "/root/repo/src/server.cpp" "CMakeFiles/objects.dir/src/server.cpp.o" "gcc" "CMakeFiles/objects.dir/src/server.cpp.o.d"
+  "/root/repo/src/session_base.cpp" "CMakeFiles/objects.dir/src/session_base.cpp.o" "gcc" "CMakeFiles/objects.dir/src/session_base.cpp.o.d"
+  "/root/repo/src/shm_connecter.cpp" "CMakeFiles/objects.dir/src/shm_connecter.cpp.o" "gcc" "CMakeFiles/objects.dir/src/shm_connecter.cpp.o.d"
+  "/root/repo/src/shm_engine.cpp" "CMakeFiles/objects.dir/src/shm_engine.cpp.o" "gcc" "CMakeFiles/objects.dir/src/shm_engine.cpp.o.d"
+  "/root/repo/src/shm_listener.cpp" "CMakeFiles/objects.dir/src/shm_listener.cpp.o" "gcc" "CMakeFiles/objects.dir/src/shm_listener.cpp.o.d"
+  "/root/repo/src/signaler.cpp" "CMakeFiles/objects.dir/src/signaler.cpp.o" "gcc" "CMakeFiles/objects.dir/src/signaler.cpp.o.d"
+  "/root/repo/src/socket_base.cpp" "CMakeFiles/objects.dir/src/socket_base.cpp.o" "gcc" "CMakeFiles/objects.dir/src/socket_base.cpp.o.d"
+  "/root/repo/src/socket_poller.cpp" "CMakeFiles/objects.dir/src/socket_poller.cpp.o" "gcc" "CMakeFiles/objects.dir/src/socket_poller.cpp.o.d"
+  "/root/repo/src/socks.cpp" "CMakeFiles/objects.dir/src/socks.cpp.o" "gcc" "CMakeFiles/objects.dir/src/socks.cpp.o.d"
+  "/root/repo/src/socks_connecter.cpp" "CMakeFiles/objects.dir/src/socks_connecter.cpp.o" "gcc" "CMakeFiles/objects.dir/src/socks_connecter.cpp.o.d"
+  "/root/repo/src/stream.cpp" "CMakeFiles/objects.dir/src/stream.cpp.o" "gcc" "CMakeFiles/objects.dir/src/stream.cpp.o.d"
+  "/root/repo/src/stream_connecter_base.cpp" "CMakeFiles/objects.dir/src/stream_connecter_base.cpp.o" "gcc" "CMakeFiles/objects.dir/src/stream_connecter_base.cpp.o.d"
+  "/root/repo/src/stream_engine_base.cpp" "CMakeFiles/objects.dir/src/stream_engine_base.cpp.o" "gcc" "CMakeFiles/objects.dir/src/stream_engine_base.cpp.o.d"
+  "/root/repo/src/stream_listener_base.cpp" "CMakeFiles/objects.dir/src/stream_listener_base.cpp.o" "gcc" "CMakeFiles/objects.dir/src/stream_listener_base.cpp.o.d"
+  "/root/repo/src/sub.cpp" "CMakeFiles/objects.dir/src/sub.cpp.o" "gcc" "CMakeFiles/objects.dir/src/sub.cpp.o.d"
+  "/root/repo/src/tcp.cpp" "CMakeFiles/objects.dir/src/tcp.cpp.o" "gcc" "CMakeFiles/objects.dir/src/tcp.cpp.o.d"
+  "/root/repo/src/tcp_address.cpp" "CMakeFiles/objects.dir/src/tcp_address.cpp.o" "gcc" "CMakeFiles/objects.dir/src/tcp_address.cpp.o.d"
+  "/root/repo/src/tcp_connecter.cpp" "CMakeFiles/objects.dir/src/tcp_connecter.cpp.o" "gcc" "CMakeFiles/objects.dir/src/tcp_connecter.cpp.o.d"
+  "/root/repo/src/tcp_listener.cpp" "CMakeFiles/objects.dir/src/tcp_listener.cpp.o" "gcc" "CMakeFiles/objects.dir/src/tcp_listener.cpp.o.d"
+  "/root/repo/src/thread.cpp" "CMakeFiles/objects.dir/src/thread.cpp.o" "gcc" "CMakeFiles/objects.dir/src/thread.cpp.o.d"
+  "/root/repo/src/timer_wheel.cpp" "CMakeFiles/objects.dir/src/timer_wheel.cpp.o" "gcc" "CMakeFiles/objects.dir/src/timer_wheel.cpp.o.d"
+  "/root/repo/src/timers.cpp" "CMakeFiles/objects.dir/src/timers.cpp.o" "gcc" "CMakeFiles/objects.dir/src/timers.cpp.o.d"
+  "/root/repo/src/tipc_address.cpp" "CMakeFiles/objects.dir/src/tipc_address.cpp.o" "gcc" "CMakeFiles/objects.dir/src/tipc_address.cpp.o.d"
+  "/root/repo/src/tipc_connecter.cpp" "CMakeFiles/objects.dir/src/tipc_connecter.cpp.o" "gcc" "CMakeFiles/objects.dir/src/tipc_connecter.cpp.o.d"
+  "/root/repo/src/tipc_listener.cpp" "CMakeFiles/objects.dir/src/tipc_listener.cpp.o" "gcc" "CMakeFiles/objects.dir/src/tipc_listener.cpp.o.d"
+  "/root/repo/src/trie.cpp" "CMakeFiles/objects.dir/src/trie.cpp.o" "gcc" "CMakeFiles/objects.dir/src/trie.cpp.o.d"
+  "/root/repo/src/udp_address.cpp" "CMakeFiles/objects.dir/src/udp_address.cpp.o" "gcc" "CMakeFiles/objects.dir/src/udp_address.cpp.o.d"
+  "/root/repo/src/udp_engine.cpp" "CMakeFiles/objects.dir/src/udp_engine.cpp.o" "gcc" "CMakeFiles/objects.dir/src/udp_engine.cpp.o.d"
+  "/root/repo/src/v1_decoder.cpp" "CMakeFiles/objects.dir/src/v1_decoder.cpp.o" "gcc" "CMakeFiles/objects.dir/src/v1_decoder.cpp.o.d"
+  "/root/repo/src/v1_encoder.cpp" "CMakeFiles/objects.dir/src/v1_encoder.cpp.o" "gcc" "CMakeFiles/objects.dir/src/v1_encoder.cpp.o.d"
+  "/root/repo/src/v2_decoder.cpp" "CMakeFiles/objects.dir/src/v2_decoder.cpp.o" "gcc" "CMakeFiles/objects.dir/src/v2_decoder.cpp.o.d"
+  "/root/repo/src/v2_encoder.cpp" "CMakeFiles/objects.dir/src/v2_encoder.cpp.o" "gcc" "CMakeFiles/objects.dir/src/v2_encoder.cpp.o.d"
+  "/root/repo/src/ws_address.cpp" "CMakeFiles/objects.dir/src/ws_address.cpp.o" "gcc" "CMakeFiles/objects.dir/src/ws_address.cpp.o.d"
+  "/root/repo/src/ws_connecter.cpp" "CMakeFiles/objects.dir/src/ws_connecter.cpp.o" "gcc" "CMakeFiles/objects.dir/src/ws_connecter.cpp.o.d"
+  "/root/repo/src/ws_decoder.cpp" "CMakeFiles/objects.dir/src/ws_decoder.cpp.o" "gcc" "CMakeFiles/objects.dir/src/ws_decoder.cpp.o.d"
+  "/root/repo/src/ws_encoder.cpp" "CMakeFiles/objects.dir/src/ws_encoder.cpp.o" "gcc" "CMakeFiles/objects.dir/src/ws_encoder.cpp.o.d"
+  "/root/repo/src/ws_engine.cpp" "CMakeFiles/objects.dir/src/ws_engine.cpp.o" "gcc" "CMakeFiles/objects.dir/src/ws_engine.cpp.o.d"
+  "/root/repo/src/ws_listener.cpp" "CMakeFiles/objects.dir/src/ws_listener.cpp.o" "gcc" "CMakeFiles/objects.dir/src/ws_listener.cpp.o.d"
+  "/root/repo/src/ws_mask.cpp" "CMakeFiles/objects.dir/src/ws_mask.cpp.o" "gcc" "CMakeFiles/objects.dir/src/ws_mask.cpp.o.d"
+  "/root/repo/src/wss_address.cpp" "CMakeFiles/objects.dir/src/wss_address.cpp.o" "gcc" "CMakeFiles/objects.dir/src/wss_address.cpp.o.d"
+  "/root/repo/src/xpub.cpp" "CMakeFiles/objects.dir/src/xpub.cpp.o" "gcc" "CMakeFiles/objects.dir/src/xpub.cpp.o.d"
+  "/root/repo/src/xsub.cpp" "CMakeFiles/objects.dir/src/xsub.cpp.o" "gcc" "CMakeFiles/objects.dir/src/xsub.cpp.o.d"
+  "/root/repo/src/zap_client.cpp" "CMakeFiles/objects.dir/src/zap_client.cpp.o" "gcc" "CMakeFiles/objects.dir/src/zap_client.cpp.o.d"
+  "/root/repo/src/zerocopy_reaper.cpp" "CMakeFiles/objects.dir/src/zerocopy_reaper.cpp.o" "gcc" "CMakeFiles/objects.dir/src/zerocopy_reaper.cpp.o.d"
+  "/root/repo/src/zmq.cpp" "CMakeFiles/objects.dir/src/zmq.cpp.o" "gcc" "CMakeFiles/objects.dir/src/zmq.cpp.o.d"
+  "/root/repo/src/zmq_utils.cpp" "CMakeFiles/objects.dir/src/zmq_utils.cpp.o" "gcc" "CMakeFiles/objects.dir/src/zmq_utils.cpp.o.d"
+  "/root/repo/src/zmtp_engine.cpp" "CMakeFiles/objects.dir/src/zmtp_engine.cpp.o" "gcc" "CMakeFiles/objects.dir/src/zmtp_engine.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
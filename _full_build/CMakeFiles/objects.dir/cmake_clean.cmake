@@ -0,0 +1,251 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/objects.dir/external/sha1/sha1.c.o"
+  "CMakeFiles/objects.dir/external/sha1/sha1.c.o.d"
+  "CMakeFiles/objects.dir/src/address.cpp.o"
+  "CMakeFiles/objects.dir/src/address.cpp.o.d"
+  "CMakeFiles/objects.dir/src/allocator.cpp.o"
+  "CMakeFiles/objects.dir/src/allocator.cpp.o.d"
+  "CMakeFiles/objects.dir/src/client.cpp.o"
+  "CMakeFiles/objects.dir/src/client.cpp.o.d"
+  "CMakeFiles/objects.dir/src/clock.cpp.o"
+  "CMakeFiles/objects.dir/src/clock.cpp.o.d"
+  "CMakeFiles/objects.dir/src/ctx.cpp.o"
+  "CMakeFiles/objects.dir/src/ctx.cpp.o.d"
+  "CMakeFiles/objects.dir/src/curve_client.cpp.o"
+  "CMakeFiles/objects.dir/src/curve_client.cpp.o.d"
+  "CMakeFiles/objects.dir/src/curve_mechanism_base.cpp.o"
+  "CMakeFiles/objects.dir/src/curve_mechanism_base.cpp.o.d"
+  "CMakeFiles/objects.dir/src/curve_server.cpp.o"
+  "CMakeFiles/objects.dir/src/curve_server.cpp.o.d"
+  "CMakeFiles/objects.dir/src/dealer.cpp.o"
+  "CMakeFiles/objects.dir/src/dealer.cpp.o.d"
+  "CMakeFiles/objects.dir/src/decoder_allocators.cpp.o"
+  "CMakeFiles/objects.dir/src/decoder_allocators.cpp.o.d"
+  "CMakeFiles/objects.dir/src/devpoll.cpp.o"
+  "CMakeFiles/objects.dir/src/devpoll.cpp.o.d"
+  "CMakeFiles/objects.dir/src/dgram.cpp.o"
+  "CMakeFiles/objects.dir/src/dgram.cpp.o.d"
+  "CMakeFiles/objects.dir/src/dish.cpp.o"
+  "CMakeFiles/objects.dir/src/dish.cpp.o.d"
+  "CMakeFiles/objects.dir/src/dist.cpp.o"
+  "CMakeFiles/objects.dir/src/dist.cpp.o.d"
+  "CMakeFiles/objects.dir/src/endpoint.cpp.o"
+  "CMakeFiles/objects.dir/src/endpoint.cpp.o.d"
+  "CMakeFiles/objects.dir/src/epoll.cpp.o"
+  "CMakeFiles/objects.dir/src/epoll.cpp.o.d"
+  "CMakeFiles/objects.dir/src/err.cpp.o"
+  "CMakeFiles/objects.dir/src/err.cpp.o.d"
+  "CMakeFiles/objects.dir/src/fq.cpp.o"
+  "CMakeFiles/objects.dir/src/fq.cpp.o.d"
+  "CMakeFiles/objects.dir/src/gather.cpp.o"
+  "CMakeFiles/objects.dir/src/gather.cpp.o.d"
+  "CMakeFiles/objects.dir/src/gather_buffer.cpp.o"
+  "CMakeFiles/objects.dir/src/gather_buffer.cpp.o.d"
+  "CMakeFiles/objects.dir/src/io_object.cpp.o"
+  "CMakeFiles/objects.dir/src/io_object.cpp.o.d"
+  "CMakeFiles/objects.dir/src/io_thread.cpp.o"
+  "CMakeFiles/objects.dir/src/io_thread.cpp.o.d"
+  "CMakeFiles/objects.dir/src/io_uring.cpp.o"
+  "CMakeFiles/objects.dir/src/io_uring.cpp.o.d"
+  "CMakeFiles/objects.dir/src/ip.cpp.o"
+  "CMakeFiles/objects.dir/src/ip.cpp.o.d"
+  "CMakeFiles/objects.dir/src/ip_resolver.cpp.o"
+  "CMakeFiles/objects.dir/src/ip_resolver.cpp.o.d"
+  "CMakeFiles/objects.dir/src/ipc_address.cpp.o"
+  "CMakeFiles/objects.dir/src/ipc_address.cpp.o.d"
+  "CMakeFiles/objects.dir/src/ipc_connecter.cpp.o"
+  "CMakeFiles/objects.dir/src/ipc_connecter.cpp.o.d"
+  "CMakeFiles/objects.dir/src/ipc_listener.cpp.o"
+  "CMakeFiles/objects.dir/src/ipc_listener.cpp.o.d"
+  "CMakeFiles/objects.dir/src/kqueue.cpp.o"
+  "CMakeFiles/objects.dir/src/kqueue.cpp.o.d"
+  "CMakeFiles/objects.dir/src/lb.cpp.o"
+  "CMakeFiles/objects.dir/src/lb.cpp.o.d"
+  "CMakeFiles/objects.dir/src/mailbox.cpp.o"
+  "CMakeFiles/objects.dir/src/mailbox.cpp.o.d"
+  "CMakeFiles/objects.dir/src/mailbox_safe.cpp.o"
+  "CMakeFiles/objects.dir/src/mailbox_safe.cpp.o.d"
+  "CMakeFiles/objects.dir/src/mechanism.cpp.o"
+  "CMakeFiles/objects.dir/src/mechanism.cpp.o.d"
+  "CMakeFiles/objects.dir/src/mechanism_base.cpp.o"
+  "CMakeFiles/objects.dir/src/mechanism_base.cpp.o.d"
+  "CMakeFiles/objects.dir/src/memfd.cpp.o"
+  "CMakeFiles/objects.dir/src/memfd.cpp.o.d"
+  "CMakeFiles/objects.dir/src/metadata.cpp.o"
+  "CMakeFiles/objects.dir/src/metadata.cpp.o.d"
+  "CMakeFiles/objects.dir/src/msg.cpp.o"
+  "CMakeFiles/objects.dir/src/msg.cpp.o.d"
+  "CMakeFiles/objects.dir/src/msg_pool.cpp.o"
+  "CMakeFiles/objects.dir/src/msg_pool.cpp.o.d"
+  "CMakeFiles/objects.dir/src/mtrie.cpp.o"
+  "CMakeFiles/objects.dir/src/mtrie.cpp.o.d"
+  "CMakeFiles/objects.dir/src/norm_engine.cpp.o"
+  "CMakeFiles/objects.dir/src/norm_engine.cpp.o.d"
+  "CMakeFiles/objects.dir/src/null_mechanism.cpp.o"
+  "CMakeFiles/objects.dir/src/null_mechanism.cpp.o.d"
+  "CMakeFiles/objects.dir/src/numa.cpp.o"
+  "CMakeFiles/objects.dir/src/numa.cpp.o.d"
+  "CMakeFiles/objects.dir/src/object.cpp.o"
+  "CMakeFiles/objects.dir/src/object.cpp.o.d"
+  "CMakeFiles/objects.dir/src/options.cpp.o"
+  "CMakeFiles/objects.dir/src/options.cpp.o.d"
+  "CMakeFiles/objects.dir/src/own.cpp.o"
+  "CMakeFiles/objects.dir/src/own.cpp.o.d"
+  "CMakeFiles/objects.dir/src/pair.cpp.o"
+  "CMakeFiles/objects.dir/src/pair.cpp.o.d"
+  "CMakeFiles/objects.dir/src/pgm_receiver.cpp.o"
+  "CMakeFiles/objects.dir/src/pgm_receiver.cpp.o.d"
+  "CMakeFiles/objects.dir/src/pgm_sender.cpp.o"
+  "CMakeFiles/objects.dir/src/pgm_sender.cpp.o.d"
+  "CMakeFiles/objects.dir/src/pgm_socket.cpp.o"
+  "CMakeFiles/objects.dir/src/pgm_socket.cpp.o.d"
+  "CMakeFiles/objects.dir/src/pipe.cpp.o"
+  "CMakeFiles/objects.dir/src/pipe.cpp.o.d"
+  "CMakeFiles/objects.dir/src/plain_client.cpp.o"
+  "CMakeFiles/objects.dir/src/plain_client.cpp.o.d"
+  "CMakeFiles/objects.dir/src/plain_server.cpp.o"
+  "CMakeFiles/objects.dir/src/plain_server.cpp.o.d"
+  "CMakeFiles/objects.dir/src/poll.cpp.o"
+  "CMakeFiles/objects.dir/src/poll.cpp.o.d"
+  "CMakeFiles/objects.dir/src/poller_base.cpp.o"
+  "CMakeFiles/objects.dir/src/poller_base.cpp.o.d"
+  "CMakeFiles/objects.dir/src/polling_util.cpp.o"
+  "CMakeFiles/objects.dir/src/polling_util.cpp.o.d"
+  "CMakeFiles/objects.dir/src/pollset.cpp.o"
+  "CMakeFiles/objects.dir/src/pollset.cpp.o.d"
+  "CMakeFiles/objects.dir/src/precompiled.cpp.o"
+  "CMakeFiles/objects.dir/src/precompiled.cpp.o.d"
+  "CMakeFiles/objects.dir/src/proxy.cpp.o"
+  "CMakeFiles/objects.dir/src/proxy.cpp.o.d"
+  "CMakeFiles/objects.dir/src/pub.cpp.o"
+  "CMakeFiles/objects.dir/src/pub.cpp.o.d"
+  "CMakeFiles/objects.dir/src/pull.cpp.o"
+  "CMakeFiles/objects.dir/src/pull.cpp.o.d"
+  "CMakeFiles/objects.dir/src/push.cpp.o"
+  "CMakeFiles/objects.dir/src/push.cpp.o.d"
+  "CMakeFiles/objects.dir/src/radio.cpp.o"
+  "CMakeFiles/objects.dir/src/radio.cpp.o.d"
+  "CMakeFiles/objects.dir/src/radix_tree.cpp.o"
+  "CMakeFiles/objects.dir/src/radix_tree.cpp.o.d"
+  "CMakeFiles/objects.dir/src/random.cpp.o"
+  "CMakeFiles/objects.dir/src/random.cpp.o.d"
+  "CMakeFiles/objects.dir/src/raw_decoder.cpp.o"
+  "CMakeFiles/objects.dir/src/raw_decoder.cpp.o.d"
+  "CMakeFiles/objects.dir/src/raw_encoder.cpp.o"
+  "CMakeFiles/objects.dir/src/raw_encoder.cpp.o.d"
+  "CMakeFiles/objects.dir/src/raw_engine.cpp.o"
+  "CMakeFiles/objects.dir/src/raw_engine.cpp.o.d"
+  "CMakeFiles/objects.dir/src/reaper.cpp.o"
+  "CMakeFiles/objects.dir/src/reaper.cpp.o.d"
+  "CMakeFiles/objects.dir/src/rep.cpp.o"
+  "CMakeFiles/objects.dir/src/rep.cpp.o.d"
+  "CMakeFiles/objects.dir/src/req.cpp.o"
+  "CMakeFiles/objects.dir/src/req.cpp.o.d"
+  "CMakeFiles/objects.dir/src/router.cpp.o"
+  "CMakeFiles/objects.dir/src/router.cpp.o.d"
+  "CMakeFiles/objects.dir/src/routing_table.cpp.o"
+  "CMakeFiles/objects.dir/src/routing_table.cpp.o.d"
+  "CMakeFiles/objects.dir/src/scatter.cpp.o"
+  "CMakeFiles/objects.dir/src/scatter.cpp.o.d"
+  "CMakeFiles/objects.dir/src/select.cpp.o"
+  "CMakeFiles/objects.dir/src/select.cpp.o.d"
+  "CMakeFiles/objects.dir/src/server.cpp.o"
+  "CMakeFiles/objects.dir/src/server.cpp.o.d"
+  "CMakeFiles/objects.dir/src/session_base.cpp.o"
+  "CMakeFiles/objects.dir/src/session_base.cpp.o.d"
+  "CMakeFiles/objects.dir/src/shm_connecter.cpp.o"
+  "CMakeFiles/objects.dir/src/shm_connecter.cpp.o.d"
+  "CMakeFiles/objects.dir/src/shm_engine.cpp.o"
+  "CMakeFiles/objects.dir/src/shm_engine.cpp.o.d"
+  "CMakeFiles/objects.dir/src/shm_listener.cpp.o"
+  "CMakeFiles/objects.dir/src/shm_listener.cpp.o.d"
+  "CMakeFiles/objects.dir/src/signaler.cpp.o"
+  "CMakeFiles/objects.dir/src/signaler.cpp.o.d"
+  "CMakeFiles/objects.dir/src/socket_base.cpp.o"
+  "CMakeFiles/objects.dir/src/socket_base.cpp.o.d"
+  "CMakeFiles/objects.dir/src/socket_poller.cpp.o"
+  "CMakeFiles/objects.dir/src/socket_poller.cpp.o.d"
+  "CMakeFiles/objects.dir/src/socks.cpp.o"
+  "CMakeFiles/objects.dir/src/socks.cpp.o.d"
+  "CMakeFiles/objects.dir/src/socks_connecter.cpp.o"
+  "CMakeFiles/objects.dir/src/socks_connecter.cpp.o.d"
+  "CMakeFiles/objects.dir/src/stream.cpp.o"
+  "CMakeFiles/objects.dir/src/stream.cpp.o.d"
+  "CMakeFiles/objects.dir/src/stream_connecter_base.cpp.o"
+  "CMakeFiles/objects.dir/src/stream_connecter_base.cpp.o.d"
+  "CMakeFiles/objects.dir/src/stream_engine_base.cpp.o"
+  "CMakeFiles/objects.dir/src/stream_engine_base.cpp.o.d"
+  "CMakeFiles/objects.dir/src/stream_listener_base.cpp.o"
+  "CMakeFiles/objects.dir/src/stream_listener_base.cpp.o.d"
+  "CMakeFiles/objects.dir/src/sub.cpp.o"
+  "CMakeFiles/objects.dir/src/sub.cpp.o.d"
+  "CMakeFiles/objects.dir/src/tcp.cpp.o"
+  "CMakeFiles/objects.dir/src/tcp.cpp.o.d"
+  "CMakeFiles/objects.dir/src/tcp_address.cpp.o"
+  "CMakeFiles/objects.dir/src/tcp_address.cpp.o.d"
+  "CMakeFiles/objects.dir/src/tcp_connecter.cpp.o"
+  "CMakeFiles/objects.dir/src/tcp_connecter.cpp.o.d"
+  "CMakeFiles/objects.dir/src/tcp_listener.cpp.o"
+  "CMakeFiles/objects.dir/src/tcp_listener.cpp.o.d"
+  "CMakeFiles/objects.dir/src/thread.cpp.o"
+  "CMakeFiles/objects.dir/src/thread.cpp.o.d"
+  "CMakeFiles/objects.dir/src/timer_wheel.cpp.o"
+  "CMakeFiles/objects.dir/src/timer_wheel.cpp.o.d"
+  "CMakeFiles/objects.dir/src/timers.cpp.o"
+  "CMakeFiles/objects.dir/src/timers.cpp.o.d"
+  "CMakeFiles/objects.dir/src/tipc_address.cpp.o"
+  "CMakeFiles/objects.dir/src/tipc_address.cpp.o.d"
+  "CMakeFiles/objects.dir/src/tipc_connecter.cpp.o"
+  "CMakeFiles/objects.dir/src/tipc_connecter.cpp.o.d"
+  "CMakeFiles/objects.dir/src/tipc_listener.cpp.o"
+  "CMakeFiles/objects.dir/src/tipc_listener.cpp.o.d"
+  "CMakeFiles/objects.dir/src/trie.cpp.o"
+  "CMakeFiles/objects.dir/src/trie.cpp.o.d"
+  "CMakeFiles/objects.dir/src/udp_address.cpp.o"
+  "CMakeFiles/objects.dir/src/udp_address.cpp.o.d"
+  "CMakeFiles/objects.dir/src/udp_engine.cpp.o"
+  "CMakeFiles/objects.dir/src/udp_engine.cpp.o.d"
+  "CMakeFiles/objects.dir/src/v1_decoder.cpp.o"
+  "CMakeFiles/objects.dir/src/v1_decoder.cpp.o.d"
+  "CMakeFiles/objects.dir/src/v1_encoder.cpp.o"
+  "CMakeFiles/objects.dir/src/v1_encoder.cpp.o.d"
+  "CMakeFiles/objects.dir/src/v2_decoder.cpp.o"
+  "CMakeFiles/objects.dir/src/v2_decoder.cpp.o.d"
+  "CMakeFiles/objects.dir/src/v2_encoder.cpp.o"
+  "CMakeFiles/objects.dir/src/v2_encoder.cpp.o.d"
+  "CMakeFiles/objects.dir/src/ws_address.cpp.o"
+  "CMakeFiles/objects.dir/src/ws_address.cpp.o.d"
+  "CMakeFiles/objects.dir/src/ws_connecter.cpp.o"
+  "CMakeFiles/objects.dir/src/ws_connecter.cpp.o.d"
+  "CMakeFiles/objects.dir/src/ws_decoder.cpp.o"
+  "CMakeFiles/objects.dir/src/ws_decoder.cpp.o.d"
+  "CMakeFiles/objects.dir/src/ws_encoder.cpp.o"
+  "CMakeFiles/objects.dir/src/ws_encoder.cpp.o.d"
+  "CMakeFiles/objects.dir/src/ws_engine.cpp.o"
+  "CMakeFiles/objects.dir/src/ws_engine.cpp.o.d"
+  "CMakeFiles/objects.dir/src/ws_listener.cpp.o"
+  "CMakeFiles/objects.dir/src/ws_listener.cpp.o.d"
+  "CMakeFiles/objects.dir/src/ws_mask.cpp.o"
+  "CMakeFiles/objects.dir/src/ws_mask.cpp.o.d"
+  "CMakeFiles/objects.dir/src/wss_address.cpp.o"
+  "CMakeFiles/objects.dir/src/wss_address.cpp.o.d"
+  "CMakeFiles/objects.dir/src/xpub.cpp.o"
+  "CMakeFiles/objects.dir/src/xpub.cpp.o.d"
+  "CMakeFiles/objects.dir/src/xsub.cpp.o"
+  "CMakeFiles/objects.dir/src/xsub.cpp.o.d"
+  "CMakeFiles/objects.dir/src/zap_client.cpp.o"
+  "CMakeFiles/objects.dir/src/zap_client.cpp.o.d"
+  "CMakeFiles/objects.dir/src/zerocopy_reaper.cpp.o"
+  "CMakeFiles/objects.dir/src/zerocopy_reaper.cpp.o.d"
+  "CMakeFiles/objects.dir/src/zmq.cpp.o"
+  "CMakeFiles/objects.dir/src/zmq.cpp.o.d"
+  "CMakeFiles/objects.dir/src/zmq_utils.cpp.o"
+  "CMakeFiles/objects.dir/src/zmq_utils.cpp.o.d"
+  "CMakeFiles/objects.dir/src/zmtp_engine.cpp.o"
+  "CMakeFiles/objects.dir/src/zmtp_engine.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/objects.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/proxy_thr.dir/perf/proxy_thr.cpp.o"
+  "CMakeFiles/proxy_thr.dir/perf/proxy_thr.cpp.o.d"
+  "bin/proxy_thr"
+  "bin/proxy_thr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/proxy_thr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/remote_lat.dir/perf/remote_lat.cpp.o"
+  "CMakeFiles/remote_lat.dir/perf/remote_lat.cpp.o.d"
+  "bin/remote_lat"
+  "bin/remote_lat.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/remote_lat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/remote_thr.dir/perf/remote_thr.cpp.o"
+  "CMakeFiles/remote_thr.dir/perf/remote_thr.cpp.o.d"
+  "bin/remote_thr"
+  "bin/remote_thr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/remote_thr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
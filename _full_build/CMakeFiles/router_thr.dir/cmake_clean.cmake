@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/router_thr.dir/perf/router_thr.cpp.o"
+  "CMakeFiles/router_thr.dir/perf/router_thr.cpp.o.d"
+  "bin/router_thr"
+  "bin/router_thr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/router_thr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
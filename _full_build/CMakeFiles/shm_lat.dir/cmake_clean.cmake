@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/shm_lat.dir/perf/shm_lat.cpp.o"
+  "CMakeFiles/shm_lat.dir/perf/shm_lat.cpp.o.d"
+  "bin/shm_lat"
+  "bin/shm_lat.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/shm_lat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/shm_thr.dir/perf/shm_thr.cpp.o"
+  "CMakeFiles/shm_thr.dir/perf/shm_thr.cpp.o.d"
+  "bin/shm_thr"
+  "bin/shm_thr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/shm_thr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
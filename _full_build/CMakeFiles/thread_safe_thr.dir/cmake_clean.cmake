@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/thread_safe_thr.dir/perf/thread_safe_thr.cpp.o"
+  "CMakeFiles/thread_safe_thr.dir/perf/thread_safe_thr.cpp.o.d"
+  "bin/thread_safe_thr"
+  "bin/thread_safe_thr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/thread_safe_thr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/zerocopy_thr.dir/perf/zerocopy_thr.cpp.o"
+  "CMakeFiles/zerocopy_thr.dir/perf/zerocopy_thr.cpp.o.d"
+  "bin/zerocopy_thr"
+  "bin/zerocopy_thr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/zerocopy_thr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_abstract_ipc"
+  "../bin/test_abstract_ipc.pdb"
+  "CMakeFiles/test_abstract_ipc.dir/test_abstract_ipc.cpp.o"
+  "CMakeFiles/test_abstract_ipc.dir/test_abstract_ipc.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_abstract_ipc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/test_address_tipc.cpp" "tests/CMakeFiles/test_address_tipc.dir/test_address_tipc.cpp.o" "gcc" "tests/CMakeFiles/test_address_tipc.dir/test_address_tipc.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_full_build/tests/CMakeFiles/testutil.dir/DependInfo.cmake"
+  "/root/repo/_full_build/CMakeFiles/libzmq.dir/DependInfo.cmake"
+  "/root/repo/_full_build/tests/CMakeFiles/unity.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_address_tipc"
+  "../bin/test_address_tipc.pdb"
+  "CMakeFiles/test_address_tipc.dir/test_address_tipc.cpp.o"
+  "CMakeFiles/test_address_tipc.dir/test_address_tipc.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_address_tipc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
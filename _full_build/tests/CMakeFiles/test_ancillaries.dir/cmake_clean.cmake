@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_ancillaries"
+  "../bin/test_ancillaries.pdb"
+  "CMakeFiles/test_ancillaries.dir/test_ancillaries.cpp.o"
+  "CMakeFiles/test_ancillaries.dir/test_ancillaries.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_ancillaries.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
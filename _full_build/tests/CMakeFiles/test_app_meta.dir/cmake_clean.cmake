@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_app_meta"
+  "../bin/test_app_meta.pdb"
+  "CMakeFiles/test_app_meta.dir/test_app_meta.cpp.o"
+  "CMakeFiles/test_app_meta.dir/test_app_meta.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_app_meta.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_atomics"
+  "../bin/test_atomics.pdb"
+  "CMakeFiles/test_atomics.dir/test_atomics.cpp.o"
+  "CMakeFiles/test_atomics.dir/test_atomics.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_atomics.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_base85"
+  "../bin/test_base85.pdb"
+  "CMakeFiles/test_base85.dir/test_base85.cpp.o"
+  "CMakeFiles/test_base85.dir/test_base85.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_base85.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_batch"
+  "../bin/test_batch.pdb"
+  "CMakeFiles/test_batch.dir/test_batch.cpp.o"
+  "CMakeFiles/test_batch.dir/test_batch.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_batch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
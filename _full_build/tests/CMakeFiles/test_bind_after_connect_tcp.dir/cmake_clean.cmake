@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_bind_after_connect_tcp"
+  "../bin/test_bind_after_connect_tcp.pdb"
+  "CMakeFiles/test_bind_after_connect_tcp.dir/test_bind_after_connect_tcp.cpp.o"
+  "CMakeFiles/test_bind_after_connect_tcp.dir/test_bind_after_connect_tcp.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_bind_after_connect_tcp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_bind_src_address"
+  "../bin/test_bind_src_address.pdb"
+  "CMakeFiles/test_bind_src_address.dir/test_bind_src_address.cpp.o"
+  "CMakeFiles/test_bind_src_address.dir/test_bind_src_address.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_bind_src_address.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_capabilities"
+  "../bin/test_capabilities.pdb"
+  "CMakeFiles/test_capabilities.dir/test_capabilities.cpp.o"
+  "CMakeFiles/test_capabilities.dir/test_capabilities.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_capabilities.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
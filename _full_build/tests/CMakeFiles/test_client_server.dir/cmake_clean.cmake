@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_client_server"
+  "../bin/test_client_server.pdb"
+  "CMakeFiles/test_client_server.dir/test_client_server.cpp.o"
+  "CMakeFiles/test_client_server.dir/test_client_server.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_client_server.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
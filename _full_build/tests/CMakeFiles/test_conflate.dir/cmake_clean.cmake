@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_conflate"
+  "../bin/test_conflate.pdb"
+  "CMakeFiles/test_conflate.dir/test_conflate.cpp.o"
+  "CMakeFiles/test_conflate.dir/test_conflate.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_conflate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
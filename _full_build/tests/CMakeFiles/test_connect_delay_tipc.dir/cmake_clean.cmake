@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_connect_delay_tipc"
+  "../bin/test_connect_delay_tipc.pdb"
+  "CMakeFiles/test_connect_delay_tipc.dir/test_connect_delay_tipc.cpp.o"
+  "CMakeFiles/test_connect_delay_tipc.dir/test_connect_delay_tipc.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_connect_delay_tipc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_connect_resolve"
+  "../bin/test_connect_resolve.pdb"
+  "CMakeFiles/test_connect_resolve.dir/test_connect_resolve.cpp.o"
+  "CMakeFiles/test_connect_resolve.dir/test_connect_resolve.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_connect_resolve.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
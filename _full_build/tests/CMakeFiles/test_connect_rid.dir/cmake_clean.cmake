@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_connect_rid"
+  "../bin/test_connect_rid.pdb"
+  "CMakeFiles/test_connect_rid.dir/test_connect_rid.cpp.o"
+  "CMakeFiles/test_connect_rid.dir/test_connect_rid.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_connect_rid.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
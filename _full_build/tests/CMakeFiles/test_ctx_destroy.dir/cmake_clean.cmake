@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_ctx_destroy"
+  "../bin/test_ctx_destroy.pdb"
+  "CMakeFiles/test_ctx_destroy.dir/test_ctx_destroy.cpp.o"
+  "CMakeFiles/test_ctx_destroy.dir/test_ctx_destroy.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_ctx_destroy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
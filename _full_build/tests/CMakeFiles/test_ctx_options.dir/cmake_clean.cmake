@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_ctx_options"
+  "../bin/test_ctx_options.pdb"
+  "CMakeFiles/test_ctx_options.dir/test_ctx_options.cpp.o"
+  "CMakeFiles/test_ctx_options.dir/test_ctx_options.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_ctx_options.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
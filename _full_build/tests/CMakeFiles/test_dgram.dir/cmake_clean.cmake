@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_dgram"
+  "../bin/test_dgram.pdb"
+  "CMakeFiles/test_dgram.dir/test_dgram.cpp.o"
+  "CMakeFiles/test_dgram.dir/test_dgram.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_dgram.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
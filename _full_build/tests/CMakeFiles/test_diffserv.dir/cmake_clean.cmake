@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_diffserv"
+  "../bin/test_diffserv.pdb"
+  "CMakeFiles/test_diffserv.dir/test_diffserv.cpp.o"
+  "CMakeFiles/test_diffserv.dir/test_diffserv.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_diffserv.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
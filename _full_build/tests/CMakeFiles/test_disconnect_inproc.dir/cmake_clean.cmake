@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_disconnect_inproc"
+  "../bin/test_disconnect_inproc.pdb"
+  "CMakeFiles/test_disconnect_inproc.dir/test_disconnect_inproc.cpp.o"
+  "CMakeFiles/test_disconnect_inproc.dir/test_disconnect_inproc.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_disconnect_inproc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_filter_ipc"
+  "../bin/test_filter_ipc.pdb"
+  "CMakeFiles/test_filter_ipc.dir/test_filter_ipc.cpp.o"
+  "CMakeFiles/test_filter_ipc.dir/test_filter_ipc.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_filter_ipc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
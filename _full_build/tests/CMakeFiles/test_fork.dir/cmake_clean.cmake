@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_fork"
+  "../bin/test_fork.pdb"
+  "CMakeFiles/test_fork.dir/test_fork.cpp.o"
+  "CMakeFiles/test_fork.dir/test_fork.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_fork.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_getsockopt_memset"
+  "../bin/test_getsockopt_memset.pdb"
+  "CMakeFiles/test_getsockopt_memset.dir/test_getsockopt_memset.cpp.o"
+  "CMakeFiles/test_getsockopt_memset.dir/test_getsockopt_memset.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_getsockopt_memset.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
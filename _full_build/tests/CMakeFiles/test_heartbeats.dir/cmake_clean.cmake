@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_heartbeats"
+  "../bin/test_heartbeats.pdb"
+  "CMakeFiles/test_heartbeats.dir/test_heartbeats.cpp.o"
+  "CMakeFiles/test_heartbeats.dir/test_heartbeats.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_heartbeats.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_hwm_pubsub"
+  "../bin/test_hwm_pubsub.pdb"
+  "CMakeFiles/test_hwm_pubsub.dir/test_hwm_pubsub.cpp.o"
+  "CMakeFiles/test_hwm_pubsub.dir/test_hwm_pubsub.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_hwm_pubsub.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_immediate"
+  "../bin/test_immediate.pdb"
+  "CMakeFiles/test_immediate.dir/test_immediate.cpp.o"
+  "CMakeFiles/test_immediate.dir/test_immediate.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_immediate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_inproc_connect"
+  "../bin/test_inproc_connect.pdb"
+  "CMakeFiles/test_inproc_connect.dir/test_inproc_connect.cpp.o"
+  "CMakeFiles/test_inproc_connect.dir/test_inproc_connect.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_inproc_connect.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
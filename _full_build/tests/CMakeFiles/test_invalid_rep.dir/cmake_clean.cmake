@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_invalid_rep"
+  "../bin/test_invalid_rep.pdb"
+  "CMakeFiles/test_invalid_rep.dir/test_invalid_rep.cpp.o"
+  "CMakeFiles/test_invalid_rep.dir/test_invalid_rep.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_invalid_rep.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_iov"
+  "../bin/test_iov.pdb"
+  "CMakeFiles/test_iov.dir/test_iov.cpp.o"
+  "CMakeFiles/test_iov.dir/test_iov.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_iov.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
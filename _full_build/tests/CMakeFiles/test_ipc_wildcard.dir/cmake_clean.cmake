@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_ipc_wildcard"
+  "../bin/test_ipc_wildcard.pdb"
+  "CMakeFiles/test_ipc_wildcard.dir/test_ipc_wildcard.cpp.o"
+  "CMakeFiles/test_ipc_wildcard.dir/test_ipc_wildcard.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_ipc_wildcard.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
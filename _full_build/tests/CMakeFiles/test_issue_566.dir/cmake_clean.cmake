@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_issue_566"
+  "../bin/test_issue_566.pdb"
+  "CMakeFiles/test_issue_566.dir/test_issue_566.cpp.o"
+  "CMakeFiles/test_issue_566.dir/test_issue_566.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_issue_566.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_last_endpoint"
+  "../bin/test_last_endpoint.pdb"
+  "CMakeFiles/test_last_endpoint.dir/test_last_endpoint.cpp.o"
+  "CMakeFiles/test_last_endpoint.dir/test_last_endpoint.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_last_endpoint.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
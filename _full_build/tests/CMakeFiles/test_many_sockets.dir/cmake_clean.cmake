@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_many_sockets"
+  "../bin/test_many_sockets.pdb"
+  "CMakeFiles/test_many_sockets.dir/test_many_sockets.cpp.o"
+  "CMakeFiles/test_many_sockets.dir/test_many_sockets.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_many_sockets.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_metadata"
+  "../bin/test_metadata.pdb"
+  "CMakeFiles/test_metadata.dir/test_metadata.cpp.o"
+  "CMakeFiles/test_metadata.dir/test_metadata.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_metadata.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
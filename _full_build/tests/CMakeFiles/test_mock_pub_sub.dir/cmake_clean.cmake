@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_mock_pub_sub"
+  "../bin/test_mock_pub_sub.pdb"
+  "CMakeFiles/test_mock_pub_sub.dir/test_mock_pub_sub.cpp.o"
+  "CMakeFiles/test_mock_pub_sub.dir/test_mock_pub_sub.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_mock_pub_sub.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_monitor"
+  "../bin/test_monitor.pdb"
+  "CMakeFiles/test_monitor.dir/test_monitor.cpp.o"
+  "CMakeFiles/test_monitor.dir/test_monitor.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_monitor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_msg_ffn"
+  "../bin/test_msg_ffn.pdb"
+  "CMakeFiles/test_msg_ffn.dir/test_msg_ffn.cpp.o"
+  "CMakeFiles/test_msg_ffn.dir/test_msg_ffn.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_msg_ffn.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
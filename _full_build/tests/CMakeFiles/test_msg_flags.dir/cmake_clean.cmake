@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_msg_flags"
+  "../bin/test_msg_flags.pdb"
+  "CMakeFiles/test_msg_flags.dir/test_msg_flags.cpp.o"
+  "CMakeFiles/test_msg_flags.dir/test_msg_flags.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_msg_flags.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_pair_ipc"
+  "../bin/test_pair_ipc.pdb"
+  "CMakeFiles/test_pair_ipc.dir/test_pair_ipc.cpp.o"
+  "CMakeFiles/test_pair_ipc.dir/test_pair_ipc.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_pair_ipc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_pair_shm"
+  "../bin/test_pair_shm.pdb"
+  "CMakeFiles/test_pair_shm.dir/test_pair_shm.cpp.o"
+  "CMakeFiles/test_pair_shm.dir/test_pair_shm.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_pair_shm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
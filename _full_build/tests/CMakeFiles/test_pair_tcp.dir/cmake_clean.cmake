@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_pair_tcp"
+  "../bin/test_pair_tcp.pdb"
+  "CMakeFiles/test_pair_tcp.dir/test_pair_tcp.cpp.o"
+  "CMakeFiles/test_pair_tcp.dir/test_pair_tcp.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_pair_tcp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_pair_tipc"
+  "../bin/test_pair_tipc.pdb"
+  "CMakeFiles/test_pair_tipc.dir/test_pair_tipc.cpp.o"
+  "CMakeFiles/test_pair_tipc.dir/test_pair_tipc.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_pair_tipc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_poller"
+  "../bin/test_poller.pdb"
+  "CMakeFiles/test_poller.dir/test_poller.cpp.o"
+  "CMakeFiles/test_poller.dir/test_poller.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_poller.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_probe_router"
+  "../bin/test_probe_router.pdb"
+  "CMakeFiles/test_probe_router.dir/test_probe_router.cpp.o"
+  "CMakeFiles/test_probe_router.dir/test_probe_router.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_probe_router.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
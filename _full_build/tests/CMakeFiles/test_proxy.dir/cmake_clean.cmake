@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_proxy"
+  "../bin/test_proxy.pdb"
+  "CMakeFiles/test_proxy.dir/test_proxy.cpp.o"
+  "CMakeFiles/test_proxy.dir/test_proxy.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_proxy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_proxy_hwm"
+  "../bin/test_proxy_hwm.pdb"
+  "CMakeFiles/test_proxy_hwm.dir/test_proxy_hwm.cpp.o"
+  "CMakeFiles/test_proxy_hwm.dir/test_proxy_hwm.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_proxy_hwm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
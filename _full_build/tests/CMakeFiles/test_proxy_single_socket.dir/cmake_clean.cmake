@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_proxy_single_socket"
+  "../bin/test_proxy_single_socket.pdb"
+  "CMakeFiles/test_proxy_single_socket.dir/test_proxy_single_socket.cpp.o"
+  "CMakeFiles/test_proxy_single_socket.dir/test_proxy_single_socket.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_proxy_single_socket.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
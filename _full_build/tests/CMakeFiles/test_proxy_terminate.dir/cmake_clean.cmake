@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_proxy_terminate"
+  "../bin/test_proxy_terminate.pdb"
+  "CMakeFiles/test_proxy_terminate.dir/test_proxy_terminate.cpp.o"
+  "CMakeFiles/test_proxy_terminate.dir/test_proxy_terminate.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_proxy_terminate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
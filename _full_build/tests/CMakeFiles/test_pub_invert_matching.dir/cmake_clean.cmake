@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_pub_invert_matching"
+  "../bin/test_pub_invert_matching.pdb"
+  "CMakeFiles/test_pub_invert_matching.dir/test_pub_invert_matching.cpp.o"
+  "CMakeFiles/test_pub_invert_matching.dir/test_pub_invert_matching.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_pub_invert_matching.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
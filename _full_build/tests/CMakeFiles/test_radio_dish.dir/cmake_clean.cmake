@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_radio_dish"
+  "../bin/test_radio_dish.pdb"
+  "CMakeFiles/test_radio_dish.dir/test_radio_dish.cpp.o"
+  "CMakeFiles/test_radio_dish.dir/test_radio_dish.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_radio_dish.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_rebind_ipc"
+  "../bin/test_rebind_ipc.pdb"
+  "CMakeFiles/test_rebind_ipc.dir/test_rebind_ipc.cpp.o"
+  "CMakeFiles/test_rebind_ipc.dir/test_rebind_ipc.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_rebind_ipc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_reconnect_ivl"
+  "../bin/test_reconnect_ivl.pdb"
+  "CMakeFiles/test_reconnect_ivl.dir/test_reconnect_ivl.cpp.o"
+  "CMakeFiles/test_reconnect_ivl.dir/test_reconnect_ivl.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_reconnect_ivl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_req_correlate"
+  "../bin/test_req_correlate.pdb"
+  "CMakeFiles/test_req_correlate.dir/test_req_correlate.cpp.o"
+  "CMakeFiles/test_req_correlate.dir/test_req_correlate.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_req_correlate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
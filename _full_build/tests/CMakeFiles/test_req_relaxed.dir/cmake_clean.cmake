@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_req_relaxed"
+  "../bin/test_req_relaxed.pdb"
+  "CMakeFiles/test_req_relaxed.dir/test_req_relaxed.cpp.o"
+  "CMakeFiles/test_req_relaxed.dir/test_req_relaxed.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_req_relaxed.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_reqrep_device"
+  "../bin/test_reqrep_device.pdb"
+  "CMakeFiles/test_reqrep_device.dir/test_reqrep_device.cpp.o"
+  "CMakeFiles/test_reqrep_device.dir/test_reqrep_device.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_reqrep_device.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_reqrep_device_tipc"
+  "../bin/test_reqrep_device_tipc.pdb"
+  "CMakeFiles/test_reqrep_device_tipc.dir/test_reqrep_device_tipc.cpp.o"
+  "CMakeFiles/test_reqrep_device_tipc.dir/test_reqrep_device_tipc.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_reqrep_device_tipc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
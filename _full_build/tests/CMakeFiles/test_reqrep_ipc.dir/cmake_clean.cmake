@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_reqrep_ipc"
+  "../bin/test_reqrep_ipc.pdb"
+  "CMakeFiles/test_reqrep_ipc.dir/test_reqrep_ipc.cpp.o"
+  "CMakeFiles/test_reqrep_ipc.dir/test_reqrep_ipc.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_reqrep_ipc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_reqrep_tcp"
+  "../bin/test_reqrep_tcp.pdb"
+  "CMakeFiles/test_reqrep_tcp.dir/test_reqrep_tcp.cpp.o"
+  "CMakeFiles/test_reqrep_tcp.dir/test_reqrep_tcp.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_reqrep_tcp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
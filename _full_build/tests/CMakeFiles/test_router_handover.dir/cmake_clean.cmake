@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_router_handover"
+  "../bin/test_router_handover.pdb"
+  "CMakeFiles/test_router_handover.dir/test_router_handover.cpp.o"
+  "CMakeFiles/test_router_handover.dir/test_router_handover.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_router_handover.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_router_mandatory"
+  "../bin/test_router_mandatory.pdb"
+  "CMakeFiles/test_router_mandatory.dir/test_router_mandatory.cpp.o"
+  "CMakeFiles/test_router_mandatory.dir/test_router_mandatory.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_router_mandatory.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_router_mandatory_hwm"
+  "../bin/test_router_mandatory_hwm.pdb"
+  "CMakeFiles/test_router_mandatory_hwm.dir/test_router_mandatory_hwm.cpp.o"
+  "CMakeFiles/test_router_mandatory_hwm.dir/test_router_mandatory_hwm.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_router_mandatory_hwm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_router_mandatory_tipc"
+  "../bin/test_router_mandatory_tipc.pdb"
+  "CMakeFiles/test_router_mandatory_tipc.dir/test_router_mandatory_tipc.cpp.o"
+  "CMakeFiles/test_router_mandatory_tipc.dir/test_router_mandatory_tipc.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_router_mandatory_tipc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
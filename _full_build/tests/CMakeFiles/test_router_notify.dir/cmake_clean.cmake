@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_router_notify"
+  "../bin/test_router_notify.pdb"
+  "CMakeFiles/test_router_notify.dir/test_router_notify.cpp.o"
+  "CMakeFiles/test_router_notify.dir/test_router_notify.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_router_notify.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
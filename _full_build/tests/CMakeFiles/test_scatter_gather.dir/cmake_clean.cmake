@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_scatter_gather"
+  "../bin/test_scatter_gather.pdb"
+  "CMakeFiles/test_scatter_gather.dir/test_scatter_gather.cpp.o"
+  "CMakeFiles/test_scatter_gather.dir/test_scatter_gather.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_scatter_gather.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
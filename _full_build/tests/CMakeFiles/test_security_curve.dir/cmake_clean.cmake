@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../bin/test_security_curve"
+  "../bin/test_security_curve.pdb"
+  "CMakeFiles/test_security_curve.dir/__/src/clock.cpp.o"
+  "CMakeFiles/test_security_curve.dir/__/src/clock.cpp.o.d"
+  "CMakeFiles/test_security_curve.dir/__/src/err.cpp.o"
+  "CMakeFiles/test_security_curve.dir/__/src/err.cpp.o.d"
+  "CMakeFiles/test_security_curve.dir/__/src/random.cpp.o"
+  "CMakeFiles/test_security_curve.dir/__/src/random.cpp.o.d"
+  "CMakeFiles/test_security_curve.dir/test_security_curve.cpp.o"
+  "CMakeFiles/test_security_curve.dir/test_security_curve.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_security_curve.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
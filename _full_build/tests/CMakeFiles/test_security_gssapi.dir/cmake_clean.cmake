@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_security_gssapi"
+  "../bin/test_security_gssapi.pdb"
+  "CMakeFiles/test_security_gssapi.dir/test_security_gssapi.cpp.o"
+  "CMakeFiles/test_security_gssapi.dir/test_security_gssapi.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_security_gssapi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
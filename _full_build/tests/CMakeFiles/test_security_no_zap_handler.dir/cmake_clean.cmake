@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_security_no_zap_handler"
+  "../bin/test_security_no_zap_handler.pdb"
+  "CMakeFiles/test_security_no_zap_handler.dir/test_security_no_zap_handler.cpp.o"
+  "CMakeFiles/test_security_no_zap_handler.dir/test_security_no_zap_handler.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_security_no_zap_handler.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_security_null"
+  "../bin/test_security_null.pdb"
+  "CMakeFiles/test_security_null.dir/test_security_null.cpp.o"
+  "CMakeFiles/test_security_null.dir/test_security_null.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_security_null.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
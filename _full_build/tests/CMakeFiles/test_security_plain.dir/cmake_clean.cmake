@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_security_plain"
+  "../bin/test_security_plain.pdb"
+  "CMakeFiles/test_security_plain.dir/test_security_plain.cpp.o"
+  "CMakeFiles/test_security_plain.dir/test_security_plain.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_security_plain.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_security_zap"
+  "../bin/test_security_zap.pdb"
+  "CMakeFiles/test_security_zap.dir/test_security_zap.cpp.o"
+  "CMakeFiles/test_security_zap.dir/test_security_zap.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_security_zap.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
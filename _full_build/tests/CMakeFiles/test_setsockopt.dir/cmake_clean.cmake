@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_setsockopt"
+  "../bin/test_setsockopt.pdb"
+  "CMakeFiles/test_setsockopt.dir/test_setsockopt.cpp.o"
+  "CMakeFiles/test_setsockopt.dir/test_setsockopt.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_setsockopt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
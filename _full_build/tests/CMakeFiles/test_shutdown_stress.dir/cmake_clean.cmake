@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_shutdown_stress"
+  "../bin/test_shutdown_stress.pdb"
+  "CMakeFiles/test_shutdown_stress.dir/test_shutdown_stress.cpp.o"
+  "CMakeFiles/test_shutdown_stress.dir/test_shutdown_stress.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_shutdown_stress.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
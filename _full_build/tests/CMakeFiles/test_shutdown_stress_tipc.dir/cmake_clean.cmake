@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_shutdown_stress_tipc"
+  "../bin/test_shutdown_stress_tipc.pdb"
+  "CMakeFiles/test_shutdown_stress_tipc.dir/test_shutdown_stress_tipc.cpp.o"
+  "CMakeFiles/test_shutdown_stress_tipc.dir/test_shutdown_stress_tipc.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_shutdown_stress_tipc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
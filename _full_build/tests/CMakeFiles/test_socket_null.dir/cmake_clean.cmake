@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_socket_null"
+  "../bin/test_socket_null.pdb"
+  "CMakeFiles/test_socket_null.dir/test_socket_null.cpp.o"
+  "CMakeFiles/test_socket_null.dir/test_socket_null.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_socket_null.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_sockopt_hwm"
+  "../bin/test_sockopt_hwm.pdb"
+  "CMakeFiles/test_sockopt_hwm.dir/test_sockopt_hwm.cpp.o"
+  "CMakeFiles/test_sockopt_hwm.dir/test_sockopt_hwm.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_sockopt_hwm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_sodium"
+  "../bin/test_sodium.pdb"
+  "CMakeFiles/test_sodium.dir/test_sodium.cpp.o"
+  "CMakeFiles/test_sodium.dir/test_sodium.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_sodium.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_spec_dealer"
+  "../bin/test_spec_dealer.pdb"
+  "CMakeFiles/test_spec_dealer.dir/test_spec_dealer.cpp.o"
+  "CMakeFiles/test_spec_dealer.dir/test_spec_dealer.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_spec_dealer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
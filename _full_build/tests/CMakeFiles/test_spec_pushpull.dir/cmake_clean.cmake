@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_spec_pushpull"
+  "../bin/test_spec_pushpull.pdb"
+  "CMakeFiles/test_spec_pushpull.dir/test_spec_pushpull.cpp.o"
+  "CMakeFiles/test_spec_pushpull.dir/test_spec_pushpull.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_spec_pushpull.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_spec_rep"
+  "../bin/test_spec_rep.pdb"
+  "CMakeFiles/test_spec_rep.dir/test_spec_rep.cpp.o"
+  "CMakeFiles/test_spec_rep.dir/test_spec_rep.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_spec_rep.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
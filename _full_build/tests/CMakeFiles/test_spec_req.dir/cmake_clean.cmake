@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_spec_req"
+  "../bin/test_spec_req.pdb"
+  "CMakeFiles/test_spec_req.dir/test_spec_req.cpp.o"
+  "CMakeFiles/test_spec_req.dir/test_spec_req.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_spec_req.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
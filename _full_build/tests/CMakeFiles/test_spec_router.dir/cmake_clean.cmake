@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_spec_router"
+  "../bin/test_spec_router.pdb"
+  "CMakeFiles/test_spec_router.dir/test_spec_router.cpp.o"
+  "CMakeFiles/test_spec_router.dir/test_spec_router.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_spec_router.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_srcfd"
+  "../bin/test_srcfd.pdb"
+  "CMakeFiles/test_srcfd.dir/test_srcfd.cpp.o"
+  "CMakeFiles/test_srcfd.dir/test_srcfd.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_srcfd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
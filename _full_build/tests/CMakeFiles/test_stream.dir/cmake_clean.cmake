@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_stream"
+  "../bin/test_stream.pdb"
+  "CMakeFiles/test_stream.dir/test_stream.cpp.o"
+  "CMakeFiles/test_stream.dir/test_stream.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_stream.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
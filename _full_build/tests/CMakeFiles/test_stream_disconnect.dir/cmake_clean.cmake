@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_stream_disconnect"
+  "../bin/test_stream_disconnect.pdb"
+  "CMakeFiles/test_stream_disconnect.dir/test_stream_disconnect.cpp.o"
+  "CMakeFiles/test_stream_disconnect.dir/test_stream_disconnect.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_stream_disconnect.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
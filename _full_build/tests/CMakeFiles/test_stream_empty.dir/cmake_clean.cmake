@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_stream_empty"
+  "../bin/test_stream_empty.pdb"
+  "CMakeFiles/test_stream_empty.dir/test_stream_empty.cpp.o"
+  "CMakeFiles/test_stream_empty.dir/test_stream_empty.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_stream_empty.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
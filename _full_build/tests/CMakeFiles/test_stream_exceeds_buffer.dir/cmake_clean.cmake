@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_stream_exceeds_buffer"
+  "../bin/test_stream_exceeds_buffer.pdb"
+  "CMakeFiles/test_stream_exceeds_buffer.dir/test_stream_exceeds_buffer.cpp.o"
+  "CMakeFiles/test_stream_exceeds_buffer.dir/test_stream_exceeds_buffer.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_stream_exceeds_buffer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
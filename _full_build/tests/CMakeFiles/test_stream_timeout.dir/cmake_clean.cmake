@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_stream_timeout"
+  "../bin/test_stream_timeout.pdb"
+  "CMakeFiles/test_stream_timeout.dir/test_stream_timeout.cpp.o"
+  "CMakeFiles/test_stream_timeout.dir/test_stream_timeout.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_stream_timeout.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_sub_forward"
+  "../bin/test_sub_forward.pdb"
+  "CMakeFiles/test_sub_forward.dir/test_sub_forward.cpp.o"
+  "CMakeFiles/test_sub_forward.dir/test_sub_forward.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_sub_forward.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_sub_forward_tipc"
+  "../bin/test_sub_forward_tipc.pdb"
+  "CMakeFiles/test_sub_forward_tipc.dir/test_sub_forward_tipc.cpp.o"
+  "CMakeFiles/test_sub_forward_tipc.dir/test_sub_forward_tipc.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_sub_forward_tipc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_system"
+  "../bin/test_system.pdb"
+  "CMakeFiles/test_system.dir/test_system.cpp.o"
+  "CMakeFiles/test_system.dir/test_system.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_system.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
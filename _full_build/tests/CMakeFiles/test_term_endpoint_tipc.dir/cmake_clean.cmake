@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_term_endpoint_tipc"
+  "../bin/test_term_endpoint_tipc.pdb"
+  "CMakeFiles/test_term_endpoint_tipc.dir/test_term_endpoint_tipc.cpp.o"
+  "CMakeFiles/test_term_endpoint_tipc.dir/test_term_endpoint_tipc.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_term_endpoint_tipc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
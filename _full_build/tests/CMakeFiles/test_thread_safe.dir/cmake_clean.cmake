@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_thread_safe"
+  "../bin/test_thread_safe.pdb"
+  "CMakeFiles/test_thread_safe.dir/test_thread_safe.cpp.o"
+  "CMakeFiles/test_thread_safe.dir/test_thread_safe.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_thread_safe.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_timeo"
+  "../bin/test_timeo.pdb"
+  "CMakeFiles/test_timeo.dir/test_timeo.cpp.o"
+  "CMakeFiles/test_timeo.dir/test_timeo.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_timeo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
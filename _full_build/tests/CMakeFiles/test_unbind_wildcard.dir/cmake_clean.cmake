@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_unbind_wildcard"
+  "../bin/test_unbind_wildcard.pdb"
+  "CMakeFiles/test_unbind_wildcard.dir/test_unbind_wildcard.cpp.o"
+  "CMakeFiles/test_unbind_wildcard.dir/test_unbind_wildcard.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_unbind_wildcard.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_use_fd"
+  "../bin/test_use_fd.pdb"
+  "CMakeFiles/test_use_fd.dir/test_use_fd.cpp.o"
+  "CMakeFiles/test_use_fd.dir/test_use_fd.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_use_fd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
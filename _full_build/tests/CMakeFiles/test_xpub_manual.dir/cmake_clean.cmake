@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_xpub_manual"
+  "../bin/test_xpub_manual.pdb"
+  "CMakeFiles/test_xpub_manual.dir/test_xpub_manual.cpp.o"
+  "CMakeFiles/test_xpub_manual.dir/test_xpub_manual.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_xpub_manual.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
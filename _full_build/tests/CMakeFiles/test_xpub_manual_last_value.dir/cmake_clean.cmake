@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_xpub_manual_last_value"
+  "../bin/test_xpub_manual_last_value.pdb"
+  "CMakeFiles/test_xpub_manual_last_value.dir/test_xpub_manual_last_value.cpp.o"
+  "CMakeFiles/test_xpub_manual_last_value.dir/test_xpub_manual_last_value.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_xpub_manual_last_value.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_xpub_nodrop"
+  "../bin/test_xpub_nodrop.pdb"
+  "CMakeFiles/test_xpub_nodrop.dir/test_xpub_nodrop.cpp.o"
+  "CMakeFiles/test_xpub_nodrop.dir/test_xpub_nodrop.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_xpub_nodrop.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_xpub_verbose"
+  "../bin/test_xpub_verbose.pdb"
+  "CMakeFiles/test_xpub_verbose.dir/test_xpub_verbose.cpp.o"
+  "CMakeFiles/test_xpub_verbose.dir/test_xpub_verbose.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_xpub_verbose.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_xpub_welcome_msg"
+  "../bin/test_xpub_welcome_msg.pdb"
+  "CMakeFiles/test_xpub_welcome_msg.dir/test_xpub_welcome_msg.cpp.o"
+  "CMakeFiles/test_xpub_welcome_msg.dir/test_xpub_welcome_msg.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_xpub_welcome_msg.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
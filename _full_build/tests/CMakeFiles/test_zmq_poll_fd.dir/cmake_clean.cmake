@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/test_zmq_poll_fd"
+  "../bin/test_zmq_poll_fd.pdb"
+  "CMakeFiles/test_zmq_poll_fd.dir/test_zmq_poll_fd.cpp.o"
+  "CMakeFiles/test_zmq_poll_fd.dir/test_zmq_poll_fd.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_zmq_poll_fd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../lib/libtestutil-static.a"
+  "../lib/libtestutil-static.pdb"
+  "CMakeFiles/testutil-static.dir/testutil.cpp.o"
+  "CMakeFiles/testutil-static.dir/testutil.cpp.o.d"
+  "CMakeFiles/testutil-static.dir/testutil_monitoring.cpp.o"
+  "CMakeFiles/testutil-static.dir/testutil_monitoring.cpp.o.d"
+  "CMakeFiles/testutil-static.dir/testutil_security.cpp.o"
+  "CMakeFiles/testutil-static.dir/testutil_security.cpp.o.d"
+  "CMakeFiles/testutil-static.dir/testutil_unity.cpp.o"
+  "CMakeFiles/testutil-static.dir/testutil_unity.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testutil-static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
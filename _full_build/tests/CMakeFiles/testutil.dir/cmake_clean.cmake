@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../lib/libtestutil.a"
+  "../lib/libtestutil.pdb"
+  "CMakeFiles/testutil.dir/testutil.cpp.o"
+  "CMakeFiles/testutil.dir/testutil.cpp.o.d"
+  "CMakeFiles/testutil.dir/testutil_monitoring.cpp.o"
+  "CMakeFiles/testutil.dir/testutil_monitoring.cpp.o.d"
+  "CMakeFiles/testutil.dir/testutil_security.cpp.o"
+  "CMakeFiles/testutil.dir/testutil_security.cpp.o.d"
+  "CMakeFiles/testutil.dir/testutil_unity.cpp.o"
+  "CMakeFiles/testutil.dir/testutil_unity.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/testutil.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../lib/libunity.a"
+  "../lib/libunity.pdb"
+  "CMakeFiles/unity.dir/__/external/unity/unity.c.o"
+  "CMakeFiles/unity.dir/__/external/unity/unity.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unity.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
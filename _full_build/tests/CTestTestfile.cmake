@@ -0,0 +1,220 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests
+# Build directory: /root/repo/_full_build/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test_ancillaries "/root/repo/_full_build/bin/test_ancillaries")
+set_tests_properties(test_ancillaries PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_system "/root/repo/_full_build/bin/test_system")
+set_tests_properties(test_system PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_pair_inproc "/root/repo/_full_build/bin/test_pair_inproc")
+set_tests_properties(test_pair_inproc PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_pair_tcp "/root/repo/_full_build/bin/test_pair_tcp")
+set_tests_properties(test_pair_tcp PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_reqrep_inproc "/root/repo/_full_build/bin/test_reqrep_inproc")
+set_tests_properties(test_reqrep_inproc PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_reqrep_tcp "/root/repo/_full_build/bin/test_reqrep_tcp")
+set_tests_properties(test_reqrep_tcp PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_hwm "/root/repo/_full_build/bin/test_hwm")
+set_tests_properties(test_hwm PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_hwm_pubsub "/root/repo/_full_build/bin/test_hwm_pubsub")
+set_tests_properties(test_hwm_pubsub PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_reqrep_device "/root/repo/_full_build/bin/test_reqrep_device")
+set_tests_properties(test_reqrep_device PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_sub_forward "/root/repo/_full_build/bin/test_sub_forward")
+set_tests_properties(test_sub_forward PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_invalid_rep "/root/repo/_full_build/bin/test_invalid_rep")
+set_tests_properties(test_invalid_rep PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_msg_flags "/root/repo/_full_build/bin/test_msg_flags")
+set_tests_properties(test_msg_flags PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_msg_ffn "/root/repo/_full_build/bin/test_msg_ffn")
+set_tests_properties(test_msg_ffn PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_connect_resolve "/root/repo/_full_build/bin/test_connect_resolve")
+set_tests_properties(test_connect_resolve PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_immediate "/root/repo/_full_build/bin/test_immediate")
+set_tests_properties(test_immediate PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_last_endpoint "/root/repo/_full_build/bin/test_last_endpoint")
+set_tests_properties(test_last_endpoint PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_term_endpoint "/root/repo/_full_build/bin/test_term_endpoint")
+set_tests_properties(test_term_endpoint PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_router_mandatory "/root/repo/_full_build/bin/test_router_mandatory")
+set_tests_properties(test_router_mandatory PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_probe_router "/root/repo/_full_build/bin/test_probe_router")
+set_tests_properties(test_probe_router PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_stream "/root/repo/_full_build/bin/test_stream")
+set_tests_properties(test_stream PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_stream_empty "/root/repo/_full_build/bin/test_stream_empty")
+set_tests_properties(test_stream_empty PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_stream_disconnect "/root/repo/_full_build/bin/test_stream_disconnect")
+set_tests_properties(test_stream_disconnect PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_disconnect_inproc "/root/repo/_full_build/bin/test_disconnect_inproc")
+set_tests_properties(test_disconnect_inproc PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_unbind_wildcard "/root/repo/_full_build/bin/test_unbind_wildcard")
+set_tests_properties(test_unbind_wildcard PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_ctx_options "/root/repo/_full_build/bin/test_ctx_options")
+set_tests_properties(test_ctx_options PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_ctx_destroy "/root/repo/_full_build/bin/test_ctx_destroy")
+set_tests_properties(test_ctx_destroy PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_security_no_zap_handler "/root/repo/_full_build/bin/test_security_no_zap_handler")
+set_tests_properties(test_security_no_zap_handler PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_security_null "/root/repo/_full_build/bin/test_security_null")
+set_tests_properties(test_security_null PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_security_plain "/root/repo/_full_build/bin/test_security_plain")
+set_tests_properties(test_security_plain PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_security_zap "/root/repo/_full_build/bin/test_security_zap")
+set_tests_properties(test_security_zap PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_iov "/root/repo/_full_build/bin/test_iov")
+set_tests_properties(test_iov PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_spec_req "/root/repo/_full_build/bin/test_spec_req")
+set_tests_properties(test_spec_req PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_spec_rep "/root/repo/_full_build/bin/test_spec_rep")
+set_tests_properties(test_spec_rep PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_spec_dealer "/root/repo/_full_build/bin/test_spec_dealer")
+set_tests_properties(test_spec_dealer PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_spec_router "/root/repo/_full_build/bin/test_spec_router")
+set_tests_properties(test_spec_router PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_spec_pushpull "/root/repo/_full_build/bin/test_spec_pushpull")
+set_tests_properties(test_spec_pushpull PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_req_correlate "/root/repo/_full_build/bin/test_req_correlate")
+set_tests_properties(test_req_correlate PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_req_relaxed "/root/repo/_full_build/bin/test_req_relaxed")
+set_tests_properties(test_req_relaxed PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_conflate "/root/repo/_full_build/bin/test_conflate")
+set_tests_properties(test_conflate PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_inproc_connect "/root/repo/_full_build/bin/test_inproc_connect")
+set_tests_properties(test_inproc_connect PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_issue_566 "/root/repo/_full_build/bin/test_issue_566")
+set_tests_properties(test_issue_566 PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_shutdown_stress "/root/repo/_full_build/bin/test_shutdown_stress")
+set_tests_properties(test_shutdown_stress PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_timeo "/root/repo/_full_build/bin/test_timeo")
+set_tests_properties(test_timeo PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_many_sockets "/root/repo/_full_build/bin/test_many_sockets")
+set_tests_properties(test_many_sockets PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_diffserv "/root/repo/_full_build/bin/test_diffserv")
+set_tests_properties(test_diffserv PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_connect_rid "/root/repo/_full_build/bin/test_connect_rid")
+set_tests_properties(test_connect_rid PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_xpub_nodrop "/root/repo/_full_build/bin/test_xpub_nodrop")
+set_tests_properties(test_xpub_nodrop PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_pub_invert_matching "/root/repo/_full_build/bin/test_pub_invert_matching")
+set_tests_properties(test_pub_invert_matching PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_setsockopt "/root/repo/_full_build/bin/test_setsockopt")
+set_tests_properties(test_setsockopt PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_sockopt_hwm "/root/repo/_full_build/bin/test_sockopt_hwm")
+set_tests_properties(test_sockopt_hwm PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_heartbeats "/root/repo/_full_build/bin/test_heartbeats")
+set_tests_properties(test_heartbeats PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_atomics "/root/repo/_full_build/bin/test_atomics")
+set_tests_properties(test_atomics PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_bind_src_address "/root/repo/_full_build/bin/test_bind_src_address")
+set_tests_properties(test_bind_src_address PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_capabilities "/root/repo/_full_build/bin/test_capabilities")
+set_tests_properties(test_capabilities PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_metadata "/root/repo/_full_build/bin/test_metadata")
+set_tests_properties(test_metadata PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_router_handover "/root/repo/_full_build/bin/test_router_handover")
+set_tests_properties(test_router_handover PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_srcfd "/root/repo/_full_build/bin/test_srcfd")
+set_tests_properties(test_srcfd PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_stream_timeout "/root/repo/_full_build/bin/test_stream_timeout")
+set_tests_properties(test_stream_timeout PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_xpub_manual "/root/repo/_full_build/bin/test_xpub_manual")
+set_tests_properties(test_xpub_manual PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_xpub_welcome_msg "/root/repo/_full_build/bin/test_xpub_welcome_msg")
+set_tests_properties(test_xpub_welcome_msg PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_xpub_verbose "/root/repo/_full_build/bin/test_xpub_verbose")
+set_tests_properties(test_xpub_verbose PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_base85 "/root/repo/_full_build/bin/test_base85")
+set_tests_properties(test_base85 PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_bind_after_connect_tcp "/root/repo/_full_build/bin/test_bind_after_connect_tcp")
+set_tests_properties(test_bind_after_connect_tcp PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_sodium "/root/repo/_full_build/bin/test_sodium")
+set_tests_properties(test_sodium PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_monitor "/root/repo/_full_build/bin/test_monitor")
+set_tests_properties(test_monitor PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_socket_null "/root/repo/_full_build/bin/test_socket_null")
+set_tests_properties(test_socket_null PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_reconnect_ivl "/root/repo/_full_build/bin/test_reconnect_ivl")
+set_tests_properties(test_reconnect_ivl PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_mock_pub_sub "/root/repo/_full_build/bin/test_mock_pub_sub")
+set_tests_properties(test_mock_pub_sub PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_security_gssapi "/root/repo/_full_build/bin/test_security_gssapi")
+set_tests_properties(test_security_gssapi PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_security_curve "/root/repo/_full_build/bin/test_security_curve")
+set_tests_properties(test_security_curve PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_ipc_wildcard "/root/repo/_full_build/bin/test_ipc_wildcard")
+set_tests_properties(test_ipc_wildcard PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_pair_ipc "/root/repo/_full_build/bin/test_pair_ipc")
+set_tests_properties(test_pair_ipc PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_reqrep_ipc "/root/repo/_full_build/bin/test_reqrep_ipc")
+set_tests_properties(test_reqrep_ipc PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_rebind_ipc "/root/repo/_full_build/bin/test_rebind_ipc")
+set_tests_properties(test_rebind_ipc PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_pair_shm "/root/repo/_full_build/bin/test_pair_shm")
+set_tests_properties(test_pair_shm PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_proxy "/root/repo/_full_build/bin/test_proxy")
+set_tests_properties(test_proxy PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_proxy_hwm "/root/repo/_full_build/bin/test_proxy_hwm")
+set_tests_properties(test_proxy_hwm PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_proxy_single_socket "/root/repo/_full_build/bin/test_proxy_single_socket")
+set_tests_properties(test_proxy_single_socket PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_proxy_terminate "/root/repo/_full_build/bin/test_proxy_terminate")
+set_tests_properties(test_proxy_terminate PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_getsockopt_memset "/root/repo/_full_build/bin/test_getsockopt_memset")
+set_tests_properties(test_getsockopt_memset PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_filter_ipc "/root/repo/_full_build/bin/test_filter_ipc")
+set_tests_properties(test_filter_ipc PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_stream_exceeds_buffer "/root/repo/_full_build/bin/test_stream_exceeds_buffer")
+set_tests_properties(test_stream_exceeds_buffer PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_router_mandatory_hwm "/root/repo/_full_build/bin/test_router_mandatory_hwm")
+set_tests_properties(test_router_mandatory_hwm PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_use_fd "/root/repo/_full_build/bin/test_use_fd")
+set_tests_properties(test_use_fd PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_zmq_poll_fd "/root/repo/_full_build/bin/test_zmq_poll_fd")
+set_tests_properties(test_zmq_poll_fd PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_fork "/root/repo/_full_build/bin/test_fork")
+set_tests_properties(test_fork PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_abstract_ipc "/root/repo/_full_build/bin/test_abstract_ipc")
+set_tests_properties(test_abstract_ipc PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_address_tipc "/root/repo/_full_build/bin/test_address_tipc")
+set_tests_properties(test_address_tipc PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_pair_tipc "/root/repo/_full_build/bin/test_pair_tipc")
+set_tests_properties(test_pair_tipc PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_reqrep_device_tipc "/root/repo/_full_build/bin/test_reqrep_device_tipc")
+set_tests_properties(test_reqrep_device_tipc PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_reqrep_tipc "/root/repo/_full_build/bin/test_reqrep_tipc")
+set_tests_properties(test_reqrep_tipc PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_router_mandatory_tipc "/root/repo/_full_build/bin/test_router_mandatory_tipc")
+set_tests_properties(test_router_mandatory_tipc PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_sub_forward_tipc "/root/repo/_full_build/bin/test_sub_forward_tipc")
+set_tests_properties(test_sub_forward_tipc PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_connect_delay_tipc "/root/repo/_full_build/bin/test_connect_delay_tipc")
+set_tests_properties(test_connect_delay_tipc PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_shutdown_stress_tipc "/root/repo/_full_build/bin/test_shutdown_stress_tipc")
+set_tests_properties(test_shutdown_stress_tipc PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_term_endpoint_tipc "/root/repo/_full_build/bin/test_term_endpoint_tipc")
+set_tests_properties(test_term_endpoint_tipc PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_poller "/root/repo/_full_build/bin/test_poller")
+set_tests_properties(test_poller PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_thread_safe "/root/repo/_full_build/bin/test_thread_safe")
+set_tests_properties(test_thread_safe PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_client_server "/root/repo/_full_build/bin/test_client_server")
+set_tests_properties(test_client_server PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_timers "/root/repo/_full_build/bin/test_timers")
+set_tests_properties(test_timers PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_radio_dish "/root/repo/_full_build/bin/test_radio_dish")
+set_tests_properties(test_radio_dish PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "30" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_scatter_gather "/root/repo/_full_build/bin/test_scatter_gather")
+set_tests_properties(test_scatter_gather PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_dgram "/root/repo/_full_build/bin/test_dgram")
+set_tests_properties(test_dgram PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_app_meta "/root/repo/_full_build/bin/test_app_meta")
+set_tests_properties(test_app_meta PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_router_notify "/root/repo/_full_build/bin/test_router_notify")
+set_tests_properties(test_router_notify PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_xpub_manual_last_value "/root/repo/_full_build/bin/test_xpub_manual_last_value")
+set_tests_properties(test_xpub_manual_last_value PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_batch "/root/repo/_full_build/bin/test_batch")
+set_tests_properties(test_batch PROPERTIES  SKIP_RETURN_CODE "77" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/tests/CMakeLists.txt;283;add_test;/root/repo/tests/CMakeLists.txt;0;")
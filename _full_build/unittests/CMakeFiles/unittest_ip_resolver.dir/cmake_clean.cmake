@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/unittest_ip_resolver"
+  "../bin/unittest_ip_resolver.pdb"
+  "CMakeFiles/unittest_ip_resolver.dir/unittest_ip_resolver.cpp.o"
+  "CMakeFiles/unittest_ip_resolver.dir/unittest_ip_resolver.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unittest_ip_resolver.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
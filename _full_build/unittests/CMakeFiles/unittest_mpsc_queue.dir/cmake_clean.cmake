@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/unittest_mpsc_queue"
+  "../bin/unittest_mpsc_queue.pdb"
+  "CMakeFiles/unittest_mpsc_queue.dir/unittest_mpsc_queue.cpp.o"
+  "CMakeFiles/unittest_mpsc_queue.dir/unittest_mpsc_queue.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unittest_mpsc_queue.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/unittest_mtrie"
+  "../bin/unittest_mtrie.pdb"
+  "CMakeFiles/unittest_mtrie.dir/unittest_mtrie.cpp.o"
+  "CMakeFiles/unittest_mtrie.dir/unittest_mtrie.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unittest_mtrie.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
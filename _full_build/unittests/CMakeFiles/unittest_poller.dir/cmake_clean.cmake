@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/unittest_poller"
+  "../bin/unittest_poller.pdb"
+  "CMakeFiles/unittest_poller.dir/unittest_poller.cpp.o"
+  "CMakeFiles/unittest_poller.dir/unittest_poller.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unittest_poller.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/unittest_radix_tree"
+  "../bin/unittest_radix_tree.pdb"
+  "CMakeFiles/unittest_radix_tree.dir/unittest_radix_tree.cpp.o"
+  "CMakeFiles/unittest_radix_tree.dir/unittest_radix_tree.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unittest_radix_tree.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
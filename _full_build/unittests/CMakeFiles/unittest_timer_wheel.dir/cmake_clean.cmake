@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/unittest_timer_wheel"
+  "../bin/unittest_timer_wheel.pdb"
+  "CMakeFiles/unittest_timer_wheel.dir/unittest_timer_wheel.cpp.o"
+  "CMakeFiles/unittest_timer_wheel.dir/unittest_timer_wheel.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unittest_timer_wheel.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/unittest_udp_address"
+  "../bin/unittest_udp_address.pdb"
+  "CMakeFiles/unittest_udp_address.dir/unittest_udp_address.cpp.o"
+  "CMakeFiles/unittest_udp_address.dir/unittest_udp_address.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unittest_udp_address.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../bin/unittest_ypipe"
+  "../bin/unittest_ypipe.pdb"
+  "CMakeFiles/unittest_ypipe.dir/unittest_ypipe.cpp.o"
+  "CMakeFiles/unittest_ypipe.dir/unittest_ypipe.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unittest_ypipe.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
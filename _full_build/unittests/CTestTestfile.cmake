@@ -0,0 +1,22 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/unittests
+# Build directory: /root/repo/_full_build/unittests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(unittest_ypipe "/root/repo/_full_build/bin/unittest_ypipe")
+set_tests_properties(unittest_ypipe PROPERTIES  TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/unittests/CMakeLists.txt;54;add_test;/root/repo/unittests/CMakeLists.txt;0;")
+add_test(unittest_mpsc_queue "/root/repo/_full_build/bin/unittest_mpsc_queue")
+set_tests_properties(unittest_mpsc_queue PROPERTIES  TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/unittests/CMakeLists.txt;54;add_test;/root/repo/unittests/CMakeLists.txt;0;")
+add_test(unittest_poller "/root/repo/_full_build/bin/unittest_poller")
+set_tests_properties(unittest_poller PROPERTIES  TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/unittests/CMakeLists.txt;54;add_test;/root/repo/unittests/CMakeLists.txt;0;")
+add_test(unittest_mtrie "/root/repo/_full_build/bin/unittest_mtrie")
+set_tests_properties(unittest_mtrie PROPERTIES  TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/unittests/CMakeLists.txt;54;add_test;/root/repo/unittests/CMakeLists.txt;0;")
+add_test(unittest_ip_resolver "/root/repo/_full_build/bin/unittest_ip_resolver")
+set_tests_properties(unittest_ip_resolver PROPERTIES  TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/unittests/CMakeLists.txt;54;add_test;/root/repo/unittests/CMakeLists.txt;0;")
+add_test(unittest_udp_address "/root/repo/_full_build/bin/unittest_udp_address")
+set_tests_properties(unittest_udp_address PROPERTIES  TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/unittests/CMakeLists.txt;54;add_test;/root/repo/unittests/CMakeLists.txt;0;")
+add_test(unittest_radix_tree "/root/repo/_full_build/bin/unittest_radix_tree")
+set_tests_properties(unittest_radix_tree PROPERTIES  TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/unittests/CMakeLists.txt;54;add_test;/root/repo/unittests/CMakeLists.txt;0;")
+add_test(unittest_timer_wheel "/root/repo/_full_build/bin/unittest_timer_wheel")
+set_tests_properties(unittest_timer_wheel PROPERTIES  TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/unittests/CMakeLists.txt;54;add_test;/root/repo/unittests/CMakeLists.txt;0;")
@@ -966,6 +966,24 @@ epoll_create1(EPOLL_CLOEXEC);
     )
 }])
 
+dnl ################################################################################
+dnl # LIBZMQ_CHECK_POLLER_IO_URING([action-if-found], [action-if-not-found])       #
+dnl # Checks io_uring polling system (requires IORING_ENTER_EXT_ARG, Linux 5.11)   #
+dnl ################################################################################
+AC_DEFUN([LIBZMQ_CHECK_POLLER_IO_URING], [{
+    AC_COMPILE_IFELSE([
+        AC_LANG_PROGRAM([
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+        ],[[
+struct io_uring_getevents_arg t_arg;
+int t_flags = IORING_ENTER_EXT_ARG;
+long t_nr = __NR_io_uring_enter;
+        ]])],
+        [$1], [$2]
+    )
+}])
+
 dnl ################################################################################
 dnl # LIBZMQ_CHECK_POLLER_DEVPOLL([action-if-found], [action-if-not-found])        #
 dnl # Checks devpoll polling system                                                #
@@ -1051,7 +1069,7 @@ AC_DEFUN([LIBZMQ_CHECK_POLLER], [{
     # Allow user to override poller autodetection
     AC_ARG_WITH([poller],
         [AS_HELP_STRING([--with-poller],
-        [choose I/O thread polling system manually. Valid values are 'kqueue', 'epoll', 'devpoll', 'pollset', 'poll', 'select', 'wepoll', or 'auto'. [default=auto]])])
+        [choose I/O thread polling system manually. Valid values are 'kqueue', 'epoll', 'io_uring', 'devpoll', 'pollset', 'poll', 'select', 'wepoll', or 'auto'. [default=auto]])])
 
     # Allow user to override poller autodetection
     AC_ARG_WITH([api_poller],
@@ -1105,6 +1123,14 @@ AC_DEFUN([LIBZMQ_CHECK_POLLER], [{
                         ;;
                 esac
             ;;
+            io_uring)
+                # io_uring can only be manually selected
+                LIBZMQ_CHECK_POLLER_IO_URING([
+                    AC_MSG_NOTICE([Using 'io_uring' I/O thread polling system])
+                    AC_DEFINE(ZMQ_IOTHREAD_POLLER_USE_IO_URING, 1, [Use 'io_uring' I/O thread polling system])
+                    poller_found=1
+                ])
+            ;;
             devpoll)
                 LIBZMQ_CHECK_POLLER_DEVPOLL([
                     AC_MSG_NOTICE([Using 'devpoll' I/O thread polling system])
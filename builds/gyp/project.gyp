@@ -65,6 +65,8 @@
         '../../include/zmq.h',
         '../../src/address.cpp',
         '../../src/address.hpp',
+        '../../src/allocator.cpp',
+        '../../src/allocator.hpp',
         '../../src/array.hpp',
         '../../src/atomic_counter.hpp',
         '../../src/atomic_ptr.hpp',
@@ -105,6 +107,8 @@
         '../../src/fd.hpp',
         '../../src/fq.cpp',
         '../../src/fq.hpp',
+        '../../src/gather_buffer.cpp',
+        '../../src/gather_buffer.hpp',
         '../../src/gssapi_client.cpp',
         '../../src/gssapi_client.hpp',
         '../../src/gssapi_mechanism_base.cpp',
@@ -120,6 +124,8 @@
         '../../src/io_object.hpp',
         '../../src/io_thread.cpp',
         '../../src/io_thread.hpp',
+        '../../src/io_uring.cpp',
+        '../../src/io_uring.hpp',
         '../../src/ip.cpp',
         '../../src/ip.hpp',
         '../../src/ipc_address.cpp',
@@ -141,10 +147,16 @@
         '../../src/mechanism.hpp ',
         '../../src/mechanism_base.cpp',
         '../../src/mechanism_base.hpp ',
+        '../../src/memfd.cpp',
+        '../../src/memfd.hpp',
+        '../../src/memory_counter.hpp',
         '../../src/metadata.cpp',
         '../../src/metadata.hpp',
+        '../../src/mpsc_queue.hpp',
         '../../src/msg.cpp',
         '../../src/msg.hpp',
+        '../../src/msg_pool.cpp',
+        '../../src/msg_pool.hpp',
         '../../src/mtrie.cpp',
         '../../src/mtrie.hpp',
         '../../src/mutex.hpp',
@@ -152,6 +164,8 @@
         '../../src/norm_engine.hpp',
         '../../src/null_mechanism.cpp',
         '../../src/null_mechanism.hpp',
+        '../../src/numa.cpp',
+        '../../src/numa.hpp',
         '../../src/object.cpp',
         '../../src/object.hpp',
         '../../src/options.cpp',
@@ -199,14 +213,23 @@
         '../../src/rep.hpp',
         '../../src/req.cpp',
         '../../src/req.hpp',
+        '../../src/ring.hpp',
         '../../src/router.cpp',
         '../../src/router.hpp',
+        '../../src/routing_table.cpp',
+        '../../src/routing_table.hpp',
         '../../src/select.cpp',
         '../../src/select.hpp',
         '../../src/server.cpp',
         '../../src/server.hpp',
         '../../src/session_base.cpp',
         '../../src/session_base.hpp',
+        '../../src/shm_connecter.cpp',
+        '../../src/shm_connecter.hpp',
+        '../../src/shm_engine.cpp',
+        '../../src/shm_engine.hpp',
+        '../../src/shm_listener.cpp',
+        '../../src/shm_listener.hpp',
         '../../src/signaler.cpp',
         '../../src/signaler.hpp',
         '../../src/socket_base.cpp',
@@ -234,6 +257,8 @@
         '../../src/tcp_listener.hpp',
         '../../src/thread.cpp',
         '../../src/thread.hpp',
+        '../../src/timer_wheel.cpp',
+        '../../src/timer_wheel.hpp',
         '../../src/timers.cpp',
         '../../src/timers.hpp',
         '../../src/tipc_address.cpp',
@@ -279,6 +304,8 @@
         '../../src/yqueue.hpp',
         '../../src/zap_client.cpp',
         '../../src/zap_client.hpp',
+        '../../src/zerocopy_reaper.cpp',
+        '../../src/zerocopy_reaper.hpp',
         '../../src/zmq.cpp',
         '../../src/zmq_utils.cpp'
       ],
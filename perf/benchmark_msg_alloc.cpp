@@ -0,0 +1,180 @@
+/*
+    Copyright (c) 2007-2016 Contributors as noted in the AUTHORS file
+
+    This file is part of libzmq, the ZeroMQ core engine in C++.
+
+    libzmq is free software; you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    As a special exception, the Contributors give you permission to link
+    this library with independent modules to produce an executable,
+    regardless of the license terms of these independent modules, and to
+    copy and distribute the resulting executable under terms of your choice,
+    provided that you also meet, for each linked independent module, the
+    terms and conditions of the license of that module. An independent
+    module is a module which is not derived from or based on this library.
+    If you modify this library, you must extend this exception to your
+    version of the library.
+
+    libzmq is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../include/zmq.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+//  Measures what allocating and freeing message contents costs, with and
+//  without the message pools (ZMQ_MSG_POOL), when a message is freed by
+//  the thread that allocated it and when it is freed by another one.
+
+#ifndef ZMQ_MSG_POOL
+#define ZMQ_MSG_POOL 11
+#endif
+
+static const int batch_size = 1000;
+
+struct cross_thread_t
+{
+    void *ctx;
+    size_t message_size;
+    int batch_count;
+    zmq_msg_t *batches[2];
+};
+
+static void die (const char *what_)
+{
+    printf ("error in %s: %s\n", what_, zmq_strerror (errno));
+    exit (1);
+}
+
+static double same_thread (size_t message_size_, int message_count_)
+{
+    zmq_msg_t msg;
+    void *watch = zmq_stopwatch_start ();
+    for (int i = 0; i != message_count_; i++) {
+        if (zmq_msg_init_size (&msg, message_size_) != 0)
+            die ("zmq_msg_init_size");
+        if (zmq_msg_close (&msg) != 0)
+            die ("zmq_msg_close");
+    }
+    const unsigned long elapsed = zmq_stopwatch_stop (watch);
+    return (double) elapsed * 1000 / message_count_;
+}
+
+//  Allocates batches of messages and hands them over to the main thread,
+//  which frees them while the next batch is being allocated.
+static void producer (void *arg_)
+{
+    cross_thread_t *cross = (cross_thread_t *) arg_;
+
+    void *s = zmq_socket (cross->ctx, ZMQ_PAIR);
+    if (!s)
+        die ("zmq_socket");
+    if (zmq_connect (s, "inproc://benchmark_msg_alloc") != 0)
+        die ("zmq_connect");
+
+    for (int i = 0; i != cross->batch_count; i++) {
+        const unsigned char slot = (unsigned char) (i % 2);
+
+        //  Wait until the main thread is done with the slot.
+        if (i >= 2 && zmq_recv (s, NULL, 0, 0) != 1)
+            die ("zmq_recv");
+
+        zmq_msg_t *batch = cross->batches[slot];
+        for (int j = 0; j != batch_size; j++)
+            if (zmq_msg_init_size (&batch[j], cross->message_size) != 0)
+                die ("zmq_msg_init_size");
+        if (zmq_send (s, &slot, 1, 0) != 1)
+            die ("zmq_send");
+    }
+
+    if (zmq_close (s) != 0)
+        die ("zmq_close");
+}
+
+static double cross_thread (void *ctx_, size_t message_size_, int message_count_)
+{
+    cross_thread_t cross;
+    cross.ctx = ctx_;
+    cross.message_size = message_size_;
+    cross.batch_count = (message_count_ + batch_size - 1) / batch_size;
+    for (int i = 0; i != 2; i++) {
+        cross.batches[i] =
+          (zmq_msg_t *) malloc (batch_size * sizeof (zmq_msg_t));
+        if (!cross.batches[i])
+            die ("malloc");
+    }
+
+    void *s = zmq_socket (ctx_, ZMQ_PAIR);
+    if (!s)
+        die ("zmq_socket");
+    if (zmq_bind (s, "inproc://benchmark_msg_alloc") != 0)
+        die ("zmq_bind");
+
+    void *watch = zmq_stopwatch_start ();
+    void *thread = zmq_threadstart (producer, &cross);
+
+    for (int i = 0; i != cross.batch_count; i++) {
+        unsigned char slot;
+        if (zmq_recv (s, &slot, 1, 0) != 1)
+            die ("zmq_recv");
+        zmq_msg_t *batch = cross.batches[slot];
+        for (int j = 0; j != batch_size; j++)
+            if (zmq_msg_close (&batch[j]) != 0)
+                die ("zmq_msg_close");
+        if (i + 2 < cross.batch_count && zmq_send (s, &slot, 1, 0) != 1)
+            die ("zmq_send");
+    }
+
+    zmq_threadclose (thread);
+    const unsigned long elapsed = zmq_stopwatch_stop (watch);
+
+    if (zmq_close (s) != 0)
+        die ("zmq_close");
+    for (int i = 0; i != 2; i++)
+        free (cross.batches[i]);
+
+    return (double) elapsed * 1000 / (cross.batch_count * batch_size);
+}
+
+int main (int argc, char *argv[])
+{
+    if (argc != 3) {
+        printf ("usage: benchmark_msg_alloc <message-size> <message-count>\n");
+        return 1;
+    }
+    const size_t message_size = atoi (argv[1]);
+    const int message_count = atoi (argv[2]);
+
+    printf ("message size: %d [B]\n", (int) message_size);
+    printf ("message count: %d\n", message_count);
+
+    //  The pools are enabled for the whole process while any context asks
+    //  for them, so measure the heap first.
+    for (int pool = 0; pool != 2; pool++) {
+        void *ctx = zmq_ctx_new ();
+        if (!ctx)
+            die ("zmq_ctx_new");
+        if (zmq_ctx_set (ctx, ZMQ_MSG_POOL, pool) != 0)
+            die ("zmq_ctx_set");
+
+        const double same = same_thread (message_size, message_count);
+        const double cross = cross_thread (ctx, message_size, message_count);
+        printf ("%s: same thread: %.1f [ns], cross thread: %.1f [ns]\n",
+                pool ? "pool" : "heap", same, cross);
+
+        if (zmq_ctx_term (ctx) != 0)
+            die ("zmq_ctx_term");
+    }
+
+    return 0;
+}
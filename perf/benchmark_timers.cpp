@@ -0,0 +1,193 @@
+/*
+    Copyright (c) 2007-2016 Contributors as noted in the AUTHORS file
+
+    This file is part of libzmq, the ZeroMQ core engine in C++.
+
+    libzmq is free software; you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    As a special exception, the Contributors give you permission to link
+    this library with independent modules to produce an executable,
+    regardless of the license terms of these independent modules, and to
+    copy and distribute the resulting executable under terms of your choice,
+    provided that you also meet, for each linked independent module, the
+    terms and conditions of the license of that module. An independent
+    module is a module which is not derived from or based on this library.
+    If you modify this library, you must extend this exception to your
+    version of the library.
+
+    libzmq is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "timer_wheel.hpp"
+#include "i_poll_events.hpp"
+
+#include <zmq.h>
+
+#include <map>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+//  Simulates the timers of many connections heartbeating each other, as
+//  an I/O thread sees them with ZMQ_HEARTBEAT_IVL and ZMQ_HEARTBEAT_TIMEOUT
+//  set: each connection first has its handshake timer cancelled, then
+//  re-arms its heartbeat timer whenever it fires, replacing the timeout
+//  timer of the previous ping. Time is simulated, so only the cost of
+//  the timer operations is measured.
+
+const int heartbeat_ivl = 1000;
+const int heartbeat_timeout = 3000;
+const int handshake_ivl = 30000;
+
+//  The timer store of poller_base_t before the timing wheel.
+class multimap_timers_t
+{
+  public:
+    void add (uint64_t now_, int timeout_, zmq::i_poll_events *sink_, int id_)
+    {
+        timer_info_t info = {sink_, id_};
+        _timers.insert (timers_t::value_type (now_ + timeout_, info));
+    }
+
+    bool cancel (zmq::i_poll_events *sink_, int id_)
+    {
+        for (timers_t::iterator it = _timers.begin (), end = _timers.end ();
+             it != end; ++it)
+            if (it->second.sink == sink_ && it->second.id == id_) {
+                _timers.erase (it);
+                return true;
+            }
+        return false;
+    }
+
+    uint64_t execute (uint64_t current_)
+    {
+        const timers_t::iterator begin = _timers.begin ();
+        const timers_t::iterator end = _timers.end ();
+        uint64_t res = 0;
+        timers_t::iterator it = begin;
+        for (; it != end; ++it) {
+            if (it->first > current_) {
+                res = it->first - current_;
+                break;
+            }
+            it->second.sink->timer_event (it->second.id);
+        }
+        _timers.erase (begin, it);
+        return res;
+    }
+
+  private:
+    struct timer_info_t
+    {
+        zmq::i_poll_events *sink;
+        int id;
+    };
+    typedef std::multimap<uint64_t, timer_info_t> timers_t;
+    timers_t _timers;
+};
+
+template <class T> class connection_t : public zmq::i_poll_events
+{
+  public:
+    enum
+    {
+        heartbeat_ivl_timer_id = 0x80,
+        heartbeat_timeout_timer_id = 0x81,
+        handshake_timer_id = 0x82
+    };
+
+    connection_t () : _timers (NULL), _now (NULL), _has_timeout (false) {}
+
+    void start (T *timers_, const uint64_t *now_, int first_heartbeat_)
+    {
+        _timers = timers_;
+        _now = now_;
+        _timers->add (*_now, handshake_ivl, this, handshake_timer_id);
+        _timers->add (*_now, first_heartbeat_, this, heartbeat_ivl_timer_id);
+    }
+
+    void handshake_done ()
+    {
+        _timers->cancel (this, handshake_timer_id);
+    }
+
+    void in_event () ZMQ_OVERRIDE {}
+
+    void out_event () ZMQ_OVERRIDE {}
+
+    void timer_event (int id_) ZMQ_OVERRIDE
+    {
+        if (id_ != heartbeat_ivl_timer_id)
+            return;
+
+        //  The peer answered the previous ping.
+        if (_has_timeout)
+            _timers->cancel (this, heartbeat_timeout_timer_id);
+        _timers->add (*_now, heartbeat_timeout, this,
+                      heartbeat_timeout_timer_id);
+        _has_timeout = true;
+        _timers->add (*_now, heartbeat_ivl, this, heartbeat_ivl_timer_id);
+    }
+
+  private:
+    T *_timers;
+    const uint64_t *_now;
+    bool _has_timeout;
+};
+
+template <class T> void benchmark (int connections_, int seconds_)
+{
+    T timers;
+    uint64_t now = 0;
+    std::vector<connection_t<T> > conns (connections_);
+
+    void *watch = zmq_stopwatch_start ();
+
+    for (int i = 0; i != connections_; ++i)
+        conns[i].start (&timers, &now, 1 + i % heartbeat_ivl);
+    for (int i = 0; i != connections_; ++i)
+        conns[i].handshake_done ();
+
+    const uint64_t end = static_cast<uint64_t> (seconds_) * 1000;
+    while (now < end) {
+        const uint64_t wait = timers.execute (now);
+        now += wait ? wait : 1;
+    }
+
+    const unsigned long elapsed = zmq_stopwatch_stop (watch);
+
+    //  Each heartbeat fires a timer, cancels one and adds two.
+    const double heartbeats =
+      static_cast<double> (connections_) * end / heartbeat_ivl;
+    const double operations = 4.0 * connections_ + 4.0 * heartbeats;
+    printf ("time = %.1f ms, operations = %.0f, %.1f ns per operation\n",
+            elapsed / 1000.0, operations, elapsed * 1000.0 / operations);
+}
+
+int main (int argc, char *argv[])
+{
+    if (argc > 3) {
+        printf ("usage: benchmark_timers [connections] [seconds]\n");
+        return 1;
+    }
+    const int connections = argc > 1 ? atoi (argv[1]) : 10000;
+    const int seconds = argc > 2 ? atoi (argv[2]) : 10;
+
+    printf ("connections = %d, heartbeat interval = %d ms, time = %d s\n",
+            connections, heartbeat_ivl, seconds);
+    puts ("[multimap]");
+    benchmark<multimap_timers_t> (connections, seconds);
+    puts ("[timer_wheel]");
+    benchmark<zmq::timer_wheel_t> (connections, seconds);
+    return 0;
+}
@@ -0,0 +1,84 @@
+/*
+    Copyright (c) 2007-2016 Contributors as noted in the AUTHORS file
+
+    This file is part of libzmq, the ZeroMQ core engine in C++.
+
+    libzmq is free software; you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    As a special exception, the Contributors give you permission to link
+    this library with independent modules to produce an executable,
+    regardless of the license terms of these independent modules, and to
+    copy and distribute the resulting executable under terms of your choice,
+    provided that you also meet, for each linked independent module, the
+    terms and conditions of the license of that module. An independent
+    module is a module which is not derived from or based on this library.
+    If you modify this library, you must extend this exception to your
+    version of the library.
+
+    libzmq is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "ws_mask.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <vector>
+
+//  Compares the WebSocket masking kernel with a byte by byte loop, for
+//  payloads of various sizes. The throughput of the whole ws transport can
+//  be measured with local_thr and remote_thr on a ws:// endpoint.
+
+const std::size_t total_bytes = 1024 * 1024 * 1024;
+const std::size_t sizes[] = {16, 64, 256, 1024, 4096, 65536, 1048576};
+
+static void mask_bytewise (unsigned char *dest_,
+                           const unsigned char *src_,
+                           std::size_t size_,
+                           const unsigned char *mask_,
+                           std::size_t offset_)
+{
+    for (std::size_t i = 0; i < size_; ++i)
+        dest_[i] = src_[i] ^ mask_[(offset_ + i) % 4];
+}
+
+template <class F> double measure (F func_, std::size_t size_)
+{
+    using namespace std::chrono;
+    std::vector<unsigned char> buf (size_, 0x5a);
+    const unsigned char mask[4] = {0x12, 0x34, 0x56, 0x78};
+    const std::size_t iterations = total_bytes / size_;
+
+    const steady_clock::time_point start = steady_clock::now ();
+    for (std::size_t i = 0; i != iterations; ++i)
+        func_ (&buf[0], &buf[0], size_, mask, 1);
+    const duration<double> elapsed = steady_clock::now () - start;
+
+    //  Keep the compiler from discarding the work.
+    volatile unsigned char sink = buf[size_ / 2];
+    (void) sink;
+
+    return static_cast<double> (iterations * size_) / elapsed.count () / 1e9;
+}
+
+int main ()
+{
+    std::printf ("# size[B],bytewise[GB/s],ws_mask[GB/s],speedup\n");
+    for (std::size_t i = 0; i != sizeof sizes / sizeof sizes[0]; ++i) {
+        const double bytewise = measure (mask_bytewise, sizes[i]);
+        const double kernel = measure (zmq::ws_mask, sizes[i]);
+        std::printf ("%zu,%.2f,%.2f,%.2f\n", sizes[i], bytewise, kernel,
+                     kernel / bytewise);
+    }
+    return 0;
+}
@@ -0,0 +1,63 @@
+#!/bin/bash
+
+#
+# This script measures the TCP throughput of a libzmq build with and without
+# CURVE security, to make regressions in the CURVE data phase visible.
+# Both local_thr and remote_thr run on this machine, over the loopback
+# interface by default.
+#
+# Usage example:
+#    cmake -S . -B build -DWITH_PERF_TOOL=ON && cmake --build build
+#    ./perf/compare_curve.sh build/bin
+#
+
+set -u
+
+if [ $# -ne 1 ]; then
+    echo "usage: $0 <perf-dir>"
+    exit 1
+fi
+
+PERF_DIR="$1"
+
+# configurable values (via environment variables):
+TEST_ENDPOINT=${TEST_ENDPOINT:-tcp://127.0.0.1:5555}
+MESSAGE_SIZE_LIST=${MESSAGE_SIZE_LIST:-"8 64 256 1024 4096 16384 65536"}
+NUM_MESSAGES=${NUM_MESSAGES:-1000000}
+
+
+# utility functions:
+
+# prints the throughput in msg/s, with CURVE enabled if the 2nd arg is 1
+function measure_throughput()
+{
+    local MESSAGE_SIZE="$1"
+    local CURVE="$2"
+    local OUTPUT_FILE
+    OUTPUT_FILE="$(mktemp)"
+
+    "$PERF_DIR/local_thr" $TEST_ENDPOINT $MESSAGE_SIZE $NUM_MESSAGES $CURVE >$OUTPUT_FILE &
+    local LOCAL_PID=$!
+    "$PERF_DIR/remote_thr" $TEST_ENDPOINT $MESSAGE_SIZE $NUM_MESSAGES $CURVE
+    wait $LOCAL_PID
+
+    grep -o '[0-9]* \[msg/s\]' $OUTPUT_FILE | grep -o '[0-9]*'
+    rm -f $OUTPUT_FILE
+}
+
+
+
+# main:
+
+if [ ! -x "$PERF_DIR/local_thr" ] || [ ! -x "$PERF_DIR/remote_thr" ]; then
+    echo "The folder $PERF_DIR does not contain local_thr and remote_thr. Please fix the problem and retry."
+    exit 2
+fi
+
+echo "# message_size,null[msg/s],curve[msg/s],curve/null"
+for MESSAGE_SIZE in $MESSAGE_SIZE_LIST; do
+    NULL_THR=$(measure_throughput $MESSAGE_SIZE 0)
+    CURVE_THR=$(measure_throughput $MESSAGE_SIZE 1)
+    RATIO=$(awk "BEGIN { printf \"%.2f\", $CURVE_THR / $NULL_THR }")
+    echo "$MESSAGE_SIZE,$NULL_THR,$CURVE_THR,$RATIO"
+done
@@ -0,0 +1,78 @@
+#!/bin/bash
+
+#
+# This script compares the TCP throughput of two libzmq builds which differ
+# only in the I/O thread polling system, e.g. epoll versus io_uring.
+# Both local_thr and remote_thr run on this machine, over the loopback
+# interface by default.
+#
+# With the io_uring poller, stream engines receive and send through the
+# ring, into and out of buffers the poller owns, which saves system calls
+# per batch. Bodies of large messages mostly bypass the buffers, so expect
+# differences to shrink as messages grow.
+#
+# Usage example:
+#    cmake -S . -B build-epoll -DPOLLER=epoll && cmake --build build-epoll
+#    cmake -S . -B build-io_uring -DPOLLER=io_uring && cmake --build build-io_uring
+#    ./perf/compare_pollers.sh build-epoll/bin build-io_uring/bin
+#
+
+set -u
+
+if [ $# -ne 2 ]; then
+    echo "usage: $0 <baseline-perf-dir> <candidate-perf-dir>"
+    exit 1
+fi
+
+BASELINE_DIR="$1"
+CANDIDATE_DIR="$2"
+
+# configurable values (via environment variables):
+TEST_ENDPOINT=${TEST_ENDPOINT:-tcp://127.0.0.1:5555}
+MESSAGE_SIZE_LIST=${MESSAGE_SIZE_LIST:-"8 64 256 1024 4096 16384 65536"}
+NUM_MESSAGES=${NUM_MESSAGES:-1000000}
+
+
+# utility functions:
+
+function verify_perf_dir()
+{
+    local PERF_DIR="$1"
+
+    if [ ! -x "$PERF_DIR/local_thr" ] || [ ! -x "$PERF_DIR/remote_thr" ]; then
+        echo "The folder $PERF_DIR does not contain local_thr and remote_thr. Please fix the problem and retry."
+        exit 2
+    fi
+}
+
+# prints the throughput in msg/s measured by the given build
+function measure_throughput()
+{
+    local PERF_DIR="$1"
+    local MESSAGE_SIZE="$2"
+    local OUTPUT_FILE
+    OUTPUT_FILE="$(mktemp)"
+
+    "$PERF_DIR/local_thr" $TEST_ENDPOINT $MESSAGE_SIZE $NUM_MESSAGES >$OUTPUT_FILE &
+    local LOCAL_PID=$!
+    "$PERF_DIR/remote_thr" $TEST_ENDPOINT $MESSAGE_SIZE $NUM_MESSAGES
+    wait $LOCAL_PID
+
+    grep -o '[0-9]* \[msg/s\]' $OUTPUT_FILE | grep -o '[0-9]*'
+    rm -f $OUTPUT_FILE
+}
+
+
+
+# main:
+
+verify_perf_dir "$BASELINE_DIR"
+verify_perf_dir "$CANDIDATE_DIR"
+
+echo "# message_size,baseline[msg/s],candidate[msg/s],speedup"
+for MESSAGE_SIZE in $MESSAGE_SIZE_LIST; do
+    BASELINE=$(measure_throughput "$BASELINE_DIR" $MESSAGE_SIZE)
+    CANDIDATE=$(measure_throughput "$CANDIDATE_DIR" $MESSAGE_SIZE)
+    SPEEDUP=$(awk "BEGIN { printf \"%.2f\", $CANDIDATE / $BASELINE }")
+    echo "$MESSAGE_SIZE,$BASELINE,$CANDIDATE,$SPEEDUP"
+done
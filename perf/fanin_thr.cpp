@@ -0,0 +1,216 @@
+/*
+    Copyright (c) 2007-2016 Contributors as noted in the AUTHORS file
+
+    This file is part of libzmq, the ZeroMQ core engine in C++.
+
+    libzmq is free software; you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    As a special exception, the Contributors give you permission to link
+    this library with independent modules to produce an executable,
+    regardless of the license terms of these independent modules, and to
+    copy and distribute the resulting executable under terms of your choice,
+    provided that you also meet, for each linked independent module, the
+    terms and conditions of the license of that module. An independent
+    module is a module which is not derived from or based on this library.
+    If you modify this library, you must extend this exception to your
+    version of the library.
+
+    libzmq is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "../include/zmq.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//  Measures fair queueing on a PULL socket with many connected PUSH peers,
+//  of which only some are sending. The senders send in bursts, so that
+//  their pipes keep being deactivated and activated again. In every burst,
+//  half of the messages are received first and the spread between the
+//  senders which got the most and the fewest of them is recorded. With
+//  perfectly fair queueing the spread is at most 1.
+
+#define BURST_SIZE 16
+
+int main (int argc, char *argv[])
+{
+    int peer_count;
+    int active_count;
+    int message_size;
+    int message_count;
+    int round_count;
+    void *ctx;
+    void *pull;
+    void **pushes;
+    int *received;
+    char *buf;
+    int rc;
+    int i;
+    int j;
+    int round;
+    int zero = 0;
+    int max_spread = 0;
+    void *watch;
+    unsigned long elapsed;
+    double throughput;
+
+    if (argc != 5) {
+        printf ("usage: fanin_thr <peer-count> <active-peer-count> "
+                "<message-size> <message-count>\n");
+        return 1;
+    }
+    peer_count = atoi (argv[1]);
+    active_count = atoi (argv[2]);
+    message_size = atoi (argv[3]);
+    message_count = atoi (argv[4]);
+    if (peer_count < 1 || active_count < 1 || active_count > peer_count
+        || message_size < (int) sizeof (int) || message_count < 1) {
+        printf ("error: invalid arguments\n");
+        return 1;
+    }
+    round_count = message_count / (active_count * BURST_SIZE);
+    if (round_count < 1)
+        round_count = 1;
+
+    ctx = zmq_init (1);
+    if (!ctx) {
+        printf ("error in zmq_init: %s\n", zmq_strerror (errno));
+        return -1;
+    }
+
+    rc = zmq_ctx_set (ctx, ZMQ_MAX_SOCKETS, peer_count + 1);
+    if (rc != 0) {
+        printf ("error in zmq_ctx_set: %s\n", zmq_strerror (errno));
+        return -1;
+    }
+
+    pull = zmq_socket (ctx, ZMQ_PULL);
+    if (!pull) {
+        printf ("error in zmq_socket: %s\n", zmq_strerror (errno));
+        return -1;
+    }
+
+    rc = zmq_bind (pull, "inproc://fanin_thr");
+    if (rc != 0) {
+        printf ("error in zmq_bind: %s\n", zmq_strerror (errno));
+        return -1;
+    }
+
+    pushes = (void **) malloc (peer_count * sizeof (void *));
+    received = (int *) malloc (active_count * sizeof (int));
+    buf = (char *) malloc (message_size);
+    if (!pushes || !received || !buf) {
+        printf ("error in malloc\n");
+        return -1;
+    }
+    memset (buf, 0, message_size);
+
+    for (i = 0; i != peer_count; i++) {
+        pushes[i] = zmq_socket (ctx, ZMQ_PUSH);
+        if (!pushes[i]) {
+            printf ("error in zmq_socket: %s\n", zmq_strerror (errno));
+            return -1;
+        }
+        rc = zmq_setsockopt (pushes[i], ZMQ_SNDHWM, &zero, sizeof (zero));
+        if (rc != 0) {
+            printf ("error in zmq_setsockopt: %s\n", zmq_strerror (errno));
+            return -1;
+        }
+        rc = zmq_connect (pushes[i], "inproc://fanin_thr");
+        if (rc != 0) {
+            printf ("error in zmq_connect: %s\n", zmq_strerror (errno));
+            return -1;
+        }
+    }
+
+    watch = zmq_stopwatch_start ();
+
+    for (round = 0; round != round_count; round++) {
+        //  The active peers are spread evenly among all the peers.
+        for (i = 0; i != active_count; i++) {
+            memcpy (buf, &i, sizeof (i));
+            for (j = 0; j != BURST_SIZE; j++) {
+                rc = zmq_send (pushes[i * (peer_count / active_count)], buf,
+                               message_size, 0);
+                if (rc < 0) {
+                    printf ("error in zmq_send: %s\n", zmq_strerror (errno));
+                    return -1;
+                }
+            }
+        }
+
+        memset (received, 0, active_count * sizeof (int));
+        for (j = 0; j != active_count * BURST_SIZE; j++) {
+            int sender;
+            rc = zmq_recv (pull, buf, message_size, 0);
+            if (rc < 0) {
+                printf ("error in zmq_recv: %s\n", zmq_strerror (errno));
+                return -1;
+            }
+            memcpy (&sender, buf, sizeof (sender));
+            if (j < active_count * BURST_SIZE / 2)
+                received[sender]++;
+        }
+
+        int min = received[0];
+        int max = received[0];
+        for (i = 1; i != active_count; i++) {
+            if (received[i] < min)
+                min = received[i];
+            if (received[i] > max)
+                max = received[i];
+        }
+        if (max - min > max_spread)
+            max_spread = max - min;
+    }
+
+    elapsed = zmq_stopwatch_stop (watch);
+    if (elapsed == 0)
+        elapsed = 1;
+
+    message_count = round_count * active_count * BURST_SIZE;
+    throughput = ((double) message_count / (double) elapsed * 1000000);
+
+    printf ("peer count: %d\n", peer_count);
+    printf ("active peer count: %d\n", active_count);
+    printf ("message size: %d [B]\n", message_size);
+    printf ("message count: %d\n", message_count);
+    printf ("mean throughput: %d [msg/s]\n", (int) throughput);
+    printf ("max spread: %d [msg]\n", max_spread);
+
+    for (i = 0; i != peer_count; i++) {
+        rc = zmq_close (pushes[i]);
+        if (rc != 0) {
+            printf ("error in zmq_close: %s\n", zmq_strerror (errno));
+            return -1;
+        }
+    }
+
+    rc = zmq_close (pull);
+    if (rc != 0) {
+        printf ("error in zmq_close: %s\n", zmq_strerror (errno));
+        return -1;
+    }
+
+    rc = zmq_ctx_term (ctx);
+    if (rc != 0) {
+        printf ("error in zmq_ctx_term: %s\n", zmq_strerror (errno));
+        return -1;
+    }
+
+    free (buf);
+    free (received);
+    free (pushes);
+
+    return 0;
+}
@@ -46,6 +46,80 @@
 
 static int message_count;
 static size_t message_size;
+static int batch_size = 1;
+
+#ifdef ZMQ_BUILD_DRAFT_API
+//  Sends message_count messages with zmq_send_batch, batch_size at a time.
+static void send_batched (void *s_)
+{
+    zmq_msg_t *msgs = (zmq_msg_t *) malloc (batch_size * sizeof (zmq_msg_t));
+    if (!msgs) {
+        printf ("error in malloc\n");
+        exit (1);
+    }
+
+    for (int i = 0; i != message_count;) {
+        const int count =
+          message_count - i < batch_size ? message_count - i : batch_size;
+        for (int j = 0; j != count; j++) {
+            const int rc = zmq_msg_init_size (&msgs[j], message_size);
+            if (rc != 0) {
+                printf ("error in zmq_msg_init_size: %s\n",
+                        zmq_strerror (errno));
+                exit (1);
+            }
+#if defined ZMQ_MAKE_VALGRIND_HAPPY
+            memset (zmq_msg_data (&msgs[j]), 0, message_size);
+#endif
+        }
+
+        //  A blocking batch only returns early on an error or timeout.
+        for (int sent = 0; sent != count;) {
+            const int rc = zmq_send_batch (s_, msgs + sent, count - sent, 0);
+            if (rc < 0) {
+                printf ("error in zmq_send_batch: %s\n", zmq_strerror (errno));
+                exit (1);
+            }
+            sent += rc;
+        }
+        i += count;
+    }
+
+    free (msgs);
+}
+
+//  Receives count_ messages with zmq_recv_batch, batch_size at a time.
+static void recv_batched (void *s_, int count_)
+{
+    zmq_msg_t *msgs = (zmq_msg_t *) malloc (batch_size * sizeof (zmq_msg_t));
+    if (!msgs) {
+        printf ("error in malloc\n");
+        exit (1);
+    }
+    for (int j = 0; j != batch_size; j++)
+        zmq_msg_init (&msgs[j]);
+
+    for (int i = 0; i != count_;) {
+        const int count = count_ - i < batch_size ? count_ - i : batch_size;
+        const int rc = zmq_recv_batch (s_, msgs, count, 0);
+        if (rc < 0) {
+            printf ("error in zmq_recv_batch: %s\n", zmq_strerror (errno));
+            exit (1);
+        }
+        for (int j = 0; j != rc; j++) {
+            if (zmq_msg_size (&msgs[j]) != message_size) {
+                printf ("message of incorrect size received\n");
+                exit (1);
+            }
+        }
+        i += rc;
+    }
+
+    for (int j = 0; j != batch_size; j++)
+        zmq_msg_close (&msgs[j]);
+    free (msgs);
+}
+#endif
 
 #if defined ZMQ_HAVE_WINDOWS
 static unsigned int __stdcall worker (void *ctx_)
@@ -70,25 +144,32 @@ static void *worker (void *ctx_)
         exit (1);
     }
 
-    for (i = 0; i != message_count; i++) {
-        rc = zmq_msg_init_size (&msg, message_size);
-        if (rc != 0) {
-            printf ("error in zmq_msg_init_size: %s\n", zmq_strerror (errno));
-            exit (1);
-        }
+    if (batch_size > 1) {
+#ifdef ZMQ_BUILD_DRAFT_API
+        send_batched (s);
+#endif
+    } else {
+        for (i = 0; i != message_count; i++) {
+            rc = zmq_msg_init_size (&msg, message_size);
+            if (rc != 0) {
+                printf ("error in zmq_msg_init_size: %s\n",
+                        zmq_strerror (errno));
+                exit (1);
+            }
 #if defined ZMQ_MAKE_VALGRIND_HAPPY
-        memset (zmq_msg_data (&msg), 0, message_size);
+            memset (zmq_msg_data (&msg), 0, message_size);
 #endif
 
-        rc = zmq_sendmsg (s, &msg, 0);
-        if (rc < 0) {
-            printf ("error in zmq_sendmsg: %s\n", zmq_strerror (errno));
-            exit (1);
-        }
-        rc = zmq_msg_close (&msg);
-        if (rc != 0) {
-            printf ("error in zmq_msg_close: %s\n", zmq_strerror (errno));
-            exit (1);
+            rc = zmq_sendmsg (s, &msg, 0);
+            if (rc < 0) {
+                printf ("error in zmq_sendmsg: %s\n", zmq_strerror (errno));
+                exit (1);
+            }
+            rc = zmq_msg_close (&msg);
+            if (rc != 0) {
+                printf ("error in zmq_msg_close: %s\n", zmq_strerror (errno));
+                exit (1);
+            }
         }
     }
 
@@ -122,13 +203,26 @@ int main (int argc, char *argv[])
     unsigned long throughput;
     double megabits;
 
-    if (argc != 3) {
-        printf ("usage: inproc_thr <message-size> <message-count>\n");
+    if (argc != 3 && argc != 4) {
+        printf ("usage: inproc_thr <message-size> <message-count> "
+                "[<batch-size>]\n");
         return 1;
     }
 
     message_size = atoi (argv[1]);
     message_count = atoi (argv[2]);
+    if (argc >= 4)
+        batch_size = atoi (argv[3]);
+    if (batch_size < 1) {
+        printf ("batch size must be at least 1\n");
+        return 1;
+    }
+#ifndef ZMQ_BUILD_DRAFT_API
+    if (batch_size > 1) {
+        printf ("batched mode needs the draft API\n");
+        return 1;
+    }
+#endif
 
     ctx = zmq_init (1);
     if (!ctx) {
@@ -170,6 +264,8 @@ int main (int argc, char *argv[])
 
     printf ("message size: %d [B]\n", (int) message_size);
     printf ("message count: %d\n", (int) message_count);
+    if (batch_size > 1)
+        printf ("batch size: %d\n", batch_size);
 
     rc = zmq_recvmsg (s, &msg, 0);
     if (rc < 0) {
@@ -183,15 +279,21 @@ int main (int argc, char *argv[])
 
     watch = zmq_stopwatch_start ();
 
-    for (i = 0; i != message_count - 1; i++) {
-        rc = zmq_recvmsg (s, &msg, 0);
-        if (rc < 0) {
-            printf ("error in zmq_recvmsg: %s\n", zmq_strerror (errno));
-            return -1;
-        }
-        if (zmq_msg_size (&msg) != message_size) {
-            printf ("message of incorrect size received\n");
-            return -1;
+    if (batch_size > 1) {
+#ifdef ZMQ_BUILD_DRAFT_API
+        recv_batched (s, message_count - 1);
+#endif
+    } else {
+        for (i = 0; i != message_count - 1; i++) {
+            rc = zmq_recvmsg (s, &msg, 0);
+            if (rc < 0) {
+                printf ("error in zmq_recvmsg: %s\n", zmq_strerror (errno));
+                return -1;
+            }
+            if (zmq_msg_size (&msg) != message_size) {
+                printf ("message of incorrect size received\n");
+                return -1;
+            }
         }
     }
 
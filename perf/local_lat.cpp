@@ -41,15 +41,18 @@ int main (int argc, char *argv[])
     int rc;
     int i;
     zmq_msg_t msg;
+    int busy_poll = 0;
 
-    if (argc != 4) {
+    if (argc != 4 && argc != 5) {
         printf ("usage: local_lat <bind-to> <message-size> "
-                "<roundtrip-count>\n");
+                "<roundtrip-count> [<busy-poll-us>]\n");
         return 1;
     }
     bind_to = argv[1];
     message_size = atoi (argv[2]);
     roundtrip_count = atoi (argv[3]);
+    if (argc >= 5)
+        busy_poll = atoi (argv[4]);
 
     ctx = zmq_init (1);
     if (!ctx) {
@@ -57,6 +60,19 @@ int main (int argc, char *argv[])
         return -1;
     }
 
+#ifdef ZMQ_BUSY_POLL
+    rc = zmq_ctx_set (ctx, ZMQ_BUSY_POLL, busy_poll);
+    if (rc != 0) {
+        printf ("error in zmq_ctx_set: %s\n", zmq_strerror (errno));
+        return -1;
+    }
+#else
+    if (busy_poll) {
+        printf ("busy polling needs the draft API\n");
+        return 1;
+    }
+#endif
+
     s = zmq_socket (ctx, ZMQ_REP);
     if (!s) {
         printf ("error in zmq_socket: %s\n", zmq_strerror (errno));
@@ -49,10 +49,11 @@ int main (int argc, char *argv[])
     double throughput;
     double megabits;
     int curve = 0;
+    int batch_size = 1;
 
-    if (argc != 4 && argc != 5) {
+    if (argc < 4 || argc > 6) {
         printf ("usage: local_thr <bind-to> <message-size> <message-count> "
-                "[<enable_curve>]\n");
+                "[<enable_curve>] [<batch-size>]\n");
         return 1;
     }
     bind_to = argv[1];
@@ -61,6 +62,18 @@ int main (int argc, char *argv[])
     if (argc >= 5 && atoi (argv[4])) {
         curve = 1;
     }
+    if (argc >= 6)
+        batch_size = atoi (argv[5]);
+    if (batch_size < 1) {
+        printf ("batch size must be at least 1\n");
+        return 1;
+    }
+#ifndef ZMQ_BUILD_DRAFT_API
+    if (batch_size > 1) {
+        printf ("batched mode needs the draft API\n");
+        return 1;
+    }
+#endif
 
     ctx = zmq_init (1);
     if (!ctx) {
@@ -115,15 +128,51 @@ int main (int argc, char *argv[])
 
     watch = zmq_stopwatch_start ();
 
-    for (i = 0; i != message_count - 1; i++) {
-        rc = zmq_recvmsg (s, &msg, 0);
-        if (rc < 0) {
-            printf ("error in zmq_recvmsg: %s\n", zmq_strerror (errno));
+    if (batch_size > 1) {
+#ifdef ZMQ_BUILD_DRAFT_API
+        //  Receive whatever is queued, up to batch_size messages per call.
+        zmq_msg_t *msgs =
+          (zmq_msg_t *) malloc (batch_size * sizeof (zmq_msg_t));
+        if (!msgs) {
+            printf ("error in malloc\n");
             return -1;
         }
-        if (zmq_msg_size (&msg) != message_size) {
-            printf ("message of incorrect size received\n");
-            return -1;
+        for (i = 0; i != batch_size; i++)
+            zmq_msg_init (&msgs[i]);
+
+        for (i = 0; i != message_count - 1; i += rc) {
+            const int remaining = message_count - 1 - i;
+            rc = zmq_recv_batch (s, msgs,
+                                 remaining < batch_size ? remaining
+                                                        : batch_size,
+                                 0);
+            if (rc < 0) {
+                printf ("error in zmq_recv_batch: %s\n", zmq_strerror (errno));
+                return -1;
+            }
+            for (int j = 0; j != rc; j++) {
+                if (zmq_msg_size (&msgs[j]) != message_size) {
+                    printf ("message of incorrect size received\n");
+                    return -1;
+                }
+            }
+        }
+
+        for (i = 0; i != batch_size; i++)
+            zmq_msg_close (&msgs[i]);
+        free (msgs);
+#endif
+    } else {
+        for (i = 0; i != message_count - 1; i++) {
+            rc = zmq_recvmsg (s, &msg, 0);
+            if (rc < 0) {
+                printf ("error in zmq_recvmsg: %s\n", zmq_strerror (errno));
+                return -1;
+            }
+            if (zmq_msg_size (&msg) != message_size) {
+                printf ("message of incorrect size received\n");
+                return -1;
+            }
         }
     }
 
@@ -142,6 +191,8 @@ int main (int argc, char *argv[])
 
     printf ("message size: %d [B]\n", (int) message_size);
     printf ("message count: %d\n", (int) message_count);
+    if (batch_size > 1)
+        printf ("batch size: %d\n", batch_size);
     printf ("mean throughput: %d [msg/s]\n", (int) throughput);
     printf ("mean throughput: %.3f [Mb/s]\n", (double) megabits);
 
@@ -0,0 +1,201 @@
+/*
+    Copyright (c) 2007-2016 Contributors as noted in the AUTHORS file
+
+    This file is part of libzmq, the ZeroMQ core engine in C++.
+
+    libzmq is free software; you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    As a special exception, the Contributors give you permission to link
+    this library with independent modules to produce an executable,
+    regardless of the license terms of these independent modules, and to
+    copy and distribute the resulting executable under terms of your choice,
+    provided that you also meet, for each linked independent module, the
+    terms and conditions of the license of that module. An independent
+    module is a module which is not derived from or based on this library.
+    If you modify this library, you must extend this exception to your
+    version of the library.
+
+    libzmq is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../include/zmq.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined __linux__
+#include <sched.h>
+#endif
+
+//  Measures TCP throughput between a sender and a receiver thread pinned
+//  to given NUMA nodes, in a context in NUMA mode (ZMQ_NUMA). Each socket
+//  uses the I/O threads of the node it was created on, so running with
+//  the same node twice and with two different nodes compares local with
+//  cross-node throughput.
+
+#ifndef ZMQ_NUMA
+#define ZMQ_NUMA 18
+#endif
+
+struct sender_t
+{
+    void *ctx;
+    int node;
+    size_t message_size;
+    int message_count;
+};
+
+static void die (const char *what_)
+{
+    printf ("error in %s: %s\n", what_, zmq_strerror (errno));
+    exit (1);
+}
+
+//  Moves the calling thread to the CPUs of NUMA node node_.
+static void pin_to_node (int node_)
+{
+#if defined __linux__
+    char path[64];
+    snprintf (path, sizeof path, "/sys/devices/system/node/node%d/cpulist",
+              node_);
+    FILE *file = fopen (path, "r");
+    if (!file) {
+        printf ("error: no NUMA node %d\n", node_);
+        exit (1);
+    }
+    char list[4096];
+    const bool ok = fgets (list, sizeof list, file) != NULL;
+    fclose (file);
+    if (!ok)
+        die ("fgets");
+
+    cpu_set_t cpus;
+    CPU_ZERO (&cpus);
+    const char *pos = list;
+    while (*pos >= '0' && *pos <= '9') {
+        char *end;
+        const int first = (int) strtol (pos, &end, 10);
+        int last = first;
+        if (*end == '-')
+            last = (int) strtol (end + 1, &end, 10);
+        for (int cpu = first; cpu <= last; cpu++)
+            CPU_SET (cpu, &cpus);
+        pos = *end == ',' ? end + 1 : end;
+    }
+    if (sched_setaffinity (0, sizeof cpus, &cpus) != 0)
+        die ("sched_setaffinity");
+#else
+    (void) node_;
+    printf ("error: pinning threads to NUMA nodes needs Linux\n");
+    exit (1);
+#endif
+}
+
+static void sender (void *arg_)
+{
+    sender_t *args = (sender_t *) arg_;
+    pin_to_node (args->node);
+
+    void *s = zmq_socket (args->ctx, ZMQ_PUSH);
+    if (!s)
+        die ("zmq_socket");
+    if (zmq_connect (s, "tcp://127.0.0.1:5599") != 0)
+        die ("zmq_connect");
+
+    for (int i = 0; i != args->message_count; i++) {
+        zmq_msg_t msg;
+        if (zmq_msg_init_size (&msg, args->message_size) != 0)
+            die ("zmq_msg_init_size");
+        memset (zmq_msg_data (&msg), 0, args->message_size);
+        if (zmq_sendmsg (s, &msg, 0) < 0)
+            die ("zmq_sendmsg");
+    }
+
+    if (zmq_close (s) != 0)
+        die ("zmq_close");
+}
+
+int main (int argc, char *argv[])
+{
+    if (argc != 6) {
+        printf ("usage: numa_thr <message-size> <message-count> "
+                "<io-threads> <sender-node> <receiver-node>\n");
+        return 1;
+    }
+    const size_t message_size = (size_t) atoi (argv[1]);
+    const int message_count = atoi (argv[2]);
+    const int io_threads = atoi (argv[3]);
+    sender_t args;
+    args.node = atoi (argv[4]);
+    const int receiver_node = atoi (argv[5]);
+    args.message_size = message_size;
+    args.message_count = message_count;
+    if (message_count < 1 || io_threads < 1) {
+        printf ("error: invalid arguments\n");
+        return 1;
+    }
+
+    void *ctx = zmq_ctx_new ();
+    if (!ctx)
+        die ("zmq_ctx_new");
+    if (zmq_ctx_set (ctx, ZMQ_IO_THREADS, io_threads) != 0)
+        die ("zmq_ctx_set");
+    if (zmq_ctx_set (ctx, ZMQ_NUMA, 1) != 0)
+        die ("zmq_ctx_set");
+    args.ctx = ctx;
+
+    pin_to_node (receiver_node);
+    void *s = zmq_socket (ctx, ZMQ_PULL);
+    if (!s)
+        die ("zmq_socket");
+    if (zmq_bind (s, "tcp://127.0.0.1:5599") != 0)
+        die ("zmq_bind");
+
+    zmq_msg_t msg;
+    if (zmq_msg_init (&msg) != 0)
+        die ("zmq_msg_init");
+
+    void *thread = zmq_threadstart (sender, &args);
+
+    if (zmq_recvmsg (s, &msg, 0) < 0)
+        die ("zmq_recvmsg");
+    void *watch = zmq_stopwatch_start ();
+    for (int i = 1; i != message_count; i++)
+        if (zmq_recvmsg (s, &msg, 0) < 0)
+            die ("zmq_recvmsg");
+    unsigned long elapsed = zmq_stopwatch_stop (watch);
+    if (elapsed == 0)
+        elapsed = 1;
+
+    zmq_threadclose (thread);
+
+    const double throughput =
+      (double) (message_count - 1) / (double) elapsed * 1000000;
+    const double megabits = throughput * message_size * 8 / 1000000;
+
+    printf ("sender node: %d\n", args.node);
+    printf ("receiver node: %d\n", receiver_node);
+    printf ("message size: %d [B]\n", (int) message_size);
+    printf ("message count: %d\n", message_count);
+    printf ("mean throughput: %d [msg/s]\n", (int) throughput);
+    printf ("mean throughput: %.3f [Mb/s]\n", megabits);
+
+    if (zmq_msg_close (&msg) != 0)
+        die ("zmq_msg_close");
+    if (zmq_close (s) != 0)
+        die ("zmq_close");
+    if (zmq_ctx_term (ctx) != 0)
+        die ("zmq_ctx_term");
+
+    return 0;
+}
@@ -32,6 +32,23 @@
 #include <stdlib.h>
 #include <string.h>
 
+static int compare_samples (const void *lhs_, const void *rhs_)
+{
+    const unsigned long lhs = *(const unsigned long *) lhs_;
+    const unsigned long rhs = *(const unsigned long *) rhs_;
+    return lhs < rhs ? -1 : lhs > rhs ? 1 : 0;
+}
+
+//  Returns the p-th percentile of the sorted samples, halved to match the
+//  one-way average latency.
+static double percentile (const unsigned long *samples_, int count_, double p_)
+{
+    int index = (int) (p_ / 100 * count_);
+    if (index >= count_)
+        index = count_ - 1;
+    return (double) samples_[index] / 2;
+}
+
 int main (int argc, char *argv[])
 {
     const char *connect_to;
@@ -45,15 +62,32 @@ int main (int argc, char *argv[])
     void *watch;
     unsigned long elapsed;
     double latency;
+    unsigned long *samples;
+    unsigned long last;
+    unsigned long now;
+    int busy_poll = 0;
 
-    if (argc != 4) {
+    if (argc != 4 && argc != 5) {
         printf ("usage: remote_lat <connect-to> <message-size> "
-                "<roundtrip-count>\n");
+                "<roundtrip-count> [<busy-poll-us>]\n");
         return 1;
     }
     connect_to = argv[1];
     message_size = atoi (argv[2]);
     roundtrip_count = atoi (argv[3]);
+    if (argc >= 5)
+        busy_poll = atoi (argv[4]);
+    if (roundtrip_count <= 0) {
+        printf ("roundtrip count must be positive\n");
+        return 1;
+    }
+
+    samples =
+      (unsigned long *) malloc (roundtrip_count * sizeof (unsigned long));
+    if (!samples) {
+        printf ("error in malloc\n");
+        return -1;
+    }
 
     ctx = zmq_init (1);
     if (!ctx) {
@@ -61,6 +95,19 @@ int main (int argc, char *argv[])
         return -1;
     }
 
+#ifdef ZMQ_BUSY_POLL
+    rc = zmq_ctx_set (ctx, ZMQ_BUSY_POLL, busy_poll);
+    if (rc != 0) {
+        printf ("error in zmq_ctx_set: %s\n", zmq_strerror (errno));
+        return -1;
+    }
+#else
+    if (busy_poll) {
+        printf ("busy polling needs the draft API\n");
+        return 1;
+    }
+#endif
+
     s = zmq_socket (ctx, ZMQ_REQ);
     if (!s) {
         printf ("error in zmq_socket: %s\n", zmq_strerror (errno));
@@ -81,6 +128,7 @@ int main (int argc, char *argv[])
     memset (zmq_msg_data (&msg), 0, message_size);
 
     watch = zmq_stopwatch_start ();
+    last = 0;
 
     for (i = 0; i != roundtrip_count; i++) {
         rc = zmq_sendmsg (s, &msg, 0);
@@ -97,6 +145,9 @@ int main (int argc, char *argv[])
             printf ("message of incorrect size received\n");
             return -1;
         }
+        now = zmq_stopwatch_intermediate (watch);
+        samples[i] = now - last;
+        last = now;
     }
 
     elapsed = zmq_stopwatch_stop (watch);
@@ -113,6 +164,16 @@ int main (int argc, char *argv[])
     printf ("roundtrip count: %d\n", (int) roundtrip_count);
     printf ("average latency: %.3f [us]\n", (double) latency);
 
+    qsort (samples, roundtrip_count, sizeof (unsigned long), compare_samples);
+    printf ("latency percentiles: p50 %.1f, p90 %.1f, p99 %.1f, "
+            "p99.9 %.1f, max %.1f [us]\n",
+            percentile (samples, roundtrip_count, 50),
+            percentile (samples, roundtrip_count, 90),
+            percentile (samples, roundtrip_count, 99),
+            percentile (samples, roundtrip_count, 99.9),
+            (double) samples[roundtrip_count - 1] / 2);
+    free (samples);
+
     rc = zmq_close (s);
     if (rc != 0) {
         printf ("error in zmq_close: %s\n", zmq_strerror (errno));
@@ -0,0 +1,226 @@
+/*
+    Copyright (c) 2007-2016 Contributors as noted in the AUTHORS file
+
+    This file is part of libzmq, the ZeroMQ core engine in C++.
+
+    libzmq is free software; you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    As a special exception, the Contributors give you permission to link
+    this library with independent modules to produce an executable,
+    regardless of the license terms of these independent modules, and to
+    copy and distribute the resulting executable under terms of your choice,
+    provided that you also meet, for each linked independent module, the
+    terms and conditions of the license of that module. An independent
+    module is a module which is not derived from or based on this library.
+    If you modify this library, you must extend this exception to your
+    version of the library.
+
+    libzmq is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "../include/zmq.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//  Measures how fast a ROUTER socket routes messages to peers picked at
+//  random among many connected DEALERs, which is dominated by the lookup
+//  of the outbound pipe by routing id.
+
+#define ROUTING_ID_SIZE 16
+
+int main (int argc, char *argv[])
+{
+    int peer_count;
+    int message_size;
+    int message_count;
+    void *ctx;
+    void *router;
+    void **dealers;
+    char *routing_ids;
+    int *targets;
+    char *buf;
+    int rc;
+    int i;
+    int zero = 0;
+    int one = 1;
+    unsigned int seed = 1;
+    void *watch;
+    unsigned long elapsed;
+    double throughput;
+
+    if (argc != 4) {
+        printf ("usage: router_thr <peer-count> <message-size> "
+                "<message-count>\n");
+        return 1;
+    }
+    peer_count = atoi (argv[1]);
+    message_size = atoi (argv[2]);
+    message_count = atoi (argv[3]);
+    if (peer_count < 1 || message_size < 0 || message_count < 1) {
+        printf ("error: invalid arguments\n");
+        return 1;
+    }
+
+    ctx = zmq_init (1);
+    if (!ctx) {
+        printf ("error in zmq_init: %s\n", zmq_strerror (errno));
+        return -1;
+    }
+
+    rc = zmq_ctx_set (ctx, ZMQ_MAX_SOCKETS, peer_count + 1);
+    if (rc != 0) {
+        printf ("error in zmq_ctx_set: %s\n", zmq_strerror (errno));
+        return -1;
+    }
+
+    router = zmq_socket (ctx, ZMQ_ROUTER);
+    if (!router) {
+        printf ("error in zmq_socket: %s\n", zmq_strerror (errno));
+        return -1;
+    }
+
+    //  Fail on unknown peers until all of them are known.
+    rc = zmq_setsockopt (router, ZMQ_ROUTER_MANDATORY, &one, sizeof (one));
+    if (rc != 0) {
+        printf ("error in zmq_setsockopt: %s\n", zmq_strerror (errno));
+        return -1;
+    }
+
+    rc = zmq_bind (router, "inproc://router_thr");
+    if (rc != 0) {
+        printf ("error in zmq_bind: %s\n", zmq_strerror (errno));
+        return -1;
+    }
+
+    dealers = (void **) malloc (peer_count * sizeof (void *));
+    routing_ids = (char *) malloc (peer_count * ROUTING_ID_SIZE);
+    targets = (int *) malloc (message_count * sizeof (int));
+    buf = (char *) malloc (message_size ? message_size : 1);
+    if (!dealers || !routing_ids || !targets || !buf) {
+        printf ("error in malloc\n");
+        return -1;
+    }
+    memset (buf, 0, message_size ? message_size : 1);
+
+    for (i = 0; i != peer_count; i++) {
+        dealers[i] = zmq_socket (ctx, ZMQ_DEALER);
+        if (!dealers[i]) {
+            printf ("error in zmq_socket: %s\n", zmq_strerror (errno));
+            return -1;
+        }
+        snprintf (routing_ids + i * ROUTING_ID_SIZE, ROUTING_ID_SIZE,
+                  "peer-%010d", i);
+        rc = zmq_setsockopt (dealers[i], ZMQ_ROUTING_ID,
+                             routing_ids + i * ROUTING_ID_SIZE,
+                             ROUTING_ID_SIZE);
+        if (rc != 0) {
+            printf ("error in zmq_setsockopt: %s\n", zmq_strerror (errno));
+            return -1;
+        }
+        rc = zmq_connect (dealers[i], "inproc://router_thr");
+        if (rc != 0) {
+            printf ("error in zmq_connect: %s\n", zmq_strerror (errno));
+            return -1;
+        }
+    }
+
+    //  Wait until the router knows every peer, by sending each one a
+    //  message. Reading ZMQ_EVENTS makes the router process the pending
+    //  peer registrations.
+    for (i = 0; i != peer_count; i++) {
+        while (zmq_send (router, routing_ids + i * ROUTING_ID_SIZE,
+                         ROUTING_ID_SIZE, ZMQ_SNDMORE)
+               == -1) {
+            int events;
+            size_t events_size = sizeof (events);
+            if (errno != EHOSTUNREACH) {
+                printf ("error in zmq_send: %s\n", zmq_strerror (errno));
+                return -1;
+            }
+            zmq_getsockopt (router, ZMQ_EVENTS, &events, &events_size);
+        }
+        rc = zmq_send (router, buf, 0, 0);
+        if (rc != 0) {
+            printf ("error in zmq_send: %s\n", zmq_strerror (errno));
+            return -1;
+        }
+    }
+
+    //  From now on, messages to peers which reached their high water mark
+    //  are dropped, so that nobody needs to read them.
+    rc = zmq_setsockopt (router, ZMQ_ROUTER_MANDATORY, &zero, sizeof (zero));
+    if (rc != 0) {
+        printf ("error in zmq_setsockopt: %s\n", zmq_strerror (errno));
+        return -1;
+    }
+
+    for (i = 0; i != message_count; i++) {
+        seed = seed * 1103515245 + 12345;
+        targets[i] = (int) ((seed >> 8) % (unsigned int) peer_count);
+    }
+
+    watch = zmq_stopwatch_start ();
+
+    for (i = 0; i != message_count; i++) {
+        rc = zmq_send (router, routing_ids + targets[i] * ROUTING_ID_SIZE,
+                       ROUTING_ID_SIZE, ZMQ_SNDMORE);
+        if (rc < 0) {
+            printf ("error in zmq_send: %s\n", zmq_strerror (errno));
+            return -1;
+        }
+        rc = zmq_send (router, buf, message_size, 0);
+        if (rc < 0) {
+            printf ("error in zmq_send: %s\n", zmq_strerror (errno));
+            return -1;
+        }
+    }
+
+    elapsed = zmq_stopwatch_stop (watch);
+    if (elapsed == 0)
+        elapsed = 1;
+
+    throughput = ((double) message_count / (double) elapsed * 1000000);
+
+    printf ("peer count: %d\n", peer_count);
+    printf ("message size: %d [B]\n", message_size);
+    printf ("message count: %d\n", message_count);
+    printf ("mean throughput: %d [msg/s]\n", (int) throughput);
+
+    for (i = 0; i != peer_count; i++) {
+        rc = zmq_close (dealers[i]);
+        if (rc != 0) {
+            printf ("error in zmq_close: %s\n", zmq_strerror (errno));
+            return -1;
+        }
+    }
+
+    rc = zmq_close (router);
+    if (rc != 0) {
+        printf ("error in zmq_close: %s\n", zmq_strerror (errno));
+        return -1;
+    }
+
+    rc = zmq_ctx_term (ctx);
+    if (rc != 0) {
+        printf ("error in zmq_ctx_term: %s\n", zmq_strerror (errno));
+        return -1;
+    }
+
+    free (buf);
+    free (targets);
+    free (routing_ids);
+    free (dealers);
+
+    return 0;
+}
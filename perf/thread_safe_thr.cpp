@@ -0,0 +1,136 @@
+/*
+    Copyright (c) 2007-2016 Contributors as noted in the AUTHORS file
+
+    This file is part of libzmq, the ZeroMQ core engine in C++.
+
+    libzmq is free software; you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    As a special exception, the Contributors give you permission to link
+    this library with independent modules to produce an executable,
+    regardless of the license terms of these independent modules, and to
+    copy and distribute the resulting executable under terms of your choice,
+    provided that you also meet, for each linked independent module, the
+    terms and conditions of the license of that module. An independent
+    module is a module which is not derived from or based on this library.
+    If you modify this library, you must extend this exception to your
+    version of the library.
+
+    libzmq is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../include/zmq.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+//  Measures throughput of a CLIENT socket shared by several sender threads,
+//  as in test_thread_safe, towards a SERVER socket over TCP. The senders
+//  contend on the client's mutex with each other and with the I/O thread
+//  posting commands to its mailbox.
+
+#ifndef ZMQ_CLIENT
+#define ZMQ_CLIENT 13
+#define ZMQ_SERVER 12
+#endif
+
+struct sender_t
+{
+    void *client;
+    int message_count;
+};
+
+static void die (const char *what_)
+{
+    printf ("error in %s: %s\n", what_, zmq_strerror (errno));
+    exit (1);
+}
+
+static void sender (void *arg_)
+{
+    const sender_t *args = (const sender_t *) arg_;
+    for (int i = 0; i != args->message_count; i++)
+        if (zmq_send (args->client, "0", 1, 0) != 1)
+            die ("zmq_send");
+}
+
+int main (int argc, char *argv[])
+{
+    if (argc != 3) {
+        printf ("usage: thread_safe_thr <message-count> <threads>\n");
+        return 1;
+    }
+    const int message_count = atoi (argv[1]);
+    const int thread_count = atoi (argv[2]);
+    if (message_count < 1 || thread_count < 1) {
+        printf ("error: invalid arguments\n");
+        return 1;
+    }
+
+    void *ctx = zmq_ctx_new ();
+    if (!ctx)
+        die ("zmq_ctx_new");
+
+    void *server = zmq_socket (ctx, ZMQ_SERVER);
+    if (!server)
+        die ("zmq_socket");
+    if (zmq_bind (server, "tcp://127.0.0.1:5598") != 0)
+        die ("zmq_bind");
+    void *client = zmq_socket (ctx, ZMQ_CLIENT);
+    if (!client)
+        die ("zmq_socket");
+    if (zmq_connect (client, "tcp://127.0.0.1:5598") != 0)
+        die ("zmq_connect");
+
+    //  Wait for the connection before starting the clock.
+    char data;
+    if (zmq_send (client, "0", 1, 0) != 1)
+        die ("zmq_send");
+    if (zmq_recv (server, &data, 1, 0) != 1)
+        die ("zmq_recv");
+
+    sender_t args;
+    args.client = client;
+    args.message_count = message_count / thread_count;
+    const int total = args.message_count * thread_count;
+
+    void *watch = zmq_stopwatch_start ();
+    void **threads = (void **) malloc (thread_count * sizeof (void *));
+    if (!threads)
+        die ("malloc");
+    for (int i = 0; i != thread_count; i++)
+        threads[i] = zmq_threadstart (sender, &args);
+    for (int i = 0; i != total; i++)
+        if (zmq_recv (server, &data, 1, 0) != 1)
+            die ("zmq_recv");
+    unsigned long elapsed = zmq_stopwatch_stop (watch);
+    if (elapsed == 0)
+        elapsed = 1;
+
+    for (int i = 0; i != thread_count; i++)
+        zmq_threadclose (threads[i]);
+    free (threads);
+
+    const double throughput = (double) total / (double) elapsed * 1000000;
+
+    printf ("threads: %d\n", thread_count);
+    printf ("message count: %d\n", total);
+    printf ("mean throughput: %d [msg/s]\n", (int) throughput);
+
+    if (zmq_close (client) != 0)
+        die ("zmq_close");
+    if (zmq_close (server) != 0)
+        die ("zmq_close");
+    if (zmq_ctx_term (ctx) != 0)
+        die ("zmq_ctx_term");
+
+    return 0;
+}
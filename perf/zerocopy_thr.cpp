@@ -0,0 +1,160 @@
+/*
+    Copyright (c) 2007-2016 Contributors as noted in the AUTHORS file
+
+    This file is part of libzmq, the ZeroMQ core engine in C++.
+
+    libzmq is free software; you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    As a special exception, the Contributors give you permission to link
+    this library with independent modules to produce an executable,
+    regardless of the license terms of these independent modules, and to
+    copy and distribute the resulting executable under terms of your choice,
+    provided that you also meet, for each linked independent module, the
+    terms and conditions of the license of that module. An independent
+    module is a module which is not derived from or based on this library.
+    If you modify this library, you must extend this exception to your
+    version of the library.
+
+    libzmq is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "../include/zmq.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if !defined _WIN32
+#include <sys/resource.h>
+#endif
+
+//  Sender for local_thr, reporting how much CPU time it takes to push
+//  the data through the TCP stack with and without MSG_ZEROCOPY.
+
+#ifndef ZMQ_TCP_ZEROCOPY_THRESHOLD
+#define ZMQ_TCP_ZEROCOPY_THRESHOLD 110
+#endif
+
+static double cpu_seconds ()
+{
+#if defined _WIN32
+    return 0;
+#else
+    struct rusage usage;
+    getrusage (RUSAGE_SELF, &usage);
+    return (double) usage.ru_utime.tv_sec + (double) usage.ru_stime.tv_sec
+           + ((double) usage.ru_utime.tv_usec + (double) usage.ru_stime.tv_usec)
+               / 1000000;
+#endif
+}
+
+int main (int argc, char *argv[])
+{
+    const char *connect_to;
+    int message_count;
+    int message_size;
+    int threshold;
+    void *ctx;
+    void *s;
+    int rc;
+    int i;
+    zmq_msg_t msg;
+    void *watch;
+    unsigned long elapsed;
+    double cpu;
+    double gigabytes;
+
+    if (argc != 5) {
+        printf ("usage: zerocopy_thr <connect-to> <message-size> "
+                "<message-count> <zerocopy-threshold>\n");
+        return 1;
+    }
+    connect_to = argv[1];
+    message_size = atoi (argv[2]);
+    message_count = atoi (argv[3]);
+    threshold = atoi (argv[4]);
+
+    ctx = zmq_init (1);
+    if (!ctx) {
+        printf ("error in zmq_init: %s\n", zmq_strerror (errno));
+        return -1;
+    }
+
+    s = zmq_socket (ctx, ZMQ_PUSH);
+    if (!s) {
+        printf ("error in zmq_socket: %s\n", zmq_strerror (errno));
+        return -1;
+    }
+
+    rc = zmq_setsockopt (s, ZMQ_TCP_ZEROCOPY_THRESHOLD, &threshold,
+                         sizeof (threshold));
+    if (rc != 0) {
+        printf ("error in zmq_setsockopt: %s\n", zmq_strerror (errno));
+        return -1;
+    }
+
+    rc = zmq_connect (s, connect_to);
+    if (rc != 0) {
+        printf ("error in zmq_connect: %s\n", zmq_strerror (errno));
+        return -1;
+    }
+
+    watch = zmq_stopwatch_start ();
+    cpu = cpu_seconds ();
+
+    for (i = 0; i != message_count; i++) {
+        rc = zmq_msg_init_size (&msg, message_size);
+        if (rc != 0) {
+            printf ("error in zmq_msg_init_size: %s\n", zmq_strerror (errno));
+            return -1;
+        }
+        rc = zmq_sendmsg (s, &msg, 0);
+        if (rc < 0) {
+            printf ("error in zmq_sendmsg: %s\n", zmq_strerror (errno));
+            return -1;
+        }
+        rc = zmq_msg_close (&msg);
+        if (rc != 0) {
+            printf ("error in zmq_msg_close: %s\n", zmq_strerror (errno));
+            return -1;
+        }
+    }
+
+    rc = zmq_close (s);
+    if (rc != 0) {
+        printf ("error in zmq_close: %s\n", zmq_strerror (errno));
+        return -1;
+    }
+
+    //  Terminating the context waits for the data to be written out.
+    rc = zmq_ctx_term (ctx);
+    if (rc != 0) {
+        printf ("error in zmq_ctx_term: %s\n", zmq_strerror (errno));
+        return -1;
+    }
+
+    elapsed = zmq_stopwatch_stop (watch);
+    if (elapsed == 0)
+        elapsed = 1;
+    cpu = cpu_seconds () - cpu;
+    gigabytes = (double) message_count * message_size / 1000000000;
+
+    printf ("message size: %d [B]\n", message_size);
+    printf ("message count: %d\n", message_count);
+    printf ("zerocopy threshold: %d [B]\n", threshold);
+    printf ("mean throughput: %.3f [Mb/s]\n",
+            gigabytes * 8000 / ((double) elapsed / 1000000));
+    printf ("CPU time: %.3f [s]\n", cpu);
+    printf ("CPU per GB: %.3f [s/GB]\n", cpu / gigabytes);
+
+    return 0;
+}
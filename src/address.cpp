@@ -79,6 +79,11 @@ zmq::address_t::~address_t ()
         LIBZMQ_DELETE (resolved.ipc_addr);
     }
 #endif
+#if defined ZMQ_HAVE_SHM
+    else if (protocol == protocol_name::shm) {
+        LIBZMQ_DELETE (resolved.ipc_addr);
+    }
+#endif
 #if defined ZMQ_HAVE_TIPC
     else if (protocol == protocol_name::tipc) {
         LIBZMQ_DELETE (resolved.tipc_addr);
@@ -109,6 +114,10 @@ int zmq::address_t::to_string (std::string &addr_) const
     if (protocol == protocol_name::ipc && resolved.ipc_addr)
         return resolved.ipc_addr->to_string (addr_);
 #endif
+#if defined ZMQ_HAVE_SHM
+    if (protocol == protocol_name::shm && resolved.ipc_addr)
+        return resolved.ipc_addr->to_string (addr_, protocol_name::shm);
+#endif
 #if defined ZMQ_HAVE_TIPC
     if (protocol == protocol_name::tipc && resolved.tipc_addr)
         return resolved.tipc_addr->to_string (addr_);
@@ -71,6 +71,9 @@ static const char wss[] = "wss";
 #if defined ZMQ_HAVE_IPC
 static const char ipc[] = "ipc";
 #endif
+#if defined ZMQ_HAVE_SHM
+static const char shm[] = "shm";
+#endif
 #if defined ZMQ_HAVE_TIPC
 static const char tipc[] = "tipc";
 #endif
@@ -103,6 +106,7 @@ struct address_t
         wss_address_t *wss_addr;
 #endif
 #if defined ZMQ_HAVE_IPC
+        //  Also used by shm, which is set up over a UNIX domain socket.
         ipc_address_t *ipc_addr;
 #endif
 #if defined ZMQ_HAVE_LINUX || defined ZMQ_HAVE_VXWORKS
@@ -146,6 +150,22 @@ std::string get_socket_name (fd_t fd_, socket_end_t socket_end_)
     addr.to_string (address_string);
     return address_string;
 }
+
+template <typename T>
+std::string
+get_socket_name (fd_t fd_, socket_end_t socket_end_, const char *protocol_)
+{
+    struct sockaddr_storage ss;
+    const zmq_socklen_t sl = get_socket_address (fd_, socket_end_, &ss);
+    if (sl == 0) {
+        return std::string ();
+    }
+
+    const T addr (reinterpret_cast<struct sockaddr *> (&ss), sl);
+    std::string address_string;
+    addr.to_string (address_string, protocol_);
+    return address_string;
+}
 }
 
 #endif
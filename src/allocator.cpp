@@ -0,0 +1,88 @@
+/*
+    Copyright (c) 2007-2016 Contributors as noted in the AUTHORS file
+
+    This file is part of libzmq, the ZeroMQ core engine in C++.
+
+    libzmq is free software; you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    As a special exception, the Contributors give you permission to link
+    this library with independent modules to produce an executable,
+    regardless of the license terms of these independent modules, and to
+    copy and distribute the resulting executable under terms of your choice,
+    provided that you also meet, for each linked independent module, the
+    terms and conditions of the license of that module. An independent
+    module is a module which is not derived from or based on this library.
+    If you modify this library, you must extend this exception to your
+    version of the library.
+
+    libzmq is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "precompiled.hpp"
+#include "allocator.hpp"
+
+#include <string.h>
+#include <new>
+
+#include "mutex.hpp"
+
+//  Has no constructor, so it is zero-initialised before any code runs.
+zmq::allocator_t zmq::allocator_t::_heap;
+
+static zmq::mutex_t allocators_sync;
+static zmq::allocator_t *allocators = NULL;
+
+zmq::allocator_t *zmq::allocator_t::find (const zmq_allocator_t &functions_)
+{
+    if (functions_.allocate_fn == NULL)
+        return heap ();
+
+    scoped_lock_t locker (allocators_sync);
+
+    for (allocator_t *allocator = allocators; allocator != NULL;
+         allocator = allocator->_next)
+        if (allocator->_functions.allocate_fn == functions_.allocate_fn
+            && allocator->_functions.reallocate_fn == functions_.reallocate_fn
+            && allocator->_functions.deallocate_fn == functions_.deallocate_fn
+            && allocator->_functions.hint == functions_.hint)
+            return allocator;
+
+    allocator_t *allocator = new (std::nothrow) allocator_t;
+    if (allocator == NULL)
+        return NULL;
+    allocator->_functions = functions_;
+    allocator->_next = allocators;
+    allocators = allocator;
+    return allocator;
+}
+
+void *zmq::allocator_t::reallocate (void *ptr_,
+                                    size_t old_size_,
+                                    size_t new_size_,
+                                    int tag_)
+{
+    if (is_heap ())
+        return realloc (ptr_, new_size_);
+    if (_functions.reallocate_fn != NULL)
+        return _functions.reallocate_fn (_functions.hint, ptr_, old_size_,
+                                         new_size_, tag_);
+
+    //  Without a reallocate function, move the memory ourselves.
+    void *const ptr = allocate (new_size_, tag_);
+    if (ptr == NULL)
+        return NULL;
+    if (ptr_ != NULL) {
+        memcpy (ptr, ptr_, old_size_ < new_size_ ? old_size_ : new_size_);
+        deallocate (ptr_, old_size_, tag_);
+    }
+    return ptr;
+}
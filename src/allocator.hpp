@@ -0,0 +1,89 @@
+/*
+    Copyright (c) 2007-2016 Contributors as noted in the AUTHORS file
+
+    This file is part of libzmq, the ZeroMQ core engine in C++.
+
+    libzmq is free software; you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    As a special exception, the Contributors give you permission to link
+    this library with independent modules to produce an executable,
+    regardless of the license terms of these independent modules, and to
+    copy and distribute the resulting executable under terms of your choice,
+    provided that you also meet, for each linked independent module, the
+    terms and conditions of the license of that module. An independent
+    module is a module which is not derived from or based on this library.
+    If you modify this library, you must extend this exception to your
+    version of the library.
+
+    libzmq is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __ZMQ_ALLOCATOR_HPP_INCLUDED__
+#define __ZMQ_ALLOCATOR_HPP_INCLUDED__
+
+#include <stddef.h>
+#include <stdlib.h>
+
+#include "../include/zmq.h"
+#include "zmq_draft.h"
+
+namespace zmq
+{
+//  Allocates the memory of messages, pipes, encoders and decoders, either
+//  with the functions set through ZMQ_ALLOCATOR or from the heap.
+//
+//  Memory handed out may outlive the context that asked for it, e.g. as
+//  the content of a received message. Allocators are therefore never
+//  destroyed, and setting the same functions twice yields the same
+//  allocator.
+
+class allocator_t
+{
+  public:
+    //  Returns the allocator using the heap.
+    static allocator_t *heap () { return &_heap; }
+
+    //  Returns the allocator using 'functions_', or NULL if out of memory.
+    static allocator_t *find (const zmq_allocator_t &functions_);
+
+    bool is_heap () const { return _functions.allocate_fn == NULL; }
+
+    const zmq_allocator_t &functions () const { return _functions; }
+
+    void *allocate (size_t size_, int tag_)
+    {
+        if (is_heap ())
+            return malloc (size_);
+        return _functions.allocate_fn (_functions.hint, size_, tag_);
+    }
+
+    void *reallocate (void *ptr_, size_t old_size_, size_t new_size_, int tag_);
+
+    void deallocate (void *ptr_, size_t size_, int tag_)
+    {
+        if (is_heap ())
+            free (ptr_);
+        else if (ptr_ != NULL)
+            _functions.deallocate_fn (_functions.hint, ptr_, size_, tag_);
+    }
+
+  private:
+    zmq_allocator_t _functions;
+
+    //  Next allocator created by find.
+    allocator_t *_next;
+
+    static allocator_t _heap;
+};
+}
+
+#endif
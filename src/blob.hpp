@@ -32,6 +32,7 @@
 
 #include "macros.hpp"
 #include "err.hpp"
+#include "stdint.hpp"
 
 #include <stdlib.h>
 #include <string.h>
@@ -115,6 +116,55 @@ struct blob_t
     //  Returns a pointer to the data of the blob_t.
     unsigned char *data () { return _data; }
 
+    //  Secret key of the hash below.
+    struct hash_key_t
+    {
+        uint64_t k0;
+        uint64_t k1;
+    };
+
+    //  Returns a keyed hash of the content of a buffer (SipHash-1-3).
+    //  Hash tables indexed by data coming from peers pick a random key,
+    //  so that peers cannot choose ids which all collide.
+    static uint32_t hash (const unsigned char *data_,
+                          const size_t size_,
+                          const hash_key_t &key_)
+    {
+        uint64_t v0 = key_.k0 ^ 0x736f6d6570736575ULL;
+        uint64_t v1 = key_.k1 ^ 0x646f72616e646f6dULL;
+        uint64_t v2 = key_.k0 ^ 0x6c7967656e657261ULL;
+        uint64_t v3 = key_.k1 ^ 0x7465646279746573ULL;
+
+        const size_t end = size_ & ~static_cast<size_t> (7);
+        for (size_t i = 0; i != end; i += 8) {
+            uint64_t m = 0;
+            for (size_t j = 8; j-- > 0;)
+                m = (m << 8) | data_[i + j];
+            v3 ^= m;
+            sip_round (v0, v1, v2, v3);
+            v0 ^= m;
+        }
+
+        uint64_t last = static_cast<uint64_t> (size_) << 56;
+        for (size_t j = size_ - end; j-- > 0;)
+            last |= static_cast<uint64_t> (data_[end + j]) << (8 * j);
+        v3 ^= last;
+        sip_round (v0, v1, v2, v3);
+        v0 ^= last;
+
+        v2 ^= 0xff;
+        sip_round (v0, v1, v2, v3);
+        sip_round (v0, v1, v2, v3);
+        sip_round (v0, v1, v2, v3);
+        return static_cast<uint32_t> (v0 ^ v1 ^ v2 ^ v3);
+    }
+
+    //  Returns a keyed hash of the content of the blob_t.
+    uint32_t hash (const hash_key_t &key_) const
+    {
+        return hash (_data, _size, key_);
+    }
+
     //  Defines an order relationship on blob_t.
     bool operator< (blob_t const &other_) const
     {
@@ -196,6 +246,30 @@ struct blob_t
 #endif
 
   private:
+    static uint64_t rotl (uint64_t x_, int bits_)
+    {
+        return (x_ << bits_) | (x_ >> (64 - bits_));
+    }
+
+    static void
+    sip_round (uint64_t &v0_, uint64_t &v1_, uint64_t &v2_, uint64_t &v3_)
+    {
+        v0_ += v1_;
+        v1_ = rotl (v1_, 13);
+        v1_ ^= v0_;
+        v0_ = rotl (v0_, 32);
+        v2_ += v3_;
+        v3_ = rotl (v3_, 16);
+        v3_ ^= v2_;
+        v0_ += v3_;
+        v3_ = rotl (v3_, 21);
+        v3_ ^= v0_;
+        v2_ += v1_;
+        v1_ = rotl (v1_, 17);
+        v1_ ^= v2_;
+        v2_ = rotl (v2_, 32);
+    }
+
     unsigned char *_data;
     size_t _size;
     bool _owned;
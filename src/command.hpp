@@ -76,6 +76,7 @@ __declspec(align (64))
         inproc_connected,
         pipe_peer_stats,
         pipe_stats_publish,
+        migrate,
         done
     } type;
 
@@ -119,10 +120,11 @@ __declspec(align (64))
         } activate_read;
 
         //  Sent by pipe reader to inform pipe writer about how many
-        //  messages it has read so far.
+        //  messages and payload bytes it has read so far.
         struct
         {
             uint64_t msgs_read;
+            uint64_t bytes_read;
         } activate_write;
 
         //  Sent by pipe reader to writer after creating a new inpipe.
@@ -193,6 +195,7 @@ __declspec(align (64))
         struct
         {
             uint64_t queue_count;
+            uint64_t queue_bytes;
             zmq::own_t *socket_base;
             endpoint_uri_pair_t *endpoint_pair;
         } pipe_peer_stats;
@@ -203,9 +206,17 @@ __declspec(align (64))
         {
             uint64_t outbound_queue_count;
             uint64_t inbound_queue_count;
+            uint64_t outbound_queue_bytes;
+            uint64_t inbound_queue_bytes;
             endpoint_uri_pair_t *endpoint_pair;
         } pipe_stats_publish;
 
+        //  Sent by an I/O thread to a session it has moved to another
+        //  I/O thread, to have it register with its new poller.
+        struct
+        {
+        } migrate;
+
         //  Sent by reaper thread to the term thread when all the sockets
         //  are successfully deallocated.
         struct
@@ -58,6 +58,35 @@ enum
     //  Maximum number of events the I/O thread can process in one go.
     max_io_events = 256,
 
+    //  Maximum number of datagrams the UDP engine may receive or send in
+    //  one system call (ZMQ_UDP_BATCH_SIZE).
+    max_udp_batch_size = 1024,
+
+    //  Interval in milliseconds at which stream engines free the encoder
+    //  and decoder buffers holding no pending data. Idle connections thus
+    //  hold no buffers.
+    buffer_release_ivl = 1000,
+
+    //  Maximum number of segments the stream engines pass to a single
+    //  gather write.
+    max_gather_segments = 64,
+
+    //  Chunks of encoded data smaller than this are copied into the
+    //  gather write's scratch area, larger ones are sent in place.
+    gather_copy_threshold = 256,
+
+    //  Maximum time in milliseconds a closing TCP engine waits for the
+    //  kernel to complete its outstanding zero-copy sends.
+    zerocopy_drain_timeout = 1000,
+
+    //  Size of each of the two rings shared by a shm:// connection.
+    //  Must be a power of two.
+    shm_ring_size = 256 * 1024,
+
+    //  Maximum number of descriptors passed along with a single write to
+    //  a UNIX domain socket (ZMQ_IPC_MEMFD_THRESHOLD).
+    ipc_max_passed_fds = 16,
+
     //  Maximal batch size of packets forwarded by a ZMQ proxy.
     //  Increasing this value improves throughput at the expense of
     //  latency and fairness.
@@ -46,6 +46,8 @@
 #include "pipe.hpp"
 #include "err.hpp"
 #include "msg.hpp"
+#include "msg_pool.hpp"
+#include "numa.hpp"
 #include "random.hpp"
 
 #ifdef ZMQ_HAVE_VMCI
@@ -83,7 +85,14 @@ zmq::ctx_t::ctx_t () :
     _io_thread_count (ZMQ_IO_THREADS_DFLT),
     _blocky (true),
     _ipv6 (false),
-    _zero_copy (true)
+    _zero_copy (true),
+    _msg_pool (false),
+    _allocator (allocator_t::heap ()),
+    _busy_poll (0),
+    _busy_poll_threads (0),
+    _io_load_ivl (0),
+    _io_rebalance (0),
+    _numa (false)
 {
 #ifdef HAVE_FORK
     _pid = getpid ();
@@ -130,6 +139,9 @@ zmq::ctx_t::~ctx_t ()
     //  Deallocate the reaper thread object.
     LIBZMQ_DELETE (_reaper);
 
+    if (_msg_pool)
+        msg_pool_t::disable ();
+
     //  The mailboxes in _slots themselves were deallocated with their
     //  corresponding io_thread/socket objects.
 
@@ -311,6 +323,83 @@ int zmq::ctx_t::set (int option_, const void *optval_, size_t optvallen_)
             }
             break;
 
+        case ZMQ_MSG_POOL:
+            if (is_int && value >= 0) {
+                scoped_lock_t locker (_opt_sync);
+                if (_msg_pool != (value != 0)) {
+                    _msg_pool = value != 0;
+                    if (_msg_pool)
+                        msg_pool_t::enable ();
+                    else
+                        msg_pool_t::disable ();
+                }
+                return 0;
+            }
+            break;
+
+        case ZMQ_ALLOCATOR:
+            if (optvallen_ == sizeof (zmq_allocator_t)) {
+                zmq_allocator_t functions;
+                memcpy (&functions, optval_, sizeof functions);
+                if ((functions.allocate_fn == NULL)
+                    != (functions.deallocate_fn == NULL))
+                    break;
+
+                //  Sockets keep the allocator they were created with, so
+                //  it can only change before the first one.
+                scoped_lock_t locker (_slot_sync);
+                if (!_starting)
+                    break;
+                allocator_t *const allocator = allocator_t::find (functions);
+                if (allocator == NULL) {
+                    errno = ENOMEM;
+                    return -1;
+                }
+                _allocator = allocator;
+                return 0;
+            }
+            break;
+
+        case ZMQ_BUSY_POLL:
+            if (is_int && value >= 0) {
+                scoped_lock_t locker (_opt_sync);
+                _busy_poll = value;
+                return 0;
+            }
+            break;
+
+        case ZMQ_BUSY_POLL_THREADS:
+            if (is_int) {
+                scoped_lock_t locker (_opt_sync);
+                _busy_poll_threads = value;
+                return 0;
+            }
+            break;
+
+        case ZMQ_IO_LOAD_IVL:
+            if (is_int && value >= 0) {
+                scoped_lock_t locker (_opt_sync);
+                _io_load_ivl = value;
+                return 0;
+            }
+            break;
+
+        case ZMQ_IO_REBALANCE:
+            if (is_int && value >= 0 && value <= 1000) {
+                scoped_lock_t locker (_opt_sync);
+                _io_rebalance = value;
+                return 0;
+            }
+            break;
+
+        case ZMQ_NUMA:
+            if (is_int && value >= 0) {
+                scoped_lock_t locker (_opt_sync);
+                _numa = value != 0;
+                return 0;
+            }
+            break;
+
         default: {
             return thread_ctx_t::set (option_, optval_, optvallen_);
         }
@@ -382,6 +471,79 @@ int zmq::ctx_t::get (int option_, void *optval_, const size_t *optvallen_)
             }
             break;
 
+        case ZMQ_MSG_POOL:
+            if (is_int) {
+                *value = _msg_pool;
+                return 0;
+            }
+            break;
+
+        case ZMQ_ALLOCATOR:
+            if (*optvallen_ == sizeof (zmq_allocator_t)) {
+                memcpy (optval_, &_allocator->functions (),
+                        sizeof (zmq_allocator_t));
+                return 0;
+            }
+            break;
+
+        case ZMQ_BUSY_POLL:
+            if (is_int) {
+                *value = _busy_poll;
+                return 0;
+            }
+            break;
+
+        case ZMQ_BUSY_POLL_THREADS:
+            if (is_int) {
+                *value = _busy_poll_threads;
+                return 0;
+            }
+            break;
+
+        case ZMQ_IO_LOAD_IVL:
+            if (is_int) {
+                *value = _io_load_ivl;
+                return 0;
+            }
+            break;
+
+        case ZMQ_IO_REBALANCE:
+            if (is_int) {
+                *value = _io_rebalance;
+                return 0;
+            }
+            break;
+
+        case ZMQ_NUMA:
+            if (is_int) {
+                *value = _numa;
+                return 0;
+            }
+            break;
+
+        case ZMQ_IO_THREAD_LOADS: {
+            //  One entry per I/O thread, all zero until the first socket
+            //  starts the threads.
+            scoped_lock_t locker (_slot_sync);
+            _opt_sync.lock ();
+            const size_t count = _starting
+                                   ? static_cast<size_t> (_io_thread_count)
+                                   : _io_threads.size ();
+            _opt_sync.unlock ();
+            if (*optvallen_ != count * sizeof (zmq_io_thread_load_t))
+                break;
+            zmq_io_thread_load_t *loads =
+              static_cast<zmq_io_thread_load_t *> (optval_);
+            memset (loads, 0, *optvallen_);
+            for (size_t i = 0; i != _io_threads.size (); i++) {
+                loads[i].fds = _io_threads[i]->get_load ();
+                _io_threads[i]->get_load_sample (
+                  &loads[i].busy, &loads[i].traffic, &loads[i].migrations,
+                  &loads[i].cost);
+            }
+            return 0;
+        }
+
         default: {
             return thread_ctx_t::get (option_, optval_, optvallen_);
         }
@@ -411,6 +573,11 @@ bool zmq::ctx_t::start ()
     const int term_and_reaper_threads_count = 2;
     const int mazmq = _max_sockets;
     const int ios = _io_thread_count;
+    const int busy_poll = _busy_poll;
+    const int busy_poll_threads = _busy_poll_threads;
+    const int io_load_ivl = _io_load_ivl;
+    const int io_rebalance = _io_rebalance;
+    const bool numa = _numa;
     _opt_sync.unlock ();
     const int slot_count = mazmq + ios + term_and_reaper_threads_count;
     try {
@@ -437,6 +604,12 @@ bool zmq::ctx_t::start ()
     _slots[reaper_tid] = _reaper->get_mailbox ();
     _reaper->start ();
 
+    //  In NUMA mode, the I/O threads are split into groups of consecutive
+    //  ones, one per node, and each group runs on the CPUs of its node.
+    _io_thread_nodes.clear ();
+    if (numa && !numa_nodes (&_numa_nodes))
+        _numa_nodes.clear ();
+
     //  Create I/O thread objects and launch them.
     _slots.resize (slot_count, NULL);
 
@@ -453,6 +626,19 @@ bool zmq::ctx_t::start ()
         }
         _io_threads.push_back (io_thread);
         _slots[i] = io_thread->get_mailbox ();
+        const int index = i - term_and_reaper_threads_count;
+        if (busy_poll_threads == 0
+            || (index < 32
+                && (static_cast<unsigned int> (busy_poll_threads) >> index)
+                     & 1u))
+            io_thread->get_poller ()->set_busy_poll (busy_poll);
+        io_thread->set_load_sampling (io_load_ivl, io_rebalance);
+        if (!_numa_nodes.empty ()) {
+            const int node = static_cast<int> (
+              static_cast<size_t> (index) * _numa_nodes.size () / ios);
+            _io_thread_nodes.push_back (node);
+            io_thread->get_poller ()->set_cpus (_numa_nodes[node]);
+        }
         io_thread->start ();
     }
 
@@ -548,10 +734,12 @@ zmq::thread_ctx_t::thread_ctx_t () :
 void zmq::thread_ctx_t::start_thread (thread_t &thread_,
                                       thread_fn *tfn_,
                                       void *arg_,
-                                      const char *name_) const
+                                      const char *name_,
+                                      const std::set<int> &cpus_) const
 {
     thread_.setSchedulingParameters (_thread_priority, _thread_sched_policy,
-                                     _thread_affinity_cpus);
+                                     cpus_.empty () ? _thread_affinity_cpus
+                                                    : cpus_);
 
     char namebuf[16] = "";
     snprintf (namebuf, sizeof (namebuf), "%s%sZMQbg%s%s",
@@ -675,7 +863,7 @@ zmq::io_thread_t *zmq::ctx_t::choose_io_thread (uint64_t affinity_)
     for (io_threads_t::size_type i = 0, size = _io_threads.size (); i != size;
          i++) {
         if (!affinity_ || (affinity_ & (uint64_t (1) << i))) {
-            const int load = _io_threads[i]->get_load ();
+            const int load = _io_threads[i]->get_cost ();
             if (selected_io_thread == NULL || load < min_load) {
                 min_load = load;
                 selected_io_thread = _io_threads[i];
@@ -685,6 +873,28 @@ zmq::io_thread_t *zmq::ctx_t::choose_io_thread (uint64_t affinity_)
     return selected_io_thread;
 }
 
+void zmq::ctx_t::get_io_threads (uint64_t affinity_,
+                                 std::vector<io_thread_t *> *io_threads_)
+{
+    for (io_threads_t::size_type i = 0, size = _io_threads.size (); i != size;
+         i++)
+        if (!affinity_ || (affinity_ & (uint64_t (1) << i)))
+            io_threads_->push_back (_io_threads[i]);
+}
+
+uint64_t zmq::ctx_t::get_numa_affinity () const
+{
+    const int cpu = current_cpu ();
+    if (_io_thread_nodes.empty () || cpu < 0)
+        return 0;
+
+    uint64_t affinity = 0;
+    for (size_t i = 0; i != _io_thread_nodes.size () && i != 64; i++)
+        if (_numa_nodes[_io_thread_nodes[i]].count (cpu))
+            affinity |= uint64_t (1) << i;
+    return affinity;
+}
+
 int zmq::ctx_t::register_endpoint (const char *addr_,
                                    const endpoint_t &endpoint_)
 {
@@ -823,6 +1033,20 @@ void zmq::ctx_t::connect_inproc_sockets (
           pending_connection_.endpoint.options.sndhwm);
         pending_connection_.bind_pipe->set_hwms (bind_options_.rcvhwm,
                                                  bind_options_.sndhwm);
+
+        const options_t &connect_options = pending_connection_.endpoint.options;
+        const int64_t sndhwm_bytes =
+          connect_options.sndhwm_bytes != 0 && bind_options_.rcvhwm_bytes != 0
+            ? connect_options.sndhwm_bytes + bind_options_.rcvhwm_bytes
+            : 0;
+        const int64_t rcvhwm_bytes =
+          connect_options.rcvhwm_bytes != 0 && bind_options_.sndhwm_bytes != 0
+            ? connect_options.rcvhwm_bytes + bind_options_.sndhwm_bytes
+            : 0;
+        pending_connection_.connect_pipe->set_hwms_bytes (rcvhwm_bytes,
+                                                          sndhwm_bytes);
+        pending_connection_.bind_pipe->set_hwms_bytes (sndhwm_bytes,
+                                                       rcvhwm_bytes);
     } else {
         pending_connection_.connect_pipe->set_hwms (-1, -1);
         pending_connection_.bind_pipe->set_hwms (-1, -1);
@@ -31,6 +31,7 @@
 #define __ZMQ_CTX_HPP_INCLUDED__
 
 #include <map>
+#include <set>
 #include <vector>
 #include <string>
 #include <stdarg.h>
@@ -42,6 +43,7 @@
 #include "stdint.hpp"
 #include "options.hpp"
 #include "atomic_counter.hpp"
+#include "allocator.hpp"
 #include "thread.hpp"
 
 namespace zmq
@@ -66,11 +68,14 @@ class thread_ctx_t
   public:
     thread_ctx_t ();
 
-    //  Start a new thread with proper scheduling parameters.
+    //  Start a new thread with proper scheduling parameters. If cpus_ is
+    //  not empty, the thread runs on those CPUs instead of the ones set
+    //  with ZMQ_THREAD_AFFINITY_CPU_ADD.
     void start_thread (thread_t &thread_,
                        thread_fn *tfn_,
                        void *arg_,
-                       const char *name_ = NULL) const;
+                       const char *name_ = NULL,
+                       const std::set<int> &cpus_ = std::set<int> ()) const;
 
     int set (int option_, const void *optval_, size_t optvallen_);
     int get (int option_, void *optval_, const size_t *optvallen_);
@@ -131,9 +136,21 @@ class ctx_t ZMQ_FINAL : public thread_ctx_t
     //  Returns NULL if no I/O thread is available.
     zmq::io_thread_t *choose_io_thread (uint64_t affinity_);
 
+    //  Returns all the I/O threads eligible under affinity_ (0 = all).
+    void get_io_threads (uint64_t affinity_,
+                         std::vector<zmq::io_thread_t *> *io_threads_);
+
+    //  In NUMA mode, returns the affinity of the I/O threads on the NUMA
+    //  node the calling thread runs on. Returns 0 otherwise.
+    uint64_t get_numa_affinity () const;
+
     //  Returns reaper thread object.
     zmq::object_t *get_reaper () const;
 
+    //  Returns the allocator for the memory of this context's sockets.
+    //  It does not change once the first socket is created.
+    allocator_t *get_allocator () const { return _allocator; }
+
     //  Management of inproc endpoints.
     int register_endpoint (const char *addr_, const endpoint_t &endpoint_);
     int unregister_endpoint (const std::string &addr_,
@@ -242,6 +259,34 @@ class ctx_t ZMQ_FINAL : public thread_ctx_t
     // Should we use zero copy message decoding in this context?
     bool _zero_copy;
 
+    //  Has this context enabled the message content pools?
+    bool _msg_pool;
+
+    //  Allocator set with ZMQ_ALLOCATOR.
+    allocator_t *_allocator;
+
+    //  Microseconds to spin before blocking, set with ZMQ_BUSY_POLL.
+    int _busy_poll;
+
+    //  Bitmask of the I/O threads that spin, 0 meaning all of them.
+    int _busy_poll_threads;
+
+    //  Milliseconds between I/O thread load samples, set with
+    //  ZMQ_IO_LOAD_IVL.
+    int _io_load_ivl;
+
+    //  Busy time gap between I/O threads, in permille, above which they
+    //  pass sessions on, set with ZMQ_IO_REBALANCE.
+    int _io_rebalance;
+
+    //  NUMA mode, set with ZMQ_NUMA.
+    bool _numa;
+
+    //  In NUMA mode, the CPUs of each NUMA node, and the node each I/O
+    //  thread runs on.
+    std::vector<std::set<int> > _numa_nodes;
+    std::vector<int> _io_thread_nodes;
+
     ZMQ_NON_COPYABLE_NOR_MOVABLE (ctx_t)
 
 #ifdef HAVE_FORK
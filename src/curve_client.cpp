@@ -175,11 +175,22 @@ int zmq::curve_client_t::process_welcome (const uint8_t *msg_data_,
 
 int zmq::curve_client_t::produce_initiate (msg_t *msg_)
 {
-    const size_t metadata_length = basic_properties_len ();
+    const std::string cipher_offer = data_cipher_offer ();
+    const size_t cipher_offer_length =
+      cipher_offer.empty ()
+        ? 0
+        : property_len (ZMTP_PROPERTY_CURVEZMQ_CIPHER, cipher_offer.size ());
+    const size_t metadata_length =
+      basic_properties_len () + cipher_offer_length;
     std::vector<unsigned char, secure_allocator_t<unsigned char> >
       metadata_plaintext (metadata_length);
 
-    add_basic_properties (&metadata_plaintext[0], metadata_length);
+    const size_t basic_length =
+      add_basic_properties (&metadata_plaintext[0], metadata_length);
+    if (cipher_offer_length > 0)
+        add_property (&metadata_plaintext[basic_length], cipher_offer_length,
+                      ZMTP_PROPERTY_CURVEZMQ_CIPHER, cipher_offer.data (),
+                      cipher_offer.size ());
 
     const size_t msg_size =
       113 + 128 + crypto_box_BOXZEROBYTES + metadata_length;
@@ -29,6 +29,7 @@
 
 
 #include "precompiled.hpp"
+#include "macros.hpp"
 #include "curve_mechanism_base.hpp"
 #include "msg.hpp"
 #include "wire.hpp"
@@ -45,12 +46,116 @@ zmq::curve_mechanism_base_t::curve_mechanism_base_t (
     encode_nonce_prefix (encode_nonce_prefix_),
     decode_nonce_prefix (decode_nonce_prefix_),
     cn_nonce (1),
-    cn_peer_nonce (1)
+    cn_peer_nonce (1),
+    _data_cipher (cipher_box)
 {
 }
 
+static const char aes256gcm_name[] = "AES-256-GCM";
+static const char chacha20poly1305_name[] = "ChaCha20-Poly1305";
+
+//  Returns the next name in the space separated list_, starting at *pos_,
+//  and moves *pos_ past it. Returns an empty string at the end of list_.
+static std::string next_cipher_name (const std::string &list_, size_t *pos_)
+{
+    const size_t begin = list_.find_first_not_of (' ', *pos_);
+    if (begin == std::string::npos) {
+        *pos_ = list_.size ();
+        return std::string ();
+    }
+    size_t end = list_.find (' ', begin);
+    if (end == std::string::npos)
+        end = list_.size ();
+    *pos_ = end;
+    return list_.substr (begin, end - begin);
+}
+
+std::string zmq::curve_mechanism_base_t::default_data_ciphers ()
+{
+    std::string ciphers;
+#ifdef ZMQ_HAVE_CURVE_AEAD
+    //  AES-GCM is only faster where the CPU implements it.
+    if (crypto_aead_aes256gcm_is_available ()) {
+        ciphers += aes256gcm_name;
+        ciphers += ' ';
+    }
+    ciphers += chacha20poly1305_name;
+#endif
+    return ciphers;
+}
+
+bool zmq::curve_mechanism_base_t::data_ciphers_available (
+  const std::string &ciphers_)
+{
+    size_t pos = 0;
+    std::string name;
+    while (!(name = next_cipher_name (ciphers_, &pos)).empty ()) {
+#ifdef ZMQ_HAVE_CURVE_AEAD
+        if (name == aes256gcm_name && crypto_aead_aes256gcm_is_available ())
+            continue;
+        if (name == chacha20poly1305_name)
+            continue;
+#endif
+        return false;
+    }
+    return true;
+}
+
+std::string zmq::curve_mechanism_base_t::data_cipher_offer () const
+{
+    return options.curve_ciphers_set ? options.curve_ciphers
+                                     : default_data_ciphers ();
+}
+
+std::string zmq::curve_mechanism_base_t::data_cipher_choice () const
+{
+    switch (_data_cipher) {
+        case cipher_aes256gcm:
+            return aes256gcm_name;
+        case cipher_chacha20poly1305:
+            return chacha20poly1305_name;
+        default:
+            return std::string ();
+    }
+}
+
+int zmq::curve_mechanism_base_t::property (const std::string &name_,
+                                           const void *value_,
+                                           size_t length_)
+{
+    if (name_ != ZMTP_PROPERTY_CURVEZMQ_CIPHER)
+        return 0;
+
+#ifdef ZMQ_HAVE_CURVE_AEAD
+    //  Our own offer only names ciphers available here, so any name found
+    //  in both lists can be used.
+    const std::string offer (static_cast<const char *> (value_), length_);
+    const std::string accepted = " " + data_cipher_offer () + " ";
+    size_t pos = 0;
+    std::string name;
+    while (_data_cipher == cipher_box
+           && !(name = next_cipher_name (offer, &pos)).empty ()) {
+        if (accepted.find (" " + name + " ") == std::string::npos)
+            continue;
+        if (name == aes256gcm_name)
+            select_data_cipher (cipher_aes256gcm);
+        else if (name == chacha20poly1305_name)
+            select_data_cipher (cipher_chacha20poly1305);
+    }
+#else
+    LIBZMQ_UNUSED (value_);
+    LIBZMQ_UNUSED (length_);
+#endif
+    return 0;
+}
+
 int zmq::curve_mechanism_base_t::encode (msg_t *msg_)
 {
+#ifdef ZMQ_HAVE_CURVE_AEAD
+    if (_data_cipher != cipher_box)
+        return encode_aead (msg_);
+#endif
+
     const size_t mlen = crypto_box_ZEROBYTES + 1 + msg_->size ();
 
     uint8_t message_nonce[crypto_box_NONCEBYTES];
@@ -63,35 +168,33 @@ int zmq::curve_mechanism_base_t::encode (msg_t *msg_)
     if (msg_->flags () & msg_t::command)
         flags |= 0x02;
 
-    std::vector<uint8_t> message_plaintext (mlen);
+    //  The MESSAGE command is 16 bytes of header followed by the box minus
+    //  its crypto_box_BOXZEROBYTES leading zeros, i.e. exactly mlen bytes.
+    //  The padded plaintext is laid out in the outgoing message, boxed in
+    //  place and the zero padding is then overwritten by the header, so no
+    //  intermediate buffers are needed.
+    msg_t encoded;
+    int rc = encoded.init_size (16 + mlen - crypto_box_BOXZEROBYTES);
+    zmq_assert (rc == 0);
+
+    uint8_t *message = static_cast<uint8_t *> (encoded.data ());
 
-    std::fill (message_plaintext.begin (),
-               message_plaintext.begin () + crypto_box_ZEROBYTES, 0);
-    message_plaintext[crypto_box_ZEROBYTES] = flags;
+    memset (message, 0, crypto_box_ZEROBYTES);
+    message[crypto_box_ZEROBYTES] = flags;
     // this is copying the data from insecure memory, so there is no point in
-    // using secure_allocator_t for message_plaintext
+    // using secure memory for the plaintext
     if (msg_->size () > 0)
-        memcpy (&message_plaintext[crypto_box_ZEROBYTES + 1], msg_->data (),
+        memcpy (message + crypto_box_ZEROBYTES + 1, msg_->data (),
                 msg_->size ());
 
-    std::vector<uint8_t> message_box (mlen);
-
-    int rc = crypto_box_afternm (&message_box[0], &message_plaintext[0], mlen,
-                                 message_nonce, cn_precom);
-    zmq_assert (rc == 0);
-
-    rc = msg_->close ();
-    zmq_assert (rc == 0);
-
-    rc = msg_->init_size (16 + mlen - crypto_box_BOXZEROBYTES);
+    rc = crypto_box_afternm (message, message, mlen, message_nonce, cn_precom);
     zmq_assert (rc == 0);
 
-    uint8_t *message = static_cast<uint8_t *> (msg_->data ());
-
     memcpy (message, "\x07MESSAGE", 8);
     memcpy (message + 8, message_nonce + 16, 8);
-    memcpy (message + 16, &message_box[crypto_box_BOXZEROBYTES],
-            mlen - crypto_box_BOXZEROBYTES);
+
+    rc = msg_->move (encoded);
+    zmq_assert (rc == 0);
 
     cn_nonce++;
 
@@ -105,7 +208,7 @@ int zmq::curve_mechanism_base_t::decode (msg_t *msg_)
         return -1;
 
     const size_t size = msg_->size ();
-    const uint8_t *message = static_cast<uint8_t *> (msg_->data ());
+    uint8_t *message = static_cast<uint8_t *> (msg_->data ());
 
     if (size < 8 || memcmp (message, "\x07MESSAGE", 8)) {
         session->get_socket ()->event_handshake_failed_protocol (
@@ -134,36 +237,38 @@ int zmq::curve_mechanism_base_t::decode (msg_t *msg_)
     }
     cn_peer_nonce = nonce;
 
-    const size_t clen = crypto_box_BOXZEROBYTES + msg_->size () - 16;
-
-    std::vector<uint8_t> message_plaintext (clen);
-    std::vector<uint8_t> message_box (clen);
+#ifdef ZMQ_HAVE_CURVE_AEAD
+    if (_data_cipher != cipher_box)
+        return decode_aead (msg_, message + 8);
+#endif
 
-    std::fill (message_box.begin (),
-               message_box.begin () + crypto_box_BOXZEROBYTES, 0);
-    memcpy (&message_box[crypto_box_BOXZEROBYTES], message + 16,
-            msg_->size () - 16);
+    //  The 16 header bytes are exactly the space needed for the box's
+    //  crypto_box_BOXZEROBYTES leading zeros, so the received message is
+    //  turned into the box and opened in place.
+    const size_t clen = crypto_box_BOXZEROBYTES + size - 16;
+    uint8_t *const box = message + 16 - crypto_box_BOXZEROBYTES;
+    memset (box, 0, crypto_box_BOXZEROBYTES);
 
-    rc = crypto_box_open_afternm (&message_plaintext[0], &message_box[0], clen,
-                                  message_nonce, cn_precom);
+    rc = crypto_box_open_afternm (box, box, clen, message_nonce, cn_precom);
     if (rc == 0) {
-        rc = msg_->close ();
-        zmq_assert (rc == 0);
-
-        rc = msg_->init_size (clen - 1 - crypto_box_ZEROBYTES);
+        msg_t decoded;
+        rc = decoded.init_size (clen - 1 - crypto_box_ZEROBYTES);
         zmq_assert (rc == 0);
 
-        const uint8_t flags = message_plaintext[crypto_box_ZEROBYTES];
+        const uint8_t flags = box[crypto_box_ZEROBYTES];
         if (flags & 0x01)
-            msg_->set_flags (msg_t::more);
+            decoded.set_flags (msg_t::more);
         if (flags & 0x02)
-            msg_->set_flags (msg_t::command);
+            decoded.set_flags (msg_t::command);
 
         // this is copying the data to insecure memory, so there is no point in
-        // using secure_allocator_t for message_plaintext
-        if (msg_->size () > 0)
-            memcpy (msg_->data (), &message_plaintext[crypto_box_ZEROBYTES + 1],
-                    msg_->size ());
+        // using secure memory for the plaintext
+        if (decoded.size () > 0)
+            memcpy (decoded.data (), box + crypto_box_ZEROBYTES + 1,
+                    decoded.size ());
+
+        rc = msg_->move (decoded);
+        zmq_assert (rc == 0);
     } else {
         // CURVE I : connection key used for MESSAGE is wrong
         session->get_socket ()->event_handshake_failed_protocol (
@@ -174,4 +279,121 @@ int zmq::curve_mechanism_base_t::decode (msg_t *msg_)
     return rc;
 }
 
+#ifdef ZMQ_HAVE_CURVE_AEAD
+void zmq::curve_mechanism_base_t::select_data_cipher (data_cipher_t cipher_)
+{
+    _data_cipher = cipher_;
+
+    //  Bind the data phase key to the chosen cipher, so that it is never
+    //  used with more than one construction.
+    const std::string label =
+      std::string (ZMTP_PROPERTY_CURVEZMQ_CIPHER " ") + data_cipher_choice ();
+    int rc = crypto_generichash (
+      _data_key, sizeof _data_key,
+      reinterpret_cast<const unsigned char *> (label.data ()), label.size (),
+      cn_precom, sizeof cn_precom);
+    zmq_assert (rc == 0);
+
+    if (_data_cipher == cipher_aes256gcm) {
+        rc = crypto_aead_aes256gcm_beforenm (&_aes_state, _data_key);
+        zmq_assert (rc == 0);
+    }
+}
+
+//  With an AEAD cipher the MESSAGE command carries the flags and body
+//  encrypted in place, followed by the authentication tag. The command
+//  name and short nonce are authenticated as additional data. The 96-bit
+//  nonce is the last 4 bytes of the nonce prefix, which tell the two
+//  directions apart, followed by the 64-bit message counter.
+int zmq::curve_mechanism_base_t::encode_aead (msg_t *msg_)
+{
+    uint8_t message_nonce[12];
+    memcpy (message_nonce, encode_nonce_prefix + 12, 4);
+    put_uint64 (message_nonce + 4, cn_nonce);
+
+    uint8_t flags = 0;
+    if (msg_->flags () & msg_t::more)
+        flags |= 0x01;
+    if (msg_->flags () & msg_t::command)
+        flags |= 0x02;
+
+    const size_t mlen = 1 + msg_->size ();
+
+    msg_t encoded;
+    int rc = encoded.init_size (16 + mlen + 16);
+    zmq_assert (rc == 0);
+
+    uint8_t *message = static_cast<uint8_t *> (encoded.data ());
+
+    memcpy (message, "\x07MESSAGE", 8);
+    memcpy (message + 8, message_nonce + 4, 8);
+    message[16] = flags;
+    if (msg_->size () > 0)
+        memcpy (message + 17, msg_->data (), msg_->size ());
+
+    if (_data_cipher == cipher_aes256gcm)
+        rc = crypto_aead_aes256gcm_encrypt_detached_afternm (
+          message + 16, message + 16 + mlen, NULL, message + 16, mlen,
+          message, 16, NULL, message_nonce, &_aes_state);
+    else
+        rc = crypto_aead_chacha20poly1305_ietf_encrypt_detached (
+          message + 16, message + 16 + mlen, NULL, message + 16, mlen,
+          message, 16, NULL, message_nonce, _data_key);
+    zmq_assert (rc == 0);
+
+    rc = msg_->move (encoded);
+    zmq_assert (rc == 0);
+
+    cn_nonce++;
+
+    return 0;
+}
+
+int zmq::curve_mechanism_base_t::decode_aead (msg_t *msg_,
+                                              const uint8_t *nonce_)
+{
+    uint8_t message_nonce[12];
+    memcpy (message_nonce, decode_nonce_prefix + 12, 4);
+    memcpy (message_nonce + 4, nonce_, 8);
+
+    uint8_t *message = static_cast<uint8_t *> (msg_->data ());
+    const size_t clen = msg_->size () - 16 - 16;
+
+    int rc;
+    if (_data_cipher == cipher_aes256gcm)
+        rc = crypto_aead_aes256gcm_decrypt_detached_afternm (
+          message + 16, NULL, message + 16, clen, message + 16 + clen,
+          message, 16, message_nonce, &_aes_state);
+    else
+        rc = crypto_aead_chacha20poly1305_ietf_decrypt_detached (
+          message + 16, NULL, message + 16, clen, message + 16 + clen,
+          message, 16, message_nonce, _data_key);
+    if (rc != 0) {
+        // CURVE I : connection key used for MESSAGE is wrong
+        session->get_socket ()->event_handshake_failed_protocol (
+          session->get_endpoint (), ZMQ_PROTOCOL_ERROR_ZMTP_CRYPTOGRAPHIC);
+        errno = EPROTO;
+        return -1;
+    }
+
+    msg_t decoded;
+    rc = decoded.init_size (clen - 1);
+    zmq_assert (rc == 0);
+
+    const uint8_t flags = message[16];
+    if (flags & 0x01)
+        decoded.set_flags (msg_t::more);
+    if (flags & 0x02)
+        decoded.set_flags (msg_t::command);
+
+    if (decoded.size () > 0)
+        memcpy (decoded.data (), message + 17, decoded.size ());
+
+    rc = msg_->move (decoded);
+    zmq_assert (rc == 0);
+
+    return 0;
+}
+#endif
+
 #endif
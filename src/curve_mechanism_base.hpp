@@ -45,10 +45,22 @@
 #error "CURVE library not built properly"
 #endif
 
+//  libsodium provides AEAD constructions with hardware accelerated kernels
+//  (AES-NI/PCLMUL for AES-256-GCM, SSSE3/AVX2 for ChaCha20-Poly1305), which
+//  may be negotiated for the data phase instead of XSalsa20-Poly1305.
+#if defined(ZMQ_USE_LIBSODIUM)                                                 \
+  && defined(crypto_aead_chacha20poly1305_ietf_NPUBBYTES)
+#define ZMQ_HAVE_CURVE_AEAD
+#endif
+
 #include "mechanism_base.hpp"
 #include "options.hpp"
 
 #include <memory>
+#include <string>
+
+//  Metadata property used to negotiate the data phase cipher.
+#define ZMTP_PROPERTY_CURVEZMQ_CIPHER "CurveZMQ-Cipher"
 
 namespace zmq
 {
@@ -64,7 +76,29 @@ class curve_mechanism_base_t : public virtual mechanism_base_t
     int encode (msg_t *msg_) ZMQ_OVERRIDE;
     int decode (msg_t *msg_) ZMQ_OVERRIDE;
 
+    //  All the data phase ciphers available, in order of preference and
+    //  separated by spaces. Empty if there are none.
+    static std::string default_data_ciphers ();
+
+    //  Returns true if every cipher named in the space separated list
+    //  ciphers_ is available in this build and on this CPU.
+    static bool data_ciphers_available (const std::string &ciphers_);
+
   protected:
+    //  Value of the CurveZMQ-Cipher property offering the data phase
+    //  ciphers we accept, in order of preference. Empty if there are none.
+    std::string data_cipher_offer () const;
+
+    //  Value of the CurveZMQ-Cipher property confirming the cipher chosen
+    //  from the peer's offer. Empty if none was chosen.
+    std::string data_cipher_choice () const;
+
+    //  Picks the first cipher we accept from the peer's CurveZMQ-Cipher
+    //  property. Peers which do not send it keep using MESSAGE boxes.
+    int property (const std::string &name_,
+                  const void *value_,
+                  size_t length_) ZMQ_OVERRIDE;
+
     const char *encode_nonce_prefix;
     const char *decode_nonce_prefix;
 
@@ -73,6 +107,28 @@ class curve_mechanism_base_t : public virtual mechanism_base_t
 
     //  Intermediary buffer used to speed up boxing and unboxing.
     uint8_t cn_precom[crypto_box_BEFORENMBYTES];
+
+  private:
+    enum data_cipher_t
+    {
+        cipher_box,
+        cipher_aes256gcm,
+        cipher_chacha20poly1305
+    };
+
+    data_cipher_t _data_cipher;
+
+#ifdef ZMQ_HAVE_CURVE_AEAD
+    void select_data_cipher (data_cipher_t cipher_);
+    int encode_aead (msg_t *msg_);
+    int decode_aead (msg_t *msg_, const uint8_t *nonce_);
+
+    //  Data phase key derived from cn_precom.
+    uint8_t _data_key[32];
+
+    //  Expanded AES key, only valid with cipher_aes256gcm.
+    crypto_aead_aes256gcm_state _aes_state;
+#endif
 };
 }
 
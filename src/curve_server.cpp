@@ -434,7 +434,13 @@ int zmq::curve_server_t::process_initiate (msg_t *msg_)
 
 int zmq::curve_server_t::produce_ready (msg_t *msg_)
 {
-    const size_t metadata_length = basic_properties_len ();
+    const std::string cipher_choice = data_cipher_choice ();
+    const size_t cipher_choice_length =
+      cipher_choice.empty ()
+        ? 0
+        : property_len (ZMTP_PROPERTY_CURVEZMQ_CIPHER, cipher_choice.size ());
+    const size_t metadata_length =
+      basic_properties_len () + cipher_choice_length;
     uint8_t ready_nonce[crypto_box_NONCEBYTES];
 
     std::vector<uint8_t, secure_allocator_t<uint8_t> > ready_plaintext (
@@ -446,6 +452,10 @@ int zmq::curve_server_t::produce_ready (msg_t *msg_)
     uint8_t *ptr = &ready_plaintext[crypto_box_ZEROBYTES];
 
     ptr += add_basic_properties (ptr, metadata_length);
+    if (cipher_choice_length > 0)
+        ptr += add_property (ptr, cipher_choice_length,
+                             ZMTP_PROPERTY_CURVEZMQ_CIPHER,
+                             cipher_choice.data (), cipher_choice.size ());
     const size_t mlen = ptr - &ready_plaintext[0];
 
     memcpy (ready_nonce, "CurveZMQREADY---", 16);
@@ -57,13 +57,13 @@ template <typename T, typename A = c_single_allocator>
 class decoder_base_t : public i_decoder
 {
   public:
-    explicit decoder_base_t (const size_t buf_size_) :
+    decoder_base_t (const size_t buf_size_, allocator_t *allocator_) :
         _next (NULL),
         _read_pos (NULL),
         _to_read (0),
-        _allocator (buf_size_)
+        _allocator (buf_size_, allocator_),
+        _buf (NULL)
     {
-        _buf = _allocator.allocate ();
     }
 
     ~decoder_base_t () ZMQ_OVERRIDE { _allocator.deallocate (); }
@@ -152,6 +152,14 @@ class decoder_base_t : public i_decoder
         _allocator.resize (new_size_);
     }
 
+    void release_buffer () ZMQ_FINAL
+    {
+        _allocator.deallocate ();
+        _buf = NULL;
+    }
+
+    std::size_t buffer_size () const ZMQ_FINAL { return _allocator.memory (); }
+
   protected:
     //  Prototype of state machine action. Action should return false if
     //  it is unable to push the data to the system.
@@ -33,7 +33,8 @@
 #include "msg.hpp"
 
 zmq::shared_message_memory_allocator::shared_message_memory_allocator (
-  std::size_t bufsize_) :
+  std::size_t bufsize_, allocator_t *allocator_) :
+    _allocator (allocator_),
     _buf (NULL),
     _buf_size (0),
     _max_size (bufsize_),
@@ -43,7 +44,8 @@ zmq::shared_message_memory_allocator::shared_message_memory_allocator (
 }
 
 zmq::shared_message_memory_allocator::shared_message_memory_allocator (
-  std::size_t bufsize_, std::size_t max_messages_) :
+  std::size_t bufsize_, std::size_t max_messages_, allocator_t *allocator_) :
+    _allocator (allocator_),
     _buf (NULL),
     _buf_size (0),
     _max_size (bufsize_),
@@ -62,7 +64,7 @@ unsigned char *zmq::shared_message_memory_allocator::allocate ()
     if (_buf) {
         // release reference count to couple lifetime to messages
         zmq::atomic_counter_t *c =
-          reinterpret_cast<zmq::atomic_counter_t *> (_buf);
+          &reinterpret_cast<header_t *> (_buf)->refcnt;
 
         // if refcnt drops to 0, there are no message using the buffer
         // because either all messages have been closed or only vsm-messages
@@ -77,33 +79,33 @@ unsigned char *zmq::shared_message_memory_allocator::allocate ()
     // if buf != NULL it is not used by any message so we can re-use it for the next run
     if (!_buf) {
         // allocate memory for reference counters together with reception buffer
-        std::size_t const allocationsize =
-          _max_size + sizeof (zmq::atomic_counter_t)
-          + _max_counters * sizeof (zmq::msg_t::content_t);
+        std::size_t const allocationsize = allocation_size ();
 
-        _buf = static_cast<unsigned char *> (std::malloc (allocationsize));
+        _buf = static_cast<unsigned char *> (
+          _allocator->allocate (allocationsize, ZMQ_ALLOCATOR_DECODER));
         alloc_assert (_buf);
 
-        new (_buf) atomic_counter_t (1);
+        header_t *const header = new (_buf) header_t;
+        header->refcnt.set (1);
+        header->allocator = _allocator;
+        header->size = allocationsize;
     } else {
         // release reference count to couple lifetime to messages
         zmq::atomic_counter_t *c =
-          reinterpret_cast<zmq::atomic_counter_t *> (_buf);
+          &reinterpret_cast<header_t *> (_buf)->refcnt;
         c->set (1);
     }
 
     _buf_size = _max_size;
     _msg_content = reinterpret_cast<zmq::msg_t::content_t *> (
-      _buf + sizeof (atomic_counter_t) + _max_size);
-    return _buf + sizeof (zmq::atomic_counter_t);
+      _buf + sizeof (header_t) + _max_size);
+    return _buf + sizeof (header_t);
 }
 
 void zmq::shared_message_memory_allocator::deallocate ()
 {
-    zmq::atomic_counter_t *c = reinterpret_cast<zmq::atomic_counter_t *> (_buf);
-    if (_buf && !c->sub (1)) {
-        std::free (_buf);
-    }
+    if (_buf)
+        call_dec_ref (NULL, _buf);
     clear ();
 }
 
@@ -123,19 +125,19 @@ void zmq::shared_message_memory_allocator::clear ()
 
 void zmq::shared_message_memory_allocator::inc_ref ()
 {
-    (reinterpret_cast<zmq::atomic_counter_t *> (_buf))->add (1);
+    reinterpret_cast<header_t *> (_buf)->refcnt.add (1);
 }
 
 void zmq::shared_message_memory_allocator::call_dec_ref (void *, void *hint_)
 {
     zmq_assert (hint_);
-    unsigned char *buf = static_cast<unsigned char *> (hint_);
-    zmq::atomic_counter_t *c = reinterpret_cast<zmq::atomic_counter_t *> (buf);
+    header_t *const header = static_cast<header_t *> (hint_);
 
-    if (!c->sub (1)) {
-        c->~atomic_counter_t ();
-        std::free (buf);
-        buf = NULL;
+    if (!header->refcnt.sub (1)) {
+        allocator_t *const allocator = header->allocator;
+        const std::size_t size = header->size;
+        header->~header_t ();
+        allocator->deallocate (hint_, size, ZMQ_ALLOCATOR_DECODER);
     }
 }
 
@@ -145,7 +147,18 @@ std::size_t zmq::shared_message_memory_allocator::size () const
     return _buf_size;
 }
 
+std::size_t zmq::shared_message_memory_allocator::memory () const
+{
+    return _buf ? allocation_size () : 0;
+}
+
+std::size_t zmq::shared_message_memory_allocator::allocation_size () const
+{
+    return sizeof (header_t) + _max_size
+           + _max_counters * sizeof (zmq::msg_t::content_t);
+}
+
 unsigned char *zmq::shared_message_memory_allocator::data ()
 {
-    return _buf + sizeof (zmq::atomic_counter_t);
+    return _buf + sizeof (header_t);
 }
@@ -33,34 +33,57 @@
 #include <cstddef>
 #include <cstdlib>
 
+#include "allocator.hpp"
 #include "atomic_counter.hpp"
 #include "msg.hpp"
 #include "err.hpp"
 
 namespace zmq
 {
-// Static buffer policy.
+// Static buffer policy. The buffer is allocated on first use and kept
+// until deallocate is called.
 class c_single_allocator
 {
   public:
-    explicit c_single_allocator (std::size_t bufsize_) :
+    c_single_allocator (std::size_t bufsize_, allocator_t *allocator_) :
+        _allocator (allocator_),
+        _max_size (bufsize_),
         _buf_size (bufsize_),
-        _buf (static_cast<unsigned char *> (std::malloc (_buf_size)))
+        _buf (NULL)
     {
-        alloc_assert (_buf);
     }
 
-    ~c_single_allocator () { std::free (_buf); }
+    ~c_single_allocator () { deallocate (); }
 
-    unsigned char *allocate () { return _buf; }
+    allocator_t *allocator () const { return _allocator; }
 
-    void deallocate () {}
+    unsigned char *allocate ()
+    {
+        if (!_buf) {
+            _buf = static_cast<unsigned char *> (
+              _allocator->allocate (_max_size, ZMQ_ALLOCATOR_DECODER));
+            alloc_assert (_buf);
+            _buf_size = _max_size;
+        }
+        return _buf;
+    }
+
+    void deallocate ()
+    {
+        _allocator->deallocate (_buf, _max_size, ZMQ_ALLOCATOR_DECODER);
+        _buf = NULL;
+    }
 
     std::size_t size () const { return _buf_size; }
 
+    // Number of bytes held by the policy.
+    std::size_t memory () const { return _buf ? _max_size : 0; }
+
     void resize (std::size_t new_size_) { _buf_size = new_size_; }
 
   private:
+    allocator_t *const _allocator;
+    const std::size_t _max_size;
     std::size_t _buf_size;
     unsigned char *_buf;
 
@@ -79,14 +102,18 @@ class c_single_allocator
 class shared_message_memory_allocator
 {
   public:
-    explicit shared_message_memory_allocator (std::size_t bufsize_);
+    shared_message_memory_allocator (std::size_t bufsize_,
+                                     allocator_t *allocator_);
 
     // Create an allocator for a maximum number of messages
     shared_message_memory_allocator (std::size_t bufsize_,
-                                     std::size_t max_messages_);
+                                     std::size_t max_messages_,
+                                     allocator_t *allocator_);
 
     ~shared_message_memory_allocator ();
 
+    allocator_t *allocator () const { return _allocator; }
+
     // Allocate a new buffer
     //
     // This releases the current buffer to be bound to the lifetime of the messages
@@ -106,6 +133,10 @@ class shared_message_memory_allocator
 
     std::size_t size () const;
 
+    // Number of bytes held by the policy, not counting buffers released
+    // to messages.
+    std::size_t memory () const;
+
     // Return pointer to the first message data byte.
     unsigned char *data ();
 
@@ -119,8 +150,20 @@ class shared_message_memory_allocator
     void advance_content () { _msg_content++; }
 
   private:
+    // Starts every buffer. Messages may free the buffer after the decoder
+    // is gone, so it records how to.
+    struct header_t
+    {
+        atomic_counter_t refcnt;
+        allocator_t *allocator;
+        std::size_t size;
+    };
+
     void clear ();
 
+    std::size_t allocation_size () const;
+
+    allocator_t *const _allocator;
     unsigned char *_buf;
     std::size_t _buf_size;
     const std::size_t _max_size;
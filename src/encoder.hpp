@@ -41,7 +41,10 @@
 #include <stdlib.h>
 #include <algorithm>
 
+#include "allocator.hpp"
+#include "config.hpp"
 #include "err.hpp"
+#include "gather_buffer.hpp"
 #include "i_encoder.hpp"
 #include "msg.hpp"
 
@@ -54,31 +57,42 @@ namespace zmq
 template <typename T> class encoder_base_t : public i_encoder
 {
   public:
-    inline explicit encoder_base_t (size_t bufsize_) :
+    inline encoder_base_t (size_t bufsize_, allocator_t *allocator_) :
         _write_pos (0),
         _to_write (0),
         _next (NULL),
         _new_msg_flag (false),
+        _in_progress_referred (false),
+        _allocator (allocator_),
         _buf_size (bufsize_),
-        _buf (static_cast<unsigned char *> (malloc (bufsize_))),
+        _buf (NULL),
         _in_progress (NULL)
     {
-        alloc_assert (_buf);
     }
 
-    inline ~encoder_base_t () ZMQ_OVERRIDE { free (_buf); }
+    inline ~encoder_base_t () ZMQ_OVERRIDE
+    {
+        _allocator->deallocate (_buf, _buf_size, ZMQ_ALLOCATOR_ENCODER);
+    }
 
     //  The function returns a batch of binary data. The data
     //  are filled to a supplied buffer. If no buffer is supplied (data_
     //  points to NULL) decoder object will provide buffer of its own.
     inline size_t encode (unsigned char **data_, size_t size_) ZMQ_FINAL
     {
-        unsigned char *buffer = !*data_ ? _buf : *data_;
-        const size_t buffersize = !*data_ ? _buf_size : size_;
-
         if (in_progress () == NULL)
             return 0;
 
+        //  The buffer is allocated on first use only.
+        if (!*data_ && !_buf) {
+            _buf = static_cast<unsigned char *> (
+              _allocator->allocate (_buf_size, ZMQ_ALLOCATOR_ENCODER));
+            alloc_assert (_buf);
+        }
+
+        unsigned char *buffer = !*data_ ? _buf : *data_;
+        const size_t buffersize = !*data_ ? _buf_size : size_;
+
         size_t pos = 0;
         while (pos < buffersize) {
             //  If there are no more data to return, run the state machine.
@@ -126,6 +140,69 @@ template <typename T> class encoder_base_t : public i_encoder
         return pos;
     }
 
+#if defined ZMQ_HAVE_UIO
+    size_t encode (gather_buffer_t *buffer_, size_t size_) ZMQ_FINAL
+    {
+        if (in_progress () == NULL)
+            return 0;
+
+        size_t pos = 0;
+        while (true) {
+            if (!_to_write) {
+                //  The message is finished as soon as its last chunk is
+                //  in, so that it is held by the batch its data went to.
+                if (_new_msg_flag) {
+                    //  The buffer keeps the message alive until its data
+                    //  has been written.
+                    if (_in_progress_referred)
+                        buffer_->hold (_in_progress);
+                    else {
+                        int rc = _in_progress->close ();
+                        errno_assert (rc == 0);
+                        rc = _in_progress->init ();
+                        errno_assert (rc == 0);
+                    }
+                    _in_progress_referred = false;
+                    _in_progress = NULL;
+                    break;
+                }
+                (static_cast<T *> (this)->*_next) ();
+            }
+
+            if (buffer_->size () >= size_ || buffer_->full ())
+                break;
+
+            if (_to_write >= gather_copy_threshold) {
+                if (!buffer_->refer (_write_pos, _to_write))
+                    break;
+                _in_progress_referred = true;
+                pos += _to_write;
+                _write_pos = NULL;
+                _to_write = 0;
+            } else {
+                const size_t copied = buffer_->copy (_write_pos, _to_write);
+                if (!copied && _to_write)
+                    break;
+                pos += copied;
+                _write_pos += copied;
+                _to_write -= copied;
+            }
+        }
+
+        return pos;
+    }
+
+    bool supports_gather () const ZMQ_OVERRIDE { return true; }
+#endif
+
+    void release_buffer () ZMQ_FINAL
+    {
+        _allocator->deallocate (_buf, _buf_size, ZMQ_ALLOCATOR_ENCODER);
+        _buf = NULL;
+    }
+
+    size_t buffer_size () const ZMQ_FINAL { return _buf ? _buf_size : 0; }
+
     void load_msg (msg_t *msg_) ZMQ_FINAL
     {
         zmq_assert (in_progress () == NULL);
@@ -165,9 +242,15 @@ template <typename T> class encoder_base_t : public i_encoder
 
     bool _new_msg_flag;
 
-    //  The buffer for encoded data.
+    //  True iff the gather variant of encode refers to the data of the
+    //  message in progress.
+    bool _in_progress_referred;
+
+    allocator_t *const _allocator;
+
+    //  The buffer for encoded data, NULL until first used.
     const size_t _buf_size;
-    unsigned char *const _buf;
+    unsigned char *_buf;
 
     msg_t *_in_progress;
 
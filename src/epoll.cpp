@@ -95,6 +95,8 @@ zmq::epoll_t::handle_t zmq::epoll_t::add_fd (fd_t fd_, i_poll_events *events_)
     pe->ev.events = 0;
     pe->ev.data.ptr = pe;
     pe->events = events_;
+    pe->requested = 0;
+    pe->pending = false;
 
     const int rc = epoll_ctl (_epoll_fd, EPOLL_CTL_ADD, fd_, &pe->ev);
     errno_assert (rc != -1);
@@ -122,36 +124,55 @@ void zmq::epoll_t::set_pollin (handle_t handle_)
 {
     check_thread ();
     poll_entry_t *pe = static_cast<poll_entry_t *> (handle_);
-    pe->ev.events |= EPOLLIN;
-    const int rc = epoll_ctl (_epoll_fd, EPOLL_CTL_MOD, pe->fd, &pe->ev);
-    errno_assert (rc != -1);
+    request (pe, pe->requested | EPOLLIN);
 }
 
 void zmq::epoll_t::reset_pollin (handle_t handle_)
 {
     check_thread ();
     poll_entry_t *pe = static_cast<poll_entry_t *> (handle_);
-    pe->ev.events &= ~(static_cast<short> (EPOLLIN));
-    const int rc = epoll_ctl (_epoll_fd, EPOLL_CTL_MOD, pe->fd, &pe->ev);
-    errno_assert (rc != -1);
+    request (pe, pe->requested & ~static_cast<uint32_t> (EPOLLIN));
 }
 
 void zmq::epoll_t::set_pollout (handle_t handle_)
 {
     check_thread ();
     poll_entry_t *pe = static_cast<poll_entry_t *> (handle_);
-    pe->ev.events |= EPOLLOUT;
-    const int rc = epoll_ctl (_epoll_fd, EPOLL_CTL_MOD, pe->fd, &pe->ev);
-    errno_assert (rc != -1);
+    request (pe, pe->requested | EPOLLOUT);
 }
 
 void zmq::epoll_t::reset_pollout (handle_t handle_)
 {
     check_thread ();
     poll_entry_t *pe = static_cast<poll_entry_t *> (handle_);
-    pe->ev.events &= ~(static_cast<short> (EPOLLOUT));
-    const int rc = epoll_ctl (_epoll_fd, EPOLL_CTL_MOD, pe->fd, &pe->ev);
-    errno_assert (rc != -1);
+    request (pe, pe->requested & ~static_cast<uint32_t> (EPOLLOUT));
+}
+
+void zmq::epoll_t::request (poll_entry_t *pe_, uint32_t events_)
+{
+    pe_->requested = events_;
+    if (!pe_->pending && pe_->requested != pe_->ev.events) {
+        pe_->pending = true;
+        _pending.push_back (pe_);
+    }
+}
+
+void zmq::epoll_t::apply_requests ()
+{
+    for (std::vector<poll_entry_t *>::iterator it = _pending.begin (),
+                                               end = _pending.end ();
+         it != end; ++it) {
+        poll_entry_t *pe = *it;
+        pe->pending = false;
+
+        //  Skip entries removed since, and changes that cancelled out.
+        if (pe->fd == retired_fd || pe->requested == pe->ev.events)
+            continue;
+        pe->ev.events = pe->requested;
+        const int rc = epoll_ctl (_epoll_fd, EPOLL_CTL_MOD, pe->fd, &pe->ev);
+        errno_assert (rc != -1);
+    }
+    _pending.clear ();
 }
 
 void zmq::epoll_t::stop ()
@@ -180,9 +201,32 @@ void zmq::epoll_t::loop ()
             continue;
         }
 
-        //  Wait for events.
-        const int n = epoll_wait (_epoll_fd, &ev_buf[0], max_io_events,
-                                  timeout ? timeout : -1);
+        apply_requests ();
+
+        //  Wait for events. A busy polling thread spins on non-blocking
+        //  waits first, which saves the wake-up when traffic is dense.
+        wait_begin ();
+        int n = 0;
+        int wait_timeout = timeout ? timeout : -1;
+        if (get_busy_poll () > 0) {
+            uint64_t spin = static_cast<uint64_t> (get_busy_poll ());
+            if (timeout && spin > static_cast<uint64_t> (timeout) * 1000)
+                spin = static_cast<uint64_t> (timeout) * 1000;
+            const uint64_t start = clock_t::now_us ();
+            uint64_t elapsed = 0;
+            do {
+                n = epoll_wait (_epoll_fd, &ev_buf[0], max_io_events, 0);
+                elapsed = clock_t::now_us () - start;
+            } while (n == 0 && elapsed < spin);
+            if (timeout) {
+                const int spent = static_cast<int> (elapsed / 1000);
+                wait_timeout = timeout > spent ? timeout - spent : 0;
+            }
+        }
+        if (n == 0)
+            n = epoll_wait (_epoll_fd, &ev_buf[0], max_io_events,
+                            wait_timeout);
+        wait_end (n);
         if (n == -1) {
             errno_assert (errno == EINTR);
             continue;
@@ -198,14 +242,20 @@ void zmq::epoll_t::loop ()
                 pe->events->in_event ();
             if (pe->fd == retired_fd)
                 continue;
-            if (ev_buf[i].events & EPOLLOUT)
+            //  Events may have been disabled by an earlier callback, with
+            //  epoll not yet told about it.
+            if (ev_buf[i].events & pe->requested & EPOLLOUT)
                 pe->events->out_event ();
             if (pe->fd == retired_fd)
                 continue;
-            if (ev_buf[i].events & EPOLLIN)
+            if (ev_buf[i].events & pe->requested & EPOLLIN)
                 pe->events->in_event ();
         }
 
+        //  Apply the changes made by the callbacks while the entries of
+        //  retired event sources still exist.
+        apply_requests ();
+
         //  Destroy retired event sources.
         for (retired_t::iterator it = _retired.begin (), end = _retired.end ();
              it != end; ++it) {
@@ -54,6 +54,11 @@ struct i_poll_events;
 
 //  This class implements socket polling mechanism using the Linux-specific
 //  epoll mechanism.
+//
+//  Changes to the events polled for are not passed to epoll right away,
+//  but collected and applied before waiting for events. Engines typically
+//  enable and disable pollout around each message they send; such changes
+//  cancel out and then cost no system call at all.
 
 class epoll_t ZMQ_FINAL : public worker_poller_base_t
 {
@@ -89,20 +94,36 @@ class epoll_t ZMQ_FINAL : public worker_poller_base_t
     //  Main event loop.
     void loop () ZMQ_FINAL;
 
+    struct poll_entry_t;
+
+    //  Records that the events requested for the entry changed.
+    void request (poll_entry_t *pe_, uint32_t events_);
+
+    //  Passes the pending changes of the events polled for to epoll.
+    void apply_requests ();
+
     //  Main epoll file descriptor
     epoll_fd_t _epoll_fd;
 
     struct poll_entry_t
     {
         fd_t fd;
+        //  Events as registered with epoll.
         epoll_event ev;
         zmq::i_poll_events *events;
+        //  Events requested by the set_* and reset_* methods.
+        uint32_t requested;
+        //  Whether the entry is in the list of pending requests.
+        bool pending;
     };
 
     //  List of retired event sources.
     typedef std::vector<poll_entry_t *> retired_t;
     retired_t _retired;
 
+    //  Entries whose requested events may differ from the registered ones.
+    std::vector<poll_entry_t *> _pending;
+
     ZMQ_NON_COPYABLE_NOR_MOVABLE (epoll_t)
 };
 
@@ -33,7 +33,7 @@
 #include "err.hpp"
 #include "msg.hpp"
 
-zmq::fq_t::fq_t () : _active (0), _last_in (NULL), _current (0), _more (false)
+zmq::fq_t::fq_t () : _last_in (NULL), _more (false)
 {
 }
 
@@ -45,22 +45,14 @@ zmq::fq_t::~fq_t ()
 void zmq::fq_t::attach (pipe_t *pipe_)
 {
     _pipes.push_back (pipe_);
-    _pipes.swap (_active, _pipes.size () - 1);
-    _active++;
+    _active.push_back (pipe_);
 }
 
 void zmq::fq_t::pipe_terminated (pipe_t *pipe_)
 {
-    const pipes_t::size_type index = _pipes.index (pipe_);
-
-    //  Remove the pipe from the list; adjust number of active pipes
-    //  accordingly.
-    if (index < _active) {
-        _active--;
-        _pipes.swap (index, _active);
-        if (_current == _active)
-            _current = 0;
-    }
+    //  Remove the pipe from the list and from the active ring.
+    if (active_t::contains (pipe_))
+        _active.erase (pipe_);
     _pipes.erase (pipe_);
 
     if (_last_in == pipe_) {
@@ -70,9 +62,9 @@ void zmq::fq_t::pipe_terminated (pipe_t *pipe_)
 
 void zmq::fq_t::activated (pipe_t *pipe_)
 {
-    //  Move the pipe to the list of active pipes.
-    _pipes.swap (_pipes.index (pipe_), _active);
-    _active++;
+    //  Put the pipe at the end of the current round.
+    zmq_assert (!active_t::contains (pipe_));
+    _active.push_back (pipe_);
 }
 
 int zmq::fq_t::recv (msg_t *msg_)
@@ -87,21 +79,20 @@ int zmq::fq_t::recvpipe (msg_t *msg_, pipe_t **pipe_)
     errno_assert (rc == 0);
 
     //  Round-robin over the pipes to get the next message.
-    while (_active > 0) {
+    while (!_active.empty ()) {
+        pipe_t *const current = _active.current ();
+
         //  Try to fetch new message. If we've already read part of the message
         //  subsequent part should be immediately available.
-        const bool fetched = _pipes[_current]->read (msg_);
+        const bool fetched = current->read (msg_);
 
-        //  Note that when message is not fetched, current pipe is deactivated
-        //  and replaced by another active pipe. Thus we don't have to increase
-        //  the 'current' pointer.
         if (fetched) {
             if (pipe_)
-                *pipe_ = _pipes[_current];
+                *pipe_ = current;
             _more = (msg_->flags () & msg_t::more) != 0;
             if (!_more) {
-                _last_in = _pipes[_current];
-                _current = (_current + 1) % _active;
+                _last_in = current;
+                _active.advance ();
             }
             return 0;
         }
@@ -111,10 +102,8 @@ int zmq::fq_t::recvpipe (msg_t *msg_, pipe_t **pipe_)
         //  we should get the remaining parts without blocking.
         zmq_assert (!_more);
 
-        _active--;
-        _pipes.swap (_current, _active);
-        if (_current == _active)
-            _current = 0;
+        //  Deactivate the pipe. Its successor gets the turn.
+        _active.erase (current);
     }
 
     //  No message is available. Initialise the output parameter
@@ -131,19 +120,16 @@ bool zmq::fq_t::has_in ()
     if (_more)
         return true;
 
-    //  Note that messing with current doesn't break the fairness of fair
-    //  queueing algorithm. If there are no messages available current will
-    //  get back to its original value. Otherwise it'll point to the first
-    //  pipe holding messages, skipping only pipes with no messages available.
-    while (_active > 0) {
-        if (_pipes[_current]->check_read ())
+    //  Note that skipping pipes doesn't break the fairness of fair queueing
+    //  algorithm. Only pipes with no messages available are taken out of
+    //  the ring; the others keep their order.
+    while (!_active.empty ()) {
+        pipe_t *const current = _active.current ();
+        if (current->check_read ())
             return true;
 
         //  Deactivate the pipe.
-        _active--;
-        _pipes.swap (_current, _active);
-        if (_current == _active)
-            _current = 0;
+        _active.erase (current);
     }
 
     return false;
@@ -31,6 +31,7 @@
 #define __ZMQ_FQ_HPP_INCLUDED__
 
 #include "array.hpp"
+#include "ring.hpp"
 #include "blob.hpp"
 
 namespace zmq
@@ -61,18 +62,17 @@ class fq_t
     typedef array_t<pipe_t, 1> pipes_t;
     pipes_t _pipes;
 
-    //  Number of active pipes. All the active pipes are located at the
-    //  beginning of the pipes array.
-    pipes_t::size_type _active;
+    //  The pipes which may have messages to read, in round-robin order.
+    //  A pipe leaves the ring when reading from it fails and is put back
+    //  at the end of the round when it gets activated again.
+    typedef ring_t<pipe_t, 1> active_t;
+    active_t _active;
 
     //  Pointer to the last pipe we received message from.
     //  NULL when no message has been received or the pipe
     //  has terminated.
     pipe_t *_last_in;
 
-    //  Index of the next bound pipe to read a message from.
-    pipes_t::size_type _current;
-
     //  If true, part of a multipart message was already received, but
     //  there are following parts still waiting in the current pipe.
     bool _more;
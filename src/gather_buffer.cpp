@@ -0,0 +1,241 @@
+/*
+    Copyright (c) 2007-2016 Contributors as noted in the AUTHORS file
+
+    This file is part of libzmq, the ZeroMQ core engine in C++.
+
+    libzmq is free software; you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    As a special exception, the Contributors give you permission to link
+    this library with independent modules to produce an executable,
+    regardless of the license terms of these independent modules, and to
+    copy and distribute the resulting executable under terms of your choice,
+    provided that you also meet, for each linked independent module, the
+    terms and conditions of the license of that module. An independent
+    module is a module which is not derived from or based on this library.
+    If you modify this library, you must extend this exception to your
+    version of the library.
+
+    libzmq is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "precompiled.hpp"
+
+#if defined ZMQ_HAVE_UIO
+
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+
+#include "gather_buffer.hpp"
+#include "err.hpp"
+
+zmq::gather_buffer_t::gather_buffer_t (size_t scratch_size_) :
+    _first (0),
+    _count (0),
+    _size (0),
+    _largest_referred (0),
+    _scratch_size (scratch_size_),
+    _scratch_used (0),
+    _scratch (static_cast<unsigned char *> (malloc (scratch_size_))),
+    _held_count (0)
+#if defined ZMQ_HAVE_TCP_ZEROCOPY
+    ,
+    _zerocopy (false),
+    _last_id (0),
+    _next_id (0),
+    _done_id (0)
+#endif
+{
+    alloc_assert (_scratch);
+}
+
+zmq::gather_buffer_t::~gather_buffer_t ()
+{
+#if defined ZMQ_HAVE_TCP_ZEROCOPY
+    //  The zero-copy reaper waited for the completions as long as it
+    //  could; whatever is left is freed regardless.
+    _zerocopy = false;
+    for (std::deque<retained_t>::iterator it = _retained.begin (),
+                                          end = _retained.end ();
+         it != end; ++it) {
+        for (size_t i = 0; i != it->msgs.size (); i++) {
+            const int rc = it->msgs[i].close ();
+            errno_assert (rc == 0);
+        }
+        free (it->scratch);
+    }
+#endif
+    clear ();
+    free (_scratch);
+}
+
+size_t zmq::gather_buffer_t::copy (const unsigned char *data_, size_t size_)
+{
+    const size_t to_copy = std::min (size_, _scratch_size - _scratch_used);
+    if (to_copy == 0)
+        return 0;
+
+    unsigned char *const pos = _scratch + _scratch_used;
+
+    //  Extend the last segment if it ends where the new data starts,
+    //  so that consecutive small chunks make up a single segment.
+    if (_count > _first
+        && static_cast<unsigned char *> (_segments[_count - 1].iov_base)
+               + _segments[_count - 1].iov_len
+             == pos)
+        _segments[_count - 1].iov_len += to_copy;
+    else {
+        if (_count == max_gather_segments)
+            return 0;
+        _segments[_count].iov_base = pos;
+        _segments[_count].iov_len = to_copy;
+        _count++;
+    }
+
+    memcpy (pos, data_, to_copy);
+    _scratch_used += to_copy;
+    _size += to_copy;
+    return to_copy;
+}
+
+bool zmq::gather_buffer_t::refer (const unsigned char *data_, size_t size_)
+{
+    if (_count == max_gather_segments)
+        return false;
+
+    _segments[_count].iov_base = const_cast<unsigned char *> (data_);
+    _segments[_count].iov_len = size_;
+    _count++;
+    _size += size_;
+    _largest_referred = std::max (_largest_referred, size_);
+    return true;
+}
+
+void zmq::gather_buffer_t::hold (msg_t *msg_)
+{
+    zmq_assert (_held_count < max_gather_segments);
+
+    msg_t &held = _held[_held_count++];
+    int rc = held.init ();
+    errno_assert (rc == 0);
+    rc = held.move (*msg_);
+    errno_assert (rc == 0);
+}
+
+bool zmq::gather_buffer_t::full () const
+{
+    return _count == max_gather_segments || _scratch_used == _scratch_size;
+}
+
+void zmq::gather_buffer_t::consume (size_t size_)
+{
+    zmq_assert (size_ <= _size);
+    _size -= size_;
+
+    while (size_ > 0) {
+        iovec &segment = _segments[_first];
+        if (size_ < segment.iov_len) {
+            segment.iov_base = static_cast<unsigned char *> (segment.iov_base)
+                               + size_;
+            segment.iov_len -= size_;
+            break;
+        }
+        size_ -= segment.iov_len;
+        _first++;
+    }
+}
+
+bool zmq::gather_buffer_t::idle () const
+{
+#if defined ZMQ_HAVE_TCP_ZEROCOPY
+    if (_zerocopy || !_retained.empty ())
+        return false;
+#endif
+    return _size == 0;
+}
+
+void zmq::gather_buffer_t::clear ()
+{
+#if defined ZMQ_HAVE_TCP_ZEROCOPY
+    if (_zerocopy)
+        retain ();
+#endif
+    for (size_t i = 0; i != _held_count; i++) {
+        const int rc = _held[i].close ();
+        errno_assert (rc == 0);
+    }
+    _held_count = 0;
+    _first = 0;
+    _count = 0;
+    _size = 0;
+    _largest_referred = 0;
+    _scratch_used = 0;
+}
+
+#if defined ZMQ_HAVE_TCP_ZEROCOPY
+void zmq::gather_buffer_t::sent_zerocopy ()
+{
+    _zerocopy = true;
+    _last_id = _next_id++;
+}
+
+void zmq::gather_buffer_t::completed_zerocopy (uint32_t lo_, uint32_t hi_)
+{
+    if (lo_ != _done_id) {
+        _completed[lo_] = hi_;
+        return;
+    }
+
+    _done_id = hi_ + 1;
+    std::map<uint32_t, uint32_t>::iterator it;
+    while ((it = _completed.find (_done_id)) != _completed.end ()) {
+        _done_id = it->second + 1;
+        _completed.erase (it);
+    }
+
+    //  Ids wrap around, hence the signed distance.
+    while (!_retained.empty ()
+           && static_cast<int32_t> (_done_id - _retained.front ().last_id)
+                > 0) {
+        retained_t &retained = _retained.front ();
+        for (size_t i = 0; i != retained.msgs.size (); i++) {
+            const int rc = retained.msgs[i].close ();
+            errno_assert (rc == 0);
+        }
+        free (retained.scratch);
+        _retained.pop_front ();
+    }
+}
+
+void zmq::gather_buffer_t::retain ()
+{
+    _retained.push_back (retained_t ());
+    retained_t &retained = _retained.back ();
+    retained.last_id = _last_id;
+
+    //  The scratch area goes with the batch, the next one gets a new one.
+    retained.scratch = _scratch;
+    _scratch = static_cast<unsigned char *> (malloc (_scratch_size));
+    alloc_assert (_scratch);
+
+    retained.msgs.resize (_held_count);
+    for (size_t i = 0; i != _held_count; i++) {
+        retained.msgs[i] = _held[i];
+        const int rc = _held[i].init ();
+        errno_assert (rc == 0);
+    }
+    _zerocopy = false;
+}
+#endif
+
+#endif
@@ -0,0 +1,165 @@
+/*
+    Copyright (c) 2007-2016 Contributors as noted in the AUTHORS file
+
+    This file is part of libzmq, the ZeroMQ core engine in C++.
+
+    libzmq is free software; you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    As a special exception, the Contributors give you permission to link
+    this library with independent modules to produce an executable,
+    regardless of the license terms of these independent modules, and to
+    copy and distribute the resulting executable under terms of your choice,
+    provided that you also meet, for each linked independent module, the
+    terms and conditions of the license of that module. An independent
+    module is a module which is not derived from or based on this library.
+    If you modify this library, you must extend this exception to your
+    version of the library.
+
+    libzmq is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef __ZMQ_GATHER_BUFFER_HPP_INCLUDED__
+#define __ZMQ_GATHER_BUFFER_HPP_INCLUDED__
+
+#if defined ZMQ_HAVE_UIO
+
+#include <stddef.h>
+#include <sys/uio.h>
+#if defined ZMQ_HAVE_TCP_ZEROCOPY
+#include <deque>
+#include <map>
+#include <vector>
+#endif
+
+#include "config.hpp"
+#include "macros.hpp"
+#include "msg.hpp"
+#include "stdint.hpp"
+
+namespace zmq
+{
+//  Batch of outgoing data to be written with a single gather write.
+//  Small chunks such as frame headers are copied into a scratch area,
+//  while message bodies are referred to in place. Messages whose data
+//  is referred to are held by the batch until it is cleared.
+
+class gather_buffer_t
+{
+  public:
+    explicit gather_buffer_t (size_t scratch_size_);
+    ~gather_buffer_t ();
+
+    //  Copies up to size_ bytes into the scratch area and returns the
+    //  number of bytes actually copied.
+    size_t copy (const unsigned char *data_, size_t size_);
+
+    //  Appends a segment referring to size_ bytes at data_. Returns false
+    //  if there is no free segment left.
+    bool refer (const unsigned char *data_, size_t size_);
+
+    //  Keeps the content of msg_ alive until the batch is cleared.
+    //  msg_ is left empty.
+    void hold (msg_t *msg_);
+
+    //  Returns true if no further data can be appended.
+    bool full () const;
+
+    //  Number of bytes still to be written.
+    size_t size () const { return _size; }
+
+    const iovec *segments () const { return _segments + _first; }
+    int segment_count () const { return static_cast<int> (_count - _first); }
+
+    //  Drops size_ bytes, already written, from the front of the batch.
+    void consume (size_t size_);
+
+    //  Releases the held messages and empties the batch.
+    void clear ();
+
+    //  Size of the largest segment referring to message data in place.
+    size_t largest_referred () const { return _largest_referred; }
+
+    //  Returns true if all the data has been written and none of it
+    //  may still be read by the kernel, so that the batch can be freed.
+    bool idle () const;
+
+    //  Number of bytes held by the batch itself.
+    size_t memory () const { return sizeof (*this) + _scratch_size; }
+
+#if defined ZMQ_HAVE_TCP_ZEROCOPY
+    //  Records that data of the batch was passed to the kernel with
+    //  MSG_ZEROCOPY. When cleared, the batch then keeps its messages and
+    //  scratch area until the kernel reports that send as completed.
+    void sent_zerocopy ();
+
+    //  Takes note of the kernel having completed the zero-copy sends with
+    //  ids lo_ to hi_ and releases the batches no longer referred to.
+    void completed_zerocopy (uint32_t lo_, uint32_t hi_);
+
+    //  Returns true if cleared batches still wait for the kernel to
+    //  complete their zero-copy sends.
+    bool zerocopy_pending () const { return !_retained.empty (); }
+#endif
+
+  private:
+    iovec _segments[max_gather_segments];
+
+    //  Index of the first segment not yet written and number of
+    //  segments in use.
+    size_t _first;
+    size_t _count;
+
+    size_t _size;
+
+    size_t _largest_referred;
+
+    const size_t _scratch_size;
+    size_t _scratch_used;
+    unsigned char *_scratch;
+
+    //  Each held message has a segment referring to it.
+    msg_t _held[max_gather_segments];
+    size_t _held_count;
+
+#if defined ZMQ_HAVE_TCP_ZEROCOPY
+    //  Data of a cleared batch the kernel may still be sending from.
+    struct retained_t
+    {
+        uint32_t last_id;
+        unsigned char *scratch;
+        std::vector<msg_t> msgs;
+    };
+    std::deque<retained_t> _retained;
+
+    //  True iff the current batch was sent with MSG_ZEROCOPY; its last
+    //  send got _last_id.
+    bool _zerocopy;
+    uint32_t _last_id;
+
+    //  Id the kernel assigns to the next zero-copy send, and id of the
+    //  first send not known to be completed. Completions reported out of
+    //  order are kept in _completed until the gap is closed.
+    uint32_t _next_id;
+    uint32_t _done_id;
+    std::map<uint32_t, uint32_t> _completed;
+
+    void retain ();
+#endif
+
+    ZMQ_NON_COPYABLE_NOR_MOVABLE (gather_buffer_t)
+};
+}
+
+#endif
+
+#endif
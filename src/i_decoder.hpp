@@ -55,6 +55,13 @@ class i_decoder
     decode (const unsigned char *data_, size_t size_, size_t &processed_) = 0;
 
     virtual msg_t *msg () = 0;
+
+    //  Frees the decoder's buffer until get_buffer is called again. All
+    //  the data read into it must have been decoded by then.
+    virtual void release_buffer () = 0;
+
+    //  Returns the number of bytes held in the decoder's buffer.
+    virtual size_t buffer_size () const = 0;
 };
 }
 
@@ -37,6 +37,7 @@ namespace zmq
 {
 //  Forward declaration
 class msg_t;
+class gather_buffer_t;
 
 //  Interface to be implemented by message encoder.
 
@@ -52,6 +53,25 @@ struct i_encoder
 
     //  Load a new message into encoder.
     virtual void load_msg (msg_t *msg_) = 0;
+
+    //  Frees the encoder's own buffer until it is needed again. All the
+    //  data encoded into it must have been written by then.
+    virtual void release_buffer () = 0;
+
+    //  Returns the number of bytes held in the encoder's own buffer.
+    virtual size_t buffer_size () const = 0;
+
+#if defined ZMQ_HAVE_UIO
+    //  Gather variant of encode. Appends the encoded data to buffer_ until
+    //  it holds at least size_ bytes or is full, referring to message
+    //  bodies in place rather than copying them. Returns the number of
+    //  bytes appended; 0 when a new message is required.
+    virtual size_t encode (gather_buffer_t *buffer_, size_t size_) = 0;
+
+    //  Returns false if the encoded data may live in buffers the encoder
+    //  reuses, in which case the gather variant must not be used.
+    virtual bool supports_gather () const = 0;
+#endif
 };
 }
 
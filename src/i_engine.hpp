@@ -72,6 +72,15 @@ struct i_engine
     virtual void zap_msg_available () = 0;
 
     virtual const endpoint_uri_pair_t &get_endpoint () const = 0;
+
+    //  Detaches the engine from its I/O thread, so that the session
+    //  can move it to another one. Returns false, and leaves the engine
+    //  alone, if the engine cannot move in its current state.
+    virtual bool migrate_out () = 0;
+
+    //  Attaches an engine detached with migrate_out to io_thread_. It
+    //  resumes where it stopped.
+    virtual void migrate_in (zmq::io_thread_t *io_thread_) = 0;
 };
 }
 
@@ -100,6 +100,37 @@ void zmq::io_object_t::cancel_timer (int id_)
     _poller->cancel_timer (this, id_);
 }
 
+#if defined ZMQ_IOTHREAD_POLLER_USE_IO_URING
+bool zmq::io_object_t::set_ring_io (handle_t handle_,
+                                    size_t in_size_,
+                                    size_t out_size_)
+{
+    return _poller->set_ring_io (handle_, in_size_, out_size_);
+}
+
+int zmq::io_object_t::ring_read (handle_t handle_, void *data_, size_t size_)
+{
+    return _poller->ring_read (handle_, data_, size_);
+}
+
+int zmq::io_object_t::ring_writev (handle_t handle_,
+                                   const iovec *iov_,
+                                   int iovcnt_)
+{
+    return _poller->ring_writev (handle_, iov_, iovcnt_);
+}
+
+bool zmq::io_object_t::detach_ring_io (handle_t handle_)
+{
+    return _poller->detach_ring_io (handle_);
+}
+#endif
+
+void zmq::io_object_t::add_traffic (size_t bytes_)
+{
+    _poller->add_traffic (bytes_);
+}
+
 void zmq::io_object_t::in_event ()
 {
     zmq_assert (false);
@@ -67,6 +67,15 @@ class io_object_t : public i_poll_events
     void reset_pollout (handle_t handle_);
     void add_timer (int timeout_, int id_);
     void cancel_timer (int id_);
+#if defined ZMQ_IOTHREAD_POLLER_USE_IO_URING
+    bool set_ring_io (handle_t handle_, size_t in_size_, size_t out_size_);
+    int ring_read (handle_t handle_, void *data_, size_t size_);
+    int ring_writev (handle_t handle_, const iovec *iov_, int iovcnt_);
+    bool detach_ring_io (handle_t handle_);
+#endif
+
+    //  Accounts for bytes_ transferred to the load of the I/O thread.
+    void add_traffic (size_t bytes_);
 
     //  i_poll_events interface implementation.
     void in_event () ZMQ_OVERRIDE;
@@ -30,15 +30,29 @@
 #include "precompiled.hpp"
 
 #include <new>
+#include <algorithm>
+#include <limits.h>
+#include <time.h>
+#include <vector>
 
 #include "macros.hpp"
 #include "io_thread.hpp"
+#include "clock.hpp"
 #include "err.hpp"
 #include "ctx.hpp"
+#include "likely.hpp"
+#include "session_base.hpp"
 
 zmq::io_thread_t::io_thread_t (ctx_t *ctx_, uint32_t tid_) :
     object_t (ctx_, tid_),
-    _mailbox_handle (static_cast<poller_t::handle_t> (NULL))
+    _mailbox_handle (static_cast<poller_t::handle_t> (NULL)),
+    _load_ivl (0),
+    _rebalance (0),
+    _sample_time (0),
+    _sample_busy_time (0),
+    _sample_traffic (0),
+    _sample_events (0),
+    _sample_cpu_time (0)
 {
     _poller = new (std::nothrow) poller_t (*ctx_);
     alloc_assert (_poller);
@@ -78,6 +92,20 @@ int zmq::io_thread_t::get_load () const
     return _poller->get_load ();
 }
 
+int zmq::io_thread_t::get_cost () const
+{
+    return _poller->get_load () + static_cast<int> (_weight.get ())
+           + static_cast<int> (_cost.get ());
+}
+
+void zmq::io_thread_t::adjust_weight (int amount_)
+{
+    if (amount_ > 0)
+        _weight.add (amount_);
+    else if (amount_ < 0)
+        _weight.sub (-amount_);
+}
+
 void zmq::io_thread_t::in_event ()
 {
     //  TODO: Do we want to limit number of commands I/O thread can
@@ -87,8 +115,15 @@ void zmq::io_thread_t::in_event ()
     int rc = _mailbox.recv (&cmd, 0);
 
     while (rc == 0 || errno == EINTR) {
-        if (rc == 0)
-            cmd.destination->process_command (cmd);
+        if (rc == 0) {
+            //  Objects that moved to another I/O thread get their commands
+            //  relayed by this one, so that they stay in order.
+            const uint32_t host_tid = cmd.destination->get_host_tid ();
+            if (unlikely (host_tid != get_tid ()))
+                get_ctx ()->send_command (host_tid, cmd);
+            else
+                cmd.destination->process_command (cmd);
+        }
         rc = _mailbox.recv (&cmd, 0);
     }
 
@@ -101,10 +136,148 @@ void zmq::io_thread_t::out_event ()
     zmq_assert (false);
 }
 
-void zmq::io_thread_t::timer_event (int)
+void zmq::io_thread_t::timer_event (int id_)
 {
-    //  No timers here. This function is never called.
-    zmq_assert (false);
+    zmq_assert (id_ == load_timer_id);
+    sample_load ();
+    if (_rebalance > 0)
+        rebalance ();
+    _poller->add_timer (_load_ivl, this, load_timer_id);
+}
+
+void zmq::io_thread_t::set_load_sampling (int ivl_, int rebalance_)
+{
+    zmq_assert (_load_ivl == 0);
+    if (ivl_ <= 0)
+        return;
+
+    //  The CPU time has to be read by the I/O thread itself, so the first
+    //  sample taken there only sets the starting point.
+    _load_ivl = ivl_;
+    _rebalance = rebalance_;
+    _poller->add_timer (_load_ivl, this, load_timer_id);
+}
+
+void zmq::io_thread_t::get_load_sample (int *busy_,
+                                        int *traffic_,
+                                        int *migrations_,
+                                        int *cost_) const
+{
+    *busy_ = static_cast<int> (_busy.get ());
+    *traffic_ = static_cast<int> (_traffic.get ());
+    *migrations_ = static_cast<int> (_migrations.get ());
+    *cost_ = static_cast<int> (_cost.get ());
+}
+
+void zmq::io_thread_t::register_session (session_base_t *session_)
+{
+    _sessions.insert (session_);
+}
+
+void zmq::io_thread_t::unregister_session (session_base_t *session_)
+{
+    _sessions.erase (session_);
+}
+
+uint64_t zmq::io_thread_t::thread_cpu_time () const
+{
+#if defined CLOCK_THREAD_CPUTIME_ID
+    struct timespec ts;
+    if (clock_gettime (CLOCK_THREAD_CPUTIME_ID, &ts) == 0)
+        return static_cast<uint64_t> (ts.tv_sec) * 1000000
+               + static_cast<uint64_t> (ts.tv_nsec) / 1000;
+#endif
+    //  Where the CPU time is unknown, the time spent busy approximates it.
+    return _poller->get_busy_time ();
+}
+
+void zmq::io_thread_t::sample_load ()
+{
+    const uint64_t now = clock_t::now_us ();
+    const uint64_t busy_time = _poller->get_busy_time ();
+    const uint64_t traffic = _poller->get_traffic ();
+    const uint64_t events = _poller->get_events ();
+    const uint64_t cpu_time = thread_cpu_time ();
+    const uint64_t elapsed = now - _sample_time;
+    if (_sample_time != 0 && elapsed > 0) {
+        const uint64_t busy = (busy_time - _sample_busy_time) * 1000 / elapsed;
+        const uint64_t kib_per_sec =
+          (traffic - _sample_traffic) * 1000000 / elapsed / 1024;
+        _busy.set (static_cast<atomic_counter_t::integer_t> (
+          std::min (busy, static_cast<uint64_t> (1000))));
+        _traffic.set (static_cast<atomic_counter_t::integer_t> (
+          std::min (kib_per_sec, static_cast<uint64_t> (INT_MAX))));
+
+        //  A thread using a whole core weighs as much as a thousand idle
+        //  connections, as does one moving a GiB/s or handling a million
+        //  events per second. Each sample counts for a quarter of the cost.
+        const uint64_t cpu = (cpu_time - _sample_cpu_time) * 1000 / elapsed;
+        const uint64_t events_per_ms = (events - _sample_events) * 1000 / elapsed;
+        const uint64_t cost =
+          std::min (cpu + kib_per_sec / 1024 + events_per_ms,
+                    static_cast<uint64_t> (INT_MAX / 4));
+        _cost.set (static_cast<atomic_counter_t::integer_t> (
+          (_cost.get () * 3 + cost) / 4));
+    }
+    _sample_time = now;
+    _sample_busy_time = busy_time;
+    _sample_traffic = traffic;
+    _sample_events = events;
+    _sample_cpu_time = cpu_time;
+}
+
+void zmq::io_thread_t::rebalance ()
+{
+    //  Weigh the sessions by the messages they passed since the last
+    //  sample. This has to be done every time to restart the counts.
+    typedef std::pair<uint64_t, session_base_t *> candidate_t;
+    std::vector<candidate_t> candidates;
+    uint64_t total = 0;
+    for (std::set<session_base_t *>::iterator it = _sessions.begin (),
+                                               end = _sessions.end ();
+         it != end; ++it) {
+        const uint64_t msgs = (*it)->take_activity ();
+        if (msgs > 0) {
+            candidates.push_back (candidate_t (msgs, *it));
+            total += msgs;
+        }
+    }
+    if (total == 0)
+        return;
+
+    //  Find the least busy I/O thread.
+    std::vector<io_thread_t *> io_threads;
+    get_ctx ()->get_io_threads (0, &io_threads);
+    const int busy = static_cast<int> (_busy.get ());
+    io_thread_t *target = NULL;
+    int target_busy = busy;
+    for (size_t i = 0; i != io_threads.size (); i++) {
+        const int other_busy = static_cast<int> (io_threads[i]->_busy.get ());
+        if (io_threads[i] != this && other_busy < target_busy) {
+            target = io_threads[i];
+            target_busy = other_busy;
+        }
+    }
+    const int gap = busy - target_busy;
+    if (target == NULL || gap < _rebalance)
+        return;
+
+    //  Move the busiest session whose share of the load is less than the
+    //  gap, so that the target does not end up busier than this thread.
+    //  A session that carries the bulk of the load stays where it is.
+    std::sort (candidates.begin (), candidates.end ());
+    for (std::vector<candidate_t>::reverse_iterator it = candidates.rbegin (),
+                                                    end = candidates.rend ();
+         it != end; ++it) {
+        const uint64_t share = busy * it->first / total;
+        if (share >= static_cast<uint64_t> (gap))
+            continue;
+        if (it->second->migrate (target)) {
+            _sessions.erase (it->second);
+            _migrations.add (1);
+            return;
+        }
+    }
 }
 
 zmq::poller_t *zmq::io_thread_t::get_poller () const
@@ -117,5 +290,7 @@ void zmq::io_thread_t::process_stop ()
 {
     zmq_assert (_mailbox_handle);
     _poller->rm_fd (_mailbox_handle);
+    if (_load_ivl > 0)
+        _poller->cancel_timer (this, load_timer_id);
     _poller->stop ();
 }
@@ -30,7 +30,10 @@
 #ifndef __ZMQ_IO_THREAD_HPP_INCLUDED__
 #define __ZMQ_IO_THREAD_HPP_INCLUDED__
 
+#include <set>
+
 #include "stdint.hpp"
+#include "atomic_counter.hpp"
 #include "object.hpp"
 #include "poller.hpp"
 #include "i_poll_events.hpp"
@@ -39,6 +42,7 @@
 namespace zmq
 {
 class ctx_t;
+class session_base_t;
 
 //  Generic part of the I/O thread. Polling-mechanism-specific features
 //  are implemented in separate "polling objects".
@@ -75,7 +79,42 @@ class io_thread_t ZMQ_FINAL : public object_t, public i_poll_events
     //  Returns load experienced by the I/O thread.
     int get_load () const;
 
+    //  Returns the load used to place new objects on the thread: its file
+    //  descriptors, the weights declared by its sessions and, if sampled,
+    //  its decayed cost. May be called from any thread.
+    int get_cost () const;
+
+    //  Adds amount_ to the weights declared by the thread's sessions.
+    void adjust_weight (int amount_);
+
+    //  Makes the thread sample its load every ivl_ milliseconds, and
+    //  pass sessions to less busy threads when it is busier than them by
+    //  rebalance_ permille or more (0 = never). Call before start.
+    void set_load_sampling (int ivl_, int rebalance_);
+
+    //  Returns the figures of the last load sample. May be called from
+    //  any thread.
+    void get_load_sample (int *busy_,
+                          int *traffic_,
+                          int *migrations_,
+                          int *cost_) const;
+
+    //  Sessions created in this thread register here to be considered
+    //  for rebalancing.
+    void register_session (zmq::session_base_t *session_);
+    void unregister_session (zmq::session_base_t *session_);
+
   private:
+    //  Returns the CPU time the thread used so far, in microseconds.
+    uint64_t thread_cpu_time () const;
+
+    //  Measures the busy time and traffic since the previous sample.
+    void sample_load ();
+
+    //  Moves a session to the least busy I/O thread if that helps.
+    void rebalance ();
+
+
     //  I/O thread accesses incoming commands via this mailbox.
     mailbox_t _mailbox;
 
@@ -85,6 +124,42 @@ class io_thread_t ZMQ_FINAL : public object_t, public i_poll_events
     //  I/O multiplexing is performed using a poller object.
     poller_t *_poller;
 
+    //  ID of the load sampling timer.
+    enum
+    {
+        load_timer_id = 0x10
+    };
+
+    //  Milliseconds between load samples, 0 if not sampling.
+    int _load_ivl;
+
+    //  Busy time gap, in permille, that triggers rebalancing.
+    int _rebalance;
+
+    //  Time, busy time, traffic, events and CPU time of the thread at the
+    //  previous sample. The time is 0 before the first one.
+    uint64_t _sample_time;
+    uint64_t _sample_busy_time;
+    uint64_t _sample_traffic;
+    uint64_t _sample_events;
+    uint64_t _sample_cpu_time;
+
+    //  Figures of the last sample: busy permille and KiB/s. Read by other
+    //  threads, like the number of sessions migrated away.
+    atomic_counter_t _busy;
+    atomic_counter_t _traffic;
+    atomic_counter_t _migrations;
+
+    //  Exponentially decayed sum of the CPU permille, MiB/s and events
+    //  per millisecond of the samples.
+    atomic_counter_t _cost;
+
+    //  Weights declared by the sessions living in the thread.
+    atomic_counter_t _weight;
+
+    //  Sessions that may move to another I/O thread.
+    std::set<session_base_t *> _sessions;
+
     ZMQ_NON_COPYABLE_NOR_MOVABLE (io_thread_t)
 };
 }
@@ -0,0 +1,830 @@
+/*
+    Copyright (c) 2007-2016 Contributors as noted in the AUTHORS file
+
+    This file is part of libzmq, the ZeroMQ core engine in C++.
+
+    libzmq is free software; you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    As a special exception, the Contributors give you permission to link
+    this library with independent modules to produce an executable,
+    regardless of the license terms of these independent modules, and to
+    copy and distribute the resulting executable under terms of your choice,
+    provided that you also meet, for each linked independent module, the
+    terms and conditions of the license of that module. An independent
+    module is a module which is not derived from or based on this library.
+    If you modify this library, you must extend this exception to your
+    version of the library.
+
+    libzmq is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "precompiled.hpp"
+#if defined ZMQ_IOTHREAD_POLLER_USE_IO_URING
+#include "io_uring.hpp"
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <poll.h>
+#include <endian.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <algorithm>
+#include <new>
+
+#include "macros.hpp"
+#include "err.hpp"
+#include "config.hpp"
+#include "i_poll_events.hpp"
+
+//  The user_data value of requests whose completions are of no interest,
+//  i.e. poll removals.
+static const uint64_t ignored_user_data = 0;
+
+//  The user_data of the other requests is the address of the entry, with
+//  the kind of request in the low bits.
+enum
+{
+    poll_request = 0,
+    recv_request = 1,
+    send_request = 2
+};
+static const uint64_t request_mask = 3;
+
+static uint64_t user_data (void *pe_, int request_)
+{
+    return reinterpret_cast<uint64_t> (pe_) | request_;
+}
+
+static int sys_io_uring_setup (unsigned entries_, io_uring_params *params_)
+{
+    return static_cast<int> (syscall (__NR_io_uring_setup, entries_, params_));
+}
+
+static int sys_io_uring_enter (int fd_,
+                               unsigned to_submit_,
+                               unsigned min_complete_,
+                               unsigned flags_,
+                               const void *arg_,
+                               size_t argsz_)
+{
+    return static_cast<int> (syscall (__NR_io_uring_enter, fd_, to_submit_,
+                                      min_complete_, flags_, arg_, argsz_));
+}
+
+#if defined IORING_ASYNC_CANCEL_FD_FIXED
+static int sys_io_uring_register (int fd_,
+                                  unsigned opcode_,
+                                  void *arg_,
+                                  unsigned nr_args_)
+{
+    return static_cast<int> (
+      syscall (__NR_io_uring_register, fd_, opcode_, arg_, nr_args_));
+}
+#endif
+
+static void *map_ring (int fd_, size_t size_, off_t offset_)
+{
+    void *ptr = mmap (NULL, size_, PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_POPULATE, fd_, offset_);
+    errno_assert (ptr != MAP_FAILED);
+    return ptr;
+}
+
+zmq::io_uring_t::io_uring_t (const zmq::thread_ctx_t &ctx_) :
+    worker_poller_base_t (ctx_),
+    _to_submit (0)
+{
+    io_uring_params params;
+    memset (&params, 0, sizeof params);
+    _ring_fd = sys_io_uring_setup (max_io_events, &params);
+    errno_assert (_ring_fd != -1);
+
+    //  Waiting with a timeout relies on IORING_ENTER_EXT_ARG and the
+    //  removal of requests on the kernel not dropping completions.
+    zmq_assert ((params.features & IORING_FEAT_EXT_ARG)
+                && (params.features & IORING_FEAT_NODROP));
+
+    _sq_ring_size = params.sq_off.array + params.sq_entries * sizeof (unsigned);
+    _cq_ring_size =
+      params.cq_off.cqes + params.cq_entries * sizeof (io_uring_cqe);
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        _sq_ring_size = _cq_ring_size =
+          std::max (_sq_ring_size, _cq_ring_size);
+        _sq_ring = map_ring (_ring_fd, _sq_ring_size, IORING_OFF_SQ_RING);
+        _cq_ring = _sq_ring;
+    } else {
+        _sq_ring = map_ring (_ring_fd, _sq_ring_size, IORING_OFF_SQ_RING);
+        _cq_ring = map_ring (_ring_fd, _cq_ring_size, IORING_OFF_CQ_RING);
+    }
+    _sqes_size = params.sq_entries * sizeof (io_uring_sqe);
+    _sqes = static_cast<io_uring_sqe *> (
+      map_ring (_ring_fd, _sqes_size, IORING_OFF_SQES));
+
+    unsigned char *sq = static_cast<unsigned char *> (_sq_ring);
+    _sq_head = reinterpret_cast<unsigned *> (sq + params.sq_off.head);
+    _sq_tail = reinterpret_cast<unsigned *> (sq + params.sq_off.tail);
+    _sq_mask = *reinterpret_cast<unsigned *> (sq + params.sq_off.ring_mask);
+    _sq_entries = params.sq_entries;
+    _sq_array = reinterpret_cast<unsigned *> (sq + params.sq_off.array);
+
+    unsigned char *cq = static_cast<unsigned char *> (_cq_ring);
+    _cq_head = reinterpret_cast<unsigned *> (cq + params.cq_off.head);
+    _cq_tail = reinterpret_cast<unsigned *> (cq + params.cq_off.tail);
+    _cq_mask = *reinterpret_cast<unsigned *> (cq + params.cq_off.ring_mask);
+    _cqes = reinterpret_cast<io_uring_cqe *> (cq + params.cq_off.cqes);
+}
+
+zmq::io_uring_t::~io_uring_t ()
+{
+    //  Wait till the worker thread exits.
+    stop_worker ();
+
+    //  Closing the ring cancels any requests still owned by the kernel,
+    //  so the entries referred to by them can be released afterwards.
+    munmap (_sqes, _sqes_size);
+    if (_cq_ring != _sq_ring)
+        munmap (_cq_ring, _cq_ring_size);
+    munmap (_sq_ring, _sq_ring_size);
+    close (_ring_fd);
+
+    //  Release the entries that were retired but not yet reconciled.
+    for (entries_t::iterator it = _dirty.begin (), end = _dirty.end ();
+         it != end; ++it) {
+        if ((*it)->fd == retired_fd
+            && std::find (_retired.begin (), _retired.end (), *it)
+                 == _retired.end ())
+            release (*it);
+    }
+    for (entries_t::iterator it = _retired.begin (), end = _retired.end ();
+         it != end; ++it) {
+        release (*it);
+    }
+}
+
+zmq::io_uring_t::handle_t zmq::io_uring_t::add_fd (fd_t fd_,
+                                                   i_poll_events *events_)
+{
+    check_thread ();
+    poll_entry_t *pe = new (std::nothrow) poll_entry_t;
+    alloc_assert (pe);
+
+    pe->fd = fd_;
+    pe->events = events_;
+    pe->mask = 0;
+    pe->armed_mask = 0;
+    pe->armed = false;
+    pe->cancelling = false;
+    pe->dirty = false;
+    pe->ready = false;
+    pe->io = NULL;
+
+    //  Increase the load metric of the thread.
+    adjust_load (1);
+
+    return pe;
+}
+
+void zmq::io_uring_t::rm_fd (handle_t handle_)
+{
+    check_thread ();
+    poll_entry_t *pe = static_cast<poll_entry_t *> (handle_);
+    pe->fd = retired_fd;
+    pe->mask = 0;
+    mark_dirty (pe);
+
+    //  Output already accepted still goes out, unless the socket is full.
+    if (pe->io && pe->io->send_blocked) {
+        pe->io->send_blocked = false;
+        pe->io->out_pos = pe->io->out_end;
+    }
+
+    if (pe->armed || pe->io)
+        _retired.push_back (pe);
+
+    //  Decrease the load metric of the thread.
+    adjust_load (-1);
+}
+
+void zmq::io_uring_t::set_pollin (handle_t handle_)
+{
+    check_thread ();
+    poll_entry_t *pe = static_cast<poll_entry_t *> (handle_);
+    pe->mask |= POLLIN;
+    mark_dirty (pe);
+    if (pe->io)
+        check_ready (pe);
+}
+
+void zmq::io_uring_t::reset_pollin (handle_t handle_)
+{
+    check_thread ();
+    poll_entry_t *pe = static_cast<poll_entry_t *> (handle_);
+    pe->mask &= ~static_cast<unsigned int> (POLLIN);
+    mark_dirty (pe);
+}
+
+void zmq::io_uring_t::set_pollout (handle_t handle_)
+{
+    check_thread ();
+    poll_entry_t *pe = static_cast<poll_entry_t *> (handle_);
+    pe->mask |= POLLOUT;
+    mark_dirty (pe);
+    if (pe->io)
+        check_ready (pe);
+}
+
+void zmq::io_uring_t::reset_pollout (handle_t handle_)
+{
+    check_thread ();
+    poll_entry_t *pe = static_cast<poll_entry_t *> (handle_);
+    pe->mask &= ~static_cast<unsigned int> (POLLOUT);
+    mark_dirty (pe);
+}
+
+void zmq::io_uring_t::stop ()
+{
+    check_thread ();
+}
+
+bool zmq::io_uring_t::set_ring_io (handle_t handle_,
+                                   size_t in_size_,
+                                   size_t out_size_)
+{
+    check_thread ();
+    poll_entry_t *pe = static_cast<poll_entry_t *> (handle_);
+    zmq_assert (!pe->io && !pe->armed);
+
+    const fd_t fd = fcntl (pe->fd, F_DUPFD_CLOEXEC, 0);
+    if (fd == -1)
+        return false;
+
+    ring_io_t *io = new (std::nothrow) ring_io_t;
+    alloc_assert (io);
+    io->fd = fd;
+    io->in_buf = static_cast<unsigned char *> (malloc (in_size_));
+    alloc_assert (io->in_buf);
+    io->in_size = in_size_;
+    io->in_pos = 0;
+    io->in_end = 0;
+    io->recv_pending = false;
+    io->recv_cancelling = false;
+    io->drained = false;
+    io->eof = false;
+    io->in_error = 0;
+    io->out_buf = static_cast<unsigned char *> (malloc (out_size_));
+    alloc_assert (io->out_buf);
+    io->out_size = out_size_;
+    io->out_pos = 0;
+    io->out_end = 0;
+    io->send_pending = false;
+    io->send_blocked = false;
+    io->out_error = 0;
+
+    pe->io = io;
+    mark_dirty (pe);
+    return true;
+}
+
+int zmq::io_uring_t::ring_read (handle_t handle_, void *data_, size_t size_)
+{
+    check_thread ();
+    poll_entry_t *pe = static_cast<poll_entry_t *> (handle_);
+    ring_io_t *io = pe->io;
+
+    size_t n = std::min (size_, io->in_end - io->in_pos);
+    memcpy (data_, io->in_buf + io->in_pos, n);
+    io->in_pos += n;
+
+    //  Once the buffer is drained, the next receive can be submitted.
+    //  Until it is, a caller reading into memory larger than the buffer,
+    //  i.e. the body of a large message, reads directly rather than having
+    //  all of it copied once more. Bytes must not be read past a receive
+    //  in flight, though.
+    if (io->in_pos == io->in_end) {
+        mark_dirty (pe);
+        if (!io->recv_pending && size_ > io->in_size)
+            n += read_direct (io, static_cast<char *> (data_) + n, size_ - n);
+    }
+    check_ready (pe);
+    if (n == 0) {
+        if (io->eof)
+            return 0;
+        errno = io->in_error ? io->in_error : EAGAIN;
+        return -1;
+    }
+    return static_cast<int> (n);
+}
+
+size_t zmq::io_uring_t::read_direct (ring_io_t *io_, char *data_, size_t size_)
+{
+    if (size_ == 0 || io_->eof || io_->in_error)
+        return 0;
+
+    const ssize_t rc = recv (io_->fd, data_, size_, MSG_DONTWAIT);
+    io_->drained = rc < static_cast<ssize_t> (size_);
+    if (rc > 0)
+        return static_cast<size_t> (rc);
+    if (rc == 0)
+        io_->eof = true;
+    else if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+        errno_assert (errno != EBADF && errno != EFAULT && errno != ENOMEM
+                      && errno != ENOTSOCK);
+        io_->in_error = errno;
+    }
+    return 0;
+}
+
+int zmq::io_uring_t::ring_writev (handle_t handle_,
+                                  const iovec *iov_,
+                                  int iovcnt_)
+{
+    check_thread ();
+    poll_entry_t *pe = static_cast<poll_entry_t *> (handle_);
+    ring_io_t *io = pe->io;
+
+    if (io->out_error) {
+        errno = io->out_error;
+        return -1;
+    }
+
+    size_t size = 0;
+    for (int i = 0; i != iovcnt_; i++)
+        size += iov_[i].iov_len;
+
+    //  More than a batch, i.e. the body of a large message, is sent
+    //  directly if nothing is waiting to be sent before it. If the socket
+    //  does not take all of it, the entry is polled for output, as with
+    //  any other poller, rather than having the rest copied.
+    if (size > io->out_size / 2 && io->out_pos == io->out_end
+        && !io->send_pending && !io->send_blocked) {
+        msghdr msg;
+        memset (&msg, 0, sizeof msg);
+        msg.msg_iov = const_cast<iovec *> (iov_);
+        msg.msg_iovlen = iovcnt_;
+        const ssize_t rc = sendmsg (io->fd, &msg, MSG_DONTWAIT | MSG_NOSIGNAL);
+        if (rc == -1 && errno != EAGAIN && errno != EWOULDBLOCK) {
+            if (errno == EINTR)
+                return 0;
+            errno_assert (errno != EACCES && errno != EBADF
+                          && errno != EDESTADDRREQ && errno != EFAULT
+                          && errno != EINVAL && errno != EISCONN
+                          && errno != EMSGSIZE && errno != ENOMEM
+                          && errno != ENOTSOCK && errno != EOPNOTSUPP);
+            io->out_error = errno;
+            return -1;
+        }
+        if (rc != static_cast<ssize_t> (size)) {
+            io->send_blocked = true;
+            mark_dirty (pe);
+        }
+        return rc == -1 ? 0 : static_cast<int> (rc);
+    }
+
+    const size_t end = io->out_end;
+    for (int i = 0; i != iovcnt_; i++) {
+        const size_t n =
+          std::min (iov_[i].iov_len, io->out_size - io->out_end);
+        memcpy (io->out_buf + io->out_end, iov_[i].iov_base, n);
+        io->out_end += n;
+        if (n != iov_[i].iov_len)
+            break;
+    }
+    if (io->out_end != end)
+        mark_dirty (pe);
+    return static_cast<int> (io->out_end - end);
+}
+
+bool zmq::io_uring_t::detach_ring_io (handle_t handle_)
+{
+    check_thread ();
+    poll_entry_t *pe = static_cast<poll_entry_t *> (handle_);
+    ring_io_t *io = pe->io;
+
+    if (io->in_pos != io->in_end || io->eof || io->in_error
+        || io->out_pos != io->out_end || io->send_pending || io->out_error)
+        return false;
+    if (!io->recv_pending)
+        return true;
+
+    //  The receive may complete with data before it is cancelled, so the
+    //  cancellation has to be done here and now, and its outcome looked
+    //  up among the completions not reaped yet. Synchronous cancellation
+    //  came with kernel 6.0, the same as IORING_ASYNC_CANCEL_FD_FIXED.
+#if defined IORING_ASYNC_CANCEL_FD_FIXED
+    if (io->recv_cancelling)
+        return false;
+    io_uring_sync_cancel_reg reg;
+    memset (&reg, 0, sizeof reg);
+    reg.addr = user_data (pe, recv_request);
+    reg.fd = -1;
+    reg.timeout.tv_sec = -1;
+    reg.timeout.tv_nsec = -1;
+    const int rc =
+      sys_io_uring_register (_ring_fd, IORING_REGISTER_SYNC_CANCEL, &reg, 1);
+    if (rc == -1) {
+        errno_assert (errno == ENOENT || errno == EALREADY || errno == EINVAL
+                      || errno == EINTR);
+        if (errno == EINVAL || errno == EINTR)
+            return false;
+    }
+    io->recv_cancelling = true;
+
+    //  The completion, if it is in the ring, is processed as usual later.
+    const unsigned tail = __atomic_load_n (_cq_tail, __ATOMIC_ACQUIRE);
+    for (unsigned head = *_cq_head; head != tail; ++head) {
+        const io_uring_cqe &cqe = _cqes[head & _cq_mask];
+        if (cqe.user_data == reg.addr)
+            return cqe.res == -ECANCELED;
+    }
+#endif
+    return false;
+}
+
+int zmq::io_uring_t::max_fds ()
+{
+    return -1;
+}
+
+void zmq::io_uring_t::mark_dirty (poll_entry_t *pe_)
+{
+    if (!pe_->dirty) {
+        pe_->dirty = true;
+        _dirty.push_back (pe_);
+    }
+}
+
+unsigned int zmq::io_uring_t::poll_mask (const poll_entry_t *pe_)
+{
+    if (pe_->io)
+        return pe_->io->send_blocked ? POLLOUT : 0;
+    return pe_->mask;
+}
+
+bool zmq::io_uring_t::in_ready (const poll_entry_t *pe_)
+{
+    const ring_io_t *io = pe_->io;
+    return (pe_->mask & POLLIN)
+           && (io->in_pos != io->in_end || io->eof || io->in_error);
+}
+
+bool zmq::io_uring_t::out_ready (const poll_entry_t *pe_)
+{
+    //  Waiting for half of the buffer to be free keeps the owner from
+    //  being called for every few bytes sent.
+    const ring_io_t *io = pe_->io;
+    return (pe_->mask & POLLOUT) && !io->send_blocked
+           && (io->out_end <= io->out_size / 2 || io->out_error);
+}
+
+void zmq::io_uring_t::check_ready (poll_entry_t *pe_)
+{
+    if (!pe_->ready && pe_->fd != retired_fd
+        && (in_ready (pe_) || out_ready (pe_))) {
+        pe_->ready = true;
+        _ready.push_back (pe_);
+    }
+}
+
+void zmq::io_uring_t::release (poll_entry_t *pe_)
+{
+    if (pe_->io) {
+        const int rc = close (pe_->io->fd);
+        errno_assert (rc == 0);
+        free (pe_->io->in_buf);
+        free (pe_->io->out_buf);
+        LIBZMQ_DELETE (pe_->io);
+    }
+    LIBZMQ_DELETE (pe_);
+}
+
+io_uring_sqe *zmq::io_uring_t::get_sqe ()
+{
+    const unsigned tail = *_sq_tail;
+    if (tail - __atomic_load_n (_sq_head, __ATOMIC_ACQUIRE) == _sq_entries)
+        return NULL;
+
+    io_uring_sqe *sqe = &_sqes[tail & _sq_mask];
+    memset (sqe, 0, sizeof (io_uring_sqe));
+    _sq_array[tail & _sq_mask] = tail & _sq_mask;
+    __atomic_store_n (_sq_tail, tail + 1, __ATOMIC_RELEASE);
+    _to_submit++;
+    return sqe;
+}
+
+void zmq::io_uring_t::reconcile ()
+{
+    entries_t::size_type i = 0;
+    const entries_t::size_type size = _dirty.size ();
+    for (; i != size; ++i) {
+        poll_entry_t *pe = _dirty[i];
+        if (pe->io && !submit_io (pe))
+            break;
+        const unsigned int mask = poll_mask (pe);
+
+        if (pe->armed) {
+            //  The kernel is polling for a stale mask (or for a retired
+            //  fd). Ask it to drop the request; the completion of the
+            //  cancelled request brings the entry back here.
+            if (pe->armed_mask != mask && !pe->cancelling) {
+                io_uring_sqe *sqe = get_sqe ();
+                if (!sqe)
+                    break;
+                sqe->opcode = IORING_OP_POLL_REMOVE;
+                sqe->fd = -1;
+                sqe->addr = user_data (pe, poll_request);
+                sqe->user_data = ignored_user_data;
+                pe->cancelling = true;
+            }
+        } else if (pe->fd == retired_fd) {
+            //  The completions of the requests still in flight bring the
+            //  entry back here.
+            if (!pe->ready
+                && (!pe->io
+                    || (!pe->io->recv_pending && !pe->io->send_pending))) {
+                const entries_t::iterator it =
+                  std::find (_retired.begin (), _retired.end (), pe);
+                if (it != _retired.end ())
+                    _retired.erase (it);
+                release (pe);
+                continue;
+            }
+        } else if (mask) {
+            io_uring_sqe *sqe = get_sqe ();
+            if (!sqe)
+                break;
+            sqe->opcode = IORING_OP_POLL_ADD;
+            sqe->fd = pe->fd;
+#if __BYTE_ORDER == __BIG_ENDIAN
+            sqe->poll32_events = (mask << 16) | (mask >> 16);
+#else
+            sqe->poll32_events = mask;
+#endif
+            sqe->user_data = user_data (pe, poll_request);
+            pe->armed = true;
+            pe->armed_mask = mask;
+        }
+        pe->dirty = false;
+    }
+
+    //  If the submission ring is full, the remaining entries are left
+    //  for the next iteration.
+    _dirty.erase (_dirty.begin (), _dirty.begin () + i);
+}
+
+bool zmq::io_uring_t::submit_io (poll_entry_t *pe_)
+{
+    ring_io_t *io = pe_->io;
+
+    //  Output is sent as soon as there is some and no send is in flight.
+    //  A send never waits for room in the socket buffer; if there is none,
+    //  the entry is polled for it, so that the send does not hold on to
+    //  the socket after rm_fd.
+    if (!io->send_pending && !io->send_blocked && !io->out_error
+        && io->out_pos != io->out_end) {
+        io_uring_sqe *sqe = get_sqe ();
+        if (!sqe)
+            return false;
+        sqe->opcode = IORING_OP_SEND;
+        sqe->fd = io->fd;
+        sqe->addr = reinterpret_cast<uint64_t> (io->out_buf + io->out_pos);
+        sqe->len = static_cast<uint32_t> (io->out_end - io->out_pos);
+        sqe->msg_flags = MSG_DONTWAIT | MSG_NOSIGNAL;
+        sqe->user_data = user_data (pe_, send_request);
+        io->send_pending = true;
+    }
+
+    if (pe_->fd == retired_fd) {
+        //  Nobody is going to read any more input.
+        if (io->recv_pending && !io->recv_cancelling) {
+            io_uring_sqe *sqe = get_sqe ();
+            if (!sqe)
+                return false;
+            sqe->opcode = IORING_OP_ASYNC_CANCEL;
+            sqe->fd = -1;
+            sqe->addr = user_data (pe_, recv_request);
+            sqe->user_data = ignored_user_data;
+            io->recv_cancelling = true;
+        }
+    } else if ((pe_->mask & POLLIN) && !io->recv_pending
+               && io->in_pos == io->in_end && !io->eof && !io->in_error) {
+        //  The receive stays in flight until data arrives.
+        io_uring_sqe *sqe = get_sqe ();
+        if (!sqe)
+            return false;
+        sqe->opcode = IORING_OP_RECV;
+        sqe->fd = io->fd;
+        sqe->addr = reinterpret_cast<uint64_t> (io->in_buf);
+        sqe->len = static_cast<uint32_t> (io->in_size);
+#if defined IORING_RECVSEND_POLL_FIRST
+        //  Do not bother trying to read before data arrives.
+        if (io->drained)
+            sqe->ioprio = IORING_RECVSEND_POLL_FIRST;
+#endif
+        sqe->user_data = user_data (pe_, recv_request);
+        io->recv_pending = true;
+    }
+    return true;
+}
+
+void zmq::io_uring_t::recv_done (poll_entry_t *pe_, int res_)
+{
+    ring_io_t *io = pe_->io;
+    io->recv_pending = false;
+    io->recv_cancelling = false;
+
+    if (res_ > 0) {
+        io->in_pos = 0;
+        io->in_end = static_cast<size_t> (res_);
+        io->drained = io->in_end < io->in_size;
+    } else if (res_ == 0)
+        io->eof = true;
+    else if (res_ != -ECANCELED && res_ != -EINTR && res_ != -EAGAIN) {
+        errno = -res_;
+        errno_assert (res_ != -EBADF && res_ != -EFAULT && res_ != -ENOMEM
+                      && res_ != -ENOTSOCK);
+        io->in_error = -res_;
+    }
+    check_ready (pe_);
+}
+
+void zmq::io_uring_t::send_done (poll_entry_t *pe_, int res_)
+{
+    ring_io_t *io = pe_->io;
+    io->send_pending = false;
+
+    if (res_ >= 0) {
+        //  Move what is left to the front of the buffer, to make room for
+        //  more output.
+        io->out_pos += static_cast<size_t> (res_);
+        if (io->out_pos != 0) {
+            memmove (io->out_buf, io->out_buf + io->out_pos,
+                     io->out_end - io->out_pos);
+            io->out_end -= io->out_pos;
+            io->out_pos = 0;
+        }
+    } else if (res_ == -EAGAIN) {
+        if (pe_->fd == retired_fd)
+            io->out_pos = io->out_end = 0;
+        else
+            io->send_blocked = true;
+    } else if (res_ != -EINTR) {
+        errno = -res_;
+        errno_assert (res_ != -EBADF && res_ != -EFAULT && res_ != -ENOTSOCK);
+        io->out_error = -res_;
+        io->out_pos = io->out_end = 0;
+    }
+    check_ready (pe_);
+}
+
+void zmq::io_uring_t::enter (bool wait_, uint64_t timeout_)
+{
+    io_uring_getevents_arg arg;
+    __kernel_timespec ts;
+    memset (&arg, 0, sizeof arg);
+    if (timeout_) {
+        ts.tv_sec = static_cast<long long> (timeout_ / 1000);
+        ts.tv_nsec = static_cast<long long> (timeout_ % 1000 * 1000000);
+        arg.ts = reinterpret_cast<uint64_t> (&ts);
+    }
+
+    const int rc = sys_io_uring_enter (
+      _ring_fd, _to_submit, wait_ ? 1 : 0,
+      IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg, sizeof arg);
+
+    //  Timer expiry and signals are not errors. EBUSY means the kernel
+    //  wants the completion backlog to be reaped first; whatever was not
+    //  consumed from the submission ring is retried in the next round.
+    if (rc == -1)
+        errno_assert (errno == ETIME || errno == EINTR || errno == EBUSY
+                      || errno == EAGAIN);
+    _to_submit = *_sq_tail - __atomic_load_n (_sq_head, __ATOMIC_ACQUIRE);
+}
+
+void zmq::io_uring_t::loop ()
+{
+    io_uring_cqe cqe_buf[max_io_events];
+
+    while (true) {
+        //  Execute any due timers.
+        const uint64_t timeout = execute_timers ();
+
+        //  Queue pending interest changes. Until the requests of retired
+        //  entries are done, e.g. until their output is sent, they keep
+        //  the loop running.
+        reconcile ();
+
+        if (get_load () == 0 && _retired.empty ()) {
+            if (timeout == 0)
+                break;
+
+            // TODO sleep for timeout
+            continue;
+        }
+
+        //  Submit the queued requests and wait for events, all in a single
+        //  system call. Don't block if some changes did not fit into the
+        //  submission ring, or if there are events to dispatch already.
+        wait_begin ();
+        enter (_dirty.empty () && _ready.empty (), timeout);
+
+        //  Copy the completions out of the ring so that the kernel can
+        //  reuse the slots while the events are being processed.
+        unsigned head = *_cq_head;
+        const unsigned tail = __atomic_load_n (_cq_tail, __ATOMIC_ACQUIRE);
+        int n = 0;
+        for (; head != tail && n != max_io_events; ++head)
+            cqe_buf[n++] = _cqes[head & _cq_mask];
+        __atomic_store_n (_cq_head, head, __ATOMIC_RELEASE);
+        wait_end (n);
+
+        for (int i = 0; i < n; i++) {
+            if (cqe_buf[i].user_data == ignored_user_data)
+                continue;
+
+            poll_entry_t *pe = reinterpret_cast<poll_entry_t *> (
+              static_cast<uintptr_t> (cqe_buf[i].user_data & ~request_mask));
+            const int res = cqe_buf[i].res;
+
+            //  Requests are one-shot. Whatever happens below, the entry
+            //  has to have them submitted again, or be released.
+            mark_dirty (pe);
+
+            const int request =
+              static_cast<int> (cqe_buf[i].user_data & request_mask);
+            if (request == recv_request) {
+                recv_done (pe, res);
+                continue;
+            }
+            if (request == send_request) {
+                send_done (pe, res);
+                continue;
+            }
+
+            pe->armed = false;
+            pe->cancelling = false;
+            if (res < 0) {
+                errno = -res;
+                errno_assert (res == -ECANCELED);
+                continue;
+            }
+
+            //  The socket has room for output again.
+            if (pe->io) {
+                pe->io->send_blocked = false;
+                check_ready (pe);
+                continue;
+            }
+
+            //  Only report events the owner is still interested in; the
+            //  mask may have changed after the request was submitted.
+            const unsigned int revents = static_cast<unsigned int> (res);
+            if (pe->fd == retired_fd)
+                continue;
+            if (revents & (POLLERR | POLLHUP))
+                pe->events->in_event ();
+            if (pe->fd == retired_fd)
+                continue;
+            if (revents & pe->mask & POLLOUT)
+                pe->events->out_event ();
+            if (pe->fd == retired_fd)
+                continue;
+            if (revents & pe->mask & POLLIN)
+                pe->events->in_event ();
+        }
+
+        //  Tell the owners of completion-based entries what they can do
+        //  now. The ones with more to do are dispatched to again after
+        //  the next, non-blocking, round of submissions.
+        _dispatching.swap (_ready);
+        for (entries_t::size_type i = 0, size = _dispatching.size ();
+             i != size; ++i) {
+            poll_entry_t *pe = _dispatching[i];
+            pe->ready = false;
+            if (pe->fd != retired_fd && out_ready (pe))
+                pe->events->out_event ();
+            if (pe->fd != retired_fd && in_ready (pe))
+                pe->events->in_event ();
+            if (pe->fd == retired_fd)
+                mark_dirty (pe);
+            else
+                check_ready (pe);
+        }
+        _dispatching.clear ();
+    }
+}
+
+#endif
@@ -0,0 +1,270 @@
+/*
+    Copyright (c) 2007-2016 Contributors as noted in the AUTHORS file
+
+    This file is part of libzmq, the ZeroMQ core engine in C++.
+
+    libzmq is free software; you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    As a special exception, the Contributors give you permission to link
+    this library with independent modules to produce an executable,
+    regardless of the license terms of these independent modules, and to
+    copy and distribute the resulting executable under terms of your choice,
+    provided that you also meet, for each linked independent module, the
+    terms and conditions of the license of that module. An independent
+    module is a module which is not derived from or based on this library.
+    If you modify this library, you must extend this exception to your
+    version of the library.
+
+    libzmq is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef __ZMQ_IO_URING_HPP_INCLUDED__
+#define __ZMQ_IO_URING_HPP_INCLUDED__
+
+//  poller.hpp decides which polling mechanism to use.
+#include "poller.hpp"
+#if defined ZMQ_IOTHREAD_POLLER_USE_IO_URING
+
+#include <vector>
+#include <sys/uio.h>
+
+#include <linux/io_uring.h>
+
+#include "ctx.hpp"
+#include "fd.hpp"
+#include "thread.hpp"
+#include "poller_base.hpp"
+
+namespace zmq
+{
+struct i_poll_events;
+
+//  This class implements socket polling mechanism using the Linux-specific
+//  io_uring interface (kernel 5.11 or newer).
+//
+//  Interest changes are not applied by a syscall each, the way epoll_ctl
+//  does it. Instead, they are queued as one-shot poll requests in the
+//  submission ring and handed to the kernel in a single io_uring_enter
+//  call that also waits for the completions.
+//
+//  Stream engines can go further and leave their reads and writes to the
+//  poller (see set_ring_io). The socket is then never polled: a receive
+//  stays posted in the ring until data arrives, output is sent from a
+//  buffer owned by the poller, and both are submitted in the same call
+//  that waits for events. The owner still gets in_event and out_event,
+//  but they mean there is data to read, or room to write, in the buffers.
+//  Reads and writes larger than the buffers, i.e. bodies of large
+//  messages, use the socket directly while no request is in flight, which
+//  saves copying most of them.
+
+class io_uring_t ZMQ_FINAL : public worker_poller_base_t
+{
+  public:
+    typedef void *handle_t;
+
+    io_uring_t (const thread_ctx_t &ctx_);
+    ~io_uring_t () ZMQ_OVERRIDE;
+
+    //  "poller" concept.
+    handle_t add_fd (fd_t fd_, zmq::i_poll_events *events_);
+    void rm_fd (handle_t handle_);
+    void set_pollin (handle_t handle_);
+    void reset_pollin (handle_t handle_);
+    void set_pollout (handle_t handle_);
+    void reset_pollout (handle_t handle_);
+    void stop ();
+
+    //  Switches the fd to completion-based I/O, with buffers of the sizes
+    //  given. Returns false if that is not possible, in which case the
+    //  fd stays polled. Afterwards, the owner reads and writes through
+    //  the functions below instead of using the fd.
+    bool set_ring_io (handle_t handle_, size_t in_size_, size_t out_size_);
+
+    //  Behave like tcp_read and tcp_writev: reading returns 0 once the
+    //  peer has closed the connection, and -1 with errno set to EAGAIN if
+    //  no data arrived yet; writing returns 0 if the buffer is full.
+    int ring_read (handle_t handle_, void *data_, size_t size_);
+    int ring_writev (handle_t handle_, const iovec *iov_, int iovcnt_);
+
+    //  Makes sure that removing the fd does not lose any data, so that its
+    //  owner can add it to another poller. Returns false if the poller
+    //  holds data of the fd, or cannot tell; the fd stays as it is then.
+    //  Otherwise, rm_fd has to follow.
+    bool detach_ring_io (handle_t handle_);
+
+    static int max_fds ();
+
+  private:
+    //  Main event loop.
+    void loop () ZMQ_FINAL;
+
+    struct ring_io_t
+    {
+        //  Duplicate of the owner's fd, used by the ring requests. Output
+        //  accepted before rm_fd still goes out after the owner closed
+        //  its fd.
+        fd_t fd;
+
+        //  Data received, of which in_pos to in_end is yet to be read.
+        unsigned char *in_buf;
+        size_t in_size;
+        size_t in_pos;
+        size_t in_end;
+
+        //  True if there is a receive request in flight, and if its
+        //  cancellation was submitted.
+        bool recv_pending;
+        bool recv_cancelling;
+
+        //  True if the last read did not fill the memory given, i.e. the
+        //  socket was probably drained.
+        bool drained;
+
+        //  Set once the peer closed the connection, or receiving failed.
+        bool eof;
+        int in_error;
+
+        //  Data to send, of which out_pos to out_end has not been sent.
+        unsigned char *out_buf;
+        size_t out_size;
+        size_t out_pos;
+        size_t out_end;
+
+        //  True if there is a send request in flight.
+        bool send_pending;
+
+        //  True if the socket buffer was full; the entry is polled for
+        //  output until it has room again.
+        bool send_blocked;
+
+        //  Set once sending failed. Any output left is dropped.
+        int out_error;
+    };
+
+    struct poll_entry_t
+    {
+        fd_t fd;
+        zmq::i_poll_events *events;
+
+        //  Poll mask requested by the owner of the entry.
+        unsigned int mask;
+
+        //  Poll mask of the request currently owned by the kernel.
+        unsigned int armed_mask;
+
+        //  True if there is a poll request in flight for this entry.
+        bool armed;
+
+        //  True if a removal of the in-flight request was submitted.
+        bool cancelling;
+
+        //  True if the entry is on the list of entries to reconcile.
+        bool dirty;
+
+        //  True if the entry is on the list of entries to dispatch.
+        bool ready;
+
+        //  Non-NULL if the fd does completion-based I/O.
+        ring_io_t *io;
+    };
+
+    //  Returns the poll mask the kernel has to watch the entry for.
+    static unsigned int poll_mask (const poll_entry_t *pe_);
+
+    //  Submits the receive and send requests the entry needs. Returns false
+    //  if the submission ring is full.
+    bool submit_io (poll_entry_t *pe_);
+
+    //  Process completions of receive and send requests.
+    void recv_done (poll_entry_t *pe_, int res_);
+    void send_done (poll_entry_t *pe_, int res_);
+
+    //  Reads from the socket without a request, while none is in flight.
+    //  Returns the number of bytes read; errors are recorded in io_.
+    static size_t read_direct (ring_io_t *io_, char *data_, size_t size_);
+
+    //  True if the owner of a completion-based entry has to be told that
+    //  it can read or write.
+    static bool in_ready (const poll_entry_t *pe_);
+    static bool out_ready (const poll_entry_t *pe_);
+
+    //  Queues a completion-based entry for dispatch if it is ready.
+    void check_ready (poll_entry_t *pe_);
+
+    //  Deallocates the entry, along with its buffers.
+    static void release (poll_entry_t *pe_);
+
+    //  Queues the entry to have its kernel state updated before the next
+    //  wait.
+    void mark_dirty (poll_entry_t *pe_);
+
+    //  Brings the kernel-side poll requests in line with the masks
+    //  requested since the last wait. Deallocates retired entries once
+    //  the kernel no longer refers to them.
+    void reconcile ();
+
+    //  Returns a free submission queue entry, or NULL if the ring is full.
+    io_uring_sqe *get_sqe ();
+
+    //  Submits all queued entries. If wait_ is true, blocks until at least
+    //  one completion is available or timeout_ (in ms, 0 = infinity)
+    //  expires. Entries the kernel did not consume stay queued.
+    void enter (bool wait_, uint64_t timeout_);
+
+    //  io_uring file descriptor and the shared ring mappings.
+    fd_t _ring_fd;
+    void *_sq_ring;
+    size_t _sq_ring_size;
+    void *_cq_ring;
+    size_t _cq_ring_size;
+    io_uring_sqe *_sqes;
+    size_t _sqes_size;
+
+    //  Pointers into the submission ring.
+    unsigned *_sq_head;
+    unsigned *_sq_tail;
+    unsigned _sq_mask;
+    unsigned _sq_entries;
+    unsigned *_sq_array;
+
+    //  Pointers into the completion ring.
+    unsigned *_cq_head;
+    unsigned *_cq_tail;
+    unsigned _cq_mask;
+    io_uring_cqe *_cqes;
+
+    //  Number of entries queued in the submission ring but not yet
+    //  handed to the kernel.
+    unsigned _to_submit;
+
+    //  Entries whose kernel state has to be updated.
+    typedef std::vector<poll_entry_t *> entries_t;
+    entries_t _dirty;
+
+    //  Entries removed by rm_fd whose requests are still in flight.
+    entries_t _retired;
+
+    //  Completion-based entries to dispatch events to, and the ones being
+    //  dispatched to now.
+    entries_t _ready;
+    entries_t _dispatching;
+
+    ZMQ_NON_COPYABLE_NOR_MOVABLE (io_uring_t)
+};
+
+typedef io_uring_t poller_t;
+}
+
+#endif
+
+#endif
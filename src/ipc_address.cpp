@@ -32,6 +32,7 @@
 
 #if defined ZMQ_HAVE_IPC
 
+#include "address.hpp"
 #include "err.hpp"
 
 #include <string>
@@ -91,20 +92,24 @@ int zmq::ipc_address_t::resolve (const char *path_)
 }
 
 int zmq::ipc_address_t::to_string (std::string &addr_) const
+{
+    return to_string (addr_, protocol_name::ipc);
+}
+
+int zmq::ipc_address_t::to_string (std::string &addr_,
+                                   const char *protocol_) const
 {
     if (_address.sun_family != AF_UNIX) {
         addr_.clear ();
         return -1;
     }
 
-    const char prefix[] = "ipc://";
-    char buf[sizeof prefix + sizeof _address.sun_path];
-    char *pos = buf;
-    memcpy (pos, prefix, sizeof prefix - 1);
-    pos += sizeof prefix - 1;
+    addr_.assign (protocol_);
+    addr_.append ("://");
+
     const char *src_pos = _address.sun_path;
     if (!_address.sun_path[0] && _address.sun_path[1]) {
-        *pos++ = '@';
+        addr_ += '@';
         src_pos++;
     }
     // according to http://man7.org/linux/man-pages/man7/unix.7.html, NOTES
@@ -113,8 +118,7 @@ int zmq::ipc_address_t::to_string (std::string &addr_) const
     const size_t src_len =
       strnlen (src_pos, _addrlen - offsetof (sockaddr_un, sun_path)
                           - (src_pos - _address.sun_path));
-    memcpy (pos, src_pos, src_len);
-    addr_.assign (buf, pos - buf + src_len);
+    addr_.append (src_pos, src_len);
     return 0;
 }
 
@@ -58,6 +58,10 @@ class ipc_address_t
     //  The opposite to resolve()
     int to_string (std::string &addr_) const;
 
+    //  As above, for transports that are bootstrapped over a UNIX
+    //  domain socket but go by another name.
+    int to_string (std::string &addr_, const char *protocol_) const;
+
     const sockaddr *addr () const;
     socklen_t addrlen () const;
 
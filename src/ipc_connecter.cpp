@@ -63,6 +63,18 @@ zmq::ipc_connecter_t::ipc_connecter_t (class io_thread_t *io_thread_,
     zmq_assert (_addr->protocol == protocol_name::ipc);
 }
 
+zmq::ipc_connecter_t::ipc_connecter_t (class io_thread_t *io_thread_,
+                                       class session_base_t *session_,
+                                       const options_t &options_,
+                                       address_t *addr_,
+                                       bool delayed_start_,
+                                       const char *protocol_) :
+    stream_connecter_base_t (
+      io_thread_, session_, options_, addr_, delayed_start_)
+{
+    zmq_assert (_addr->protocol == protocol_);
+}
+
 void zmq::ipc_connecter_t::out_event ()
 {
     const fd_t fd = connect ();
@@ -75,7 +87,8 @@ void zmq::ipc_connecter_t::out_event ()
         return;
     }
 
-    create_engine (fd, get_socket_name<ipc_address_t> (fd, socket_end_local));
+    create_engine (fd, get_socket_name<ipc_address_t> (
+                         fd, socket_end_local, _addr->protocol.c_str ()));
 }
 
 void zmq::ipc_connecter_t::start_connecting ()
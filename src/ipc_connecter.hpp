@@ -37,7 +37,7 @@
 
 namespace zmq
 {
-class ipc_connecter_t ZMQ_FINAL : public stream_connecter_base_t
+class ipc_connecter_t : public stream_connecter_base_t
 {
   public:
     //  If 'delayed_start' is true connecter first waits for a while,
@@ -48,6 +48,16 @@ class ipc_connecter_t ZMQ_FINAL : public stream_connecter_base_t
                      address_t *addr_,
                      bool delayed_start_);
 
+  protected:
+    //  For transports which set up their connections over a UNIX domain
+    //  socket and are named 'protocol_' in endpoints, such as shm.
+    ipc_connecter_t (zmq::io_thread_t *io_thread_,
+                     zmq::session_base_t *session_,
+                     const options_t &options_,
+                     address_t *addr_,
+                     bool delayed_start_,
+                     const char *protocol_);
+
   private:
     //  Handlers for I/O events.
     void out_event () ZMQ_FINAL;
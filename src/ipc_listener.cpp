@@ -79,7 +79,18 @@ zmq::ipc_listener_t::ipc_listener_t (io_thread_t *io_thread_,
                                      socket_base_t *socket_,
                                      const options_t &options_) :
     stream_listener_base_t (io_thread_, socket_, options_),
-    _has_file (false)
+    _has_file (false),
+    _protocol (protocol_name::ipc)
+{
+}
+
+zmq::ipc_listener_t::ipc_listener_t (io_thread_t *io_thread_,
+                                     socket_base_t *socket_,
+                                     const options_t &options_,
+                                     const char *protocol_) :
+    stream_listener_base_t (io_thread_, socket_, options_),
+    _has_file (false),
+    _protocol (protocol_)
 {
 }
 
@@ -103,7 +114,7 @@ std::string
 zmq::ipc_listener_t::get_socket_name (zmq::fd_t fd_,
                                       socket_end_t socket_end_) const
 {
-    return zmq::get_socket_name<ipc_address_t> (fd_, socket_end_);
+    return zmq::get_socket_name<ipc_address_t> (fd_, socket_end_, _protocol);
 }
 
 int zmq::ipc_listener_t::set_local_address (const char *addr_)
@@ -142,7 +153,7 @@ int zmq::ipc_listener_t::set_local_address (const char *addr_)
         return -1;
     }
 
-    address.to_string (_endpoint);
+    address.to_string (_endpoint, _protocol);
 
     if (options.use_fd != -1) {
         _s = options.use_fd;
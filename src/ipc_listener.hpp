@@ -39,7 +39,7 @@
 
 namespace zmq
 {
-class ipc_listener_t ZMQ_FINAL : public stream_listener_base_t
+class ipc_listener_t : public stream_listener_base_t
 {
   public:
     ipc_listener_t (zmq::io_thread_t *io_thread_,
@@ -50,6 +50,13 @@ class ipc_listener_t ZMQ_FINAL : public stream_listener_base_t
     int set_local_address (const char *addr_);
 
   protected:
+    //  For transports which set up their connections over a UNIX domain
+    //  socket and are named 'protocol_' in endpoints, such as shm.
+    ipc_listener_t (zmq::io_thread_t *io_thread_,
+                    zmq::socket_base_t *socket_,
+                    const options_t &options_,
+                    const char *protocol_);
+
     std::string get_socket_name (fd_t fd_,
                                  socket_end_t socket_end_) const ZMQ_FINAL;
 
@@ -80,6 +87,9 @@ class ipc_listener_t ZMQ_FINAL : public stream_listener_base_t
     //  Name of the file associated with the UNIX domain address.
     std::string _filename;
 
+    //  Transport name used in endpoint strings.
+    const char *const _protocol;
+
     ZMQ_NON_COPYABLE_NOR_MOVABLE (ipc_listener_t)
 };
 }
@@ -33,7 +33,7 @@
 #include "err.hpp"
 #include "msg.hpp"
 
-zmq::lb_t::lb_t () : _active (0), _current (0), _more (false), _dropping (false)
+zmq::lb_t::lb_t () : _more (false), _dropping (false)
 {
 }
 
@@ -50,29 +50,22 @@ void zmq::lb_t::attach (pipe_t *pipe_)
 
 void zmq::lb_t::pipe_terminated (pipe_t *pipe_)
 {
-    const pipes_t::size_type index = _pipes.index (pipe_);
-
     //  If we are in the middle of multipart message and current pipe
     //  have disconnected, we have to drop the remainder of the message.
-    if (index == _current && _more)
+    if (pipe_ == _active.current () && _more)
         _dropping = true;
 
-    //  Remove the pipe from the list; adjust number of active pipes
-    //  accordingly.
-    if (index < _active) {
-        _active--;
-        _pipes.swap (index, _active);
-        if (_current == _active)
-            _current = 0;
-    }
+    //  Remove the pipe from the list and from the active ring.
+    if (active_t::contains (pipe_))
+        _active.erase (pipe_);
     _pipes.erase (pipe_);
 }
 
 void zmq::lb_t::activated (pipe_t *pipe_)
 {
-    //  Move the pipe to the list of active pipes.
-    _pipes.swap (_pipes.index (pipe_), _active);
-    _active++;
+    //  Put the pipe at the end of the current round.
+    zmq_assert (!active_t::contains (pipe_));
+    _active.push_back (pipe_);
 }
 
 int zmq::lb_t::send (msg_t *msg_)
@@ -95,10 +88,11 @@ int zmq::lb_t::sendpipe (msg_t *msg_, pipe_t **pipe_)
         return 0;
     }
 
-    while (_active > 0) {
-        if (_pipes[_current]->write (msg_)) {
+    while (!_active.empty ()) {
+        pipe_t *const current = _active.current ();
+        if (current->write (msg_)) {
             if (pipe_)
-                *pipe_ = _pipes[_current];
+                *pipe_ = current;
             break;
         }
 
@@ -106,7 +100,7 @@ int zmq::lb_t::sendpipe (msg_t *msg_, pipe_t **pipe_)
         // parts sent earlier and return EAGAIN.
         // Application should handle this as suitable
         if (_more) {
-            _pipes[_current]->rollback ();
+            current->rollback ();
             // At this point the pipe is already being deallocated
             // and the first N frames are unreachable (_outpipe is
             // most likely already NULL so rollback won't actually do
@@ -127,15 +121,12 @@ int zmq::lb_t::sendpipe (msg_t *msg_, pipe_t **pipe_)
             return -2;
         }
 
-        _active--;
-        if (_current < _active)
-            _pipes.swap (_current, _active);
-        else
-            _current = 0;
+        //  Deactivate the pipe. Its successor gets the turn.
+        _active.erase (current);
     }
 
     //  If there are no pipes we cannot send the message.
-    if (_active == 0) {
+    if (_active.empty ()) {
         errno = EAGAIN;
         return -1;
     }
@@ -144,10 +135,8 @@ int zmq::lb_t::sendpipe (msg_t *msg_, pipe_t **pipe_)
     //  continue round-robining (load balance).
     _more = (msg_->flags () & msg_t::more) != 0;
     if (!_more) {
-        _pipes[_current]->flush ();
-
-        if (++_current >= _active)
-            _current = 0;
+        _active.current ()->flush ();
+        _active.advance ();
     }
 
     //  Detach the message from the data buffer.
@@ -164,16 +153,14 @@ bool zmq::lb_t::has_out ()
     if (_more)
         return true;
 
-    while (_active > 0) {
+    while (!_active.empty ()) {
         //  Check whether a pipe has room for another message.
-        if (_pipes[_current]->check_write ())
+        pipe_t *const current = _active.current ();
+        if (current->check_write ())
             return true;
 
         //  Deactivate the pipe.
-        _active--;
-        _pipes.swap (_current, _active);
-        if (_current == _active)
-            _current = 0;
+        _active.erase (current);
     }
 
     return false;
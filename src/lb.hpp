@@ -31,6 +31,7 @@
 #define __ZMQ_LB_HPP_INCLUDED__
 
 #include "array.hpp"
+#include "ring.hpp"
 
 namespace zmq
 {
@@ -65,12 +66,10 @@ class lb_t
     typedef array_t<pipe_t, 2> pipes_t;
     pipes_t _pipes;
 
-    //  Number of active pipes. All the active pipes are located at the
-    //  beginning of the pipes array.
-    pipes_t::size_type _active;
-
-    //  Points to the last pipe that the most recent message was sent to.
-    pipes_t::size_type _current;
+    //  The pipes which may accept messages, in round-robin order. The
+    //  current pipe is the one the current message is being sent to.
+    typedef ring_t<pipe_t, 2> active_t;
+    active_t _active;
 
     //  True if last we are in the middle of a multipart message.
     bool _more;
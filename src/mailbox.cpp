@@ -100,6 +100,11 @@ int zmq::mailbox_t::recv (command_t *cmd_, int timeout_)
     return 0;
 }
 
+void zmq::mailbox_t::set_spin (int us_)
+{
+    _signaler.set_spin (us_);
+}
+
 bool zmq::mailbox_t::valid () const
 {
     return _signaler.valid ();
@@ -54,6 +54,9 @@ class mailbox_t ZMQ_FINAL : public i_mailbox
 
     bool valid () const;
 
+    //  Makes recv spin for up to us_ microseconds before blocking.
+    void set_spin (int us_);
+
 #ifdef HAVE_FORK
     // close the file descriptors in the signaller. This is used in a forked
     // child process to close the file descriptors so that they do not interfere
@@ -34,13 +34,18 @@
 
 #include <algorithm>
 
+#if defined ZMQ_HAVE_WINDOWS
+#include "windows.hpp"
+#else
+#include <sched.h>
+#endif
+
 zmq::mailbox_safe_t::mailbox_safe_t (mutex_t *sync_) : _sync (sync_)
 {
-    //  Get the pipe into passive state. That way, if the users starts by
-    //  polling on the associated file descriptor it will get woken up when
-    //  new command is posted.
-    const bool ok = _cpipe.check_read ();
-    zmq_assert (!ok);
+    //  Start in idle state. That way, if the users starts by polling on
+    //  the associated signalers they will get woken up when new command
+    //  is posted.
+    _idle.set (this);
 }
 
 zmq::mailbox_safe_t::~mailbox_safe_t ()
@@ -51,6 +56,18 @@ zmq::mailbox_safe_t::~mailbox_safe_t ()
     // send() method, by waiting on the mutex before disappearing.
     _sync->lock ();
     _sync->unlock ();
+
+    //  A sender whose command has already been processed may not have
+    //  reached the mutex yet. It is only a few instructions away from
+    //  leaving send (), unless it was preempted, in which case it needs
+    //  the CPU we would otherwise be spinning on.
+    while (_senders.get () != 0) {
+#if defined ZMQ_HAVE_WINDOWS
+        SwitchToThread ();
+#else
+        sched_yield ();
+#endif
+    }
 }
 
 void zmq::mailbox_safe_t::add_signaler (signaler_t *signaler_)
@@ -76,11 +93,14 @@ void zmq::mailbox_safe_t::clear_signalers ()
 
 void zmq::mailbox_safe_t::send (const command_t &cmd_)
 {
-    _sync->lock ();
-    _cpipe.write (cmd_, false);
-    const bool ok = _cpipe.flush ();
+    _senders.add (1);
+    _cpipe.push (cmd_);
 
-    if (!ok) {
+    //  If the receiver has found the queue empty since it was last woken
+    //  up, it may be waiting or polling the signalers. Only the sender
+    //  that clears the flag needs the mutex to wake it.
+    if (_idle.xchg (NULL) != NULL) {
+        _sync->lock ();
         _cond_var.broadcast ();
 
         for (std::vector<signaler_t *>::iterator it = _signalers.begin (),
@@ -88,33 +108,39 @@ void zmq::mailbox_safe_t::send (const command_t &cmd_)
              it != end; ++it) {
             (*it)->send ();
         }
+        _sync->unlock ();
     }
-
-    _sync->unlock ();
+    _senders.sub (1);
 }
 
 int zmq::mailbox_safe_t::recv (command_t *cmd_, int timeout_)
 {
     //  Try to get the command straight away.
-    if (_cpipe.read (cmd_))
+    if (_cpipe.pop (cmd_))
+        return 0;
+
+    //  Mark the mailbox idle before looking again. A sender pushing
+    //  concurrently either finds the flag and wakes us up, or its command
+    //  is visible to the second pop. Senders don't hold the mutex, so
+    //  there is no point in releasing it when not waiting.
+    _idle.xchg (this);
+    if (_cpipe.pop (cmd_))
         return 0;
 
-    //  If the timeout is zero, it will be quicker to release the lock, giving other a chance to send a command
-    //  and immediately relock it.
     if (timeout_ == 0) {
-        _sync->unlock ();
-        _sync->lock ();
-    } else {
-        //  Wait for signal from the command sender.
-        const int rc = _cond_var.wait (_sync, timeout_);
-        if (rc == -1) {
-            errno_assert (errno == EAGAIN || errno == EINTR);
-            return -1;
-        }
+        errno = EAGAIN;
+        return -1;
+    }
+
+    //  Wait for signal from the command sender.
+    const int rc = _cond_var.wait (_sync, timeout_);
+    if (rc == -1) {
+        errno_assert (errno == EAGAIN || errno == EINTR);
+        return -1;
     }
 
     //  Another thread may already fetch the command
-    const bool ok = _cpipe.read (cmd_);
+    const bool ok = _cpipe.pop (cmd_);
 
     if (!ok) {
         errno = EAGAIN;
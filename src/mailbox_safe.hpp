@@ -37,7 +37,9 @@
 #include "fd.hpp"
 #include "config.hpp"
 #include "command.hpp"
-#include "ypipe.hpp"
+#include "mpsc_queue.hpp"
+#include "atomic_counter.hpp"
+#include "atomic_ptr.hpp"
 #include "mutex.hpp"
 #include "i_mailbox.hpp"
 #include "condition_variable.hpp"
@@ -69,14 +71,25 @@ class mailbox_safe_t ZMQ_FINAL : public i_mailbox
 #endif
 
   private:
-    //  The pipe to store actual commands.
-    typedef ypipe_t<command_t, command_pipe_granularity> cpipe_t;
-    cpipe_t _cpipe;
+    //  The queue to store actual commands. Senders push without locking;
+    //  receivers hold the socket's mutex, so there is one at a time.
+    mpsc_queue_t<command_t> _cpipe;
+
+    //  Points to this mailbox while the receiver may be waiting for a
+    //  command, NULL otherwise. The first sender to find it set wakes the
+    //  receiver up; other senders don't touch the mutex at all.
+    atomic_ptr_t<mailbox_safe_t> _idle;
+
+    //  Number of threads inside send (). The destructor waits for it to
+    //  drop to zero as a sender may still be waking the receiver after
+    //  its command was processed.
+    atomic_counter_t _senders;
 
     //  Condition variable to pass signals from writer thread to reader thread.
     condition_variable_t _cond_var;
 
-    //  Synchronize access to the mailbox from receivers and senders
+    //  Socket's mutex, held by receivers. Senders take it only to wake
+    //  an idle receiver.
     mutex_t *const _sync;
 
     std::vector<zmq::signaler_t *> _signalers;
@@ -38,7 +38,9 @@
 #include "wire.hpp"
 #include "session_base.hpp"
 
-zmq::mechanism_t::mechanism_t (const options_t &options_) : options (options_)
+zmq::mechanism_t::mechanism_t (const options_t &options_) :
+    options (options_),
+    _advertise_memfd (false)
 {
 }
 
@@ -159,6 +161,7 @@ size_t zmq::mechanism_t::property_len (const char *name_, size_t value_len_)
 
 #define ZMTP_PROPERTY_SOCKET_TYPE "Socket-Type"
 #define ZMTP_PROPERTY_IDENTITY "Identity"
+#define ZMTP_PROPERTY_MEMFD "Memfd"
 
 size_t zmq::mechanism_t::add_basic_properties (unsigned char *ptr_,
                                                size_t ptr_capacity_) const
@@ -178,6 +181,10 @@ size_t zmq::mechanism_t::add_basic_properties (unsigned char *ptr_,
                              options.routing_id_size);
     }
 
+    //  Add memfd capability property
+    if (_advertise_memfd)
+        ptr += add_property (ptr, ptr_capacity_ - (ptr - ptr_),
+                             ZMTP_PROPERTY_MEMFD, "1", 1);
 
     for (std::map<std::string, std::string>::const_iterator
            it = options.app_metadata.begin (),
@@ -206,6 +213,7 @@ size_t zmq::mechanism_t::basic_properties_len () const
 
     return property_len (ZMTP_PROPERTY_SOCKET_TYPE, strlen (socket_type))
            + meta_len
+           + (_advertise_memfd ? property_len (ZMTP_PROPERTY_MEMFD, 1) : 0)
            + ((options.type == ZMQ_REQ || options.type == ZMQ_DEALER
                || options.type == ZMQ_ROUTER)
                 ? property_len (ZMTP_PROPERTY_IDENTITY, options.routing_id_size)
@@ -284,6 +292,12 @@ int zmq::mechanism_t::parse_metadata (const unsigned char *ptr_,
     return 0;
 }
 
+bool zmq::mechanism_t::peer_accepts_memfd () const
+{
+    return _zmtp_properties.find (ZMTP_PROPERTY_MEMFD)
+           != _zmtp_properties.end ();
+}
+
 int zmq::mechanism_t::property (const std::string & /* name_ */,
                                 const void * /* value_ */,
                                 size_t /* length_ */)
@@ -305,7 +319,14 @@ static bool strequals (const char *actual_type_,
 bool zmq::mechanism_t::check_socket_type (const char *type_,
                                           const size_t len_) const
 {
-    switch (options.type) {
+    return check_socket_type (options.type, type_, len_);
+}
+
+bool zmq::mechanism_t::check_socket_type (int socket_type_,
+                                          const char *type_,
+                                          const size_t len_)
+{
+    switch (socket_type_) {
         case ZMQ_REQ:
             return strequals (type_, len_, socket_type_rep)
                    || strequals (type_, len_, socket_type_router);
@@ -91,11 +91,23 @@ class mechanism_t
         return _zap_properties;
     }
 
-  protected:
+    //  Makes the handshake tell the peer that it may pass frames to us
+    //  in memfds. Must be called before the handshake starts.
+    void advertise_memfd () { _advertise_memfd = true; }
+
+    //  Returns true iff the peer has told us it accepts memfds.
+    bool peer_accepts_memfd () const;
+
     //  Only used to identify the socket for the Socket-Type
     //  property in the wire protocol.
     static const char *socket_type_string (int socket_type_);
 
+    //  Returns true iff a socket of type 'socket_type_' may talk to
+    //  a peer whose socket type is named 'type_'.
+    static bool
+    check_socket_type (int socket_type_, const char *type_, size_t len_);
+
+  protected:
     static size_t add_property (unsigned char *ptr_,
                                 size_t ptr_capacity_,
                                 const char *name_,
@@ -142,6 +154,8 @@ class mechanism_t
 
     blob_t _user_id;
 
+    bool _advertise_memfd;
+
     //  Returns true iff socket associated with the mechanism
     //  is compatible with a given socket type 'type_'.
     bool check_socket_type (const char *type_, size_t len_) const;
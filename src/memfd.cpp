@@ -0,0 +1,220 @@
+/*
+    Copyright (c) 2007-2016 Contributors as noted in the AUTHORS file
+
+    This file is part of libzmq, the ZeroMQ core engine in C++.
+
+    libzmq is free software; you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    As a special exception, the Contributors give you permission to link
+    this library with independent modules to produce an executable,
+    regardless of the license terms of these independent modules, and to
+    copy and distribute the resulting executable under terms of your choice,
+    provided that you also meet, for each linked independent module, the
+    terms and conditions of the license of that module. An independent
+    module is a module which is not derived from or based on this library.
+    If you modify this library, you must extend this exception to your
+    version of the library.
+
+    libzmq is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "precompiled.hpp"
+#include "memfd.hpp"
+
+#if defined ZMQ_HAVE_MEMFD
+
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+
+#include "config.hpp"
+#include "err.hpp"
+#include "stdint.hpp"
+
+zmq::fd_t zmq::memfd_create_sealed (const void *data_, size_t size_)
+{
+    const fd_t fd = memfd_create ("zmq-msg", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    if (fd == -1)
+        return retired_fd;
+
+    //  Writing the data in is cheaper than mapping the memfd, which would
+    //  take a page fault for every page.
+    const char *ptr = static_cast<const char *> (data_);
+    size_t left = size_;
+    while (left > 0) {
+        const ssize_t rc = ::write (fd, ptr, left);
+        if (rc == -1 && errno == EINTR)
+            continue;
+        if (rc <= 0)
+            break;
+        ptr += rc;
+        left -= static_cast<size_t> (rc);
+    }
+
+    if (left == 0
+        && fcntl (fd, F_ADD_SEALS,
+                  F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE | F_SEAL_SEAL)
+             == 0)
+        return fd;
+
+    const int rc = close (fd);
+    errno_assert (rc == 0);
+    return retired_fd;
+}
+
+void *zmq::memfd_map (fd_t fd_, size_t size_)
+{
+    const int required_seals = F_SEAL_SHRINK | F_SEAL_WRITE;
+
+    void *map = MAP_FAILED;
+    struct stat st;
+    const int seals = fcntl (fd_, F_GET_SEALS);
+    if (seals != -1 && (seals & required_seals) == required_seals
+        && fstat (fd_, &st) == 0 && st.st_size >= 0
+        && static_cast<uint64_t> (st.st_size) >= size_) {
+        //  A private mapping lets the application write to the message
+        //  without the sender seeing it.
+        map = mmap (NULL, size_, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd_, 0);
+    }
+
+    const int rc = close (fd_);
+    errno_assert (rc == 0);
+
+    if (map == MAP_FAILED) {
+        errno = EPROTO;
+        return NULL;
+    }
+    return map;
+}
+
+void zmq::memfd_unmap (void *data_, void *hint_)
+{
+    const int rc = munmap (data_, reinterpret_cast<size_t> (hint_));
+    errno_assert (rc == 0);
+}
+
+int zmq::ipc_writev_fds (
+  fd_t s_, const iovec *iov_, int iovcnt_, const fd_t *fds_, int fd_count_)
+{
+    zmq_assert (fd_count_ > 0 && fd_count_ <= ipc_max_passed_fds);
+
+    union
+    {
+        struct cmsghdr align;
+        char buf[CMSG_SPACE (ipc_max_passed_fds * sizeof (int))];
+    } control;
+    memset (&control, 0, sizeof control);
+
+    msghdr msg;
+    memset (&msg, 0, sizeof msg);
+    msg.msg_iov = const_cast<iovec *> (iov_);
+    msg.msg_iovlen = iovcnt_;
+    msg.msg_control = control.buf;
+    msg.msg_controllen = CMSG_SPACE (fd_count_ * sizeof (int));
+
+    struct cmsghdr *cmsg = CMSG_FIRSTHDR (&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN (fd_count_ * sizeof (int));
+    memcpy (CMSG_DATA (cmsg), fds_, fd_count_ * sizeof (int));
+
+    const ssize_t nbytes = sendmsg (s_, &msg, MSG_NOSIGNAL);
+
+    //  Same as in tcp_write, not being able to write a single byte is OK.
+    if (nbytes == -1
+        && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR))
+        return 0;
+
+    //  Signalise peer failure.
+    if (nbytes == -1) {
+        errno_assert (errno != EACCES && errno != EBADF && errno != EDESTADDRREQ
+                      && errno != EFAULT && errno != EINVAL && errno != EISCONN
+                      && errno != EMSGSIZE && errno != ENOMEM
+                      && errno != ENOTSOCK && errno != EOPNOTSUPP);
+        return -1;
+    }
+
+    return static_cast<int> (nbytes);
+}
+
+int zmq::ipc_read_fds (fd_t s_,
+                       void *data_,
+                       size_t size_,
+                       std::deque<fd_t> &fds_)
+{
+    union
+    {
+        struct cmsghdr align;
+        char buf[CMSG_SPACE (ipc_max_passed_fds * sizeof (int))];
+    } control;
+
+    iovec iov;
+    iov.iov_base = data_;
+    iov.iov_len = size_;
+
+    msghdr msg;
+    memset (&msg, 0, sizeof msg);
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control.buf;
+    msg.msg_controllen = sizeof control.buf;
+
+    const ssize_t rc = recvmsg (s_, &msg, MSG_CMSG_CLOEXEC);
+
+    //  Several errors are OK. When speculative read is being done we may not
+    //  be able to read a single byte from the socket. Also, SIGSTOP issued
+    //  by a debugging tool can result in EINTR error.
+    if (rc == -1) {
+        errno_assert (errno != EBADF && errno != EFAULT && errno != ENOMEM
+                      && errno != ENOTSOCK);
+        if (errno == EWOULDBLOCK || errno == EINTR)
+            errno = EAGAIN;
+        return -1;
+    }
+
+    //  A peer only passes descriptors along with the frames referring to
+    //  them, and all frames of a write arrive before the descriptors of
+    //  the next one. Any beyond what a single write carries are not going
+    //  to be claimed, so they are closed rather than piling up.
+    bool excess = false;
+    for (struct cmsghdr *cmsg = CMSG_FIRSTHDR (&msg); cmsg;
+         cmsg = CMSG_NXTHDR (&msg, cmsg)) {
+        if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS)
+            continue;
+        const size_t count = (cmsg->cmsg_len - CMSG_LEN (0)) / sizeof (int);
+        for (size_t i = 0; i != count; i++) {
+            int fd;
+            memcpy (&fd, CMSG_DATA (cmsg) + i * sizeof (int), sizeof fd);
+            if (fds_.size () < ipc_max_passed_fds)
+                fds_.push_back (fd);
+            else {
+                const int rc2 = close (fd);
+                errno_assert (rc2 == 0);
+                excess = true;
+            }
+        }
+    }
+
+    //  The kernel drops the descriptors that do not fit, after which they
+    //  can no longer be matched with the frames referring to them.
+    if (excess || (msg.msg_flags & MSG_CTRUNC)) {
+        errno = EPROTO;
+        return -1;
+    }
+
+    return static_cast<int> (rc);
+}
+
+#endif
@@ -0,0 +1,72 @@
+/*
+    Copyright (c) 2007-2016 Contributors as noted in the AUTHORS file
+
+    This file is part of libzmq, the ZeroMQ core engine in C++.
+
+    libzmq is free software; you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    As a special exception, the Contributors give you permission to link
+    this library with independent modules to produce an executable,
+    regardless of the license terms of these independent modules, and to
+    copy and distribute the resulting executable under terms of your choice,
+    provided that you also meet, for each linked independent module, the
+    terms and conditions of the license of that module. An independent
+    module is a module which is not derived from or based on this library.
+    If you modify this library, you must extend this exception to your
+    version of the library.
+
+    libzmq is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __ZMQ_MEMFD_HPP_INCLUDED__
+#define __ZMQ_MEMFD_HPP_INCLUDED__
+
+#if defined ZMQ_HAVE_MEMFD
+
+#include <deque>
+#include <stddef.h>
+#include <sys/uio.h>
+
+#include "fd.hpp"
+
+namespace zmq
+{
+//  Returns a memfd holding a copy of the 'size_' bytes at 'data_', sealed
+//  so that its content can no longer change, or retired_fd on failure.
+fd_t memfd_create_sealed (const void *data_, size_t size_);
+
+//  Maps the first 'size_' bytes of 'fd_' privately into memory and closes
+//  the descriptor. Fails with EPROTO unless 'fd_' is a memfd that is
+//  sealed against writes and shrinking and that holds at least 'size_'
+//  bytes, so that the mapping can neither change nor fault later on.
+void *memfd_map (fd_t fd_, size_t size_);
+
+//  Releases a mapping made by memfd_map, 'hint_' carrying its size.
+//  Suitable as a msg_t free function.
+void memfd_unmap (void *data_, void *hint_);
+
+//  Like tcp_writev, but passes the 'fd_count_' descriptors at 'fds_'
+//  along with the data over a UNIX domain socket. The descriptors are
+//  passed iff at least one byte has been written.
+int ipc_writev_fds (
+  fd_t s_, const iovec *iov_, int iovcnt_, const fd_t *fds_, int fd_count_);
+
+//  Like tcp_read, but appends the descriptors passed along with the data
+//  to 'fds_'. Fails with EPROTO if the peer passed more descriptors than
+//  ipc_max_passed_fds at once, or if 'fds_' would hold more than that;
+//  the excess descriptors are closed.
+int ipc_read_fds (fd_t s_, void *data_, size_t size_, std::deque<fd_t> &fds_);
+}
+
+#endif
+
+#endif
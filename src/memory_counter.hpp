@@ -0,0 +1,79 @@
+/*
+    Copyright (c) 2007-2016 Contributors as noted in the AUTHORS file
+
+    This file is part of libzmq, the ZeroMQ core engine in C++.
+
+    libzmq is free software; you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    As a special exception, the Contributors give you permission to link
+    this library with independent modules to produce an executable,
+    regardless of the license terms of these independent modules, and to
+    copy and distribute the resulting executable under terms of your choice,
+    provided that you also meet, for each linked independent module, the
+    terms and conditions of the license of that module. An independent
+    module is a module which is not derived from or based on this library.
+    If you modify this library, you must extend this exception to your
+    version of the library.
+
+    libzmq is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __ZMQ_MEMORY_COUNTER_HPP_INCLUDED__
+#define __ZMQ_MEMORY_COUNTER_HPP_INCLUDED__
+
+#include "atomic_counter.hpp"
+#include "macros.hpp"
+#include "mutex.hpp"
+#include "stdint.hpp"
+
+namespace zmq
+{
+//  Number of bytes held on behalf of a socket by objects living in other
+//  threads, or a similar count of events in them. Changes are rare, when
+//  buffers are allocated or freed, so a mutex is good enough and keeps
+//  the count 64 bits wide everywhere.
+//  The objects updating the counter may outlive the socket, so they keep
+//  a reference to it.
+
+class memory_counter_t
+{
+  public:
+    memory_counter_t () : _ref_cnt (1), _value (0) {}
+
+    void add_ref () { _ref_cnt.add (1); }
+
+    //  Drop reference. Returns true iff the reference
+    //  counter drops to zero.
+    bool drop_ref () { return !_ref_cnt.sub (1); }
+
+    void add (int64_t delta_)
+    {
+        scoped_lock_t lock (_sync);
+        _value += delta_;
+    }
+
+    uint64_t get ()
+    {
+        scoped_lock_t lock (_sync);
+        return static_cast<uint64_t> (_value);
+    }
+
+  private:
+    atomic_counter_t _ref_cnt;
+    mutex_t _sync;
+    int64_t _value;
+
+    ZMQ_NON_COPYABLE_NOR_MOVABLE (memory_counter_t)
+};
+}
+
+#endif
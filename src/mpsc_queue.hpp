@@ -0,0 +1,137 @@
+/*
+    Copyright (c) 2007-2016 Contributors as noted in the AUTHORS file
+
+    This file is part of libzmq, the ZeroMQ core engine in C++.
+
+    libzmq is free software; you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    As a special exception, the Contributors give you permission to link
+    this library with independent modules to produce an executable,
+    regardless of the license terms of these independent modules, and to
+    copy and distribute the resulting executable under terms of your choice,
+    provided that you also meet, for each linked independent module, the
+    terms and conditions of the license of that module. An independent
+    module is a module which is not derived from or based on this library.
+    If you modify this library, you must extend this exception to your
+    version of the library.
+
+    libzmq is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __ZMQ_MPSC_QUEUE_HPP_INCLUDED__
+#define __ZMQ_MPSC_QUEUE_HPP_INCLUDED__
+
+#include <new>
+#include <stddef.h>
+
+#include "err.hpp"
+#include "atomic_ptr.hpp"
+#include "macros.hpp"
+
+namespace zmq
+{
+//  Lock-free unbounded queue with any number of writers and one reader.
+//
+//  Writers link a new node after the last one with a single exchange of
+//  the tail pointer and never wait for each other or for the reader. The
+//  reader walks the list from a dummy node that holds the element popped
+//  last. Between a writer's exchange and the link that follows it, the
+//  reader sees the queue as ending just before that writer's node; the
+//  element becomes visible once the writer returns from push.
+//
+//  The last node released by the reader is kept as a spare and reused by
+//  the next push, so that a queue which is drained as fast as it is filled
+//  does not allocate.
+//
+//  T is the type of the object in the queue.
+
+template <typename T> class mpsc_queue_t
+{
+  public:
+    inline mpsc_queue_t ()
+    {
+        _front = new (std::nothrow) node_t;
+        alloc_assert (_front);
+        _front->next.set (NULL);
+        _back.set (_front);
+        _spare_node.set (NULL);
+    }
+
+    //  The destructor doesn't have to be thread-safe as no other
+    //  thread may use the queue at that point.
+    inline ~mpsc_queue_t ()
+    {
+        while (_front) {
+            node_t *const o = _front;
+            _front = o->next.xchg (NULL);
+            delete o;
+        }
+        delete _spare_node.xchg (NULL);
+    }
+
+    //  Adds an element to the back of the queue. May be called by any
+    //  number of threads concurrently.
+    inline void push (const T &value_)
+    {
+        node_t *n = _spare_node.xchg (NULL);
+        if (!n) {
+            n = new (std::nothrow) node_t;
+            alloc_assert (n);
+        }
+        n->value = value_;
+        n->next.set (NULL);
+
+        //  Claim the last position, then make the node reachable from
+        //  the one that held it before.
+        node_t *const prev = _back.xchg (n);
+        prev->next.xchg (n);
+    }
+
+    //  Removes the element at the front of the queue into *value_.
+    //  Returns false if there is none. Only one thread may call it
+    //  at a time.
+    inline bool pop (T *value_)
+    {
+        node_t *const n = _front->next.cas (NULL, NULL);
+        if (!n)
+            return false;
+        *value_ = n->value;
+
+        //  The node becomes the new dummy; the old one is recycled.
+        node_t *const o = _front;
+        _front = n;
+        delete _spare_node.xchg (o);
+        return true;
+    }
+
+  private:
+    struct node_t
+    {
+        T value;
+        atomic_ptr_t<node_t> next;
+    };
+
+    //  Dummy node in front of the first element. Accessed only by the
+    //  reader.
+    node_t *_front;
+
+    //  Last node of the list. Exchanged by the writers.
+    atomic_ptr_t<node_t> _back;
+
+    //  Node released by the reader, waiting to be reused by a writer.
+    atomic_ptr_t<node_t> _spare_node;
+
+    ZMQ_NON_COPYABLE_NOR_MOVABLE (mpsc_queue_t)
+};
+}
+
+#endif
@@ -38,6 +38,8 @@
 #include "stdint.hpp"
 #include "likely.hpp"
 #include "metadata.hpp"
+#include "msg_pool.hpp"
+#include "allocator.hpp"
 #include "err.hpp"
 
 //  Check whether the sizes of public representation of the message (zmq_msg_t)
@@ -47,6 +49,21 @@ typedef char
   zmq_msg_size_check[2 * ((sizeof (zmq::msg_t) == sizeof (zmq_msg_t)) != 0)
                      - 1];
 
+//  Frees the content of a long message, and its data if they were
+//  allocated along with it.
+static void free_lmsg_content (zmq::msg_t::content_t *content_)
+{
+    if (content_->ffn)
+        content_->ffn (content_->data, content_->hint);
+    else if (content_->hint) {
+        static_cast<zmq::allocator_t *> (content_->hint)
+          ->deallocate (content_, sizeof (*content_) + content_->size,
+                        ZMQ_ALLOCATOR_MSG);
+        return;
+    }
+    zmq::msg_pool_t::deallocate (content_);
+}
+
 bool zmq::msg_t::check () const
 {
     return _u.base.type >= type_min && _u.base.type <= type_max;
@@ -85,6 +102,11 @@ int zmq::msg_t::init ()
 }
 
 int zmq::msg_t::init_size (size_t size_)
+{
+    return init_size (size_, allocator_t::heap ());
+}
+
+int zmq::msg_t::init_size (size_t size_, allocator_t *allocator_)
 {
     if (size_ <= max_vsm_size) {
         _u.vsm.metadata = NULL;
@@ -100,9 +122,12 @@ int zmq::msg_t::init_size (size_t size_)
         _u.lmsg.group[0] = '\0';
         _u.lmsg.routing_id = 0;
         _u.lmsg.content = NULL;
+        const bool heap = allocator_->is_heap ();
         if (sizeof (content_t) + size_ > size_)
-            _u.lmsg.content =
-              static_cast<content_t *> (malloc (sizeof (content_t) + size_));
+            _u.lmsg.content = static_cast<content_t *> (
+              heap ? msg_pool_t::allocate (sizeof (content_t) + size_)
+                   : allocator_->allocate (sizeof (content_t) + size_,
+                                           ZMQ_ALLOCATOR_MSG));
         if (unlikely (!_u.lmsg.content)) {
             errno = ENOMEM;
             return -1;
@@ -111,7 +136,7 @@ int zmq::msg_t::init_size (size_t size_)
         _u.lmsg.content->data = _u.lmsg.content + 1;
         _u.lmsg.content->size = size_;
         _u.lmsg.content->ffn = NULL;
-        _u.lmsg.content->hint = NULL;
+        _u.lmsg.content->hint = heap ? NULL : allocator_;
         new (&_u.lmsg.content->refcnt) zmq::atomic_counter_t ();
     }
     return 0;
@@ -167,7 +192,7 @@ int zmq::msg_t::init_data (void *data_,
         _u.lmsg.group[0] = '\0';
         _u.lmsg.routing_id = 0;
         _u.lmsg.content =
-          static_cast<content_t *> (malloc (sizeof (content_t)));
+          static_cast<content_t *> (msg_pool_t::allocate (sizeof (content_t)));
         if (!_u.lmsg.content) {
             errno = ENOMEM;
             return -1;
@@ -229,10 +254,7 @@ int zmq::msg_t::close ()
             //  counter so we call the destructor explicitly now.
             _u.lmsg.content->refcnt.~atomic_counter_t ();
 
-            if (_u.lmsg.content->ffn)
-                _u.lmsg.content->ffn (_u.lmsg.content->data,
-                                      _u.lmsg.content->hint);
-            free (_u.lmsg.content);
+            free_lmsg_content (_u.lmsg.content);
         }
     }
 
@@ -429,6 +451,12 @@ bool zmq::msg_t::is_lmsg () const
     return _u.base.type == type_lmsg;
 }
 
+bool zmq::msg_t::is_library_owned () const
+{
+    return _u.base.type == type_vsm
+           || (_u.base.type == type_lmsg && _u.lmsg.content->ffn == NULL);
+}
+
 bool zmq::msg_t::is_zcmsg () const
 {
     return _u.base.type == type_zclmsg;
@@ -533,9 +561,7 @@ bool zmq::msg_t::rm_refs (int refs_)
         //  counter so we call the destructor explicitly now.
         _u.lmsg.content->refcnt.~atomic_counter_t ();
 
-        if (_u.lmsg.content->ffn)
-            _u.lmsg.content->ffn (_u.lmsg.content->data, _u.lmsg.content->hint);
-        free (_u.lmsg.content);
+        free_lmsg_content (_u.lmsg.content);
 
         return false;
     }
@@ -51,6 +51,8 @@ typedef void(msg_free_fn) (void *data_, void *hint_);
 
 namespace zmq
 {
+class allocator_t;
+
 //  Note that this structure needs to be explicitly constructed
 //  (init functions) and destructed (close function).
 
@@ -61,7 +63,8 @@ class msg_t
     //  continuous block along with this structure - thus avoiding one
     //  malloc/free pair or they are stored in user-supplied memory.
     //  In the latter case, ffn member stores pointer to the function to be
-    //  used to deallocate the data. If the buffer is actually shared (there
+    //  used to deallocate the data. Without ffn, a non-NULL hint is the
+    //  allocator the block came from. If the buffer is actually shared (there
     //  are at least 2 references to it) refcount member contains number of
     //  references.
     struct content_t
@@ -100,6 +103,7 @@ class msg_t
               content_t *content_ = NULL);
 
     int init_size (size_t size_);
+    int init_size (size_t size_, allocator_t *allocator_);
     int init_data (void *data_, size_t size_, msg_free_fn *ffn_, void *hint_);
     int init_external_storage (content_t *content_,
                                void *data_,
@@ -146,6 +150,10 @@ class msg_t
     bool is_cmsg () const;
     bool is_lmsg () const;
     bool is_zcmsg () const;
+
+    //  True if libzmq allocated the data itself (a vsm, or an lmsg from
+    //  init_size), false if it belongs to the application.
+    bool is_library_owned () const;
     uint32_t get_routing_id () const;
     int set_routing_id (uint32_t routing_id_);
     int reset_routing_id ();
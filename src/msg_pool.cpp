@@ -0,0 +1,258 @@
+/*
+    Copyright (c) 2007-2016 Contributors as noted in the AUTHORS file
+
+    This file is part of libzmq, the ZeroMQ core engine in C++.
+
+    libzmq is free software; you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    As a special exception, the Contributors give you permission to link
+    this library with independent modules to produce an executable,
+    regardless of the license terms of these independent modules, and to
+    copy and distribute the resulting executable under terms of your choice,
+    provided that you also meet, for each linked independent module, the
+    terms and conditions of the license of that module. An independent
+    module is a module which is not derived from or based on this library.
+    If you modify this library, you must extend this exception to your
+    version of the library.
+
+    libzmq is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "precompiled.hpp"
+#include "msg_pool.hpp"
+
+#include <stdlib.h>
+#include <new>
+
+#if !defined ZMQ_HAVE_WINDOWS
+#include <pthread.h>
+#endif
+
+#include "err.hpp"
+#include "likely.hpp"
+
+//  Precedes every block handed out. Keeps the memory after it aligned
+//  as malloc would.
+struct zmq::msg_pool_t::header_t
+{
+    //  Owning pool, NULL for memory from the heap.
+    msg_pool_t *pool;
+
+    size_t size_class;
+};
+
+struct zmq::msg_pool_t::block_t
+{
+    header_t header;
+
+    //  Next block in a free list, only valid while the block is free.
+    block_t *next;
+};
+
+zmq::atomic_counter_t zmq::msg_pool_t::_enabled;
+
+#if !defined ZMQ_HAVE_WINDOWS
+static pthread_once_t thread_pool_once = PTHREAD_ONCE_INIT;
+static pthread_key_t thread_pool_key;
+
+//  Pools whose threads have exited, waiting to be adopted.
+static pthread_mutex_t orphans_sync = PTHREAD_MUTEX_INITIALIZER;
+static zmq::msg_pool_t *orphans = NULL;
+#endif
+
+static size_t size_class (size_t block_size_, size_t min_block_size_)
+{
+    size_t size_class = 0;
+    while ((min_block_size_ << size_class) < block_size_)
+        size_class++;
+    return size_class;
+}
+
+void *zmq::msg_pool_t::allocate (size_t size_)
+{
+    const size_t block_size = sizeof (header_t) + size_;
+
+#if !defined ZMQ_HAVE_WINDOWS
+    if (_enabled.get () && block_size <= max_block_size) {
+        msg_pool_t *pool = thread_pool ();
+        if (likely (pool != NULL)) {
+            block_t *block = pool->allocate_block (
+              ::size_class (block_size, min_block_size));
+            if (likely (block != NULL))
+                return &block->header + 1;
+        }
+    }
+#endif
+
+    if (unlikely (block_size < size_))
+        return NULL;
+    header_t *header = static_cast<header_t *> (malloc (block_size));
+    if (unlikely (!header))
+        return NULL;
+    header->pool = NULL;
+    return header + 1;
+}
+
+void zmq::msg_pool_t::deallocate (void *ptr_)
+{
+    header_t *header = static_cast<header_t *> (ptr_) - 1;
+    if (header->pool == NULL) {
+        free (header);
+        return;
+    }
+    header->pool->deallocate_block (reinterpret_cast<block_t *> (header));
+}
+
+void zmq::msg_pool_t::enable ()
+{
+    _enabled.add (1);
+}
+
+void zmq::msg_pool_t::disable ()
+{
+    _enabled.sub (1);
+}
+
+zmq::msg_pool_t::msg_pool_t () : _next_orphan (NULL)
+{
+    for (int i = 0; i != size_class_count; i++)
+        _free[i] = NULL;
+}
+
+void zmq::msg_pool_t::create_thread_pool_key ()
+{
+#if !defined ZMQ_HAVE_WINDOWS
+    //  The key lives as long as the process, like the pools.
+    const int rc =
+      pthread_key_create (&thread_pool_key, release_thread_pool);
+    posix_assert (rc);
+#endif
+}
+
+zmq::msg_pool_t *zmq::msg_pool_t::thread_pool ()
+{
+#if defined ZMQ_HAVE_WINDOWS
+    return NULL;
+#else
+    int rc = pthread_once (&thread_pool_once, create_thread_pool_key);
+    posix_assert (rc);
+
+    msg_pool_t *pool =
+      static_cast<msg_pool_t *> (pthread_getspecific (thread_pool_key));
+    if (likely (pool != NULL))
+        return pool;
+
+    rc = pthread_mutex_lock (&orphans_sync);
+    posix_assert (rc);
+    pool = orphans;
+    if (pool != NULL) {
+        orphans = pool->_next_orphan;
+        pool->_next_orphan = NULL;
+    }
+    rc = pthread_mutex_unlock (&orphans_sync);
+    posix_assert (rc);
+
+    if (pool == NULL) {
+        pool = new (std::nothrow) msg_pool_t;
+        if (pool == NULL)
+            return NULL;
+    }
+    rc = pthread_setspecific (thread_pool_key, pool);
+    posix_assert (rc);
+    return pool;
+#endif
+}
+
+void zmq::msg_pool_t::release_thread_pool (void *pool_)
+{
+#if !defined ZMQ_HAVE_WINDOWS
+    msg_pool_t *pool = static_cast<msg_pool_t *> (pool_);
+    int rc = pthread_mutex_lock (&orphans_sync);
+    posix_assert (rc);
+    pool->_next_orphan = orphans;
+    orphans = pool;
+    rc = pthread_mutex_unlock (&orphans_sync);
+    posix_assert (rc);
+#else
+    LIBZMQ_UNUSED (pool_);
+#endif
+}
+
+zmq::msg_pool_t::block_t *zmq::msg_pool_t::allocate_block (size_t size_class_)
+{
+    block_t *block = _free[size_class_];
+    if (unlikely (block == NULL)) {
+        if (!reclaim () || _free[size_class_] == NULL)
+            if (!grow (size_class_))
+                return NULL;
+        block = _free[size_class_];
+    }
+    _free[size_class_] = block->next;
+    return block;
+}
+
+void zmq::msg_pool_t::deallocate_block (block_t *block_)
+{
+#if !defined ZMQ_HAVE_WINDOWS
+    //  Blocks freed by the owning thread go straight to its free list.
+    if (likely (pthread_getspecific (thread_pool_key) == this)) {
+        const size_t size_class = block_->header.size_class;
+        block_->next = _free[size_class];
+        _free[size_class] = block_;
+        return;
+    }
+#endif
+
+    //  Others push them to the remote list. The owner only ever takes
+    //  the whole list at once, so there is no ABA problem.
+    block_t *head = NULL;
+    while (true) {
+        block_->next = head;
+        block_t *const prev = _remote.cas (head, block_);
+        if (prev == head)
+            break;
+        head = prev;
+    }
+}
+
+bool zmq::msg_pool_t::reclaim ()
+{
+    block_t *block = _remote.xchg (NULL);
+    if (block == NULL)
+        return false;
+    while (block != NULL) {
+        block_t *const next = block->next;
+        const size_t size_class = block->header.size_class;
+        block->next = _free[size_class];
+        _free[size_class] = block;
+        block = next;
+    }
+    return true;
+}
+
+bool zmq::msg_pool_t::grow (size_t size_class_)
+{
+    const size_t block_size = min_block_size << size_class_;
+    unsigned char *slab = static_cast<unsigned char *> (malloc (slab_size));
+    if (unlikely (!slab))
+        return false;
+
+    for (size_t offset = 0; offset + block_size <= slab_size;
+         offset += block_size) {
+        block_t *block = reinterpret_cast<block_t *> (slab + offset);
+        block->header.pool = this;
+        block->header.size_class = size_class_;
+        block->next = _free[size_class_];
+        _free[size_class_] = block;
+    }
+    return true;
+}
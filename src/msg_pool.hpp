@@ -0,0 +1,114 @@
+/*
+    Copyright (c) 2007-2016 Contributors as noted in the AUTHORS file
+
+    This file is part of libzmq, the ZeroMQ core engine in C++.
+
+    libzmq is free software; you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    As a special exception, the Contributors give you permission to link
+    this library with independent modules to produce an executable,
+    regardless of the license terms of these independent modules, and to
+    copy and distribute the resulting executable under terms of your choice,
+    provided that you also meet, for each linked independent module, the
+    terms and conditions of the license of that module. An independent
+    module is a module which is not derived from or based on this library.
+    If you modify this library, you must extend this exception to your
+    version of the library.
+
+    libzmq is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __ZMQ_MSG_POOL_HPP_INCLUDED__
+#define __ZMQ_MSG_POOL_HPP_INCLUDED__
+
+#include <stddef.h>
+
+#include "atomic_counter.hpp"
+#include "atomic_ptr.hpp"
+#include "macros.hpp"
+
+namespace zmq
+{
+//  Allocator for message contents. While enabled, small blocks come from
+//  size-classed slabs owned by the allocating thread, so that neither
+//  allocating nor freeing them takes a lock or a trip to malloc. Blocks
+//  freed by another thread are handed back to their owner through a
+//  lock-free list. A pool outlives its thread: it is adopted by the next
+//  thread that needs one, and it never returns its slabs to the heap.
+//
+//  zmq_msg_init_size knows nothing about contexts, so pools are enabled
+//  process-wide for as long as any context asks for them (ZMQ_MSG_POOL).
+
+class msg_pool_t
+{
+  public:
+    //  Returns 'size_' bytes of memory, or NULL if there is none left.
+    static void *allocate (size_t size_);
+
+    //  Returns memory obtained from allocate.
+    static void deallocate (void *ptr_);
+
+    //  Each call to enable makes the pools used until a matching call
+    //  to disable. Memory can be deallocated at any time.
+    static void enable ();
+    static void disable ();
+
+  private:
+    struct header_t;
+    struct block_t;
+
+    msg_pool_t ();
+
+    //  Returns the calling thread's pool, creating it if needed.
+    static msg_pool_t *thread_pool ();
+
+    static void create_thread_pool_key ();
+
+    //  Orphans the pool of a thread that has exited.
+    static void release_thread_pool (void *pool_);
+
+    block_t *allocate_block (size_t size_class_);
+    void deallocate_block (block_t *block_);
+
+    //  Moves the blocks freed by other threads into the free lists.
+    //  Returns false if there were none.
+    bool reclaim ();
+
+    //  Carves a new slab into blocks of class 'size_class_'. Returns
+    //  false if out of memory.
+    bool grow (size_t size_class_);
+
+    enum
+    {
+        size_class_count = 7,
+        min_block_size = 128,
+        max_block_size = min_block_size << (size_class_count - 1),
+        slab_size = 64 * 1024
+    };
+
+    //  Free blocks of each size class, used by the owning thread only.
+    block_t *_free[size_class_count];
+
+    //  Blocks freed by other threads.
+    atomic_ptr_t<block_t> _remote;
+
+    //  Next pool in the list of pools without a thread.
+    msg_pool_t *_next_orphan;
+
+    //  Number of enable calls not matched by disable yet.
+    static atomic_counter_t _enabled;
+
+    ZMQ_NON_COPYABLE_NOR_MOVABLE (msg_pool_t)
+};
+}
+
+#endif
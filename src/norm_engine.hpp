@@ -48,6 +48,8 @@ class norm_engine_t ZMQ_FINAL : public io_object_t, public i_engine
     void zap_msg_available () ZMQ_FINAL {}
 
     const endpoint_uri_pair_t &get_endpoint () const ZMQ_FINAL;
+    bool migrate_out () ZMQ_FINAL { return false; }
+    void migrate_in (zmq::io_thread_t *) ZMQ_FINAL {}
 
     // i_poll_events interface implementation.
     // (we only need in_event() for NormEvent notification)
@@ -72,7 +74,8 @@ class norm_engine_t ZMQ_FINAL : public io_object_t, public i_engine
         NormRxStreamState (NormObjectHandle normStream,
                            int64_t maxMsgSize,
                            bool zeroCopy,
-                           int inBatchSize);
+                           int inBatchSize,
+                           allocator_t *msgAllocator);
         ~NormRxStreamState ();
 
         NormObjectHandle GetStreamHandle () const { return norm_stream; }
@@ -138,6 +141,7 @@ class norm_engine_t ZMQ_FINAL : public io_object_t, public i_engine
         int64_t max_msg_size;
         bool zero_copy;
         int in_batch_size;
+        allocator_t *allocator;
         bool in_sync;
         bool rx_ready;
         v2_decoder_t *zmq_decoder;
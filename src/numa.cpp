@@ -0,0 +1,99 @@
+/*
+    Copyright (c) 2007-2016 Contributors as noted in the AUTHORS file
+
+    This file is part of libzmq, the ZeroMQ core engine in C++.
+
+    libzmq is free software; you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    As a special exception, the Contributors give you permission to link
+    this library with independent modules to produce an executable,
+    regardless of the license terms of these independent modules, and to
+    copy and distribute the resulting executable under terms of your choice,
+    provided that you also meet, for each linked independent module, the
+    terms and conditions of the license of that module. An independent
+    module is a module which is not derived from or based on this library.
+    If you modify this library, you must extend this exception to your
+    version of the library.
+
+    libzmq is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "precompiled.hpp"
+#include "macros.hpp"
+#include "numa.hpp"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#if defined ZMQ_HAVE_LINUX
+#include <sched.h>
+
+//  Adds the numbers in a sysfs list such as "0-3,8,10-11" to items_.
+static bool read_list (const char *path_, std::set<int> *items_)
+{
+    FILE *file = fopen (path_, "r");
+    if (file == NULL)
+        return false;
+    char buffer[4096];
+    const bool ok = fgets (buffer, sizeof buffer, file) != NULL;
+    fclose (file);
+    if (!ok)
+        return false;
+
+    const char *pos = buffer;
+    while (*pos >= '0' && *pos <= '9') {
+        char *end;
+        const int first = static_cast<int> (strtol (pos, &end, 10));
+        int last = first;
+        if (*end == '-')
+            last = static_cast<int> (strtol (end + 1, &end, 10));
+        for (int item = first; item <= last; item++)
+            items_->insert (item);
+        pos = *end == ',' ? end + 1 : end;
+    }
+    return true;
+}
+#endif
+
+bool zmq::numa_nodes (std::vector<std::set<int> > *nodes_)
+{
+#if defined ZMQ_HAVE_LINUX
+    std::set<int> ids;
+    if (!read_list ("/sys/devices/system/node/online", &ids) || ids.empty ())
+        return false;
+
+    nodes_->clear ();
+    for (std::set<int>::const_iterator it = ids.begin (), end = ids.end ();
+         it != end; ++it) {
+        char path[64];
+        snprintf (path, sizeof path, "/sys/devices/system/node/node%d/cpulist",
+                  *it);
+        std::set<int> cpus;
+        //  Nodes with memory only have no CPUs to run I/O threads on.
+        if (read_list (path, &cpus) && !cpus.empty ())
+            nodes_->push_back (cpus);
+    }
+    return !nodes_->empty ();
+#else
+    LIBZMQ_UNUSED (nodes_);
+    return false;
+#endif
+}
+
+int zmq::current_cpu ()
+{
+#if defined ZMQ_HAVE_LINUX
+    return sched_getcpu ();
+#else
+    return -1;
+#endif
+}
@@ -39,13 +39,17 @@
 #include "session_base.hpp"
 #include "socket_base.hpp"
 
-zmq::object_t::object_t (ctx_t *ctx_, uint32_t tid_) : _ctx (ctx_), _tid (tid_)
+zmq::object_t::object_t (ctx_t *ctx_, uint32_t tid_) :
+    _ctx (ctx_),
+    _tid (tid_),
+    _host_tid (tid_)
 {
 }
 
 zmq::object_t::object_t (object_t *parent_) :
     _ctx (parent_->_ctx),
-    _tid (parent_->_tid)
+    _tid (parent_->_tid),
+    _host_tid (parent_->_host_tid)
 {
 }
 
@@ -61,6 +65,17 @@ uint32_t zmq::object_t::get_tid () const
 void zmq::object_t::set_tid (uint32_t id_)
 {
     _tid = id_;
+    _host_tid = id_;
+}
+
+uint32_t zmq::object_t::get_host_tid () const
+{
+    return _host_tid;
+}
+
+void zmq::object_t::set_host_tid (uint32_t id_)
+{
+    _host_tid = id_;
 }
 
 zmq::ctx_t *zmq::object_t::get_ctx () const
@@ -76,7 +91,8 @@ void zmq::object_t::process_command (const command_t &cmd_)
             break;
 
         case command_t::activate_write:
-            process_activate_write (cmd_.args.activate_write.msgs_read);
+            process_activate_write (cmd_.args.activate_write.msgs_read,
+                                    cmd_.args.activate_write.bytes_read);
             break;
 
         case command_t::stop:
@@ -109,6 +125,7 @@ void zmq::object_t::process_command (const command_t &cmd_)
 
         case command_t::pipe_peer_stats:
             process_pipe_peer_stats (cmd_.args.pipe_peer_stats.queue_count,
+                                     cmd_.args.pipe_peer_stats.queue_bytes,
                                      cmd_.args.pipe_peer_stats.socket_base,
                                      cmd_.args.pipe_peer_stats.endpoint_pair);
             break;
@@ -117,6 +134,8 @@ void zmq::object_t::process_command (const command_t &cmd_)
             process_pipe_stats_publish (
               cmd_.args.pipe_stats_publish.outbound_queue_count,
               cmd_.args.pipe_stats_publish.inbound_queue_count,
+              cmd_.args.pipe_stats_publish.outbound_queue_bytes,
+              cmd_.args.pipe_stats_publish.inbound_queue_bytes,
               cmd_.args.pipe_stats_publish.endpoint_pair);
             break;
 
@@ -161,6 +180,10 @@ void zmq::object_t::process_command (const command_t &cmd_)
             process_seqnum ();
             break;
 
+        case command_t::migrate:
+            process_migrate ();
+            break;
+
         case command_t::done:
         default:
             zmq_assert (false);
@@ -280,12 +303,14 @@ void zmq::object_t::send_activate_read (pipe_t *destination_)
 }
 
 void zmq::object_t::send_activate_write (pipe_t *destination_,
-                                         uint64_t msgs_read_)
+                                         uint64_t msgs_read_,
+                                         uint64_t bytes_read_)
 {
     command_t cmd;
     cmd.destination = destination_;
     cmd.type = command_t::activate_write;
     cmd.args.activate_write.msgs_read = msgs_read_;
+    cmd.args.activate_write.bytes_read = bytes_read_;
     send_command (cmd);
 }
 
@@ -300,6 +325,7 @@ void zmq::object_t::send_hiccup (pipe_t *destination_, void *pipe_)
 
 void zmq::object_t::send_pipe_peer_stats (pipe_t *destination_,
                                           uint64_t queue_count_,
+                                          uint64_t queue_bytes_,
                                           own_t *socket_base_,
                                           endpoint_uri_pair_t *endpoint_pair_)
 {
@@ -307,6 +333,7 @@ void zmq::object_t::send_pipe_peer_stats (pipe_t *destination_,
     cmd.destination = destination_;
     cmd.type = command_t::pipe_peer_stats;
     cmd.args.pipe_peer_stats.queue_count = queue_count_;
+    cmd.args.pipe_peer_stats.queue_bytes = queue_bytes_;
     cmd.args.pipe_peer_stats.socket_base = socket_base_;
     cmd.args.pipe_peer_stats.endpoint_pair = endpoint_pair_;
     send_command (cmd);
@@ -316,6 +343,8 @@ void zmq::object_t::send_pipe_stats_publish (
   own_t *destination_,
   uint64_t outbound_queue_count_,
   uint64_t inbound_queue_count_,
+  uint64_t outbound_queue_bytes_,
+  uint64_t inbound_queue_bytes_,
   endpoint_uri_pair_t *endpoint_pair_)
 {
     command_t cmd;
@@ -323,6 +352,8 @@ void zmq::object_t::send_pipe_stats_publish (
     cmd.type = command_t::pipe_stats_publish;
     cmd.args.pipe_stats_publish.outbound_queue_count = outbound_queue_count_;
     cmd.args.pipe_stats_publish.inbound_queue_count = inbound_queue_count_;
+    cmd.args.pipe_stats_publish.outbound_queue_bytes = outbound_queue_bytes_;
+    cmd.args.pipe_stats_publish.inbound_queue_bytes = inbound_queue_bytes_;
     cmd.args.pipe_stats_publish.endpoint_pair = endpoint_pair_;
     send_command (cmd);
 }
@@ -424,6 +455,16 @@ void zmq::object_t::send_done ()
     _ctx->send_command (ctx_t::term_tid, cmd);
 }
 
+void zmq::object_t::send_migrate (own_t *destination_)
+{
+    //  Goes straight to the new thread rather than through the original
+    //  one, so that it gets there before any command relayed later.
+    command_t cmd;
+    cmd.destination = destination_;
+    cmd.type = command_t::migrate;
+    _ctx->send_command (destination_->get_host_tid (), cmd);
+}
+
 void zmq::object_t::process_stop ()
 {
     zmq_assert (false);
@@ -454,7 +495,7 @@ void zmq::object_t::process_activate_read ()
     zmq_assert (false);
 }
 
-void zmq::object_t::process_activate_write (uint64_t)
+void zmq::object_t::process_activate_write (uint64_t, uint64_t)
 {
     zmq_assert (false);
 }
@@ -465,6 +506,7 @@ void zmq::object_t::process_hiccup (void *)
 }
 
 void zmq::object_t::process_pipe_peer_stats (uint64_t,
+                                             uint64_t,
                                              own_t *,
                                              endpoint_uri_pair_t *)
 {
@@ -472,6 +514,8 @@ void zmq::object_t::process_pipe_peer_stats (uint64_t,
 }
 
 void zmq::object_t::process_pipe_stats_publish (uint64_t,
+                                                uint64_t,
+                                                uint64_t,
                                                 uint64_t,
                                                 endpoint_uri_pair_t *)
 {
@@ -523,6 +567,11 @@ void zmq::object_t::process_reaped ()
     zmq_assert (false);
 }
 
+void zmq::object_t::process_migrate ()
+{
+    zmq_assert (false);
+}
+
 void zmq::object_t::process_seqnum ()
 {
     zmq_assert (false);
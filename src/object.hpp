@@ -61,6 +61,13 @@ class object_t
 
     uint32_t get_tid () const;
     void set_tid (uint32_t id_);
+
+    //  ID of the thread the object currently runs in. This differs from
+    //  the thread ID only for objects that migrated to another I/O thread;
+    //  their commands are still sent to the original thread, which relays
+    //  them, so that commands are never reordered.
+    uint32_t get_host_tid () const;
+    void set_host_tid (uint32_t id_);
     ctx_t *get_ctx () const;
     void process_command (const zmq::command_t &cmd_);
     void send_inproc_connected (zmq::socket_base_t *socket_);
@@ -97,15 +104,20 @@ class object_t
                       zmq::i_engine *engine_,
                       bool inc_seqnum_ = true);
     void send_activate_read (zmq::pipe_t *destination_);
-    void send_activate_write (zmq::pipe_t *destination_, uint64_t msgs_read_);
+    void send_activate_write (zmq::pipe_t *destination_,
+                              uint64_t msgs_read_,
+                              uint64_t bytes_read_);
     void send_hiccup (zmq::pipe_t *destination_, void *pipe_);
     void send_pipe_peer_stats (zmq::pipe_t *destination_,
                                uint64_t queue_count_,
+                               uint64_t queue_bytes_,
                                zmq::own_t *socket_base,
                                endpoint_uri_pair_t *endpoint_pair_);
     void send_pipe_stats_publish (zmq::own_t *destination_,
                                   uint64_t outbound_queue_count_,
                                   uint64_t inbound_queue_count_,
+                                  uint64_t outbound_queue_bytes_,
+                                  uint64_t inbound_queue_bytes_,
                                   endpoint_uri_pair_t *endpoint_pair_);
     void send_pipe_term (zmq::pipe_t *destination_);
     void send_pipe_term_ack (zmq::pipe_t *destination_);
@@ -117,6 +129,7 @@ class object_t
     void send_reap (zmq::socket_base_t *socket_);
     void send_reaped ();
     void send_done ();
+    void send_migrate (zmq::own_t *destination_);
 
     //  These handlers can be overridden by the derived objects. They are
     //  called when command arrives from another thread.
@@ -126,14 +139,18 @@ class object_t
     virtual void process_attach (zmq::i_engine *engine_);
     virtual void process_bind (zmq::pipe_t *pipe_);
     virtual void process_activate_read ();
-    virtual void process_activate_write (uint64_t msgs_read_);
+    virtual void process_activate_write (uint64_t msgs_read_,
+                                         uint64_t bytes_read_);
     virtual void process_hiccup (void *pipe_);
     virtual void process_pipe_peer_stats (uint64_t queue_count_,
+                                          uint64_t queue_bytes_,
                                           zmq::own_t *socket_base_,
                                           endpoint_uri_pair_t *endpoint_pair_);
     virtual void
     process_pipe_stats_publish (uint64_t outbound_queue_count_,
                                 uint64_t inbound_queue_count_,
+                                uint64_t outbound_queue_bytes_,
+                                uint64_t inbound_queue_bytes_,
                                 endpoint_uri_pair_t *endpoint_pair_);
     virtual void process_pipe_term ();
     virtual void process_pipe_term_ack ();
@@ -144,6 +161,7 @@ class object_t
     virtual void process_term_endpoint (std::string *endpoint_);
     virtual void process_reap (zmq::socket_base_t *socket_);
     virtual void process_reaped ();
+    virtual void process_migrate ();
 
     //  Special handler called after a command that requires a seqnum
     //  was processed. The implementation should catch up with its counter
@@ -157,6 +175,9 @@ class object_t
     //  Thread ID of the thread the object belongs to.
     uint32_t _tid;
 
+    //  Thread ID of the thread the object currently runs in.
+    uint32_t _host_tid;
+
     void send_command (const command_t &cmd_);
 
     ZMQ_NON_COPYABLE_NOR_MOVABLE (object_t)
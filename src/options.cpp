@@ -35,6 +35,8 @@
 #include "options.hpp"
 #include "err.hpp"
 #include "macros.hpp"
+#include "config.hpp"
+#include "curve_mechanism_base.hpp"
 
 #ifndef ZMQ_HAVE_WINDOWS
 #include <net/if.h>
@@ -197,7 +199,10 @@ const int default_hwm = 1000;
 zmq::options_t::options_t () :
     sndhwm (default_hwm),
     rcvhwm (default_hwm),
+    sndhwm_bytes (0),
+    rcvhwm_bytes (0),
     affinity (0),
+    io_weight (0),
     routing_id_size (0),
     rate (100),
     recovery_ivl (10000),
@@ -210,6 +215,7 @@ zmq::options_t::options_t () :
     linger (-1),
     connect_timeout (0),
     tcp_maxrt (0),
+    tcp_busy_poll (0),
     reconnect_ivl (100),
     reconnect_ivl_max (0),
     backlog (100),
@@ -229,6 +235,7 @@ zmq::options_t::options_t () :
     tcp_keepalive_intvl (-1),
     mechanism (ZMQ_NULL),
     as_server (0),
+    curve_ciphers_set (false),
     gss_principal_nt (ZMQ_GSSAPI_NT_HOSTBASED),
     gss_service_principal_nt (ZMQ_GSSAPI_NT_HOSTBASED),
     gss_plaintext (false),
@@ -242,10 +249,17 @@ zmq::options_t::options_t () :
     use_fd (-1),
     zap_enforce_domain (false),
     loopback_fastpath (false),
+    tcp_sharded_bind (false),
     multicast_loop (true),
     in_batch_size (8192),
     out_batch_size (8192),
+    udp_batch_size (1),
+    tcp_zerocopy_threshold (0),
+    ipc_memfd_threshold (0),
     zero_copy (true),
+    allocator (allocator_t::heap ()),
+    buffer_memory (NULL),
+    zerocopy_completed (NULL),
     router_notify (0),
     monitor_event_version (1),
     wss_trust_system (false)
@@ -785,6 +799,84 @@ int zmq::options_t::setsockopt (int option_,
             }
             break;
 
+        case ZMQ_UDP_BATCH_SIZE:
+            if (is_int && value > 0 && value <= max_udp_batch_size) {
+                udp_batch_size = value;
+                return 0;
+            }
+            break;
+
+        case ZMQ_TCP_ZEROCOPY_THRESHOLD:
+            if (is_int && value >= 0) {
+                tcp_zerocopy_threshold = value;
+                return 0;
+            }
+            break;
+
+        case ZMQ_IPC_MEMFD_THRESHOLD:
+            if (is_int && value >= 0) {
+                ipc_memfd_threshold = value;
+                return 0;
+            }
+            break;
+
+        case ZMQ_SNDHWM_BYTES:
+            if (optvallen_ == sizeof (int64_t)) {
+                int64_t bytes;
+                memcpy (&bytes, optval_, sizeof bytes);
+                if (bytes >= 0) {
+                    sndhwm_bytes = bytes;
+                    return 0;
+                }
+            }
+            break;
+
+        case ZMQ_RCVHWM_BYTES:
+            if (optvallen_ == sizeof (int64_t)) {
+                int64_t bytes;
+                memcpy (&bytes, optval_, sizeof bytes);
+                if (bytes >= 0) {
+                    rcvhwm_bytes = bytes;
+                    return 0;
+                }
+            }
+            break;
+
+        case ZMQ_TCP_BUSY_POLL:
+            if (is_int && value >= 0) {
+                tcp_busy_poll = value;
+                return 0;
+            }
+            break;
+
+        case ZMQ_TCP_SHARDED_BIND:
+            return do_setsockopt_int_as_bool_relaxed (optval_, optvallen_,
+                                                      &tcp_sharded_bind);
+
+        case ZMQ_IO_WEIGHT:
+            if (is_int && value >= 0) {
+                io_weight = value;
+                return 0;
+            }
+            break;
+
+#ifdef ZMQ_HAVE_CURVE
+        case ZMQ_CURVE_CIPHERS:
+            if (optvallen_ <= UCHAR_MAX && (optval_ != NULL || !optvallen_)) {
+                std::string ciphers;
+                if (optvallen_ > 0)
+                    ciphers.assign (static_cast<const char *> (optval_),
+                                    optvallen_);
+                if (curve_mechanism_base_t::data_ciphers_available (
+                      ciphers)) {
+                    curve_ciphers = ciphers;
+                    curve_ciphers_set = true;
+                    return 0;
+                }
+            }
+            break;
+#endif
+
 #ifdef ZMQ_HAVE_WSS
         case ZMQ_WSS_KEY_PEM:
             // TODO: check if valid certificate
@@ -1223,6 +1315,71 @@ int zmq::options_t::getsockopt (int option_,
                 return 0;
             }
             break;
+
+        case ZMQ_UDP_BATCH_SIZE:
+            if (is_int) {
+                *value = udp_batch_size;
+                return 0;
+            }
+            break;
+
+        case ZMQ_TCP_ZEROCOPY_THRESHOLD:
+            if (is_int) {
+                *value = tcp_zerocopy_threshold;
+                return 0;
+            }
+            break;
+
+        case ZMQ_IPC_MEMFD_THRESHOLD:
+            if (is_int) {
+                *value = ipc_memfd_threshold;
+                return 0;
+            }
+            break;
+
+        case ZMQ_SNDHWM_BYTES:
+            if (*optvallen_ == sizeof (int64_t)) {
+                *(static_cast<int64_t *> (optval_)) = sndhwm_bytes;
+                return 0;
+            }
+            break;
+
+        case ZMQ_RCVHWM_BYTES:
+            if (*optvallen_ == sizeof (int64_t)) {
+                *(static_cast<int64_t *> (optval_)) = rcvhwm_bytes;
+                return 0;
+            }
+            break;
+
+        case ZMQ_TCP_BUSY_POLL:
+            if (is_int) {
+                *value = tcp_busy_poll;
+                return 0;
+            }
+            break;
+
+        case ZMQ_TCP_SHARDED_BIND:
+            if (is_int) {
+                *value = tcp_sharded_bind;
+                return 0;
+            }
+            break;
+
+        case ZMQ_IO_WEIGHT:
+            if (is_int) {
+                *value = io_weight;
+                return 0;
+            }
+            break;
+
+#ifdef ZMQ_HAVE_CURVE
+        case ZMQ_CURVE_CIPHERS:
+            return do_getsockopt (
+              optval_, optvallen_,
+              curve_ciphers_set
+                ? curve_ciphers
+                : curve_mechanism_base_t::default_data_ciphers ());
+#endif
 #endif
 
 
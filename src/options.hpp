@@ -34,7 +34,9 @@
 #include <vector>
 #include <map>
 
+#include "allocator.hpp"
 #include "atomic_ptr.hpp"
+#include "memory_counter.hpp"
 #include "stddef.h"
 #include "stdint.hpp"
 #include "tcp_address.hpp"
@@ -73,9 +75,19 @@ struct options_t
     int sndhwm;
     int rcvhwm;
 
+    //  High-water marks for the bytes queued in message pipes,
+    //  0 for no limit.
+    int64_t sndhwm_bytes;
+    int64_t rcvhwm_bytes;
+
     //  I/O thread affinity.
     uint64_t affinity;
 
+    //  Load a connection adds to its I/O thread when placing others, in
+    //  idle connections.
+    //  Default 0
+    int io_weight;
+
     //  Socket routing id.
     unsigned char routing_id_size;
     unsigned char routing_id[256];
@@ -116,6 +128,11 @@ struct options_t
     //  Default 0 (unused)
     int tcp_maxrt;
 
+    //  Microseconds the kernel may busy poll the device queue on blocking
+    //  receives (SO_BUSY_POLL).
+    //  Default 0 (unused)
+    int tcp_busy_poll;
+
     //  Minimum interval between attempts to reconnect, in milliseconds.
     //  Default 100ms
     int reconnect_ivl;
@@ -206,6 +223,12 @@ struct options_t
     uint8_t curve_secret_key[CURVE_KEYSIZE];
     uint8_t curve_server_key[CURVE_KEYSIZE];
 
+    //  Data phase ciphers the CURVE mechanism offers and accepts, space
+    //  separated in order of preference (ZMQ_CURVE_CIPHERS). Unless set,
+    //  all the ciphers available are.
+    std::string curve_ciphers;
+    bool curve_ciphers_set;
+
     //  Principals for GSSAPI mechanism
     std::string gss_principal;
     std::string gss_service_principal;
@@ -261,6 +284,9 @@ struct options_t
     // Use of loopback fastpath.
     bool loopback_fastpath;
 
+    //  If true, TCP binds open one SO_REUSEPORT listener per I/O thread.
+    bool tcp_sharded_bind;
+
     //  Loop sent multicast packets to local sockets
     bool multicast_loop;
 
@@ -275,9 +301,32 @@ struct options_t
     //  unnecessary network stack traversals.
     int out_batch_size;
 
+    //  Maximal number of datagrams the UDP engine receives or sends with
+    //  a single recvmmsg/sendmmsg system call.
+    int udp_batch_size;
+
+    //  Frames of at least this many bytes are sent with MSG_ZEROCOPY over
+    //  TCP, if the platform supports it. 0 disables zero-copy sends.
+    int tcp_zerocopy_threshold;
+
+    //  Frames of at least this many bytes are passed in memfds over IPC,
+    //  if the peer agrees and the platform supports it. 0 disables it.
+    int ipc_memfd_threshold;
+
     // Use zero copy strategy for storing message content when decoding.
     bool zero_copy;
 
+    //  Allocator of the context, for messages, encoders and decoders.
+    allocator_t *allocator;
+
+    //  Counts the encoder and decoder buffers held by the socket's
+    //  engines. Owned by the socket, NULL if there is none.
+    memory_counter_t *buffer_memory;
+
+    //  Counts the zero-copy sends the kernel reported as completed to the
+    //  socket's engines. Owned by the socket, NULL if there is none.
+    memory_counter_t *zerocopy_completed;
+
     // Router socket ZMQ_NOTIFY_CONNECT/ZMQ_NOTIFY_DISCONNECT notifications
     int router_notify;
 
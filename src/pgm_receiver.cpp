@@ -245,7 +245,8 @@ void zmq::pgm_receiver_t::in_event ()
 
             //  Create and connect decoder for the peer.
             it->second.decoder =
-              new (std::nothrow) v1_decoder_t (0, options.maxmsgsize);
+              new (std::nothrow)
+              v1_decoder_t (0, options.maxmsgsize, options.allocator);
             alloc_assert (it->second.decoder);
         }
 
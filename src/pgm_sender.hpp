@@ -60,6 +60,8 @@ class pgm_sender_t ZMQ_FINAL : public io_object_t, public i_engine
     void restart_output ();
     void zap_msg_available () {}
     const endpoint_uri_pair_t &get_endpoint () const;
+    bool migrate_out () { return false; }
+    void migrate_in (zmq::io_thread_t *) {}
 
     //  i_poll_events interface implementation.
     void in_event ();
@@ -34,10 +34,21 @@
 #include "macros.hpp"
 #include "pipe.hpp"
 #include "err.hpp"
+#include "ctx.hpp"
 
 #include "ypipe.hpp"
 #include "ypipe_conflate.hpp"
 
+//  Number of bytes a message counts for against the byte HWMs. Routing ids
+//  and command messages without data, such as delimiters, count for none.
+static size_t queued_size (const zmq::msg_t &msg_)
+{
+    if (msg_.is_routing_id () || msg_.is_delimiter () || msg_.is_join ()
+        || msg_.is_leave ())
+        return 0;
+    return msg_.size ();
+}
+
 int zmq::pipepair (object_t *parents_[2],
                    pipe_t *pipes_[2],
                    const int hwms_[2],
@@ -49,18 +60,20 @@ int zmq::pipepair (object_t *parents_[2],
     typedef ypipe_t<msg_t, message_pipe_granularity> upipe_normal_t;
     typedef ypipe_conflate_t<msg_t> upipe_conflate_t;
 
+    allocator_t *const allocator = parents_[0]->get_ctx ()->get_allocator ();
+
     pipe_t::upipe_t *upipe1;
     if (conflate_[0])
         upipe1 = new (std::nothrow) upipe_conflate_t ();
     else
-        upipe1 = new (std::nothrow) upipe_normal_t ();
+        upipe1 = new (std::nothrow) upipe_normal_t (allocator);
     alloc_assert (upipe1);
 
     pipe_t::upipe_t *upipe2;
     if (conflate_[1])
         upipe2 = new (std::nothrow) upipe_conflate_t ();
     else
-        upipe2 = new (std::nothrow) upipe_normal_t ();
+        upipe2 = new (std::nothrow) upipe_normal_t (allocator);
     alloc_assert (upipe2);
 
     pipes_[0] = new (std::nothrow)
@@ -106,10 +119,18 @@ zmq::pipe_t::pipe_t (object_t *parent_,
     _msgs_read (0),
     _msgs_written (0),
     _peers_msgs_read (0),
+    _hwm_bytes (0),
+    _lwm_bytes (0),
+    _bytes_read (0),
+    _bytes_written (0),
+    _bytes_pending (0),
+    _bytes_read_sent (0),
+    _peers_bytes_read (0),
     _peer (NULL),
     _sink (NULL),
     _state (active),
     _delay (true),
+    _router_socket_routing_id_hash (0),
     _server_socket_routing_id (0),
     _conflate (conflate_)
 {
@@ -155,6 +176,16 @@ const zmq::blob_t &zmq::pipe_t::get_routing_id () const
     return _router_socket_routing_id;
 }
 
+void zmq::pipe_t::set_routing_id_hash (uint32_t hash_)
+{
+    _router_socket_routing_id_hash = hash_;
+}
+
+uint32_t zmq::pipe_t::get_routing_id_hash () const
+{
+    return _router_socket_routing_id_hash;
+}
+
 bool zmq::pipe_t::check_read ()
 {
     if (unlikely (!_in_active))
@@ -196,6 +227,7 @@ bool zmq::pipe_t::read (msg_t *msg_)
 
         //  If this is a credential, ignore it and receive next message.
         if (unlikely (msg_->is_credential ())) {
+            _bytes_read += queued_size (*msg_);
             const int rc = msg_->close ();
             zmq_assert (rc == 0);
         } else {
@@ -209,11 +241,16 @@ bool zmq::pipe_t::read (msg_t *msg_)
         return false;
     }
 
+    _bytes_read += queued_size (*msg_);
     if (!(msg_->flags () & msg_t::more) && !msg_->is_routing_id ())
         _msgs_read++;
 
-    if (_lwm > 0 && _msgs_read % _lwm == 0)
-        send_activate_write (_peer, _msgs_read);
+    if ((_lwm > 0 && _msgs_read % _lwm == 0)
+        || (_lwm_bytes > 0
+            && _bytes_read - _bytes_read_sent >= uint64_t (_lwm_bytes))) {
+        _bytes_read_sent = _bytes_read;
+        send_activate_write (_peer, _msgs_read, _bytes_read);
+    }
 
     return true;
 }
@@ -240,16 +277,21 @@ bool zmq::pipe_t::write (const msg_t *msg_)
 
     const bool more = (msg_->flags () & msg_t::more) != 0;
     const bool is_routing_id = msg_->is_routing_id ();
+    _bytes_pending += queued_size (*msg_);
     _out_pipe->write (*msg_, more);
-    if (!more && !is_routing_id)
+    if (!more && !is_routing_id) {
         _msgs_written++;
+        _bytes_written += _bytes_pending;
+        _bytes_pending = 0;
+    }
 
     return true;
 }
 
-void zmq::pipe_t::rollback () const
+void zmq::pipe_t::rollback ()
 {
     //  Remove incomplete message from the outbound pipe.
+    _bytes_pending = 0;
     msg_t msg;
     if (_out_pipe) {
         while (_out_pipe->unwrite (&msg)) {
@@ -278,10 +320,12 @@ void zmq::pipe_t::process_activate_read ()
     }
 }
 
-void zmq::pipe_t::process_activate_write (uint64_t msgs_read_)
+void zmq::pipe_t::process_activate_write (uint64_t msgs_read_,
+                                          uint64_t bytes_read_)
 {
     //  Remember the peer's message sequence number.
     _peers_msgs_read = msgs_read_;
+    _peers_bytes_read = bytes_read_;
 
     if (!_out_active && _state == active) {
         _out_active = true;
@@ -299,6 +343,7 @@ void zmq::pipe_t::process_hiccup (void *pipe_)
     while (_out_pipe->read (&msg)) {
         if (!(msg.flags () & msg_t::more))
             _msgs_written--;
+        _bytes_written -= queued_size (msg);
         const int rc = msg.close ();
         errno_assert (rc == 0);
     }
@@ -512,7 +557,8 @@ void zmq::pipe_t::hiccup ()
     _in_pipe =
       _conflate
         ? static_cast<upipe_t *> (new (std::nothrow) ypipe_conflate_t<msg_t> ())
-        : new (std::nothrow) ypipe_t<msg_t, message_pipe_granularity> ();
+        : new (std::nothrow) ypipe_t<msg_t, message_pipe_granularity> (
+          get_ctx ()->get_allocator ());
 
     alloc_assert (_in_pipe);
     _in_active = true;
@@ -543,13 +589,39 @@ void zmq::pipe_t::set_hwms_boost (int inhwmboost_, int outhwmboost_)
     _out_hwm_boost = outhwmboost_;
 }
 
+void zmq::pipe_t::set_hwms_bytes (int64_t inhwm_, int64_t outhwm_)
+{
+    //  As for messages, the peer is told once half the bytes have been
+    //  read, so that the writer does not resume in lock-step.
+    _lwm_bytes = inhwm_ > 0 ? (inhwm_ + 1) / 2 : 0;
+    _hwm_bytes = outhwm_ > 0 ? outhwm_ : 0;
+}
+
 bool zmq::pipe_t::check_hwm () const
 {
     const bool full =
-      _hwm > 0 && _msgs_written - _peers_msgs_read >= uint64_t (_hwm);
+      (_hwm > 0 && _msgs_written - _peers_msgs_read >= uint64_t (_hwm))
+      || (_hwm_bytes > 0
+          && _bytes_written - _peers_bytes_read >= uint64_t (_hwm_bytes));
     return !full;
 }
 
+size_t zmq::pipe_t::memory () const
+{
+    //  The outbound queue is dropped once the peer may have deleted it.
+    size_t memory = _in_pipe->memory ();
+    if (_out_pipe)
+        memory += _out_pipe->memory ();
+    return memory;
+}
+
+void zmq::pipe_t::release_spare ()
+{
+    _in_pipe->release_spare ();
+    if (_out_pipe)
+        _out_pipe->release_spare ();
+}
+
 void zmq::pipe_t::send_hwms_to_peer (int inhwm_, int outhwm_)
 {
     send_pipe_hwm (_peer, inhwm_, outhwm_);
@@ -569,14 +641,16 @@ void zmq::pipe_t::send_stats_to_peer (own_t *socket_base_)
 {
     endpoint_uri_pair_t *ep =
       new (std::nothrow) endpoint_uri_pair_t (_endpoint_pair);
-    send_pipe_peer_stats (_peer, _msgs_written - _peers_msgs_read, socket_base_,
-                          ep);
+    send_pipe_peer_stats (_peer, _msgs_written - _peers_msgs_read,
+                          _bytes_written - _peers_bytes_read, socket_base_, ep);
 }
 
 void zmq::pipe_t::process_pipe_peer_stats (uint64_t queue_count_,
+                                           uint64_t queue_bytes_,
                                            own_t *socket_base_,
                                            endpoint_uri_pair_t *endpoint_pair_)
 {
-    send_pipe_stats_publish (socket_base_, queue_count_,
-                             _msgs_written - _peers_msgs_read, endpoint_pair_);
+    send_pipe_stats_publish (
+      socket_base_, queue_count_, _msgs_written - _peers_msgs_read,
+      queue_bytes_, _bytes_written - _peers_bytes_read, endpoint_pair_);
 }
@@ -35,6 +35,7 @@
 #include "object.hpp"
 #include "stdint.hpp"
 #include "array.hpp"
+#include "ring.hpp"
 #include "blob.hpp"
 #include "options.hpp"
 #include "endpoint.hpp"
@@ -69,12 +70,15 @@ struct i_pipe_events
 
 //  Note that pipe can be stored in three different arrays.
 //  The array of inbound pipes (1), the array of outbound pipes (2) and
-//  the generic array of pipes to be deallocated (3).
+//  the generic array of pipes to be deallocated (3). Likewise it can be
+//  in the rings of active inbound (1) and outbound (2) pipes.
 
 class pipe_t ZMQ_FINAL : public object_t,
                          public array_item_t<1>,
                          public array_item_t<2>,
-                         public array_item_t<3>
+                         public array_item_t<3>,
+                         public ring_item_t<1>,
+                         public ring_item_t<2>
 {
     //  This allows pipepair to create pipe objects.
     friend int pipepair (zmq::object_t *parents_[2],
@@ -94,6 +98,11 @@ class pipe_t ZMQ_FINAL : public object_t,
     void set_router_socket_routing_id (const blob_t &router_socket_routing_id_);
     const blob_t &get_routing_id () const;
 
+    //  Hash of the routing id, as computed by the routing table holding
+    //  the pipe with its own key.
+    void set_routing_id_hash (uint32_t hash_);
+    uint32_t get_routing_id_hash () const;
+
     //  Returns true if there is at least one message to read in the pipe.
     bool check_read ();
 
@@ -111,7 +120,7 @@ class pipe_t ZMQ_FINAL : public object_t,
     bool write (const msg_t *msg_);
 
     //  Remove unfinished parts of the outbound message from the pipe.
-    void rollback () const;
+    void rollback ();
 
     //  Flush the messages downstream.
     void flush ();
@@ -136,6 +145,10 @@ class pipe_t ZMQ_FINAL : public object_t,
     //  Set the boost to high water marks, used by inproc sockets so total hwm are sum of connect and bind sockets watermarks
     void set_hwms_boost (int inhwmboost_, int outhwmboost_);
 
+    //  Set the high water marks for the payload bytes queued, 0 for
+    //  no limit. Only called before messages are passed.
+    void set_hwms_bytes (int64_t inhwm_, int64_t outhwm_);
+
     // send command to peer for notify the change of hwm
     void send_hwms_to_peer (int inhwm_, int outhwm_);
 
@@ -147,16 +160,24 @@ class pipe_t ZMQ_FINAL : public object_t,
 
     void send_stats_to_peer (own_t *socket_base_);
 
+    //  Returns the number of bytes held by the queues of both directions.
+    size_t memory () const;
+
+    //  Frees the chunks the queues of both directions keep for reuse.
+    void release_spare ();
+
   private:
     //  Type of the underlying lock-free pipe.
     typedef ypipe_base_t<msg_t> upipe_t;
 
     //  Command handlers.
     void process_activate_read () ZMQ_OVERRIDE;
-    void process_activate_write (uint64_t msgs_read_) ZMQ_OVERRIDE;
+    void process_activate_write (uint64_t msgs_read_,
+                                 uint64_t bytes_read_) ZMQ_OVERRIDE;
     void process_hiccup (void *pipe_) ZMQ_OVERRIDE;
     void
     process_pipe_peer_stats (uint64_t queue_count_,
+                             uint64_t queue_bytes_,
                              own_t *socket_base_,
                              endpoint_uri_pair_t *endpoint_pair_) ZMQ_OVERRIDE;
     void process_pipe_term () ZMQ_OVERRIDE;
@@ -208,6 +229,25 @@ class pipe_t ZMQ_FINAL : public object_t,
     //  can be higher at the moment.
     uint64_t _peers_msgs_read;
 
+    //  High watermark for the payload bytes in the outbound pipe and
+    //  low watermark for the inbound pipe. 0 if there is no limit.
+    int64_t _hwm_bytes;
+    int64_t _lwm_bytes;
+
+    //  Payload bytes read and written so far. Like messages, bytes
+    //  count as written once the last frame of their message is.
+    uint64_t _bytes_read;
+    uint64_t _bytes_written;
+
+    //  Bytes of the frames written for the message in progress.
+    uint64_t _bytes_pending;
+
+    //  Bytes read when the peer was last told about it.
+    uint64_t _bytes_read_sent;
+
+    //  Last received peer's bytes_read.
+    uint64_t _peers_bytes_read;
+
     //  The pipe object on the other side of the pipepair.
     pipe_t *_peer;
 
@@ -242,6 +282,7 @@ class pipe_t ZMQ_FINAL : public object_t,
 
     //  Routing id of the writer. Used uniquely by the reader side.
     blob_t _router_socket_routing_id;
+    uint32_t _router_socket_routing_id_hash;
 
     //  Routing id of the writer. Used uniquely by the reader side.
     int _server_socket_routing_id;
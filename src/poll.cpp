@@ -153,8 +153,10 @@ void zmq::poll_t::loop ()
         }
 
         //  Wait for events.
+        wait_begin ();
         int rc = poll (&pollset[0], static_cast<nfds_t> (pollset.size ()),
                        timeout ? timeout : -1);
+        wait_end (rc);
         if (rc == -1) {
             errno_assert (errno == EINTR);
             continue;
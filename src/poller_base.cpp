@@ -32,6 +32,15 @@
 #include "i_poll_events.hpp"
 #include "err.hpp"
 
+zmq::poller_base_t::poller_base_t () :
+    _busy_poll (0),
+    _busy_time (0),
+    _busy_since (clock_t::now_us ()),
+    _traffic (0),
+    _events (0)
+{
+}
+
 zmq::poller_base_t::~poller_base_t ()
 {
     //  Make sure there is no more load on the shutdown.
@@ -53,58 +62,49 @@ void zmq::poller_base_t::adjust_load (int amount_)
 
 void zmq::poller_base_t::add_timer (int timeout_, i_poll_events *sink_, int id_)
 {
-    uint64_t expiration = _clock.now_ms () + timeout_;
-    timer_info_t info = {sink_, id_};
-    _timers.insert (timers_t::value_type (expiration, info));
+    _timers.add (_clock.now_ms (), timeout_, sink_, id_);
 }
 
 void zmq::poller_base_t::cancel_timer (i_poll_events *sink_, int id_)
 {
-    //  Complexity of this operation is O(n). We assume it is rarely used.
-    for (timers_t::iterator it = _timers.begin (), end = _timers.end ();
-         it != end; ++it)
-        if (it->second.sink == sink_ && it->second.id == id_) {
-            _timers.erase (it);
-            return;
-        }
+    const bool found = _timers.cancel (sink_, id_);
 
     //  Timer not found.
-    zmq_assert (false);
+    zmq_assert (found);
 }
 
-uint64_t zmq::poller_base_t::execute_timers ()
+void zmq::poller_base_t::set_busy_poll (int us_)
 {
-    //  Fast track.
-    if (_timers.empty ())
-        return 0;
+    _busy_poll = us_;
+}
 
-    //  Get the current time.
-    const uint64_t current = _clock.now_ms ();
+uint64_t zmq::poller_base_t::get_busy_time () const
+{
+    return _busy_time + (clock_t::now_us () - _busy_since);
+}
 
-    //   Execute the timers that are already due.
-    const timers_t::iterator begin = _timers.begin ();
-    const timers_t::iterator end = _timers.end ();
-    uint64_t res = 0;
-    timers_t::iterator it = begin;
-    for (; it != end; ++it) {
-        //  If we have to wait to execute the item, same will be true about
-        //  all the following items (multimap is sorted). Thus we can stop
-        //  checking the subsequent timers.
-        if (it->first > current) {
-            res = it->first - current;
-            break;
-        }
+void zmq::poller_base_t::wait_begin ()
+{
+    _busy_time += clock_t::now_us () - _busy_since;
+}
 
-        //  Trigger the timer.
-        it->second.sink->timer_event (it->second.id);
-    }
+void zmq::poller_base_t::wait_end (int events_)
+{
+    _busy_since = clock_t::now_us ();
+    if (events_ > 0)
+        _events += events_;
+}
 
-    //  Remove them from the list of active timers.
-    _timers.erase (begin, it);
+uint64_t zmq::poller_base_t::execute_timers ()
+{
+    //  Fast track.
+    if (_timers.empty ())
+        return 0;
 
-    //  Return the time to wait for the next timer (at least 1ms), or 0, if
-    //  there are no more timers.
-    return res;
+    //  Execute the timers that are already due, and return the time to
+    //  wait for the next one (at least 1ms), or 0, if there are no more
+    //  timers.
+    return _timers.execute (_clock.now_ms ());
 }
 
 zmq::worker_poller_base_t::worker_poller_base_t (const thread_ctx_t &ctx_) :
@@ -120,7 +120,7 @@ void zmq::worker_poller_base_t::stop_worker ()
 void zmq::worker_poller_base_t::start (const char *name_)
 {
     zmq_assert (get_load () > 0);
-    _ctx.start_thread (_worker, worker_routine, this, name_);
+    _ctx.start_thread (_worker, worker_routine, this, name_, get_cpus ());
 }
 
 void zmq::worker_poller_base_t::check_thread () const
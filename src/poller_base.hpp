@@ -30,11 +30,10 @@
 #ifndef __ZMQ_POLLER_BASE_HPP_INCLUDED__
 #define __ZMQ_POLLER_BASE_HPP_INCLUDED__
 
-#include <map>
-
 #include "clock.hpp"
 #include "atomic_counter.hpp"
 #include "ctx.hpp"
+#include "timer_wheel.hpp"
 
 namespace zmq
 {
@@ -44,8 +43,8 @@ struct i_poll_events;
 // convention, this is done via a typedef.
 //
 // At the time of writing, the following implementations of the poller_t
-// concept exist: zmq::devpoll_t, zmq::epoll_t, zmq::kqueue_t, zmq::poll_t,
-// zmq::pollset_t, zmq::select_t
+// concept exist: zmq::devpoll_t, zmq::epoll_t, zmq::io_uring_t, zmq::kqueue_t,
+// zmq::poll_t, zmq::pollset_t, zmq::select_t
 //
 // An implementation of the poller_t concept must provide the following public
 // methods:
@@ -91,11 +90,30 @@ struct i_poll_events;
 //   poller at the same time, or -1 if there is no such fixed limit.
 // static int max_fds();
 //
+//   Makes the poller spin on non-blocking waits for up to us_ microseconds
+//   before blocking. Pollers that cannot spin ignore it.
+// void set_busy_poll(int us_);
+//
+//   Makes the poller's thread run on cpus_ rather than on the CPUs set for
+//   the context's threads.
+// void set_cpus(const std::set<int> &cpus_);
+//
+//   Accounts for bytes_ transferred by an object served by the poller.
+// void add_traffic(size_t bytes_);
+//
+//   Return the microseconds spent outside of waits for events, the bytes
+//   accounted for with add_traffic, resp. the events reported by waits,
+//   since the poller was created.
+// uint64_t get_busy_time() const;
+// uint64_t get_traffic() const;
+// uint64_t get_events() const;
+//
 // Most of the methods may only be called from a zmq::i_poll_events callback
 // function when invoked by the poller (and, therefore, typically from the
 // poller's worker thread), with the following exceptions:
 // - get_load may be called from outside
-// - add_fd and add_timer may be called from outside before start
+// - add_fd, add_timer, set_busy_poll and set_cpus may be called from
+//   outside before start
 // - start may be called from outside once
 //
 // After a poller is started, it waits for the registered events (input/output
@@ -122,15 +140,27 @@ struct i_poll_events;
 class poller_base_t
 {
   public:
-    poller_base_t () ZMQ_DEFAULT;
+    poller_base_t ();
     virtual ~poller_base_t ();
 
     // Methods from the poller concept.
     int get_load () const;
     void add_timer (int timeout_, zmq::i_poll_events *sink_, int id_);
     void cancel_timer (zmq::i_poll_events *sink_, int id_);
+    void set_busy_poll (int us_);
+    void set_cpus (const std::set<int> &cpus_) { _cpus = cpus_; }
+    void add_traffic (size_t bytes_) { _traffic += bytes_; }
+    uint64_t get_busy_time () const;
+    uint64_t get_traffic () const { return _traffic; }
+    uint64_t get_events () const { return _events; }
 
   protected:
+    //  Microseconds to spin before blocking, 0 if the poller never spins.
+    int get_busy_poll () const { return _busy_poll; }
+
+    //  CPUs set with set_cpus, empty if none.
+    const std::set<int> &get_cpus () const { return _cpus; }
+
     //  Called by individual poller implementations to manage the load.
     void adjust_load (int amount_);
 
@@ -138,23 +168,39 @@ class poller_base_t
     //  to wait to match the next timer or 0 meaning "no timers".
     uint64_t execute_timers ();
 
+    //  Called by individual poller implementations right before resp.
+    //  after waiting for events, to measure the time they are busy.
+    //  events_ is what the wait returned; negative values are errors.
+    void wait_begin ();
+    void wait_end (int events_);
+
   private:
     //  Clock instance private to this I/O thread.
     clock_t _clock;
 
-    //  List of active timers.
-    struct timer_info_t
-    {
-        zmq::i_poll_events *sink;
-        int id;
-    };
-    typedef std::multimap<uint64_t, timer_info_t> timers_t;
-    timers_t _timers;
+    //  Active timers.
+    timer_wheel_t _timers;
 
     //  Load of the poller. Currently the number of file descriptors
     //  registered.
     atomic_counter_t _load;
 
+    //  Spin time set with set_busy_poll.
+    int _busy_poll;
+
+    //  CPUs set with set_cpus.
+    std::set<int> _cpus;
+
+    //  Busy time up to the last wait, and the time that wait ended.
+    uint64_t _busy_time;
+    uint64_t _busy_since;
+
+    //  Bytes passed to add_traffic.
+    uint64_t _traffic;
+
+    //  Events reported by waits.
+    uint64_t _events;
+
     ZMQ_NON_COPYABLE_NOR_MOVABLE (poller_base_t)
 };
 
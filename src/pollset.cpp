@@ -212,8 +212,10 @@ void zmq::pollset_t::loop ()
         int timeout = (int) execute_timers ();
 
         //  Wait for events.
+        wait_begin ();
         int n = pollset_poll (pollset_fd, polldata_array, max_io_events,
                               timeout ? timeout : -1);
+        wait_end (n);
         if (n == -1) {
             errno_assert (errno == EINTR);
             continue;
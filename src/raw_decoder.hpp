@@ -42,7 +42,7 @@ namespace zmq
 class raw_decoder_t ZMQ_FINAL : public i_decoder
 {
   public:
-    raw_decoder_t (size_t bufsize_);
+    raw_decoder_t (size_t bufsize_, allocator_t *allocator_);
     ~raw_decoder_t () ZMQ_FINAL;
 
     //  i_decoder interface.
@@ -57,6 +57,10 @@ class raw_decoder_t ZMQ_FINAL : public i_decoder
 
     void resize_buffer (size_t) ZMQ_FINAL {}
 
+    void release_buffer () ZMQ_FINAL { _allocator.deallocate (); }
+
+    size_t buffer_size () const ZMQ_FINAL { return _allocator.memory (); }
+
   private:
     msg_t _in_progress;
 
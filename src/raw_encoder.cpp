@@ -32,8 +32,9 @@
 #include "raw_encoder.hpp"
 #include "msg.hpp"
 
-zmq::raw_encoder_t::raw_encoder_t (size_t bufsize_) :
-    encoder_base_t<raw_encoder_t> (bufsize_)
+zmq::raw_encoder_t::raw_encoder_t (size_t bufsize_,
+                                   allocator_t *allocator_) :
+    encoder_base_t<raw_encoder_t> (bufsize_, allocator_)
 {
     //  Write 0 bytes to the batch and go to message_ready state.
     next_step (NULL, 0, &raw_encoder_t::raw_message_ready, true);
@@ -78,10 +78,12 @@ zmq::raw_engine_t::~raw_engine_t ()
 void zmq::raw_engine_t::plug_internal ()
 {
     // no handshaking for raw sock, instantiate raw encoder and decoders
-    _encoder = new (std::nothrow) raw_encoder_t (_options.out_batch_size);
+    _encoder = new (std::nothrow)
+      raw_encoder_t (_options.out_batch_size, _options.allocator);
     alloc_assert (_encoder);
 
-    _decoder = new (std::nothrow) raw_decoder_t (_options.in_batch_size);
+    _decoder = new (std::nothrow)
+      raw_decoder_t (_options.in_batch_size, _options.allocator);
     alloc_assert (_decoder);
 
     _next_msg = &raw_engine_t::pull_msg_from_session;
@@ -0,0 +1,138 @@
+/*
+    Copyright (c) 2007-2016 Contributors as noted in the AUTHORS file
+
+    This file is part of libzmq, the ZeroMQ core engine in C++.
+
+    libzmq is free software; you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    As a special exception, the Contributors give you permission to link
+    this library with independent modules to produce an executable,
+    regardless of the license terms of these independent modules, and to
+    copy and distribute the resulting executable under terms of your choice,
+    provided that you also meet, for each linked independent module, the
+    terms and conditions of the license of that module. An independent
+    module is a module which is not derived from or based on this library.
+    If you modify this library, you must extend this exception to your
+    version of the library.
+
+    libzmq is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef __ZMQ_RING_HPP_INCLUDED__
+#define __ZMQ_RING_HPP_INCLUDED__
+
+#include <stddef.h>
+
+#include "macros.hpp"
+
+namespace zmq
+{
+//  Intrusive circular list of objects with O(1) insertion and removal,
+//  used to round-robin over the active members of a set.
+//  The items inherit from ring_item_t<ID>, which holds the links. As with
+//  array_t, the ID template argument lets an object be a member of several
+//  rings at once.
+
+template <int ID = 0> class ring_item_t
+{
+  public:
+    inline ring_item_t () : _prev (NULL), _next (NULL) {}
+
+    //  The destructor doesn't have to be virtual. It is made virtual
+    //  just to keep ICC and code checking tools from complaining.
+    inline virtual ~ring_item_t () ZMQ_DEFAULT;
+
+  private:
+    ring_item_t *_prev;
+    ring_item_t *_next;
+
+    template <typename T, int> friend class ring_t;
+
+    ZMQ_NON_COPYABLE_NOR_MOVABLE (ring_item_t)
+};
+
+template <typename T, int ID = 0> class ring_t
+{
+  private:
+    typedef ring_item_t<ID> item_t;
+
+  public:
+    inline ring_t () : _current (NULL), _size (0) {}
+
+    inline size_t size () const { return _size; }
+
+    inline bool empty () const { return _size == 0; }
+
+    //  Returns the item whose turn it is, or NULL if the ring is empty.
+    inline T *current () const
+    {
+        return _current ? static_cast<T *> (_current) : NULL;
+    }
+
+    inline static bool contains (T *item_)
+    {
+        return static_cast<item_t *> (item_)->_next != NULL;
+    }
+
+    //  Inserts the item just before the current one, so that it gets its
+    //  turn after all the items already in the ring.
+    inline void push_back (T *item_)
+    {
+        item_t *const item = static_cast<item_t *> (item_);
+        if (_current) {
+            item->_next = _current;
+            item->_prev = _current->_prev;
+            _current->_prev->_next = item;
+            _current->_prev = item;
+        } else {
+            item->_next = item;
+            item->_prev = item;
+            _current = item;
+        }
+        _size++;
+    }
+
+    //  Removes the item. If it was the current one, its successor becomes
+    //  the current item.
+    inline void erase (T *item_)
+    {
+        item_t *const item = static_cast<item_t *> (item_);
+        if (item->_next == item)
+            _current = NULL;
+        else {
+            item->_prev->_next = item->_next;
+            item->_next->_prev = item->_prev;
+            if (_current == item)
+                _current = item->_next;
+        }
+        item->_next = NULL;
+        item->_prev = NULL;
+        _size--;
+    }
+
+    //  Passes the turn to the next item.
+    inline void advance ()
+    {
+        if (_current)
+            _current = _current->_next;
+    }
+
+  private:
+    item_t *_current;
+    size_t _size;
+
+    ZMQ_NON_COPYABLE_NOR_MOVABLE (ring_t)
+};
+}
+
+#endif
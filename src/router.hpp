@@ -44,7 +44,7 @@ namespace zmq
 class ctx_t;
 class pipe_t;
 
-//  TODO: This class uses O(n) scheduling. Rewrite it to use O(1) algorithm.
+//  TODO: With ZMQ_ROUTER_MANDATORY, xhas_out is O(n) in the number of peers.
 class router_t : public routing_socket_base_t
 {
   public:
@@ -0,0 +1,190 @@
+/*
+    Copyright (c) 2007-2016 Contributors as noted in the AUTHORS file
+
+    This file is part of libzmq, the ZeroMQ core engine in C++.
+
+    libzmq is free software; you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    As a special exception, the Contributors give you permission to link
+    this library with independent modules to produce an executable,
+    regardless of the license terms of these independent modules, and to
+    copy and distribute the resulting executable under terms of your choice,
+    provided that you also meet, for each linked independent module, the
+    terms and conditions of the license of that module. An independent
+    module is a module which is not derived from or based on this library.
+    If you modify this library, you must extend this exception to your
+    version of the library.
+
+    libzmq is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "precompiled.hpp"
+#include "routing_table.hpp"
+#include "pipe.hpp"
+#include "err.hpp"
+#include "random.hpp"
+
+#include <string.h>
+
+zmq::routing_table_t::routing_table_t () : _size (0)
+{
+    _hash_key.k0 = static_cast<uint64_t> (generate_random ()) << 32
+                   | generate_random ();
+    _hash_key.k1 = static_cast<uint64_t> (generate_random ()) << 32
+                   | generate_random ();
+}
+
+zmq::routing_table_t::~routing_table_t ()
+{
+    zmq_assert (_size == 0);
+}
+
+bool zmq::routing_table_t::insert (pipe_t *pipe_, bool active_)
+{
+    //  Keep the load factor at or below 3/4.
+    if ((_size + 1) * 4 > _slots.size () * 3)
+        grow ();
+
+    const blob_t &routing_id = pipe_->get_routing_id ();
+    const uint32_t hash = routing_id.hash (_hash_key);
+    const size_t pos = probe (routing_id.data (), routing_id.size (), hash);
+    if (_slots[pos].entry.pipe)
+        return false;
+
+    _slots[pos].entry.pipe = pipe_;
+    _slots[pos].entry.active = active_;
+    _slots[pos].hash = hash;
+    _size++;
+    pipe_->set_routing_id_hash (hash);
+    return true;
+}
+
+zmq::routing_table_t::entry_t *
+zmq::routing_table_t::find (const unsigned char *routing_id_, size_t size_)
+{
+    if (_size == 0)
+        return NULL;
+    const size_t pos = probe (routing_id_, size_,
+                              blob_t::hash (routing_id_, size_, _hash_key));
+    return _slots[pos].entry.pipe ? &_slots[pos].entry : NULL;
+}
+
+const zmq::routing_table_t::entry_t *
+zmq::routing_table_t::find (const unsigned char *routing_id_,
+                            size_t size_) const
+{
+    if (_size == 0)
+        return NULL;
+    const size_t pos = probe (routing_id_, size_,
+                              blob_t::hash (routing_id_, size_, _hash_key));
+    return _slots[pos].entry.pipe ? &_slots[pos].entry : NULL;
+}
+
+zmq::routing_table_t::entry_t *zmq::routing_table_t::find (const pipe_t *pipe_)
+{
+    const size_t pos = find_slot (pipe_);
+    return pos == _slots.size () ? NULL : &_slots[pos].entry;
+}
+
+bool zmq::routing_table_t::erase (const pipe_t *pipe_)
+{
+    const size_t pos = find_slot (pipe_);
+    if (pos == _slots.size ())
+        return false;
+    erase_slot (pos);
+    return true;
+}
+
+zmq::routing_table_t::entry_t
+zmq::routing_table_t::erase (const unsigned char *routing_id_, size_t size_)
+{
+    entry_t res = {NULL, false};
+    if (_size == 0)
+        return res;
+    const size_t pos = probe (routing_id_, size_,
+                              blob_t::hash (routing_id_, size_, _hash_key));
+    if (_slots[pos].entry.pipe) {
+        res = _slots[pos].entry;
+        erase_slot (pos);
+    }
+    return res;
+}
+
+size_t zmq::routing_table_t::probe (const unsigned char *routing_id_,
+                                    size_t size_,
+                                    uint32_t hash_) const
+{
+    const size_t mask = _slots.size () - 1;
+    size_t pos = hash_ & mask;
+    while (_slots[pos].entry.pipe) {
+        if (_slots[pos].hash == hash_) {
+            const blob_t &routing_id = _slots[pos].entry.pipe->get_routing_id ();
+            if (routing_id.size () == size_
+                && (size_ == 0
+                    || memcmp (routing_id.data (), routing_id_, size_) == 0))
+                break;
+        }
+        pos = (pos + 1) & mask;
+    }
+    return pos;
+}
+
+size_t zmq::routing_table_t::find_slot (const pipe_t *pipe_) const
+{
+    if (_size == 0)
+        return _slots.size ();
+    const size_t mask = _slots.size () - 1;
+    for (size_t pos = pipe_->get_routing_id_hash () & mask;
+         _slots[pos].entry.pipe; pos = (pos + 1) & mask)
+        if (_slots[pos].entry.pipe == pipe_)
+            return pos;
+    return _slots.size ();
+}
+
+void zmq::routing_table_t::erase_slot (size_t pos_)
+{
+    const size_t mask = _slots.size () - 1;
+    size_t hole = pos_;
+    for (size_t pos = (hole + 1) & mask; _slots[pos].entry.pipe;
+         pos = (pos + 1) & mask) {
+        //  An entry can fill the hole unless its home slot lies cyclically
+        //  in (hole, pos], in which case it must stay where it is.
+        const size_t home = _slots[pos].hash & mask;
+        if (((pos - home) & mask) >= ((pos - hole) & mask)) {
+            _slots[hole] = _slots[pos];
+            hole = pos;
+        }
+    }
+    _slots[hole].entry.pipe = NULL;
+    _size--;
+}
+
+void zmq::routing_table_t::grow ()
+{
+    std::vector<slot_t> old_slots (_slots.empty () ? 8 : _slots.size () * 2);
+    for (size_t i = 0, n = old_slots.size (); i != n; ++i)
+        old_slots[i].entry.pipe = NULL;
+    old_slots.swap (_slots);
+
+    //  Hashes are kept in the slots, so rehashing needs no access to the
+    //  pipes themselves.
+    const size_t mask = _slots.size () - 1;
+    for (size_t i = 0, n = old_slots.size (); i != n; ++i) {
+        if (!old_slots[i].entry.pipe)
+            continue;
+        size_t pos = old_slots[i].hash & mask;
+        while (_slots[pos].entry.pipe)
+            pos = (pos + 1) & mask;
+        _slots[pos] = old_slots[i];
+    }
+}
@@ -0,0 +1,128 @@
+/*
+    Copyright (c) 2007-2016 Contributors as noted in the AUTHORS file
+
+    This file is part of libzmq, the ZeroMQ core engine in C++.
+
+    libzmq is free software; you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    As a special exception, the Contributors give you permission to link
+    this library with independent modules to produce an executable,
+    regardless of the license terms of these independent modules, and to
+    copy and distribute the resulting executable under terms of your choice,
+    provided that you also meet, for each linked independent module, the
+    terms and conditions of the license of that module. An independent
+    module is a module which is not derived from or based on this library.
+    If you modify this library, you must extend this exception to your
+    version of the library.
+
+    libzmq is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef __ZMQ_ROUTING_TABLE_HPP_INCLUDED__
+#define __ZMQ_ROUTING_TABLE_HPP_INCLUDED__
+
+#include <stddef.h>
+#include <vector>
+
+#include "blob.hpp"
+#include "macros.hpp"
+#include "stdint.hpp"
+
+namespace zmq
+{
+class pipe_t;
+
+//  Outbound pipes of a routing socket, indexed by the peer's routing id.
+//  This is an open addressing hash table with linear probing. The key of
+//  each entry is the routing id of its pipe. Its hash is computed once, on
+//  insertion, and kept both in the slot, so that probing compares the
+//  routing id itself only when the hashes match, and in the pipe. Routing
+//  ids may be chosen by peers, so each table hashes with a random key.
+class routing_table_t
+{
+  public:
+    struct entry_t
+    {
+        pipe_t *pipe;
+        bool active;
+    };
+
+    routing_table_t ();
+    ~routing_table_t ();
+
+    //  Adds the pipe under its current routing id. Returns false if
+    //  there already is a pipe with the same routing id.
+    bool insert (pipe_t *pipe_, bool active_);
+
+    //  Returns the entry for the routing id, or NULL if there is none.
+    entry_t *find (const unsigned char *routing_id_, size_t size_);
+    const entry_t *find (const unsigned char *routing_id_, size_t size_) const;
+
+    //  Returns the entry of the pipe, or NULL if it is not in the table.
+    entry_t *find (const pipe_t *pipe_);
+
+    //  Removes the pipe from the table. Returns false if it was not in
+    //  the table.
+    bool erase (const pipe_t *pipe_);
+
+    //  Removes the entry for the routing id and returns it. The pipe of
+    //  the returned entry is NULL if there was none.
+    entry_t erase (const unsigned char *routing_id_, size_t size_);
+
+    size_t size () const { return _size; }
+    bool empty () const { return _size == 0; }
+
+    //  Returns true if func_ returns true for any of the pipes.
+    template <typename Func> bool any_of (Func func_) const
+    {
+        bool res = false;
+        for (size_t i = 0, n = _slots.size (); i != n && !res; ++i)
+            if (_slots[i].entry.pipe)
+                res |= func_ (*_slots[i].entry.pipe);
+        return res;
+    }
+
+  private:
+    struct slot_t
+    {
+        entry_t entry;
+        uint32_t hash;
+    };
+
+    //  Returns the index of the slot holding the routing id, or of the
+    //  empty slot where it would be inserted.
+    size_t probe (const unsigned char *routing_id_,
+                  size_t size_,
+                  uint32_t hash_) const;
+
+    //  Returns the index of the slot holding the pipe, or the number of
+    //  slots if it is not in the table.
+    size_t find_slot (const pipe_t *pipe_) const;
+
+    //  Empties the slot and moves later entries of its probe sequence
+    //  back, so that no tombstones are needed.
+    void erase_slot (size_t pos_);
+
+    void grow ();
+
+    //  Number of slots is always zero or a power of two.
+    std::vector<slot_t> _slots;
+    size_t _size;
+
+    blob_t::hash_key_t _hash_key;
+
+    ZMQ_NON_COPYABLE_NOR_MOVABLE (routing_table_t)
+};
+}
+
+#endif
@@ -33,10 +33,12 @@
 #include "i_engine.hpp"
 #include "err.hpp"
 #include "pipe.hpp"
+#include "io_thread.hpp"
 #include "likely.hpp"
 #include "tcp_connecter.hpp"
 #include "ws_connecter.hpp"
 #include "ipc_connecter.hpp"
+#include "shm_connecter.hpp"
 #include "tipc_connecter.hpp"
 #include "socks_connecter.hpp"
 #include "vmci_connecter.hpp"
@@ -114,12 +116,16 @@ zmq::session_base_t::session_base_t (class io_thread_t *io_thread_,
     _socket (socket_),
     _io_thread (io_thread_),
     _has_linger_timer (false),
+    _activity (0),
+    _registered (false),
+    _migrated (false),
     _addr (addr_)
 #ifdef ZMQ_HAVE_WSS
     ,
     _wss_hostname (options_.wss_hostname)
 #endif
 {
+    _io_thread->adjust_weight (options.io_weight);
 }
 
 const zmq::endpoint_uri_pair_t &zmq::session_base_t::get_endpoint () const
@@ -132,6 +138,10 @@ zmq::session_base_t::~session_base_t ()
     zmq_assert (!_pipe);
     zmq_assert (!_zap_pipe);
 
+    if (_registered && !_migrated)
+        _io_thread->unregister_session (this);
+    _io_thread->adjust_weight (-options.io_weight);
+
     //  If there's still a pending linger timer, remove it.
     if (_has_linger_timer) {
         cancel_timer (linger_timer_id);
@@ -162,6 +172,7 @@ int zmq::session_base_t::pull_msg (msg_t *msg_)
     }
 
     _incomplete_in = (msg_->flags () & msg_t::more) != 0;
+    _activity++;
 
     return 0;
 }
@@ -175,6 +186,7 @@ int zmq::session_base_t::push_msg (msg_t *msg_)
     if (_pipe && _pipe->write (msg_)) {
         const int rc = msg_->init ();
         errno_assert (rc == 0);
+        _activity++;
         return 0;
     }
 
@@ -222,6 +234,12 @@ void zmq::session_base_t::flush ()
         _pipe->flush ();
 }
 
+void zmq::session_base_t::release_pipe_memory ()
+{
+    if (_pipe)
+        _pipe->release_spare ();
+}
+
 void zmq::session_base_t::rollback ()
 {
     if (_pipe)
@@ -332,6 +350,9 @@ zmq::socket_base_t *zmq::session_base_t::get_socket () const
 
 void zmq::session_base_t::process_plug ()
 {
+    _io_thread->register_session (this);
+    _registered = true;
+
     if (_active)
         start_connecting (false);
 }
@@ -406,6 +427,12 @@ void zmq::session_base_t::process_attach (i_engine *engine_)
         bool conflates[2] = {conflate, conflate};
         const int rc = pipepair (parents, pipes, hwms, conflates);
         errno_assert (rc == 0);
+        if (!conflate) {
+            pipes[0]->set_hwms_bytes (options.sndhwm_bytes,
+                                      options.rcvhwm_bytes);
+            pipes[1]->set_hwms_bytes (options.rcvhwm_bytes,
+                                      options.sndhwm_bytes);
+        }
 
         //  Plug the local end of the pipe.
         pipes[0]->set_event_sink (this);
@@ -510,6 +537,49 @@ void zmq::session_base_t::process_term (int linger_)
         _zap_pipe->terminate (false);
 }
 
+uint64_t zmq::session_base_t::take_activity ()
+{
+    const uint64_t activity = _activity;
+    _activity = 0;
+    return activity;
+}
+
+bool zmq::session_base_t::migrate (io_thread_t *io_thread_)
+{
+    //  Only sessions with a connected engine and no pipe termination in
+    //  progress move, as do only those allowed on io_thread_.
+    const uint32_t index = io_thread_->get_tid () - ctx_t::reaper_tid - 1;
+    if (_migrated || is_terminating () || _pending || !_pipe || !_engine
+        || !_terminating_pipes.empty () || _has_linger_timer
+        || (options.affinity
+            && (index >= 64 || !(options.affinity & (uint64_t (1) << index)))))
+        return false;
+    if (!_engine->migrate_out ())
+        return false;
+
+    io_object_t::unplug ();
+    _io_thread->adjust_weight (-options.io_weight);
+    _io_thread = io_thread_;
+    _io_thread->adjust_weight (options.io_weight);
+    _migrated = true;
+
+    //  Commands keep being sent to the thread the session was created in,
+    //  which relays them once it has sent the migrate command.
+    const uint32_t tid = io_thread_->get_tid ();
+    set_host_tid (tid);
+    _pipe->set_host_tid (tid);
+    if (_zap_pipe)
+        _zap_pipe->set_host_tid (tid);
+    send_migrate (this);
+    return true;
+}
+
+void zmq::session_base_t::process_migrate ()
+{
+    io_object_t::plug (_io_thread);
+    _engine->migrate_in (_io_thread);
+}
+
 void zmq::session_base_t::timer_event (int id_)
 {
     //  Linger period expired. We can proceed with termination even though
@@ -575,6 +645,10 @@ zmq::session_base_t::connecter_factory_entry_t
     connecter_factory_entry_t (protocol_name::ipc,
                                &zmq::session_base_t::create_connecter_ipc),
 #endif
+#if defined ZMQ_HAVE_SHM
+    connecter_factory_entry_t (protocol_name::shm,
+                               &zmq::session_base_t::create_connecter_shm),
+#endif
 #if defined ZMQ_HAVE_TIPC
     connecter_factory_entry_t (protocol_name::tipc,
                                &zmq::session_base_t::create_connecter_tipc),
@@ -671,6 +745,15 @@ zmq::own_t *zmq::session_base_t::create_connecter_ipc (io_thread_t *io_thread_,
 }
 #endif
 
+#if defined ZMQ_HAVE_SHM
+zmq::own_t *zmq::session_base_t::create_connecter_shm (io_thread_t *io_thread_,
+                                                       bool wait_)
+{
+    return new (std::nothrow)
+      shm_connecter_t (io_thread_, this, options, _addr, wait_);
+}
+#endif
+
 zmq::own_t *zmq::session_base_t::create_connecter_tcp (io_thread_t *io_thread_,
                                                        bool wait_)
 {
@@ -62,6 +62,7 @@ class session_base_t : public own_t, public io_object_t, public i_pipe_events
     virtual void reset ();
     void flush ();
     void rollback ();
+    void release_pipe_memory ();
     void engine_error (zmq::i_engine::error_reason_t reason_);
 
     //  i_pipe_events interface implementation.
@@ -95,6 +96,14 @@ class session_base_t : public own_t, public io_object_t, public i_pipe_events
     socket_base_t *get_socket () const;
     const endpoint_uri_pair_t &get_endpoint () const;
 
+    //  Returns the number of messages the session passed since the
+    //  previous call, for the I/O thread to weigh its share of the load.
+    uint64_t take_activity ();
+
+    //  Moves the session and its engine to io_thread_. A session moves
+    //  once at most. Returns false if it cannot move in its current state.
+    bool migrate (zmq::io_thread_t *io_thread_);
+
   protected:
     session_base_t (zmq::io_thread_t *io_thread_,
                     bool active_,
@@ -118,6 +127,7 @@ class session_base_t : public own_t, public io_object_t, public i_pipe_events
     own_t *create_connecter_vmci (io_thread_t *io_thread_, bool wait_);
     own_t *create_connecter_tipc (io_thread_t *io_thread_, bool wait_);
     own_t *create_connecter_ipc (io_thread_t *io_thread_, bool wait_);
+    own_t *create_connecter_shm (io_thread_t *io_thread_, bool wait_);
     own_t *create_connecter_tcp (io_thread_t *io_thread_, bool wait_);
     own_t *create_connecter_ws (io_thread_t *io_thread_, bool wait_);
     own_t *create_connecter_wss (io_thread_t *io_thread_, bool wait_);
@@ -141,6 +151,7 @@ class session_base_t : public own_t, public io_object_t, public i_pipe_events
     void process_plug () ZMQ_FINAL;
     void process_attach (zmq::i_engine *engine_) ZMQ_FINAL;
     void process_term (int linger_) ZMQ_FINAL;
+    void process_migrate () ZMQ_FINAL;
 
     //  i_poll_events handlers.
     void timer_event (int id_) ZMQ_FINAL;
@@ -189,6 +200,15 @@ class session_base_t : public own_t, public io_object_t, public i_pipe_events
     //  True is linger timer is running.
     bool _has_linger_timer;
 
+    //  Messages passed since the last call to take_activity.
+    uint64_t _activity;
+
+    //  True if the session registered with its I/O thread for rebalancing.
+    bool _registered;
+
+    //  True once the session moved to another I/O thread.
+    bool _migrated;
+
     //  Protocol and address to use when connecting.
     address_t *_addr;
 
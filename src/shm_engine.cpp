@@ -0,0 +1,897 @@
+/*
+    Copyright (c) 2007-2016 Contributors as noted in the AUTHORS file
+
+    This file is part of libzmq, the ZeroMQ core engine in C++.
+
+    libzmq is free software; you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    As a special exception, the Contributors give you permission to link
+    this library with independent modules to produce an executable,
+    regardless of the license terms of these independent modules, and to
+    copy and distribute the resulting executable under terms of your choice,
+    provided that you also meet, for each linked independent module, the
+    terms and conditions of the license of that module. An independent
+    module is a module which is not derived from or based on this library.
+    If you modify this library, you must extend this exception to your
+    version of the library.
+
+    libzmq is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "precompiled.hpp"
+#include "shm_engine.hpp"
+
+#if defined ZMQ_HAVE_SHM
+
+#include <new>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+
+#include "config.hpp"
+#include "err.hpp"
+#include "ip.hpp"
+#include "likely.hpp"
+#include "mechanism.hpp"
+#include "session_base.hpp"
+#include "socket_base.hpp"
+
+//  Layout of the greeting each side sends over the bootstrap socket.
+static const unsigned char greeting_signature[4] = {'Z', 'S', 'H', 'M'};
+static const unsigned char greeting_version = 1;
+static const size_t greeting_type_offset = 8;
+static const size_t greeting_type_capacity = 16;
+static const size_t greeting_routing_id_offset = 24;
+
+//  The connecting side passes the memfd, the accepting side's eventfd
+//  and its own eventfd, in this order.
+static const size_t greeting_fd_count = 3;
+
+//  Every frame in a ring starts with an 8-byte header holding the size
+//  of the body and the message flags; bodies are padded to 8 bytes so
+//  that headers are never split by the end of the data area.
+static const uint64_t frame_alignment = 8;
+static const unsigned char frame_flags_mask =
+  zmq::msg_t::more | zmq::msg_t::command | CMD_TYPE_MASK;
+
+//  Offset of the data areas in the mapping.
+static const size_t shm_data_offset = 4096;
+
+static uint64_t align_frame (uint64_t size_)
+{
+    return (size_ + frame_alignment - 1) & ~(frame_alignment - 1);
+}
+
+static uint64_t load_acquire (const uint64_t *ptr_)
+{
+    return __atomic_load_n (ptr_, __ATOMIC_ACQUIRE);
+}
+
+static void store_release (uint64_t *ptr_, uint64_t value_)
+{
+    __atomic_store_n (ptr_, value_, __ATOMIC_RELEASE);
+}
+
+//  Sets the waiting flag and re-reads the position the other side
+//  advances; seen together with wake_peer this cannot lose a wakeup.
+static uint64_t wait_on (uint32_t *flag_, const uint64_t *position_)
+{
+    __atomic_store_n (flag_, 1, __ATOMIC_SEQ_CST);
+    __atomic_thread_fence (__ATOMIC_SEQ_CST);
+    return __atomic_load_n (position_, __ATOMIC_SEQ_CST);
+}
+
+zmq::shm_engine_t::shm_engine_t (
+  fd_t fd_,
+  const options_t &options_,
+  const endpoint_uri_pair_t &endpoint_uri_pair_,
+  bool connect_) :
+    _options (options_),
+    _endpoint_uri_pair (endpoint_uri_pair_),
+    _connect (connect_),
+    _s (fd_),
+    _handle (static_cast<handle_t> (NULL)),
+    _wake_fd (retired_fd),
+    _peer_wake_fd (retired_fd),
+    _wake_handle (static_cast<handle_t> (NULL)),
+    _memfd (retired_fd),
+    _map (NULL),
+    _map_size (0),
+    _in (NULL),
+    _out (NULL),
+    _in_data (NULL),
+    _out_data (NULL),
+    _ring_mask (0),
+    _greeting_bytes_sent (0),
+    _greeting_bytes_received (0),
+    _peer_routing_id_size (0),
+    _tx_active (false),
+    _tx_pos (0),
+    _rx_active (false),
+    _rx_pending (false),
+    _rx_pos (0),
+    _plugged (false),
+    _handshaking (true),
+    _has_handshake_timer (false),
+    _input_stopped (false),
+    _io_error (false),
+    _session (NULL),
+    _socket (NULL)
+{
+    int rc = _tx_msg.init ();
+    errno_assert (rc == 0);
+    rc = _rx_msg.init ();
+    errno_assert (rc == 0);
+
+    //  Compose our greeting.
+    memset (_greeting_send, 0, sizeof _greeting_send);
+    memcpy (_greeting_send, greeting_signature, sizeof greeting_signature);
+    _greeting_send[4] = greeting_version;
+    const char *type = mechanism_t::socket_type_string (_options.type);
+    const size_t type_len = strlen (type);
+    zmq_assert (type_len <= greeting_type_capacity);
+    _greeting_send[5] = static_cast<unsigned char> (type_len);
+    memcpy (_greeting_send + greeting_type_offset, type, type_len);
+    _greeting_send[6] = _options.routing_id_size;
+    memcpy (_greeting_send + greeting_routing_id_offset, _options.routing_id,
+            _options.routing_id_size);
+
+    unblock_socket (_s);
+}
+
+zmq::shm_engine_t::~shm_engine_t ()
+{
+    zmq_assert (!_plugged);
+
+    const fd_t fds[] = {_s, _wake_fd, _peer_wake_fd, _memfd};
+    for (size_t i = 0; i != sizeof fds / sizeof fds[0]; i++)
+        if (fds[i] != retired_fd) {
+            const int rc = close (fds[i]);
+            errno_assert (rc == 0);
+        }
+
+    if (_map) {
+        const int rc = munmap (_map, _map_size);
+        errno_assert (rc == 0);
+    }
+
+    int rc = _tx_msg.close ();
+    errno_assert (rc == 0);
+    rc = _rx_msg.close ();
+    errno_assert (rc == 0);
+}
+
+void zmq::shm_engine_t::plug (io_thread_t *io_thread_,
+                              session_base_t *session_)
+{
+    zmq_assert (!_plugged);
+    _plugged = true;
+
+    zmq_assert (!_session);
+    zmq_assert (session_);
+    _session = session_;
+    _socket = _session->get_socket ();
+
+    io_object_t::plug (io_thread_);
+    _handle = add_fd (_s);
+    set_pollin (_handle);
+
+    if (_options.handshake_ivl > 0) {
+        add_timer (_options.handshake_ivl, handshake_timer_id);
+        _has_handshake_timer = true;
+    }
+
+    if (_connect && create_shared_state () == -1) {
+        error (connection_error);
+        return;
+    }
+
+    if (send_greeting () == -1) {
+        if (errno != EAGAIN) {
+            error (connection_error);
+            return;
+        }
+        set_pollout (_handle);
+    }
+}
+
+void zmq::shm_engine_t::unplug ()
+{
+    zmq_assert (_plugged);
+    _plugged = false;
+
+    if (_has_handshake_timer) {
+        cancel_timer (handshake_timer_id);
+        _has_handshake_timer = false;
+    }
+
+    rm_fd (_handle);
+    if (_wake_handle)
+        rm_fd (_wake_handle);
+
+    io_object_t::unplug ();
+
+    _session = NULL;
+}
+
+void zmq::shm_engine_t::terminate ()
+{
+    unplug ();
+    delete this;
+}
+
+int zmq::shm_engine_t::create_shared_state ()
+{
+    const uint64_t ring_size = shm_ring_size;
+    zmq_assert ((ring_size & (ring_size - 1)) == 0);
+    zmq_assert (2 * sizeof (ring_t) <= shm_data_offset);
+
+    _map_size = shm_data_offset + 2 * ring_size;
+    _memfd = memfd_create ("zmq-shm", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    if (_memfd == -1) {
+        _memfd = retired_fd;
+        return -1;
+    }
+    if (ftruncate (_memfd, _map_size) == -1)
+        return -1;
+
+    //  Fix the size so neither side can truncate the file under the
+    //  other's mapping and fault it with SIGBUS.
+    if (fcntl (_memfd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL)
+        == -1)
+        return -1;
+
+    void *map =
+      mmap (NULL, _map_size, PROT_READ | PROT_WRITE, MAP_SHARED, _memfd, 0);
+    if (map == MAP_FAILED)
+        return -1;
+    _map = map;
+
+    //  The file is zero filled, so positions and flags start at zero.
+    ring_t *const rings = static_cast<ring_t *> (_map);
+    rings[0].size = ring_size;
+    rings[1].size = ring_size;
+
+    //  Ring 0 carries data from the connecting to the accepting side.
+    unsigned char *const data =
+      static_cast<unsigned char *> (_map) + shm_data_offset;
+    _out = &rings[0];
+    _out_data = data;
+    _in = &rings[1];
+    _in_data = data + ring_size;
+    _ring_mask = ring_size - 1;
+
+    _wake_fd = eventfd (0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (_wake_fd == -1) {
+        _wake_fd = retired_fd;
+        return -1;
+    }
+    _peer_wake_fd = eventfd (0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (_peer_wake_fd == -1) {
+        _peer_wake_fd = retired_fd;
+        return -1;
+    }
+    return 0;
+}
+
+int zmq::shm_engine_t::map_shared_state (fd_t memfd_)
+{
+    //  Without the size seals the peer could shrink the file while it
+    //  is mapped here.
+    const int required_seals = F_SEAL_SHRINK | F_SEAL_GROW;
+    const int seals = fcntl (memfd_, F_GET_SEALS);
+    struct stat st;
+    if (seals == -1 || (seals & required_seals) != required_seals
+        || fstat (memfd_, &st) == -1
+        || st.st_size < static_cast<off_t> (shm_data_offset)) {
+        errno = EPROTO;
+        return -1;
+    }
+    _map_size = static_cast<size_t> (st.st_size);
+
+    void *map =
+      mmap (NULL, _map_size, PROT_READ | PROT_WRITE, MAP_SHARED, memfd_, 0);
+    if (map == MAP_FAILED)
+        return -1;
+    _map = map;
+
+    //  Do not trust the peer with the sizes; everything we access
+    //  later on must lie within the mapping.
+    ring_t *const rings = static_cast<ring_t *> (_map);
+    const uint64_t ring_size = rings[0].size;
+    if (ring_size == 0 || (ring_size & (ring_size - 1)) != 0
+        || ring_size % frame_alignment != 0 || rings[1].size != ring_size
+        || ring_size > (_map_size - shm_data_offset) / 2) {
+        errno = EPROTO;
+        return -1;
+    }
+
+    unsigned char *const data =
+      static_cast<unsigned char *> (_map) + shm_data_offset;
+    _in = &rings[0];
+    _in_data = data;
+    _out = &rings[1];
+    _out_data = data + ring_size;
+    _ring_mask = ring_size - 1;
+    return 0;
+}
+
+int zmq::shm_engine_t::send_greeting ()
+{
+    while (_greeting_bytes_sent < greeting_size) {
+        struct iovec iov;
+        iov.iov_base = _greeting_send + _greeting_bytes_sent;
+        iov.iov_len = greeting_size - _greeting_bytes_sent;
+
+        struct msghdr hdr;
+        memset (&hdr, 0, sizeof hdr);
+        hdr.msg_iov = &iov;
+        hdr.msg_iovlen = 1;
+
+        //  The descriptors travel with the first chunk of the greeting.
+        union
+        {
+            struct cmsghdr align;
+            char buf[CMSG_SPACE (greeting_fd_count * sizeof (int))];
+        } control;
+        if (_connect && _greeting_bytes_sent == 0) {
+            memset (&control, 0, sizeof control);
+            hdr.msg_control = control.buf;
+            hdr.msg_controllen = sizeof control.buf;
+            struct cmsghdr *cmsg = CMSG_FIRSTHDR (&hdr);
+            cmsg->cmsg_level = SOL_SOCKET;
+            cmsg->cmsg_type = SCM_RIGHTS;
+            cmsg->cmsg_len = CMSG_LEN (greeting_fd_count * sizeof (int));
+            const int fds[greeting_fd_count] = {_memfd, _peer_wake_fd,
+                                                _wake_fd};
+            memcpy (CMSG_DATA (cmsg), fds, sizeof fds);
+        }
+
+        const ssize_t rc = sendmsg (_s, &hdr, MSG_NOSIGNAL);
+        if (rc == -1) {
+            if (errno == EWOULDBLOCK || errno == EINTR)
+                errno = EAGAIN;
+            return -1;
+        }
+        _greeting_bytes_sent += static_cast<size_t> (rc);
+    }
+
+    //  The peer holds its own reference to the shared memory now.
+    if (_memfd != retired_fd) {
+        const int rc = close (_memfd);
+        errno_assert (rc == 0);
+        _memfd = retired_fd;
+    }
+    return 0;
+}
+
+int zmq::shm_engine_t::receive_greeting ()
+{
+    while (_greeting_bytes_received < greeting_size) {
+        struct iovec iov;
+        iov.iov_base = _greeting_recv + _greeting_bytes_received;
+        iov.iov_len = greeting_size - _greeting_bytes_received;
+
+        union
+        {
+            struct cmsghdr align;
+            char buf[CMSG_SPACE (greeting_fd_count * sizeof (int))];
+        } control;
+        struct msghdr hdr;
+        memset (&hdr, 0, sizeof hdr);
+        hdr.msg_iov = &iov;
+        hdr.msg_iovlen = 1;
+        hdr.msg_control = control.buf;
+        hdr.msg_controllen = sizeof control.buf;
+
+        const ssize_t rc = recvmsg (_s, &hdr, MSG_CMSG_CLOEXEC);
+        if (rc == -1) {
+            if (errno == EWOULDBLOCK || errno == EINTR)
+                errno = EAGAIN;
+            return -1;
+        }
+        if (rc == 0) {
+            errno = EPIPE;
+            return -1;
+        }
+
+        //  Take the descriptors if they are the ones we are waiting for
+        //  and close anything else the peer may have sent.
+        bool unexpected = (hdr.msg_flags & MSG_CTRUNC) != 0;
+        for (struct cmsghdr *cmsg = CMSG_FIRSTHDR (&hdr); cmsg;
+             cmsg = CMSG_NXTHDR (&hdr, cmsg)) {
+            if (cmsg->cmsg_level != SOL_SOCKET
+                || cmsg->cmsg_type != SCM_RIGHTS)
+                continue;
+            const size_t count =
+              (cmsg->cmsg_len - CMSG_LEN (0)) / sizeof (int);
+            const bool wanted = !_connect && _memfd == retired_fd
+                                && count == greeting_fd_count;
+            int fds[greeting_fd_count];
+            for (size_t i = 0; i != count; i++) {
+                int fd;
+                memcpy (&fd, CMSG_DATA (cmsg) + i * sizeof (int), sizeof fd);
+                if (wanted)
+                    fds[i] = fd;
+                else
+                    close (fd);
+            }
+            if (wanted) {
+                _memfd = fds[0];
+                _wake_fd = fds[1];
+                _peer_wake_fd = fds[2];
+            } else
+                unexpected = true;
+        }
+        if (unexpected) {
+            errno = EPROTO;
+            return -1;
+        }
+        _greeting_bytes_received += static_cast<size_t> (rc);
+    }
+    return 0;
+}
+
+void zmq::shm_engine_t::handshake_in ()
+{
+    if (receive_greeting () == -1) {
+        if (errno == EAGAIN)
+            return;
+        if (errno == EPROTO) {
+            _socket->event_handshake_failed_protocol (
+              _endpoint_uri_pair,
+              ZMQ_PROTOCOL_ERROR_ZMTP_MALFORMED_COMMAND_UNSPECIFIED);
+            error (protocol_error);
+        } else
+            error (connection_error);
+        return;
+    }
+
+    const size_t type_len = _greeting_recv[5];
+    if (memcmp (_greeting_recv, greeting_signature, sizeof greeting_signature)
+          != 0
+        || _greeting_recv[4] != greeting_version
+        || type_len > greeting_type_capacity
+        || (!_connect && _memfd == retired_fd)) {
+        _socket->event_handshake_failed_protocol (
+          _endpoint_uri_pair,
+          ZMQ_PROTOCOL_ERROR_ZMTP_MALFORMED_COMMAND_UNSPECIFIED);
+        error (protocol_error);
+        return;
+    }
+    if (!mechanism_t::check_socket_type (
+          _options.type,
+          reinterpret_cast<const char *> (_greeting_recv
+                                          + greeting_type_offset),
+          type_len)) {
+        _socket->event_handshake_failed_protocol (
+          _endpoint_uri_pair, ZMQ_PROTOCOL_ERROR_ZMTP_INVALID_METADATA);
+        error (protocol_error);
+        return;
+    }
+    _peer_routing_id_size = _greeting_recv[6];
+    memcpy (_peer_routing_id, _greeting_recv + greeting_routing_id_offset,
+            _peer_routing_id_size);
+
+    if (!_connect) {
+        const int rc = map_shared_state (_memfd);
+        const int err = errno;
+        close (_memfd);
+        _memfd = retired_fd;
+        if (rc == -1) {
+            errno = err;
+            if (errno == EPROTO) {
+                _socket->event_handshake_failed_protocol (
+                  _endpoint_uri_pair,
+                  ZMQ_PROTOCOL_ERROR_ZMTP_MALFORMED_COMMAND_UNSPECIFIED);
+                error (protocol_error);
+            } else
+                error (connection_error);
+            return;
+        }
+    }
+
+    if (_greeting_bytes_sent == greeting_size)
+        handshake_completed ();
+    else
+        //  Nothing more to read until our own greeting is out.
+        reset_pollin (_handle);
+}
+
+void zmq::shm_engine_t::handshake_completed ()
+{
+    _handshaking = false;
+    if (_has_handshake_timer) {
+        cancel_timer (handshake_timer_id);
+        _has_handshake_timer = false;
+    }
+
+    //  From now on the bootstrap socket is only watched for the peer
+    //  going away; data is signalled through our eventfd.
+    _wake_handle = add_fd (_wake_fd);
+    set_pollin (_wake_handle);
+
+    if (_options.recv_routing_id) {
+        msg_t routing_id;
+        int rc = routing_id.init_size (_peer_routing_id_size);
+        errno_assert (rc == 0);
+        if (_peer_routing_id_size)
+            memcpy (routing_id.data (), _peer_routing_id,
+                    _peer_routing_id_size);
+        routing_id.set_flags (msg_t::routing_id);
+        rc = _session->push_msg (&routing_id);
+        //  If the write is failing at this stage with an EAGAIN the
+        //  pipe must be being shut down, just like in the ZMTP engine.
+        errno_assert (rc == 0 || errno == EAGAIN);
+    }
+
+    if (_options.router_notify & ZMQ_NOTIFY_CONNECT) {
+        msg_t connect_notification;
+        connect_notification.init ();
+        const int rc = _session->push_msg (&connect_notification);
+        errno_assert (rc == 0 || errno == EAGAIN);
+    }
+    _session->flush ();
+
+    _socket->event_handshake_succeeded (_endpoint_uri_pair, 0);
+
+    //  The peer may have written data before we were ready to look.
+    if (consume () == -1) {
+        error (protocol_error);
+        return;
+    }
+    produce ();
+}
+
+void zmq::shm_engine_t::in_event ()
+{
+    if (unlikely (_handshaking)) {
+        handshake_in ();
+        return;
+    }
+
+    //  The poller does not tell which descriptor fired. If our eventfd
+    //  was not signalled, it must have been the bootstrap socket.
+    if (!drain_wake_fd () && !_io_error) {
+        unsigned char byte;
+        const ssize_t rc = recv (_s, &byte, sizeof byte, MSG_DONTWAIT);
+        if (rc == 0 || (rc == -1 && errno != EAGAIN && errno != EWOULDBLOCK
+                        && errno != EINTR)) {
+            //  Whatever the peer wrote before closing is already in the
+            //  ring; hand it over before reporting the disconnection.
+            _io_error = true;
+            reset_pollin (_handle);
+        } else if (rc == 1) {
+            _socket->event_handshake_failed_protocol (
+              _endpoint_uri_pair,
+              ZMQ_PROTOCOL_ERROR_ZMTP_UNEXPECTED_COMMAND);
+            error (protocol_error);
+            return;
+        }
+    }
+
+    if (!_input_stopped && consume () == -1) {
+        error (protocol_error);
+        return;
+    }
+    if (_io_error && !_input_stopped) {
+        error (connection_error);
+        return;
+    }
+
+    //  The peer may have woken us because it made space in our
+    //  outbound ring.
+    produce ();
+}
+
+void zmq::shm_engine_t::out_event ()
+{
+    zmq_assert (_handshaking);
+
+    if (send_greeting () == -1) {
+        if (errno != EAGAIN)
+            error (connection_error);
+        return;
+    }
+    reset_pollout (_handle);
+
+    if (_greeting_bytes_received == greeting_size) {
+        set_pollin (_handle);
+        handshake_completed ();
+    }
+}
+
+void zmq::shm_engine_t::timer_event (int id_)
+{
+    zmq_assert (id_ == handshake_timer_id);
+    _has_handshake_timer = false;
+    error (timeout_error);
+}
+
+bool zmq::shm_engine_t::drain_wake_fd ()
+{
+    uint64_t count;
+    const ssize_t rc = read (_wake_fd, &count, sizeof count);
+    if (rc == -1) {
+        errno_assert (errno == EAGAIN || errno == EWOULDBLOCK
+                      || errno == EINTR);
+        return false;
+    }
+    zmq_assert (rc == sizeof count);
+    return true;
+}
+
+void zmq::shm_engine_t::wake_peer (uint32_t *flag_)
+{
+    __atomic_thread_fence (__ATOMIC_SEQ_CST);
+    if (__atomic_load_n (flag_, __ATOMIC_SEQ_CST)
+        && __atomic_exchange_n (flag_, 0, __ATOMIC_SEQ_CST)) {
+        const uint64_t inc = 1;
+        const ssize_t rc = write (_peer_wake_fd, &inc, sizeof inc);
+        //  EAGAIN means the counter is saturated, i.e. already signalled.
+        errno_assert (rc == sizeof inc || errno == EAGAIN);
+    }
+}
+
+bool zmq::shm_engine_t::restart_input ()
+{
+    zmq_assert (_input_stopped);
+    _input_stopped = false;
+
+    if (consume () == -1) {
+        error (protocol_error);
+        return false;
+    }
+    if (_io_error && !_input_stopped) {
+        error (connection_error);
+        return false;
+    }
+    return true;
+}
+
+void zmq::shm_engine_t::restart_output ()
+{
+    if (unlikely (_handshaking))
+        return;
+    produce ();
+}
+
+void zmq::shm_engine_t::zap_msg_available ()
+{
+    //  The shm transport does not run a security mechanism.
+    zmq_assert (false);
+}
+
+const zmq::endpoint_uri_pair_t &zmq::shm_engine_t::get_endpoint () const
+{
+    return _endpoint_uri_pair;
+}
+
+void zmq::shm_engine_t::produce ()
+{
+    const uint64_t size = _ring_mask + 1;
+    //  Position up to which the reader has been told about data.
+    uint64_t notified = _out->tail;
+    uint64_t tail = notified;
+    uint64_t head = load_acquire (&_out->head);
+
+    while (true) {
+        if (!_tx_active) {
+            //  Wait for room for the header. As positions and the ring
+            //  size are multiples of 8, any free space will do.
+            if (tail - head == size) {
+                head = load_acquire (&_out->head);
+                if (tail - head == size) {
+                    if (tail != notified) {
+                        store_release (&_out->tail, tail);
+                        wake_peer (&_out->reader_waiting);
+                        notified = tail;
+                    }
+                    head = wait_on (&_out->writer_waiting, &_out->head);
+                    if (tail - head == size)
+                        return;
+                }
+            }
+            if (_session->pull_msg (&_tx_msg) == -1)
+                break;
+            _tx_active = true;
+            _tx_pos = 0;
+
+            const uint64_t header =
+              (static_cast<uint64_t> (_tx_msg.size ()) << 8)
+              | (_tx_msg.flags () & frame_flags_mask);
+            memcpy (_out_data + (tail & _ring_mask), &header, sizeof header);
+            tail += sizeof header;
+        }
+
+        //  Copy as much of the body as fits, in at most two chunks.
+        const size_t msg_size = _tx_msg.size ();
+        const unsigned char *const body =
+          static_cast<const unsigned char *> (_tx_msg.data ());
+        while (_tx_pos < msg_size) {
+            uint64_t space = size - (tail - head);
+            if (space == 0) {
+                head = load_acquire (&_out->head);
+                space = size - (tail - head);
+            }
+            if (space == 0) {
+                //  Make what we have visible, then sleep until the
+                //  reader makes room.
+                if (tail != notified) {
+                    store_release (&_out->tail, tail);
+                    wake_peer (&_out->reader_waiting);
+                    notified = tail;
+                }
+                head = wait_on (&_out->writer_waiting, &_out->head);
+                space = size - (tail - head);
+                if (space == 0)
+                    return;
+            }
+            const uint64_t offset = tail & _ring_mask;
+            const uint64_t contiguous = size - offset;
+            uint64_t chunk = align_frame (msg_size - _tx_pos);
+            if (chunk > space)
+                chunk = space;
+            if (chunk > contiguous)
+                chunk = contiguous;
+            const size_t bytes = chunk < msg_size - _tx_pos
+                                   ? static_cast<size_t> (chunk)
+                                   : msg_size - _tx_pos;
+            memcpy (_out_data + offset, body + _tx_pos, bytes);
+            _tx_pos += bytes;
+            tail += chunk;
+        }
+
+        //  The message is in the ring.
+        store_release (&_out->tail, tail);
+        _tx_active = false;
+        const int rc = _tx_msg.close ();
+        errno_assert (rc == 0);
+        _tx_msg.init ();
+    }
+
+    if (tail != notified) {
+        store_release (&_out->tail, tail);
+        wake_peer (&_out->reader_waiting);
+    }
+}
+
+int zmq::shm_engine_t::consume ()
+{
+    const uint64_t size = _ring_mask + 1;
+    //  Position up to which the writer has been told about free space.
+    uint64_t notified = _in->head;
+    uint64_t head = notified;
+    uint64_t tail = load_acquire (&_in->tail);
+    int result = 0;
+
+    while (true) {
+        if (_rx_pending) {
+            if (_session->push_msg (&_rx_msg) == -1) {
+                errno_assert (errno == EAGAIN);
+                _input_stopped = true;
+                break;
+            }
+            _rx_pending = false;
+        }
+
+        uint64_t available = tail - head;
+        if (available == 0) {
+            tail = load_acquire (&_in->tail);
+            available = tail - head;
+        }
+        if (available == 0) {
+            //  Let the writer continue, then sleep until it writes more.
+            if (head != notified) {
+                store_release (&_in->head, head);
+                wake_peer (&_in->writer_waiting);
+                notified = head;
+            }
+            tail = wait_on (&_in->reader_waiting, &_in->tail);
+            available = tail - head;
+            if (available == 0)
+                break;
+        }
+        if (unlikely (available > size || available % frame_alignment)) {
+            errno = EPROTO;
+            result = -1;
+            break;
+        }
+
+        if (!_rx_active) {
+            uint64_t header;
+            memcpy (&header, _in_data + (head & _ring_mask), sizeof header);
+            head += sizeof header;
+            const uint64_t msg_size = header >> 8;
+            if (unlikely (
+                  (header & 0xff & ~static_cast<uint64_t> (frame_flags_mask))
+                  || (_options.maxmsgsize >= 0
+                      && msg_size
+                           > static_cast<uint64_t> (_options.maxmsgsize))
+                  || _rx_msg.init_size (static_cast<size_t> (msg_size))
+                       == -1)) {
+                errno = EPROTO;
+                result = -1;
+                break;
+            }
+            _rx_msg.set_flags (static_cast<unsigned char> (header & 0xff));
+            _rx_active = true;
+            _rx_pos = 0;
+            available -= sizeof header;
+        }
+
+        const size_t msg_size = _rx_msg.size ();
+        unsigned char *const body =
+          static_cast<unsigned char *> (_rx_msg.data ());
+        while (_rx_pos < msg_size && available > 0) {
+            const uint64_t offset = head & _ring_mask;
+            const uint64_t contiguous = size - offset;
+            uint64_t chunk = align_frame (msg_size - _rx_pos);
+            if (chunk > available)
+                chunk = available;
+            if (chunk > contiguous)
+                chunk = contiguous;
+            const size_t bytes = chunk < msg_size - _rx_pos
+                                   ? static_cast<size_t> (chunk)
+                                   : msg_size - _rx_pos;
+            memcpy (body + _rx_pos, _in_data + offset, bytes);
+            _rx_pos += bytes;
+            head += chunk;
+            available -= chunk;
+        }
+        if (_rx_pos == msg_size) {
+            _rx_active = false;
+            _rx_pending = true;
+        }
+    }
+
+    if (head != notified) {
+        store_release (&_in->head, head);
+        wake_peer (&_in->writer_waiting);
+    }
+    _session->flush ();
+    return result;
+}
+
+void zmq::shm_engine_t::error (error_reason_t reason_)
+{
+    zmq_assert (_session);
+
+    if ((_options.router_notify & ZMQ_NOTIFY_DISCONNECT) && !_handshaking) {
+        //  For router sockets with disconnect notification, rollback
+        //  any incomplete message in the pipe, and push the disconnect
+        //  notification message.
+        _session->rollback ();
+
+        msg_t disconnect_notification;
+        disconnect_notification.init ();
+        _session->push_msg (&disconnect_notification);
+    }
+
+    if (reason_ != protocol_error && _handshaking) {
+        const int err = errno;
+        _socket->event_handshake_failed_no_detail (_endpoint_uri_pair, err);
+    }
+
+    _socket->event_disconnected (_endpoint_uri_pair, _s);
+    _session->flush ();
+    _session->engine_error (reason_);
+    unplug ();
+    delete this;
+}
+
+#endif
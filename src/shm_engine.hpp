@@ -0,0 +1,201 @@
+/*
+    Copyright (c) 2007-2016 Contributors as noted in the AUTHORS file
+
+    This file is part of libzmq, the ZeroMQ core engine in C++.
+
+    libzmq is free software; you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    As a special exception, the Contributors give you permission to link
+    this library with independent modules to produce an executable,
+    regardless of the license terms of these independent modules, and to
+    copy and distribute the resulting executable under terms of your choice,
+    provided that you also meet, for each linked independent module, the
+    terms and conditions of the license of that module. An independent
+    module is a module which is not derived from or based on this library.
+    If you modify this library, you must extend this exception to your
+    version of the library.
+
+    libzmq is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __ZMQ_SHM_ENGINE_HPP_INCLUDED__
+#define __ZMQ_SHM_ENGINE_HPP_INCLUDED__
+
+#if defined ZMQ_HAVE_SHM
+
+#include <stddef.h>
+
+#include "fd.hpp"
+#include "i_engine.hpp"
+#include "io_object.hpp"
+#include "options.hpp"
+#include "msg.hpp"
+#include "stdint.hpp"
+
+namespace zmq
+{
+class io_thread_t;
+class session_base_t;
+class socket_base_t;
+
+//  Engine for the shm:// transport. The peers meet over a UNIX domain
+//  socket. The connecting side creates a memfd holding one single
+//  producer, single consumer byte ring per direction plus an eventfd
+//  per peer, and hands them over with SCM_RIGHTS. From then on messages
+//  are copied straight into the rings; the eventfds are only written
+//  when the other side went idle waiting for data or for space. The
+//  socket is kept open so that the death of the peer is noticed.
+
+class shm_engine_t ZMQ_FINAL : public io_object_t, public i_engine
+{
+  public:
+    shm_engine_t (fd_t fd_,
+                  const options_t &options_,
+                  const endpoint_uri_pair_t &endpoint_uri_pair_,
+                  bool connect_);
+    ~shm_engine_t () ZMQ_FINAL;
+
+    //  i_engine interface implementation.
+    void plug (zmq::io_thread_t *io_thread_,
+               zmq::session_base_t *session_) ZMQ_FINAL;
+    void terminate () ZMQ_FINAL;
+    bool restart_input () ZMQ_FINAL;
+    void restart_output () ZMQ_FINAL;
+    void zap_msg_available () ZMQ_FINAL;
+    const endpoint_uri_pair_t &get_endpoint () const ZMQ_FINAL;
+    bool migrate_out () ZMQ_FINAL { return false; }
+    void migrate_in (zmq::io_thread_t *) ZMQ_FINAL {}
+
+    //  i_poll_events interface implementation.
+    void in_event () ZMQ_FINAL;
+    void out_event () ZMQ_FINAL;
+    void timer_event (int id_) ZMQ_FINAL;
+
+  private:
+    //  Control block of one ring, shared between the processes. The
+    //  consumer and producer halves live on separate cache lines.
+    struct ring_t
+    {
+        //  Bytes consumed so far and whether the consumer sleeps.
+        uint64_t head;
+        uint32_t reader_waiting;
+        unsigned char pad1[64 - 12];
+
+        //  Bytes produced so far and whether the producer sleeps.
+        uint64_t tail;
+        uint32_t writer_waiting;
+        unsigned char pad2[64 - 12];
+
+        //  Size of the data area, a power of two. Set by the creator.
+        uint64_t size;
+        unsigned char pad3[64 - 8];
+    };
+
+    //  Create the shared memory and the eventfds (connecting side).
+    int create_shared_state ();
+
+    //  Map the shared memory received from the peer (accepting side).
+    int map_shared_state (fd_t memfd_);
+
+    int send_greeting ();
+    int receive_greeting ();
+    void handshake_in ();
+    void handshake_completed ();
+
+    //  Copy messages from the session into the outbound ring.
+    void produce ();
+
+    //  Copy messages from the inbound ring to the session. Returns -1
+    //  if the peer wrote garbage into the ring.
+    int consume ();
+
+    //  Wakes the peer if it has set the given waiting flag.
+    void wake_peer (uint32_t *flag_);
+
+    //  Drains our own eventfd. Returns false if it was not signalled.
+    bool drain_wake_fd ();
+
+    void error (error_reason_t reason_);
+    void unplug ();
+
+    enum
+    {
+        handshake_timer_id = 0x40
+    };
+
+    const options_t _options;
+    const endpoint_uri_pair_t _endpoint_uri_pair;
+
+    //  True on the side that initiated the connection.
+    const bool _connect;
+
+    //  The bootstrap socket.
+    fd_t _s;
+    handle_t _handle;
+
+    //  Our eventfd and the one the peer waits on.
+    fd_t _wake_fd;
+    fd_t _peer_wake_fd;
+    handle_t _wake_handle;
+
+    //  Shared memory descriptor, only held until it has been passed on.
+    fd_t _memfd;
+
+    //  The mapping and the rings in it.
+    void *_map;
+    size_t _map_size;
+    ring_t *_in;
+    ring_t *_out;
+    unsigned char *_in_data;
+    unsigned char *_out_data;
+    uint64_t _ring_mask;
+
+    //  Greetings exchanged over the bootstrap socket.
+    enum
+    {
+        greeting_size = 280
+    };
+    unsigned char _greeting_send[greeting_size];
+    unsigned char _greeting_recv[greeting_size];
+    size_t _greeting_bytes_sent;
+    size_t _greeting_bytes_received;
+    unsigned char _peer_routing_id[256];
+    size_t _peer_routing_id_size;
+
+    //  Message being written into the outbound ring.
+    msg_t _tx_msg;
+    bool _tx_active;
+    size_t _tx_pos;
+
+    //  Message being read from the inbound ring.
+    msg_t _rx_msg;
+    bool _rx_active;
+    bool _rx_pending;
+    size_t _rx_pos;
+
+    bool _plugged;
+    bool _handshaking;
+    bool _has_handshake_timer;
+    bool _input_stopped;
+    bool _io_error;
+
+    //  The session this engine is attached to.
+    zmq::session_base_t *_session;
+    zmq::socket_base_t *_socket;
+
+    ZMQ_NON_COPYABLE_NOR_MOVABLE (shm_engine_t)
+};
+}
+
+#endif
+
+#endif
@@ -0,0 +1,59 @@
+/*
+    Copyright (c) 2007-2016 Contributors as noted in the AUTHORS file
+
+    This file is part of libzmq, the ZeroMQ core engine in C++.
+
+    libzmq is free software; you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    As a special exception, the Contributors give you permission to link
+    this library with independent modules to produce an executable,
+    regardless of the license terms of these independent modules, and to
+    copy and distribute the resulting executable under terms of your choice,
+    provided that you also meet, for each linked independent module, the
+    terms and conditions of the license of that module. An independent
+    module is a module which is not derived from or based on this library.
+    If you modify this library, you must extend this exception to your
+    version of the library.
+
+    libzmq is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __ZMQ_SHM_LISTENER_HPP_INCLUDED__
+#define __ZMQ_SHM_LISTENER_HPP_INCLUDED__
+
+#if defined ZMQ_HAVE_SHM
+
+#include "fd.hpp"
+#include "ipc_listener.hpp"
+
+namespace zmq
+{
+//  Accepts shm:// connections. Peers meet on a UNIX domain socket bound
+//  to the path given in the endpoint, exactly like with ipc://.
+
+class shm_listener_t ZMQ_FINAL : public ipc_listener_t
+{
+  public:
+    shm_listener_t (zmq::io_thread_t *io_thread_,
+                    zmq::socket_base_t *socket_,
+                    const options_t &options_);
+
+  private:
+    void create_engine (fd_t fd_) ZMQ_FINAL;
+
+    ZMQ_NON_COPYABLE_NOR_MOVABLE (shm_listener_t)
+};
+}
+
+#endif
+
+#endif
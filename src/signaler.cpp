@@ -62,6 +62,7 @@
 #include "fd.hpp"
 #include "ip.hpp"
 #include "tcp.hpp"
+#include "clock.hpp"
 
 #if !defined ZMQ_HAVE_WINDOWS
 #include <unistd.h>
@@ -115,7 +116,7 @@ static int close_wait_ms (int fd_, unsigned int max_ms_ = 2000)
 }
 #endif
 
-zmq::signaler_t::signaler_t ()
+zmq::signaler_t::signaler_t () : _spin_limit (0), _spin (0)
 {
     //  Create the socketpair for signaling.
     if (make_fdpair (&_r, &_w) == 0) {
@@ -227,7 +228,13 @@ void zmq::signaler_t::send ()
 #endif
 }
 
-int zmq::signaler_t::wait (int timeout_) const
+void zmq::signaler_t::set_spin (int us_)
+{
+    _spin_limit = us_;
+    _spin = us_;
+}
+
+int zmq::signaler_t::wait (int timeout_)
 {
 #ifdef HAVE_FORK
     if (unlikely (pid != getpid ())) {
@@ -243,7 +250,34 @@ int zmq::signaler_t::wait (int timeout_) const
     struct pollfd pfd;
     pfd.fd = _r;
     pfd.events = POLLIN;
-    const int rc = poll (&pfd, 1, timeout_);
+    int rc = 0;
+    int timeout = timeout_;
+
+    //  Spin on non-blocking polls before blocking. The spin time adapts:
+    //  it is restored when a signal arrives while spinning and halved
+    //  when none does, so a mostly idle mailbox spins only briefly.
+    if (_spin > 0 && timeout_ != 0) {
+        uint64_t spin = static_cast<uint64_t> (_spin);
+        if (timeout_ > 0 && spin > static_cast<uint64_t> (timeout_) * 1000)
+            spin = static_cast<uint64_t> (timeout_) * 1000;
+        const uint64_t start = clock_t::now_us ();
+        uint64_t elapsed = 0;
+        do {
+            rc = poll (&pfd, 1, 0);
+            elapsed = clock_t::now_us () - start;
+        } while (rc == 0 && elapsed < spin);
+        if (rc == 0) {
+            const int min_spin = (_spin_limit + 15) / 16;
+            _spin = _spin / 2 > min_spin ? _spin / 2 : min_spin;
+            if (timeout_ > 0) {
+                const int spent = static_cast<int> (elapsed / 1000);
+                timeout = timeout_ > spent ? timeout_ - spent : 0;
+            }
+        } else if (rc > 0)
+            _spin = _spin_limit;
+    }
+    if (rc == 0)
+        rc = poll (&pfd, 1, timeout);
     if (unlikely (rc < 0)) {
         errno_assert (errno == EINTR);
         return -1;
@@ -54,12 +54,16 @@ class signaler_t
     // May return retired_fd if the signaler could not be initialized.
     fd_t get_fd () const;
     void send ();
-    int wait (int timeout_) const;
+    int wait (int timeout_);
     void recv ();
     int recv_failable ();
 
     bool valid () const;
 
+    //  Makes wait spin for up to us_ microseconds before blocking. The
+    //  actual spin time adapts to how often spinning pays off.
+    void set_spin (int us_);
+
 #ifdef HAVE_FORK
     // close the file descriptors in a forked child process so that they
     // do not interfere with the context in the parent process.
@@ -73,6 +77,10 @@ class signaler_t
     fd_t _w;
     fd_t _r;
 
+    //  Spin time set with set_spin, and the current adapted one.
+    int _spin_limit;
+    int _spin;
+
 #ifdef HAVE_FORK
     // the process that created this context. Used to detect forking.
     pid_t pid;
@@ -52,6 +52,7 @@
 #include "tcp_listener.hpp"
 #include "ws_listener.hpp"
 #include "ipc_listener.hpp"
+#include "shm_listener.hpp"
 #include "tipc_listener.hpp"
 #include "tcp_connecter.hpp"
 #include "ws_address.hpp"
@@ -247,6 +248,14 @@ zmq::socket_base_t::socket_base_t (ctx_t *parent_,
     options.ipv6 = (parent_->get (ZMQ_IPV6) != 0);
     options.linger.store (parent_->get (ZMQ_BLOCKY) ? -1 : 0);
     options.zero_copy = parent_->get (ZMQ_ZERO_COPY_RECV) != 0;
+    options.allocator = parent_->get_allocator ();
+    options.affinity = parent_->get_numa_affinity ();
+    _buffer_memory = new (std::nothrow) memory_counter_t;
+    alloc_assert (_buffer_memory);
+    options.buffer_memory = _buffer_memory;
+    _zerocopy_completed = new (std::nothrow) memory_counter_t;
+    alloc_assert (_zerocopy_completed);
+    options.zerocopy_completed = _zerocopy_completed;
 
     if (_thread_safe) {
         _mailbox = new (std::nothrow) mailbox_safe_t (&_sync);
@@ -254,6 +263,7 @@ zmq::socket_base_t::socket_base_t (ctx_t *parent_,
     } else {
         mailbox_t *m = new (std::nothrow) mailbox_t ();
         zmq_assert (m);
+        m->set_spin (parent_->get (ZMQ_BUSY_POLL));
 
         if (m->get_fd () != retired_fd)
             _mailbox = m;
@@ -283,6 +293,12 @@ zmq::socket_base_t::~socket_base_t ()
     if (_reaper_signaler)
         LIBZMQ_DELETE (_reaper_signaler);
 
+    //  Engines may still be winding down and hold on to the counter.
+    if (_buffer_memory->drop_ref ())
+        LIBZMQ_DELETE (_buffer_memory);
+    if (_zerocopy_completed->drop_ref ())
+        LIBZMQ_DELETE (_zerocopy_completed);
+
     scoped_lock_t lock (_monitor_sync);
     stop_monitor ();
 
@@ -333,6 +349,9 @@ int zmq::socket_base_t::check_protocol (const std::string &protocol_) const
     if (protocol_ != protocol_name::inproc
 #if defined ZMQ_HAVE_IPC
         && protocol_ != protocol_name::ipc
+#endif
+#if defined ZMQ_HAVE_SHM
+        && protocol_ != protocol_name::shm
 #endif
         && protocol_ != protocol_name::tcp
 #ifdef ZMQ_HAVE_WS
@@ -373,6 +392,18 @@ int zmq::socket_base_t::check_protocol (const std::string &protocol_) const
     }
 #endif
 
+#if defined ZMQ_HAVE_SHM
+    //  The shared memory transport carries messages, not byte streams,
+    //  and runs no security handshake, so it must not silently drop a
+    //  mechanism or ZAP domain the application asked for.
+    if (protocol_ == protocol_name::shm
+        && (options.type == ZMQ_STREAM || options.mechanism != ZMQ_NULL
+            || !options.zap_domain.empty ())) {
+        errno = ENOCOMPATPROTO;
+        return -1;
+    }
+#endif
+
     if (protocol_ == protocol_name::udp
         && (options.type != ZMQ_DISH && options.type != ZMQ_RADIO
             && options.type != ZMQ_DGRAM)) {
@@ -475,6 +506,25 @@ int zmq::socket_base_t::getsockopt (int option_,
         return do_getsockopt<int> (optval_, optvallen_, _thread_safe ? 1 : 0);
     }
 
+#ifdef ZMQ_BUILD_DRAFT_API
+    if (option_ == ZMQ_QUEUE_MEMORY) {
+        uint64_t memory = 0;
+        for (pipes_t::size_type i = 0, size = _pipes.size (); i != size; i++)
+            memory += _pipes[i]->memory ();
+        return do_getsockopt<uint64_t> (optval_, optvallen_, memory);
+    }
+
+    if (option_ == ZMQ_BUFFER_MEMORY) {
+        return do_getsockopt<uint64_t> (optval_, optvallen_,
+                                        _buffer_memory->get ());
+    }
+
+    if (option_ == ZMQ_TCP_ZEROCOPY_COMPLETED) {
+        return do_getsockopt<uint64_t> (optval_, optvallen_,
+                                        _zerocopy_completed->get ());
+    }
+#endif
+
     return options.getsockopt (option_, optval_, optvallen_);
 }
 
@@ -589,6 +639,10 @@ int zmq::socket_base_t::bind (const char *endpoint_uri_)
         bool conflates[2] = {false, false};
         rc = pipepair (parents, new_pipes, hwms, conflates);
         errno_assert (rc == 0);
+        new_pipes[0]->set_hwms_bytes (options.rcvhwm_bytes,
+                                      options.sndhwm_bytes);
+        new_pipes[1]->set_hwms_bytes (options.sndhwm_bytes,
+                                      options.rcvhwm_bytes);
 
         //  Attach local end of the pipe to the socket object.
         attach_pipe (new_pipes[0], true, true);
@@ -688,6 +742,28 @@ int zmq::socket_base_t::bind (const char *endpoint_uri_)
         return 0;
     }
 #endif
+#if defined ZMQ_HAVE_SHM
+    if (protocol == protocol_name::shm) {
+        shm_listener_t *listener =
+          new (std::nothrow) shm_listener_t (io_thread, this, options);
+        alloc_assert (listener);
+        int rc = listener->set_local_address (address.c_str ());
+        if (rc != 0) {
+            LIBZMQ_DELETE (listener);
+            event_bind_failed (make_unconnected_bind_endpoint_pair (address),
+                               zmq_errno ());
+            return -1;
+        }
+
+        // Save last endpoint URI
+        listener->get_local_address (_last_endpoint);
+
+        add_endpoint (make_unconnected_bind_endpoint_pair (_last_endpoint),
+                      static_cast<own_t *> (listener), NULL);
+        options.connected = true;
+        return 0;
+    }
+#endif
 #if defined ZMQ_HAVE_TIPC
     if (protocol == protocol_name::tipc) {
         tipc_listener_t *listener =
@@ -794,6 +870,22 @@ int zmq::socket_base_t::connect (const char *endpoint_uri_)
             new_pipes[0]->set_hwms_boost (peer.options.sndhwm,
                                           peer.options.rcvhwm);
             new_pipes[1]->set_hwms_boost (options.sndhwm, options.rcvhwm);
+
+            //  Like message HWMs, byte HWMs add up over inproc.
+            int64_t sndhwm_bytes = options.sndhwm_bytes;
+            int64_t rcvhwm_bytes = options.rcvhwm_bytes;
+            if (peer.socket != NULL) {
+                sndhwm_bytes =
+                  sndhwm_bytes != 0 && peer.options.rcvhwm_bytes != 0
+                    ? sndhwm_bytes + peer.options.rcvhwm_bytes
+                    : 0;
+                rcvhwm_bytes =
+                  rcvhwm_bytes != 0 && peer.options.sndhwm_bytes != 0
+                    ? rcvhwm_bytes + peer.options.sndhwm_bytes
+                    : 0;
+            }
+            new_pipes[0]->set_hwms_bytes (rcvhwm_bytes, sndhwm_bytes);
+            new_pipes[1]->set_hwms_bytes (sndhwm_bytes, rcvhwm_bytes);
         }
 
         errno_assert (rc == 0);
@@ -940,6 +1032,18 @@ int zmq::socket_base_t::connect (const char *endpoint_uri_)
     }
 #endif
 
+#if defined ZMQ_HAVE_SHM
+    else if (protocol == protocol_name::shm) {
+        paddr->resolved.ipc_addr = new (std::nothrow) ipc_address_t ();
+        alloc_assert (paddr->resolved.ipc_addr);
+        int rc = paddr->resolved.ipc_addr->resolve (address.c_str ());
+        if (rc != 0) {
+            LIBZMQ_DELETE (paddr);
+            return -1;
+        }
+    }
+#endif
+
     if (protocol == protocol_name::udp) {
         if (options.type != ZMQ_RADIO) {
             errno = ENOCOMPATPROTO;
@@ -1029,6 +1133,12 @@ int zmq::socket_base_t::connect (const char *endpoint_uri_)
         bool conflates[2] = {conflate, conflate};
         rc = pipepair (parents, new_pipes, hwms, conflates);
         errno_assert (rc == 0);
+        if (!conflate) {
+            new_pipes[0]->set_hwms_bytes (options.rcvhwm_bytes,
+                                          options.sndhwm_bytes);
+            new_pipes[1]->set_hwms_bytes (options.sndhwm_bytes,
+                                          options.rcvhwm_bytes);
+        }
 
         //  Attach local end of the pipe to the socket object.
         attach_pipe (new_pipes[0], subscribe_to_all, true);
@@ -1166,11 +1276,50 @@ int zmq::socket_base_t::send (msg_t *msg_, int flags_)
     }
 
     //  Process pending commands, if any.
-    int rc = process_commands (0, true);
-    if (unlikely (rc != 0)) {
+    if (unlikely (process_commands (0, true) != 0)) {
+        return -1;
+    }
+
+    return send_locked (msg_, flags_);
+}
+
+int zmq::socket_base_t::send_batch (msg_t *msgs_, size_t count_, int flags_)
+{
+    scoped_optional_lock_t sync_lock (_thread_safe ? &_sync : NULL);
+
+    //  Check whether the context hasn't been shut down yet.
+    if (unlikely (_ctx_terminated)) {
+        errno = ETERM;
         return -1;
     }
 
+    //  Check whether the messages passed to the function are valid.
+    for (size_t i = 0; i != count_; i++) {
+        if (unlikely (!msgs_[i].check ())) {
+            errno = EFAULT;
+            return -1;
+        }
+    }
+
+    //  Process pending commands, if any, once for the whole batch.
+    if (unlikely (process_commands (0, true) != 0)) {
+        return -1;
+    }
+
+    //  Stop at the first message that cannot be sent. Its error is
+    //  reported only if nothing was sent; otherwise the next call
+    //  will run into it again.
+    size_t sent = 0;
+    while (sent != count_) {
+        if (send_locked (&msgs_[sent], flags_) != 0)
+            return sent == 0 ? -1 : static_cast<int> (sent);
+        sent++;
+    }
+    return static_cast<int> (sent);
+}
+
+int zmq::socket_base_t::send_locked (msg_t *msg_, int flags_)
+{
     //  Clear any user-visible flags that are set on the message.
     msg_->reset_flags (msg_t::more);
 
@@ -1181,7 +1330,7 @@ int zmq::socket_base_t::send (msg_t *msg_, int flags_)
     msg_->reset_metadata ();
 
     //  Try to send the message using method in each socket class
-    rc = xsend (msg_);
+    int rc = xsend (msg_);
     if (rc == 0) {
         return 0;
     }
@@ -1253,6 +1402,49 @@ int zmq::socket_base_t::recv (msg_t *msg_, int flags_)
         return -1;
     }
 
+    return recv_locked (msg_, flags_);
+}
+
+int zmq::socket_base_t::recv_batch (msg_t *msgs_, size_t count_, int flags_)
+{
+    scoped_optional_lock_t sync_lock (_thread_safe ? &_sync : NULL);
+
+    //  Check whether the context hasn't been shut down yet.
+    if (unlikely (_ctx_terminated)) {
+        errno = ETERM;
+        return -1;
+    }
+
+    //  Check whether the messages passed to the function are valid.
+    for (size_t i = 0; i != count_; i++) {
+        if (unlikely (!msgs_[i].check ())) {
+            errno = EFAULT;
+            return -1;
+        }
+    }
+
+    //  Only the first message is waited for, as flags_ and ZMQ_RCVTIMEO
+    //  say. The rest of the batch is whatever is already queued.
+    if (recv_locked (&msgs_[0], flags_) != 0)
+        return -1;
+
+    size_t received = 1;
+    while (received != count_) {
+        if (++_ticks == inbound_poll_rate) {
+            if (unlikely (process_commands (0, false) != 0))
+                break;
+            _ticks = 0;
+        }
+        if (xrecv (&msgs_[received]) != 0)
+            break;
+        extract_flags (&msgs_[received]);
+        received++;
+    }
+    return static_cast<int> (received);
+}
+
+int zmq::socket_base_t::recv_locked (msg_t *msg_, int flags_)
+{
     //  Once every inbound_poll_rate messages check for signals and process
     //  incoming commands. This happens only if we are not polling altogether
     //  because there are messages available all the time. If poll occurs,
@@ -1487,10 +1679,13 @@ void zmq::socket_base_t::process_term_endpoint (std::string *endpoint_)
 void zmq::socket_base_t::process_pipe_stats_publish (
   uint64_t outbound_queue_count_,
   uint64_t inbound_queue_count_,
+  uint64_t outbound_queue_bytes_,
+  uint64_t inbound_queue_bytes_,
   endpoint_uri_pair_t *endpoint_pair_)
 {
-    uint64_t values[2] = {outbound_queue_count_, inbound_queue_count_};
-    event (*endpoint_pair_, values, 2, ZMQ_EVENT_PIPES_STATS);
+    uint64_t values[4] = {outbound_queue_count_, inbound_queue_count_,
+                          outbound_queue_bytes_, inbound_queue_bytes_};
+    event (*endpoint_pair_, values, 4, ZMQ_EVENT_PIPES_STATS);
     delete endpoint_pair_;
 }
 
@@ -2012,15 +2207,10 @@ int zmq::routing_socket_base_t::xsetsockopt (int option_,
 
 void zmq::routing_socket_base_t::xwrite_activated (pipe_t *pipe_)
 {
-    const out_pipes_t::iterator end = _out_pipes.end ();
-    out_pipes_t::iterator it;
-    for (it = _out_pipes.begin (); it != end; ++it)
-        if (it->second.pipe == pipe_)
-            break;
-
-    zmq_assert (it != end);
-    zmq_assert (!it->second.active);
-    it->second.active = true;
+    out_pipe_t *const out_pipe = _out_pipes.find (pipe_);
+    zmq_assert (out_pipe);
+    zmq_assert (!out_pipe->active);
+    out_pipe->active = true;
 }
 
 std::string zmq::routing_socket_base_t::extract_connect_routing_id ()
@@ -2035,52 +2225,38 @@ bool zmq::routing_socket_base_t::connect_routing_id_is_set () const
     return !_connect_routing_id.empty ();
 }
 
-void zmq::routing_socket_base_t::add_out_pipe (blob_t routing_id_,
-                                               pipe_t *pipe_)
+void zmq::routing_socket_base_t::add_out_pipe (pipe_t *pipe_)
 {
     //  Add the record into output pipes lookup table
-    const out_pipe_t outpipe = {pipe_, true};
-    const bool ok =
-      _out_pipes.ZMQ_MAP_INSERT_OR_EMPLACE (ZMQ_MOVE (routing_id_), outpipe)
-        .second;
+    const bool ok = _out_pipes.insert (pipe_, true);
     zmq_assert (ok);
 }
 
 bool zmq::routing_socket_base_t::has_out_pipe (const blob_t &routing_id_) const
 {
-    return 0 != _out_pipes.count (routing_id_);
+    return NULL != lookup_out_pipe (routing_id_);
 }
 
 zmq::routing_socket_base_t::out_pipe_t *
 zmq::routing_socket_base_t::lookup_out_pipe (const blob_t &routing_id_)
 {
-    // TODO we could probably avoid constructor a temporary blob_t to call this function
-    out_pipes_t::iterator it = _out_pipes.find (routing_id_);
-    return it == _out_pipes.end () ? NULL : &it->second;
+    return _out_pipes.find (routing_id_.data (), routing_id_.size ());
 }
 
 const zmq::routing_socket_base_t::out_pipe_t *
 zmq::routing_socket_base_t::lookup_out_pipe (const blob_t &routing_id_) const
 {
-    // TODO we could probably avoid constructor a temporary blob_t to call this function
-    const out_pipes_t::const_iterator it = _out_pipes.find (routing_id_);
-    return it == _out_pipes.end () ? NULL : &it->second;
+    return _out_pipes.find (routing_id_.data (), routing_id_.size ());
 }
 
 void zmq::routing_socket_base_t::erase_out_pipe (const pipe_t *pipe_)
 {
-    const size_t erased = _out_pipes.erase (pipe_->get_routing_id ());
+    const bool erased = _out_pipes.erase (pipe_);
     zmq_assert (erased);
 }
 
 zmq::routing_socket_base_t::out_pipe_t
 zmq::routing_socket_base_t::try_erase_out_pipe (const blob_t &routing_id_)
 {
-    const out_pipes_t::iterator it = _out_pipes.find (routing_id_);
-    out_pipe_t res = {NULL, false};
-    if (it != _out_pipes.end ()) {
-        res = it->second;
-        _out_pipes.erase (it);
-    }
-    return res;
+    return _out_pipes.erase (routing_id_.data (), routing_id_.size ());
 }
@@ -44,6 +44,7 @@
 #include "clock.hpp"
 #include "pipe.hpp"
 #include "endpoint.hpp"
+#include "routing_table.hpp"
 
 extern "C" {
 void zmq_free_event (void *data_, void *hint_);
@@ -88,6 +89,12 @@ class socket_base_t : public own_t,
     int term_endpoint (const char *endpoint_uri_);
     int send (zmq::msg_t *msg_, int flags_);
     int recv (zmq::msg_t *msg_, int flags_);
+
+    //  Send or receive up to count_ messages under a single lock and
+    //  command check. Return the number of messages processed, or -1 if
+    //  there was none.
+    int send_batch (zmq::msg_t *msgs_, size_t count_, int flags_);
+    int recv_batch (zmq::msg_t *msgs_, size_t count_, int flags_);
     void add_signaler (signaler_t *s_);
     void remove_signaler (signaler_t *s_);
     int close ();
@@ -253,6 +260,11 @@ class socket_base_t : public own_t,
     //  to be later retrieved by getsockopt.
     void extract_flags (const msg_t *msg_);
 
+    //  Bodies of send and recv, once the socket is locked and the
+    //  arguments checked.
+    int send_locked (msg_t *msg_, int flags_);
+    int recv_locked (msg_t *msg_, int flags_);
+
     //  Used to check whether the object is a socket.
     uint32_t _tag;
 
@@ -289,6 +301,8 @@ class socket_base_t : public own_t,
     void
     process_pipe_stats_publish (uint64_t outbound_queue_count_,
                                 uint64_t inbound_queue_count_,
+                                uint64_t outbound_queue_bytes_,
+                                uint64_t inbound_queue_bytes_,
                                 endpoint_uri_pair_t *endpoint_pair_) ZMQ_FINAL;
     void process_term (int linger_) ZMQ_FINAL;
     void process_term_endpoint (std::string *endpoint_) ZMQ_FINAL;
@@ -305,6 +319,14 @@ class socket_base_t : public own_t,
     typedef array_t<pipe_t, 3> pipes_t;
     pipes_t _pipes;
 
+    //  Bytes held in the encoder and decoder buffers of the engines
+    //  serving the socket (ZMQ_BUFFER_MEMORY). Shared with the engines.
+    memory_counter_t *_buffer_memory;
+
+    //  Zero-copy sends completed by the kernel for the socket's TCP
+    //  connections (ZMQ_TCP_ZEROCOPY_COMPLETED). Shared with the engines.
+    memory_counter_t *_zerocopy_completed;
+
     //  Reaper's poller and handle of this socket within it.
     poller_t *_poller;
     poller_t::handle_t _handle;
@@ -361,13 +383,10 @@ class routing_socket_base_t : public socket_base_t
     std::string extract_connect_routing_id ();
     bool connect_routing_id_is_set () const;
 
-    struct out_pipe_t
-    {
-        pipe_t *pipe;
-        bool active;
-    };
+    typedef routing_table_t::entry_t out_pipe_t;
 
-    void add_out_pipe (blob_t routing_id_, pipe_t *pipe_);
+    //  Adds the pipe under the routing id it has been assigned.
+    void add_out_pipe (pipe_t *pipe_);
     bool has_out_pipe (const blob_t &routing_id_) const;
     out_pipe_t *lookup_out_pipe (const blob_t &routing_id_);
     const out_pipe_t *lookup_out_pipe (const blob_t &routing_id_) const;
@@ -375,20 +394,12 @@ class routing_socket_base_t : public socket_base_t
     out_pipe_t try_erase_out_pipe (const blob_t &routing_id_);
     template <typename Func> bool any_of_out_pipes (Func func_)
     {
-        bool res = false;
-        for (out_pipes_t::iterator it = _out_pipes.begin (),
-                                   end = _out_pipes.end ();
-             it != end && !res; ++it) {
-            res |= func_ (*it->second.pipe);
-        }
-
-        return res;
+        return _out_pipes.any_of (func_);
     }
 
   private:
     //  Outbound pipes indexed by the peer IDs.
-    typedef std::map<blob_t, out_pipe_t> out_pipes_t;
-    out_pipes_t _out_pipes;
+    routing_table_t _out_pipes;
 
     // Next assigned name on a zmq_connect() call used by ROUTER and STREAM socket types
     std::string _connect_routing_id;
@@ -56,12 +56,15 @@
 #include "curve_server.hpp"
 #include "raw_decoder.hpp"
 #include "raw_encoder.hpp"
+#include "gather_buffer.hpp"
+#include "memfd.hpp"
 #include "config.hpp"
 #include "err.hpp"
 #include "ip.hpp"
 #include "tcp.hpp"
 #include "likely.hpp"
 #include "wire.hpp"
+#include "zerocopy_reaper.hpp"
 
 static std::string get_peer_address (zmq::fd_t s_)
 {
@@ -99,6 +102,32 @@ static std::string get_peer_address (zmq::fd_t s_)
     return peer_address;
 }
 
+#if defined ZMQ_HAVE_MEMFD
+//  A frame passed in a memfd is replaced on the wire by a MEMFD command
+//  holding the frame's flags and size, while the memfd itself travels as
+//  ancillary data. The peer matches memfds and commands in order.
+static const unsigned char memfd_cmd_name[] = "\5MEMFD";
+static const size_t memfd_cmd_name_size = sizeof memfd_cmd_name - 1;
+static const size_t memfd_cmd_size = memfd_cmd_name_size + 1 + 8;
+
+static bool is_memfd_command (zmq::msg_t *msg_)
+{
+    return (msg_->flags () & zmq::msg_t::command)
+           && msg_->size () >= memfd_cmd_name_size
+           && memcmp (msg_->data (), memfd_cmd_name, memfd_cmd_name_size) == 0;
+}
+
+template <typename T> static void close_fds (T &fds_)
+{
+    for (typename T::iterator it = fds_.begin (), end = fds_.end (); it != end;
+         ++it) {
+        const int rc = close (*it);
+        errno_assert (rc == 0);
+    }
+    fds_.clear ();
+}
+#endif
+
 zmq::stream_engine_base_t::stream_engine_base_t (
   fd_t fd_,
   const options_t &options_,
@@ -110,6 +139,15 @@ zmq::stream_engine_base_t::stream_engine_base_t (
     _outpos (NULL),
     _outsize (0),
     _encoder (NULL),
+    _gather (NULL),
+    _zerocopy (false),
+#if defined ZMQ_HAVE_MEMFD
+    _accept_memfd (false),
+    _send_memfd (false),
+#endif
+#if defined ZMQ_IOTHREAD_POLLER_USE_IO_URING
+    _ring_io (false),
+#endif
     _mechanism (NULL),
     _next_msg (NULL),
     _process_msg (NULL),
@@ -121,18 +159,26 @@ zmq::stream_engine_base_t::stream_engine_base_t (
     _has_ttl_timer (false),
     _has_timeout_timer (false),
     _has_heartbeat_timer (false),
+    _has_buffer_release_timer (false),
     _peer_address (get_peer_address (fd_)),
     _s (fd_),
     _handle (static_cast<handle_t> (NULL)),
     _plugged (false),
     _handshaking (true),
     _io_error (false),
+    _buffer_memory (0),
     _session (NULL),
-    _socket (NULL)
+    _socket (NULL),
+    _io_thread (NULL)
 {
     const int rc = _tx_msg.init ();
     errno_assert (rc == 0);
 
+    if (_options.buffer_memory)
+        _options.buffer_memory->add_ref ();
+    if (_options.zerocopy_completed)
+        _options.zerocopy_completed->add_ref ();
+
     //  Put the socket into non-blocking mode.
     unblock_socket (_s);
 }
@@ -141,6 +187,21 @@ zmq::stream_engine_base_t::~stream_engine_base_t ()
 {
     zmq_assert (!_plugged);
 
+#if defined ZMQ_HAVE_TCP_ZEROCOPY
+    //  The kernel may still be reading from messages passed to it with
+    //  MSG_ZEROCOPY. Leave them to the reaper, along with the socket that
+    //  the completions are reported on.
+    if (_zerocopy && _gather != NULL && _s != retired_fd && _io_thread) {
+        _gather->clear ();
+        if (_gather->zerocopy_pending ()) {
+            zerocopy_reaper_t::start (_io_thread, _s, _gather,
+                                      _options.zerocopy_completed);
+            _s = retired_fd;
+            _gather = NULL;
+        }
+    }
+#endif
+
     if (_s != retired_fd) {
 #ifdef ZMQ_HAVE_WINDOWS
         const int rc = closesocket (_s);
@@ -169,9 +230,28 @@ zmq::stream_engine_base_t::~stream_engine_base_t ()
         }
     }
 
+#if defined ZMQ_HAVE_MEMFD
+    close_fds (_memfds_out);
+    close_fds (_memfds_in);
+#endif
+
+#if defined ZMQ_HAVE_UIO
+    LIBZMQ_DELETE (_gather);
+#endif
     LIBZMQ_DELETE (_encoder);
     LIBZMQ_DELETE (_decoder);
     LIBZMQ_DELETE (_mechanism);
+
+    if (_options.buffer_memory) {
+        if (_buffer_memory)
+            _options.buffer_memory->add (
+              -static_cast<int64_t> (_buffer_memory));
+        if (_options.buffer_memory->drop_ref ())
+            delete _options.buffer_memory;
+    }
+    if (_options.zerocopy_completed
+        && _options.zerocopy_completed->drop_ref ())
+        delete _options.zerocopy_completed;
 }
 
 void zmq::stream_engine_base_t::plug (io_thread_t *io_thread_,
@@ -188,9 +268,40 @@ void zmq::stream_engine_base_t::plug (io_thread_t *io_thread_,
 
     //  Connect to I/O threads poller object.
     io_object_t::plug (io_thread_);
+    _io_thread = io_thread_;
     _handle = add_fd (_s);
     _io_error = false;
 
+#if defined ZMQ_HAVE_TCP_ZEROCOPY
+    if (_options.tcp_zerocopy_threshold > 0)
+        _zerocopy = tcp_enable_zerocopy (_s);
+#endif
+
+#if defined ZMQ_HAVE_MEMFD
+    //  Frames in memfds bypass the security mechanism, so only accept
+    //  them where the mechanism does not encrypt anything.
+    if (_options.ipc_memfd_threshold > 0
+        && (_options.mechanism == ZMQ_NULL
+            || _options.mechanism == ZMQ_PLAIN)) {
+        struct sockaddr_storage ss;
+        socklen_t ss_len = sizeof ss;
+        _accept_memfd =
+          getsockname (_s, reinterpret_cast<struct sockaddr *> (&ss), &ss_len)
+            == 0
+          && ss.ss_family == AF_UNIX;
+    }
+#endif
+
+#if defined ZMQ_IOTHREAD_POLLER_USE_IO_URING
+    //  Unless ancillary data go with it, leave the I/O to the poller.
+#if defined ZMQ_HAVE_MEMFD
+    if (!_zerocopy && !_accept_memfd && use_ring_io ())
+#else
+    if (!_zerocopy && use_ring_io ())
+#endif
+        start_ring_io ();
+#endif
+
     plug_internal ();
 }
 
@@ -219,6 +330,11 @@ void zmq::stream_engine_base_t::unplug ()
         cancel_timer (heartbeat_ivl_timer_id);
         _has_heartbeat_timer = false;
     }
+
+    if (_has_buffer_release_timer) {
+        cancel_timer (buffer_release_timer_id);
+        _has_buffer_release_timer = false;
+    }
     //  Cancel all fd subscriptions.
     if (!_io_error)
         rm_fd (_handle);
@@ -235,11 +351,72 @@ void zmq::stream_engine_base_t::terminate ()
     delete this;
 }
 
+bool zmq::stream_engine_base_t::migrate_out ()
+{
+    //  Only engines past the handshake and not waiting for a heartbeat
+    //  reply can move; the timers of the others would not survive it.
+    if (!_plugged || _handshaking || _io_error
+        || (_mechanism != NULL && _mechanism->status () != mechanism_t::ready)
+        || _has_handshake_timer || _has_ttl_timer || _has_timeout_timer)
+        return false;
+
+#if defined ZMQ_IOTHREAD_POLLER_USE_IO_URING
+    //  Nor can data buffered by the poller.
+    if (_ring_io && !detach_ring_io (_handle))
+        return false;
+#endif
+
+    //  Timers that merely repeat are set again by migrate_in.
+    if (_has_heartbeat_timer)
+        cancel_timer (heartbeat_ivl_timer_id);
+    if (_has_buffer_release_timer)
+        cancel_timer (buffer_release_timer_id);
+    rm_fd (_handle);
+    io_object_t::unplug ();
+    return true;
+}
+
+void zmq::stream_engine_base_t::migrate_in (io_thread_t *io_thread_)
+{
+    io_object_t::plug (io_thread_);
+    _io_thread = io_thread_;
+    _handle = add_fd (_s);
+#if defined ZMQ_IOTHREAD_POLLER_USE_IO_URING
+    if (_ring_io)
+        start_ring_io ();
+#endif
+    if (!_input_stopped)
+        set_pollin ();
+    if (!_output_stopped)
+        set_pollout ();
+    if (_has_heartbeat_timer)
+        add_timer (_options.heartbeat_interval, heartbeat_ivl_timer_id);
+    if (_has_buffer_release_timer)
+        add_timer (buffer_release_ivl, buffer_release_timer_id);
+}
+
+#if defined ZMQ_IOTHREAD_POLLER_USE_IO_URING
+void zmq::stream_engine_base_t::start_ring_io ()
+{
+    //  The output buffer takes two batches, the most out_event writes at
+    //  once. If the poller cannot take the socket, it is polled instead.
+    _ring_io = set_ring_io (_handle, _options.in_batch_size,
+                           2 * _options.out_batch_size);
+}
+#endif
+
 void zmq::stream_engine_base_t::in_event ()
 {
-    // ignore errors
-    const bool res = in_event_internal ();
-    LIBZMQ_UNUSED (res);
+#if defined ZMQ_HAVE_TCP_ZEROCOPY
+    //  The poller reports queued zero-copy completions like a socket error.
+    //  Unless input is enabled, they must not be taken for one.
+    if (_zerocopy && reap_zerocopy () && _input_stopped)
+        return;
+#endif
+
+    //  On errors the engine is gone already.
+    if (in_event_internal ())
+        account_buffers ();
 }
 
 bool zmq::stream_engine_base_t::in_event_internal ()
@@ -287,6 +464,7 @@ bool zmq::stream_engine_base_t::in_event_internal ()
 
         //  Adjust input size
         _insize = static_cast<size_t> (rc);
+        add_traffic (_insize);
         // Adjust buffer size to received bytes
         _decoder->resize_buffer (_insize);
     }
@@ -322,9 +500,24 @@ bool zmq::stream_engine_base_t::in_event_internal ()
 }
 
 void zmq::stream_engine_base_t::out_event ()
+{
+    out_event_internal ();
+    account_buffers ();
+}
+
+void zmq::stream_engine_base_t::out_event_internal ()
 {
     zmq_assert (!_io_error);
 
+#if defined ZMQ_HAVE_UIO
+    //  Once the handshake data in the write buffer is gone, encoders
+    //  able to do so hand over message bodies without copying them.
+    if (!_outsize && _encoder != NULL && _encoder->supports_gather ()) {
+        out_event_gather ();
+        return;
+    }
+#endif
+
     //  If write buffer is empty, try to read new data from the encoder.
     if (!_outsize) {
         //  Even when we stop polling as soon as there is no
@@ -335,54 +528,160 @@ void zmq::stream_engine_base_t::out_event ()
             return;
         }
 
-        _outpos = NULL;
-        _outsize = _encoder->encode (&_outpos, 0);
-
-        while (_outsize < static_cast<size_t> (_options.out_batch_size)) {
-            if ((this->*_next_msg) (&_tx_msg) == -1)
-                break;
-            _encoder->load_msg (&_tx_msg);
-            unsigned char *bufptr = _outpos + _outsize;
-            const size_t n =
-              _encoder->encode (&bufptr, _options.out_batch_size - _outsize);
-            zmq_assert (n > 0);
-            if (_outpos == NULL)
-                _outpos = bufptr;
-            _outsize += n;
-        }
+        encode_batch ();
+        if (_outsize == 0)
+            return;
+    }
 
-        //  If there is no data to send, stop polling for output.
-        if (_outsize == 0) {
-            _output_stopped = true;
+    //  Besides the batch at hand, at most one more is written per event.
+    for (int batch = 0; batch != 2; batch++) {
+        //  If there are any data to write in write buffer, write as much as
+        //  possible to the socket. Note that amount of data to write can be
+        //  arbitrarily large. However, we assume that underlying TCP layer
+        //  has limited transmission buffer and thus the actual number of
+        //  bytes written should be reasonably modest.
+        const int nbytes = write (_outpos, _outsize);
+
+        //  IO error has occurred. We stop waiting for output events.
+        //  The engine is not terminated until we detect input error;
+        //  this is necessary to prevent losing incoming messages.
+        if (nbytes == -1) {
             reset_pollout ();
             return;
         }
+
+        _outpos += nbytes;
+        _outsize -= nbytes;
+        add_traffic (nbytes);
+
+        //  If we are still handshaking and there are no data
+        //  to send, stop polling for output.
+        if (unlikely (_handshaking)) {
+            if (_outsize == 0)
+                reset_pollout ();
+            return;
+        }
+        if (_outsize != 0 || batch == 1)
+            return;
+
+        //  Once everything is written, look for more data right away rather
+        //  than on the next output event. If there is none, polling for
+        //  output stops in the same event that enabled it, such as a
+        //  speculative write, and the poller does not need to be told about
+        //  either. If there is, it is written now: once the batch holds the
+        //  last message of a terminating pipe, the session may destroy the
+        //  engine before the next output event. Anything after that batch
+        //  is left to the next output event, so that a fast producer does
+        //  not keep the other engines and the mailbox waiting.
+        encode_batch ();
+        if (_outsize == 0)
+            return;
     }
+}
+
+void zmq::stream_engine_base_t::encode_batch ()
+{
+    _outpos = NULL;
+    _outsize = _encoder->encode (&_outpos, 0);
 
-    //  If there are any data to write in write buffer, write as much as
-    //  possible to the socket. Note that amount of data to write can be
-    //  arbitrarily large. However, we assume that underlying TCP layer has
-    //  limited transmission buffer and thus the actual number of bytes
-    //  written should be reasonably modest.
-    const int nbytes = write (_outpos, _outsize);
+    while (_outsize < static_cast<size_t> (_options.out_batch_size)) {
+        if ((this->*_next_msg) (&_tx_msg) == -1)
+            break;
+        _encoder->load_msg (&_tx_msg);
+        unsigned char *bufptr = _outpos + _outsize;
+        const size_t n =
+          _encoder->encode (&bufptr, _options.out_batch_size - _outsize);
+        zmq_assert (n > 0);
+        if (_outpos == NULL)
+            _outpos = bufptr;
+        _outsize += n;
+    }
 
-    //  IO error has occurred. We stop waiting for output events.
-    //  The engine is not terminated until we detect input error;
-    //  this is necessary to prevent losing incoming messages.
-    if (nbytes == -1) {
+    //  If there is no data to send, stop polling for output.
+    if (_outsize == 0) {
+        _output_stopped = true;
         reset_pollout ();
-        return;
     }
+}
 
-    _outpos += nbytes;
-    _outsize -= nbytes;
+#if defined ZMQ_HAVE_UIO
+void zmq::stream_engine_base_t::out_event_gather ()
+{
+    if (unlikely (_gather == NULL)) {
+        _gather = new (std::nothrow) gather_buffer_t (_options.out_batch_size);
+        alloc_assert (_gather);
+    }
 
-    //  If we are still handshaking and there are no data
-    //  to send, stop polling for output.
-    if (unlikely (_handshaking))
-        if (_outsize == 0)
+    //  If the batch has been written, fill in a new one.
+    if (!_gather->size ()) {
+        encode_gather_batch ();
+        if (_gather->size () == 0)
+            return;
+    }
+
+    //  As in out_event_internal, at most one more batch is written.
+    for (int batch = 0; batch != 2; batch++) {
+        bool zerocopy =
+          _zerocopy
+          && _gather->largest_referred ()
+               >= static_cast<size_t> (_options.tcp_zerocopy_threshold);
+        const int nbytes =
+          writev (_gather->segments (), _gather->segment_count (), &zerocopy);
+
+        //  IO error has occurred. We stop waiting for output events.
+        //  The engine is not terminated until we detect input error;
+        //  this is necessary to prevent losing incoming messages.
+        if (nbytes == -1) {
             reset_pollout ();
+            return;
+        }
+
+#if defined ZMQ_HAVE_TCP_ZEROCOPY
+        if (zerocopy)
+            _gather->sent_zerocopy ();
+#endif
+        _gather->consume (nbytes);
+        add_traffic (nbytes);
+
+        //  If we are still handshaking and there are no data
+        //  to send, stop polling for output.
+        if (unlikely (_handshaking)) {
+            if (_gather->size () == 0)
+                reset_pollout ();
+            return;
+        }
+        if (_gather->size () != 0 || batch == 1)
+            return;
+
+        //  As in out_event_internal, look for more data and write it
+        //  right away.
+        encode_gather_batch ();
+        if (_gather->size () == 0)
+            return;
+    }
+}
+
+void zmq::stream_engine_base_t::encode_gather_batch ()
+{
+    _gather->clear ();
+    _encoder->encode (_gather, _options.out_batch_size);
+
+    while (_gather->size () < static_cast<size_t> (_options.out_batch_size)
+           && !_gather->full ()) {
+        if ((this->*_next_msg) (&_tx_msg) == -1)
+            break;
+        _encoder->load_msg (&_tx_msg);
+        const size_t n = _encoder->encode (_gather, _options.out_batch_size);
+        zmq_assert (n > 0);
+    }
+
+    //  If there is no data to send, stop polling for output.
+    if (_gather->size () == 0) {
+        _output_stopped = true;
+        reset_pollout ();
+    }
 }
+#endif
 
 void zmq::stream_engine_base_t::restart_output ()
 {
@@ -451,6 +750,7 @@ bool zmq::stream_engine_base_t::restart_input ()
             return false;
     }
 
+    account_buffers ();
     return true;
 }
 
@@ -556,6 +856,10 @@ void zmq::stream_engine_base_t::mechanism_ready ()
     _next_msg = &stream_engine_base_t::pull_and_encode;
     _process_msg = &stream_engine_base_t::write_credential;
 
+#if defined ZMQ_HAVE_MEMFD
+    _send_memfd = _accept_memfd && _mechanism->peer_accepts_memfd ();
+#endif
+
     //  Compile metadata.
     properties_t properties;
     init_properties (properties);
@@ -604,8 +908,23 @@ int zmq::stream_engine_base_t::pull_and_encode (msg_t *msg_)
 {
     zmq_assert (_mechanism != NULL);
 
+#if defined ZMQ_HAVE_MEMFD
+    //  The memfds of the write buffer all go with its first write, and
+    //  the peer takes only so many at once, so end the batch here.
+    if (unlikely (_memfds_out.size () == ipc_max_passed_fds)) {
+        errno = EAGAIN;
+        return -1;
+    }
+#endif
+
     if (_session->pull_msg (msg_) == -1)
         return -1;
+#if defined ZMQ_HAVE_MEMFD
+    if (_send_memfd
+        && msg_->size () >= static_cast<size_t> (_options.ipc_memfd_threshold)
+        && !(msg_->flags () & msg_t::command))
+        encode_memfd (msg_);
+#endif
     if (_mechanism->encode (msg_) == -1)
         return -1;
     return 0;
@@ -618,6 +937,12 @@ int zmq::stream_engine_base_t::decode_and_push (msg_t *msg_)
     if (_mechanism->decode (msg_) == -1)
         return -1;
 
+#if defined ZMQ_HAVE_MEMFD
+    if (_accept_memfd && is_memfd_command (msg_))
+        if (decode_memfd (msg_) == -1)
+            return -1;
+#endif
+
     if (_has_timeout_timer) {
         _has_timeout_timer = false;
         cancel_timer (heartbeat_timeout_timer_id);
@@ -732,14 +1057,81 @@ void zmq::stream_engine_base_t::timer_event (int id_)
     } else if (id_ == heartbeat_timeout_timer_id) {
         _has_timeout_timer = false;
         error (timeout_error);
+    } else if (id_ == buffer_release_timer_id) {
+        _has_buffer_release_timer = false;
+        release_buffers ();
+        account_buffers ();
     } else
         // There are no other valid timer ids!
         assert (false);
 }
 
+void zmq::stream_engine_base_t::account_buffers ()
+{
+    size_t memory = 0;
+    if (_encoder)
+        memory += _encoder->buffer_size ();
+    if (_decoder)
+        memory += _decoder->buffer_size ();
+#if defined ZMQ_HAVE_UIO
+    if (_gather)
+        memory += _gather->memory ();
+#endif
+
+    if (memory != _buffer_memory) {
+        const int64_t delta = static_cast<int64_t> (memory)
+                              - static_cast<int64_t> (_buffer_memory);
+        if (_options.buffer_memory)
+            _options.buffer_memory->add (delta);
+        _buffer_memory = memory;
+    }
+
+    if (memory && _plugged && !_has_buffer_release_timer) {
+        add_timer (buffer_release_ivl, buffer_release_timer_id);
+        _has_buffer_release_timer = true;
+    }
+}
+
+void zmq::stream_engine_base_t::release_buffers ()
+{
+    //  Idle connections keep no buffers. Busy ones get them back on their
+    //  next read or write, at the cost of one allocation per interval.
+    if (_handshaking)
+        return;
+
+    if (_encoder && _outsize == 0)
+        _encoder->release_buffer ();
+    if (_decoder && _insize == 0)
+        _decoder->release_buffer ();
+#if defined ZMQ_HAVE_UIO
+    if (_gather && _gather->idle ())
+        LIBZMQ_DELETE (_gather);
+#endif
+
+    //  Same for the queues between the session and the socket.
+    _session->release_pipe_memory ();
+}
+
 int zmq::stream_engine_base_t::read (void *data_, size_t size_)
 {
+#if defined ZMQ_IOTHREAD_POLLER_USE_IO_URING
+    if (_ring_io) {
+        const int rc = ring_read (_handle, data_, size_);
+        if (rc == 0) {
+            errno = EPIPE;
+            return -1;
+        }
+        return rc;
+    }
+#endif
+
+#if defined ZMQ_HAVE_MEMFD
+    const int rc = _accept_memfd
+                     ? zmq::ipc_read_fds (_s, data_, size_, _memfds_in)
+                     : zmq::tcp_read (_s, data_, size_);
+#else
     const int rc = zmq::tcp_read (_s, data_, size_);
+#endif
 
     if (rc == 0) {
         // connection closed by peer
@@ -752,5 +1144,133 @@ int zmq::stream_engine_base_t::read (void *data_, size_t size_)
 
 int zmq::stream_engine_base_t::write (const void *data_, size_t size_)
 {
+#if defined ZMQ_IOTHREAD_POLLER_USE_IO_URING
+    if (_ring_io) {
+        iovec iov;
+        iov.iov_base = const_cast<void *> (data_);
+        iov.iov_len = size_;
+        return ring_writev (_handle, &iov, 1);
+    }
+#endif
+#if defined ZMQ_HAVE_MEMFD
+    if (unlikely (!_memfds_out.empty ())) {
+        iovec iov;
+        iov.iov_base = const_cast<void *> (data_);
+        iov.iov_len = size_;
+        return write_memfds (&iov, 1);
+    }
+#endif
     return zmq::tcp_write (_s, data_, size_);
 }
+
+#if defined ZMQ_HAVE_UIO
+int zmq::stream_engine_base_t::writev (const iovec *iov_,
+                                       int iovcnt_,
+                                       bool *zerocopy_)
+{
+#if defined ZMQ_IOTHREAD_POLLER_USE_IO_URING
+    //  What the poller does not send right away, it copies.
+    if (_ring_io) {
+        *zerocopy_ = false;
+        return ring_writev (_handle, iov_, iovcnt_);
+    }
+#endif
+#if defined ZMQ_HAVE_MEMFD
+    if (unlikely (!_memfds_out.empty ())) {
+        *zerocopy_ = false;
+        return write_memfds (iov_, iovcnt_);
+    }
+#endif
+    return zmq::tcp_writev (_s, iov_, iovcnt_, zerocopy_);
+}
+#endif
+
+#if defined ZMQ_HAVE_TCP_ZEROCOPY
+bool zmq::stream_engine_base_t::reap_zerocopy ()
+{
+    if (_gather == NULL)
+        return false;
+
+    bool reaped = false;
+    uint32_t lo, hi;
+    while (tcp_zerocopy_completion (_s, &lo, &hi)) {
+        _gather->completed_zerocopy (lo, hi);
+        if (_options.zerocopy_completed)
+            _options.zerocopy_completed->add (hi - lo + 1);
+        reaped = true;
+    }
+    return reaped;
+}
+#endif
+
+#if defined ZMQ_HAVE_MEMFD
+void zmq::stream_engine_base_t::encode_memfd (msg_t *msg_)
+{
+    const fd_t fd = memfd_create_sealed (msg_->data (), msg_->size ());
+    if (fd == retired_fd)
+        return;
+
+    msg_t command;
+    int rc = command.init_size (memfd_cmd_size);
+    errno_assert (rc == 0);
+    unsigned char *ptr = static_cast<unsigned char *> (command.data ());
+    memcpy (ptr, memfd_cmd_name, memfd_cmd_name_size);
+    ptr += memfd_cmd_name_size;
+    *ptr++ = msg_->flags () & msg_t::more;
+    put_uint64 (ptr, msg_->size ());
+    command.set_flags (msg_t::command);
+
+    rc = msg_->move (command);
+    errno_assert (rc == 0);
+    _memfds_out.push_back (fd);
+}
+
+int zmq::stream_engine_base_t::decode_memfd (msg_t *msg_)
+{
+    if (msg_->size () != memfd_cmd_size || _memfds_in.empty ()) {
+        errno = EPROTO;
+        return -1;
+    }
+    const unsigned char *ptr =
+      static_cast<const unsigned char *> (msg_->data ()) + memfd_cmd_name_size;
+    const unsigned char flags = *ptr++;
+    const uint64_t size = get_uint64 (ptr);
+    if ((flags & ~msg_t::more) || size == 0 || size > SIZE_MAX) {
+        errno = EPROTO;
+        return -1;
+    }
+    if (_options.maxmsgsize >= 0
+        && size > static_cast<uint64_t> (_options.maxmsgsize)) {
+        errno = EMSGSIZE;
+        return -1;
+    }
+
+    const fd_t fd = _memfds_in.front ();
+    _memfds_in.pop_front ();
+    void *data = memfd_map (fd, static_cast<size_t> (size));
+    if (data == NULL)
+        return -1;
+
+    void *hint = reinterpret_cast<void *> (static_cast<size_t> (size));
+    msg_t frame;
+    const int rc =
+      frame.init_data (data, static_cast<size_t> (size), memfd_unmap, hint);
+    if (rc == -1) {
+        memfd_unmap (data, hint);
+        return -1;
+    }
+    frame.set_flags (flags);
+    return msg_->move (frame);
+}
+
+int zmq::stream_engine_base_t::write_memfds (const iovec *iov_, int iovcnt_)
+{
+    const int rc = zmq::ipc_writev_fds (
+      _s, iov_, iovcnt_, &_memfds_out[0], static_cast<int> (_memfds_out.size ()));
+
+    //  Once passed, the memfds are the receiver's business.
+    if (rc > 0)
+        close_fds (_memfds_out);
+    return rc;
+}
+#endif
@@ -31,6 +31,14 @@
 #define __ZMQ_STREAM_ENGINE_BASE_HPP_INCLUDED__
 
 #include <stddef.h>
+#if defined ZMQ_HAVE_UIO
+#include <sys/uio.h>
+#endif
+#if defined ZMQ_HAVE_MEMFD
+#include <deque>
+#include <vector>
+#include <sys/uio.h>
+#endif
 
 #include "fd.hpp"
 #include "i_engine.hpp"
@@ -68,6 +76,8 @@ class stream_engine_base_t : public io_object_t, public i_engine
     void restart_output () ZMQ_FINAL;
     void zap_msg_available () ZMQ_FINAL;
     const endpoint_uri_pair_t &get_endpoint () const ZMQ_FINAL;
+    bool migrate_out () ZMQ_FINAL;
+    void migrate_in (zmq::io_thread_t *io_thread_) ZMQ_FINAL;
 
     //  i_poll_events interface implementation.
     void in_event () ZMQ_FINAL;
@@ -103,6 +113,14 @@ class stream_engine_base_t : public io_object_t, public i_engine
 
     virtual int read (void *data, size_t size_);
     virtual int write (const void *data_, size_t size_);
+#if defined ZMQ_HAVE_UIO
+    virtual int writev (const iovec *iov_, int iovcnt_, bool *zerocopy_);
+#endif
+#if defined ZMQ_IOTHREAD_POLLER_USE_IO_URING
+    //  Engines whose read and write do not use the socket as it is, e.g.
+    //  through a TLS session, have to keep the poller from doing them.
+    virtual bool use_ring_io () const { return true; }
+#endif
 
     void reset_pollout () { io_object_t::reset_pollout (_handle); }
     void set_pollout () { io_object_t::set_pollout (_handle); }
@@ -120,6 +138,26 @@ class stream_engine_base_t : public io_object_t, public i_engine
     size_t _outsize;
     i_encoder *_encoder;
 
+    //  Batch of encoded data written with a single gather write, used
+    //  instead of _outpos/_outsize once the encoder supports it.
+    gather_buffer_t *_gather;
+
+    //  True iff large frames are sent with MSG_ZEROCOPY.
+    bool _zerocopy;
+
+#if defined ZMQ_HAVE_MEMFD
+    //  True iff the peer may pass large frames to us in memfds.
+    bool _accept_memfd;
+
+    //  True iff large frames are passed to the peer in memfds.
+    bool _send_memfd;
+#endif
+
+#if defined ZMQ_IOTHREAD_POLLER_USE_IO_URING
+    //  True iff the poller reads and writes the socket for us.
+    bool _ring_io;
+#endif
+
     mechanism_t *_mechanism;
 
     int (stream_engine_base_t::*_next_msg) (msg_t *msg_);
@@ -157,11 +195,70 @@ class stream_engine_base_t : public io_object_t, public i_engine
     bool _has_timeout_timer;
     bool _has_heartbeat_timer;
 
+    //  Buffers not in use are freed when this timer fires.
+    enum
+    {
+        buffer_release_timer_id = 0x83
+    };
+    bool _has_buffer_release_timer;
+
 
     const std::string _peer_address;
 
   private:
     bool in_event_internal ();
+    void out_event_internal ();
+
+    //  Encodes the next batch of messages into the write buffer. Stops
+    //  polling for output if there is nothing to send.
+    void encode_batch ();
+
+    //  Brings the socket's buffer memory counter up to date and makes
+    //  sure the buffers held get released once they are no longer used.
+    void account_buffers ();
+
+    //  Frees the encoder and decoder buffers that hold no pending data,
+    //  and the spare chunks of the session's queues.
+    void release_buffers ();
+
+#if defined ZMQ_IOTHREAD_POLLER_USE_IO_URING
+    //  Hands the reads and writes of the socket over to the poller.
+    void start_ring_io ();
+#endif
+
+#if defined ZMQ_HAVE_UIO
+    //  Variant of out_event writing the encoded data with a gather write.
+    void out_event_gather ();
+
+    //  Variant of encode_batch filling the gather buffer.
+    void encode_gather_batch ();
+#endif
+
+#if defined ZMQ_HAVE_TCP_ZEROCOPY
+    //  Processes the zero-copy completion notifications queued on the
+    //  socket. Returns false if there were none.
+    bool reap_zerocopy ();
+#endif
+
+#if defined ZMQ_HAVE_MEMFD
+    //  Replaces the frame in 'msg_' by a MEMFD command referring to a
+    //  memfd holding its data. Leaves the frame alone if that fails.
+    void encode_memfd (msg_t *msg_);
+
+    //  Replaces the MEMFD command in 'msg_' by the frame it refers to.
+    int decode_memfd (msg_t *msg_);
+
+    //  Writes like writev, passing the memfds in _memfds_out along.
+    int write_memfds (const iovec *iov_, int iovcnt_);
+
+    //  Memfds of the frames in the write buffer, passed along with its
+    //  next write.
+    std::vector<fd_t> _memfds_out;
+
+    //  Memfds received from the peer whose MEMFD commands have not been
+    //  decoded yet.
+    std::deque<fd_t> _memfds_in;
+#endif
 
     //  Unplug the engine from the session.
     void unplug ();
@@ -186,12 +283,18 @@ class stream_engine_base_t : public io_object_t, public i_engine
 
     bool _io_error;
 
+    //  Bytes held in encoder and decoder buffers, as last accounted.
+    size_t _buffer_memory;
+
     //  The session this engine is attached to.
     zmq::session_base_t *_session;
 
     // Socket
     zmq::socket_base_t *_socket;
 
+    //  The I/O thread the engine was last plugged into.
+    zmq::io_thread_t *_io_thread;
+
     ZMQ_NON_COPYABLE_NOR_MOVABLE (stream_engine_base_t)
 };
 }
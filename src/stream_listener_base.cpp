@@ -48,7 +48,8 @@ zmq::stream_listener_base_t::stream_listener_base_t (
     io_object_t (io_thread_),
     _s (retired_fd),
     _handle (static_cast<handle_t> (NULL)),
-    _socket (socket_)
+    _socket (socket_),
+    _engine_thread (NULL)
 {
 }
 
@@ -112,7 +113,8 @@ void zmq::stream_listener_base_t::create_engine (fd_t fd_)
 
     //  Choose I/O thread to run connecter in. Given that we are already
     //  running in an I/O thread, there must be at least one available.
-    io_thread_t *io_thread = choose_io_thread (options.affinity);
+    io_thread_t *io_thread =
+      _engine_thread ? _engine_thread : choose_io_thread (options.affinity);
     zmq_assert (io_thread);
 
     //  Create and launch a session object.
@@ -58,9 +58,10 @@ class stream_listener_base_t : public own_t, public io_object_t
     virtual std::string get_socket_name (fd_t fd_,
                                          socket_end_t socket_end_) const = 0;
 
-  private:
     //  Handlers for incoming commands.
-    void process_plug () ZMQ_FINAL;
+    void process_plug () ZMQ_OVERRIDE;
+
+  private:
     void process_term (int linger_) ZMQ_FINAL;
 
   protected:
@@ -78,6 +79,10 @@ class stream_listener_base_t : public own_t, public io_object_t
     //  Socket the listener belongs to.
     zmq::socket_base_t *_socket;
 
+    //  I/O thread to run the sessions of accepted connections in, or NULL
+    //  to choose the least loaded one for each connection.
+    zmq::io_thread_t *_engine_thread;
+
     // String representation of endpoint to bind to
     std::string _endpoint;
 
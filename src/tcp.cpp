@@ -34,6 +34,8 @@
 #include "err.hpp"
 #include "options.hpp"
 
+#include <string.h>
+
 #if !defined ZMQ_HAVE_WINDOWS
 #include <fcntl.h>
 #include <sys/types.h>
@@ -50,6 +52,17 @@
 #include <ioctl.h>
 #endif
 
+#if defined ZMQ_HAVE_TCP_ZEROCOPY
+#include <time.h>
+#include <linux/errqueue.h>
+#ifndef SO_ZEROCOPY
+#define SO_ZEROCOPY 60
+#endif
+#ifndef MSG_ZEROCOPY
+#define MSG_ZEROCOPY 0x4000000
+#endif
+#endif
+
 #ifdef __APPLE__
 #include <TargetConditionals.h>
 #endif
@@ -210,6 +223,23 @@ int zmq::tune_tcp_maxrt (fd_t sockfd_, int timeout_)
 #endif
 }
 
+int zmq::tune_tcp_busy_poll (fd_t sockfd_, int busy_poll_)
+{
+    if (busy_poll_ <= 0)
+        return 0;
+
+    LIBZMQ_UNUSED (sockfd_);
+
+#if defined(SO_BUSY_POLL)
+    //  Busy polling is a hint: values above net.core.busy_read need
+    //  CAP_NET_ADMIN, and the socket works the same without it.
+    const int rc = setsockopt (sockfd_, SOL_SOCKET, SO_BUSY_POLL, &busy_poll_,
+                               sizeof (busy_poll_));
+    assert_success_or_recoverable (sockfd_, rc);
+#endif
+    return 0;
+}
+
 int zmq::tcp_write (fd_t s_, const void *data_, size_t size_)
 {
 #ifdef ZMQ_HAVE_WINDOWS
@@ -269,6 +299,97 @@ int zmq::tcp_write (fd_t s_, const void *data_, size_t size_)
 #endif
 }
 
+#if defined ZMQ_HAVE_UIO
+int zmq::tcp_writev (fd_t s_, const iovec *iov_, int iovcnt_, bool *zerocopy_)
+{
+    msghdr msg;
+    memset (&msg, 0, sizeof msg);
+    msg.msg_iov = const_cast<iovec *> (iov_);
+    msg.msg_iovlen = iovcnt_;
+
+#if defined ZMQ_HAVE_TCP_ZEROCOPY
+    ssize_t nbytes = sendmsg (s_, &msg, *zerocopy_ ? MSG_ZEROCOPY : 0);
+
+    //  The kernel limits the amount of memory pinned for zero-copy sends.
+    //  Until earlier sends complete, fall back to copying.
+    if (nbytes == -1 && errno == ENOBUFS && *zerocopy_) {
+        *zerocopy_ = false;
+        nbytes = sendmsg (s_, &msg, 0);
+    }
+    if (nbytes <= 0)
+        *zerocopy_ = false;
+#else
+    *zerocopy_ = false;
+    const ssize_t nbytes = sendmsg (s_, &msg, 0);
+#endif
+
+    //  Same as in tcp_write, not being able to write a single byte is OK.
+    if (nbytes == -1
+        && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR))
+        return 0;
+
+    //  Signalise peer failure.
+    if (nbytes == -1) {
+        errno_assert (errno != EACCES && errno != EBADF && errno != EDESTADDRREQ
+                      && errno != EFAULT && errno != EINVAL && errno != EISCONN
+                      && errno != EMSGSIZE && errno != ENOMEM
+                      && errno != ENOTSOCK && errno != EOPNOTSUPP);
+        return -1;
+    }
+
+    return static_cast<int> (nbytes);
+}
+#endif
+
+#if defined ZMQ_HAVE_TCP_ZEROCOPY
+bool zmq::tcp_enable_zerocopy (fd_t s_)
+{
+    const int on = 1;
+    const int rc = setsockopt (s_, SOL_SOCKET, SO_ZEROCOPY, &on, sizeof on);
+    return rc == 0;
+}
+
+bool zmq::tcp_zerocopy_completion (fd_t s_, uint32_t *lo_, uint32_t *hi_)
+{
+    unsigned char control[CMSG_SPACE (sizeof (sock_extended_err))
+                          + CMSG_SPACE (sizeof (sockaddr_in6))];
+    msghdr msg;
+    memset (&msg, 0, sizeof msg);
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof control;
+
+    while (true) {
+        const ssize_t rc = recvmsg (s_, &msg, MSG_ERRQUEUE);
+        if (rc == -1) {
+            //  The error queue is empty, or a real socket error is pending
+            //  which the next read or write will pick up.
+            errno_assert (errno != EBADF && errno != EFAULT && errno != EINVAL
+                          && errno != ENOTSOCK);
+            return false;
+        }
+
+        for (cmsghdr *cmsg = CMSG_FIRSTHDR (&msg); cmsg;
+             cmsg = CMSG_NXTHDR (&msg, cmsg)) {
+            if (!((cmsg->cmsg_level == SOL_IP && cmsg->cmsg_type == IP_RECVERR)
+                  || (cmsg->cmsg_level == SOL_IPV6
+                      && cmsg->cmsg_type == IPV6_RECVERR)))
+                continue;
+            const sock_extended_err *err =
+              reinterpret_cast<const sock_extended_err *> (CMSG_DATA (cmsg));
+            if (err->ee_errno != 0
+                || err->ee_origin != SO_EE_ORIGIN_ZEROCOPY)
+                continue;
+            *lo_ = err->ee_info;
+            *hi_ = err->ee_data;
+            return true;
+        }
+
+        //  Not a zero-copy notification, skip it.
+        msg.msg_controllen = sizeof control;
+    }
+}
+#endif
+
 int zmq::tcp_read (fd_t s_, void *data_, size_t size_)
 {
 #ifdef ZMQ_HAVE_WINDOWS
@@ -31,6 +31,11 @@
 #define __ZMQ_TCP_HPP_INCLUDED__
 
 #include "fd.hpp"
+#include "stdint.hpp"
+
+#if defined ZMQ_HAVE_UIO
+#include <sys/uio.h>
+#endif
 
 namespace zmq
 {
@@ -56,11 +61,32 @@ int tune_tcp_keepalives (fd_t s_,
 //  Tunes TCP max retransmit timeout
 int tune_tcp_maxrt (fd_t sockfd_, int timeout_);
 
+//  Tunes busy polling of the device queue on receives
+int tune_tcp_busy_poll (fd_t sockfd_, int busy_poll_);
+
 //  Writes data to the socket. Returns the number of bytes actually
 //  written (even zero is to be considered to be a success). In case
 //  of error or orderly shutdown by the other peer -1 is returned.
 int tcp_write (fd_t s_, const void *data_, size_t size_);
 
+#if defined ZMQ_HAVE_UIO
+//  Gather variant of tcp_write, writing the iovcnt_ segments at iov_.
+//  If *zerocopy_ is true, MSG_ZEROCOPY is requested; on return it tells
+//  whether the data was actually handed over that way.
+int tcp_writev (fd_t s_, const iovec *iov_, int iovcnt_, bool *zerocopy_);
+#endif
+
+#if defined ZMQ_HAVE_TCP_ZEROCOPY
+//  Enables MSG_ZEROCOPY sends on the socket. Returns false if the
+//  socket does not support them.
+bool tcp_enable_zerocopy (fd_t s_);
+
+//  Reads the next zero-copy completion notification from the socket's
+//  error queue. Returns true and the range of completed send ids if
+//  there was one.
+bool tcp_zerocopy_completion (fd_t s_, uint32_t *lo_, uint32_t *hi_);
+#endif
+
 //  Reads data from the socket (up to 'size' bytes).
 //  Returns the number of bytes actually read or -1 on error.
 //  Zero indicates the peer has closed the connection.
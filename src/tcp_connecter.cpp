@@ -298,6 +298,7 @@ bool zmq::tcp_connecter_t::tune_socket (const fd_t fd_)
                    | tune_tcp_keepalives (
                      fd_, options.tcp_keepalive, options.tcp_keepalive_cnt,
                      options.tcp_keepalive_idle, options.tcp_keepalive_intvl)
-                   | tune_tcp_maxrt (fd_, options.tcp_maxrt);
+                   | tune_tcp_maxrt (fd_, options.tcp_maxrt)
+                   | tune_tcp_busy_poll (fd_, options.tcp_busy_poll);
     return rc == 0;
 }
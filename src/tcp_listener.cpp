@@ -41,6 +41,7 @@
 #include "tcp.hpp"
 #include "socket_base.hpp"
 #include "address.hpp"
+#include "ctx.hpp"
 
 #ifndef ZMQ_HAVE_WINDOWS
 #include <unistd.h>
@@ -62,10 +63,55 @@
 zmq::tcp_listener_t::tcp_listener_t (io_thread_t *io_thread_,
                                      socket_base_t *socket_,
                                      const options_t &options_) :
-    stream_listener_base_t (io_thread_, socket_, options_)
+    stream_listener_base_t (io_thread_, socket_, options_),
+    _io_thread (io_thread_)
 {
 }
 
+zmq::tcp_listener_t::tcp_listener_t (io_thread_t *io_thread_,
+                                     socket_base_t *socket_,
+                                     const options_t &options_,
+                                     fd_t fd_,
+                                     const std::string &endpoint_) :
+    stream_listener_base_t (io_thread_, socket_, options_),
+    _io_thread (io_thread_)
+{
+    _s = fd_;
+    _endpoint = endpoint_;
+    _engine_thread = io_thread_;
+    _socket->event_listening (make_unconnected_bind_endpoint_pair (_endpoint),
+                              _s);
+}
+
+zmq::tcp_listener_t::~tcp_listener_t ()
+{
+    //  Shards not launched yet, if the listener was never plugged.
+    for (shards_t::size_type i = 0, size = _shards.size (); i != size; i++) {
+#ifdef ZMQ_HAVE_WINDOWS
+        const int rc = closesocket (_shards[i].fd);
+        wsa_assert (rc != SOCKET_ERROR);
+#else
+        const int rc = ::close (_shards[i].fd);
+        errno_assert (rc == 0);
+#endif
+    }
+}
+
+void zmq::tcp_listener_t::process_plug ()
+{
+    stream_listener_base_t::process_plug ();
+
+    //  The shards are children of this listener, so that they are closed
+    //  together with it.
+    for (shards_t::size_type i = 0, size = _shards.size (); i != size; i++) {
+        tcp_listener_t *shard = new (std::nothrow) tcp_listener_t (
+          _shards[i].io_thread, _socket, options, _shards[i].fd, _endpoint);
+        alloc_assert (shard);
+        launch_child (shard);
+    }
+    _shards.clear ();
+}
+
 void zmq::tcp_listener_t::in_event ()
 {
     const fd_t fd = accept ();
@@ -84,6 +130,7 @@ void zmq::tcp_listener_t::in_event ()
            fd, options.tcp_keepalive, options.tcp_keepalive_cnt,
            options.tcp_keepalive_idle, options.tcp_keepalive_intvl);
     rc = rc | tune_tcp_maxrt (fd, options.tcp_maxrt);
+    rc = rc | tune_tcp_busy_poll (fd, options.tcp_busy_poll);
     if (rc != 0) {
         _socket->event_accept_failed (
           make_unconnected_bind_endpoint_pair (_endpoint), zmq_errno ());
@@ -103,13 +150,29 @@ zmq::tcp_listener_t::get_socket_name (zmq::fd_t fd_,
 
 int zmq::tcp_listener_t::create_socket (const char *addr_)
 {
-    _s = tcp_open_socket (addr_, options, true, true, &_address);
-    if (_s == retired_fd) {
+    if (open_socket (addr_, &_address, &_s) == 0)
+        return 0;
+
+    if (_s != retired_fd) {
+        const int err = errno;
+        close ();
+        errno = err;
+    }
+    return -1;
+}
+
+int zmq::tcp_listener_t::open_socket (const char *addr_,
+                                      tcp_address_t *address_,
+                                      fd_t *s_)
+{
+    const fd_t s = tcp_open_socket (addr_, options, true, true, address_);
+    *s_ = s;
+    if (s == retired_fd) {
         return -1;
     }
 
     //  TODO why is this only done for the listener?
-    make_socket_noninheritable (_s);
+    make_socket_noninheritable (s);
 
     //  Allow reusing of the address.
     int flag = 1;
@@ -120,53 +183,90 @@ int zmq::tcp_listener_t::create_socket (const char *addr_)
     //  so the comment above is no longer correct; also, now the settings are
     //  different between listener and connecter with a src address.
     //  is this intentional?
-    rc = setsockopt (_s, SOL_SOCKET, SO_EXCLUSIVEADDRUSE,
+    rc = setsockopt (s, SOL_SOCKET, SO_EXCLUSIVEADDRUSE,
                      reinterpret_cast<const char *> (&flag), sizeof (int));
     wsa_assert (rc != SOCKET_ERROR);
 #elif defined ZMQ_HAVE_VXWORKS
     rc =
-      setsockopt (_s, SOL_SOCKET, SO_REUSEADDR, (char *) &flag, sizeof (int));
+      setsockopt (s, SOL_SOCKET, SO_REUSEADDR, (char *) &flag, sizeof (int));
     errno_assert (rc == 0);
 #else
-    rc = setsockopt (_s, SOL_SOCKET, SO_REUSEADDR, &flag, sizeof (int));
+    rc = setsockopt (s, SOL_SOCKET, SO_REUSEADDR, &flag, sizeof (int));
     errno_assert (rc == 0);
+#ifdef SO_REUSEPORT
+    //  The shards of a sharded bind share the port.
+    if (options.tcp_sharded_bind) {
+        rc = setsockopt (s, SOL_SOCKET, SO_REUSEPORT, &flag, sizeof (int));
+        errno_assert (rc == 0);
+    }
+#endif
 #endif
 
     //  Bind the socket to the network interface and port.
 #if defined ZMQ_HAVE_VXWORKS
-    rc = bind (_s, (sockaddr *) _address.addr (), _address.addrlen ());
+    rc = bind (s, (sockaddr *) address_->addr (), address_->addrlen ());
 #else
-    rc = bind (_s, _address.addr (), _address.addrlen ());
+    rc = bind (s, address_->addr (), address_->addrlen ());
 #endif
 #ifdef ZMQ_HAVE_WINDOWS
     if (rc == SOCKET_ERROR) {
         errno = wsa_error_to_errno (WSAGetLastError ());
-        goto error;
+        return -1;
     }
 #else
     if (rc != 0)
-        goto error;
+        return -1;
 #endif
 
     //  Listen for incoming connections.
-    rc = listen (_s, options.backlog);
+    rc = listen (s, options.backlog);
 #ifdef ZMQ_HAVE_WINDOWS
     if (rc == SOCKET_ERROR) {
         errno = wsa_error_to_errno (WSAGetLastError ());
-        goto error;
+        return -1;
     }
 #else
     if (rc != 0)
-        goto error;
+        return -1;
 #endif
 
     return 0;
+}
 
-error:
-    const int err = errno;
-    close ();
-    errno = err;
-    return -1;
+void zmq::tcp_listener_t::open_shards ()
+{
+    std::vector<io_thread_t *> io_threads;
+    get_ctx ()->get_io_threads (options.affinity, &io_threads);
+
+    //  Bind to the port actually bound, in case it was a wildcard.
+    const std::string address =
+      _endpoint.substr (_endpoint.find ("://") + 3);
+
+    for (size_t i = 0, size = io_threads.size (); i != size; i++) {
+        if (io_threads[i] == _io_thread)
+            continue;
+
+        //  Should a shard fail to open, the listeners opened so far
+        //  accept all the connections.
+        tcp_address_t shard_address;
+        shard_t shard = {io_threads[i], retired_fd};
+        if (open_socket (address.c_str (), &shard_address, &shard.fd) != 0) {
+            if (shard.fd != retired_fd) {
+#ifdef ZMQ_HAVE_WINDOWS
+                const int rc = closesocket (shard.fd);
+                wsa_assert (rc != SOCKET_ERROR);
+#else
+                const int rc = ::close (shard.fd);
+                errno_assert (rc == 0);
+#endif
+            }
+            break;
+        }
+        _shards.push_back (shard);
+    }
+
+    //  Connections stay in the I/O thread of the shard accepting them.
+    _engine_thread = _io_thread;
 }
 
 int zmq::tcp_listener_t::set_local_address (const char *addr_)
@@ -184,6 +284,11 @@ int zmq::tcp_listener_t::set_local_address (const char *addr_)
 
     _socket->event_listening (make_unconnected_bind_endpoint_pair (_endpoint),
                               _s);
+
+#ifdef SO_REUSEPORT
+    if (options.tcp_sharded_bind && options.use_fd == -1)
+        open_shards ();
+#endif
     return 0;
 }
 
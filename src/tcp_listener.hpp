@@ -30,6 +30,8 @@
 #ifndef __ZMQ_TCP_LISTENER_HPP_INCLUDED__
 #define __ZMQ_TCP_LISTENER_HPP_INCLUDED__
 
+#include <vector>
+
 #include "fd.hpp"
 #include "tcp_address.hpp"
 #include "stream_listener_base.hpp"
@@ -42,6 +44,7 @@ class tcp_listener_t ZMQ_FINAL : public stream_listener_base_t
     tcp_listener_t (zmq::io_thread_t *io_thread_,
                     zmq::socket_base_t *socket_,
                     const options_t &options_);
+    ~tcp_listener_t () ZMQ_FINAL;
 
     //  Set address to listen on.
     int set_local_address (const char *addr_);
@@ -51,6 +54,16 @@ class tcp_listener_t ZMQ_FINAL : public stream_listener_base_t
                                  socket_end_t socket_end_) const ZMQ_FINAL;
 
   private:
+    //  Creates a shard listening on fd_, which is bound to endpoint_.
+    tcp_listener_t (zmq::io_thread_t *io_thread_,
+                    zmq::socket_base_t *socket_,
+                    const options_t &options_,
+                    fd_t fd_,
+                    const std::string &endpoint_);
+
+    //  Handlers for incoming commands.
+    void process_plug () ZMQ_FINAL;
+
     //  Handlers for I/O events.
     void in_event () ZMQ_FINAL;
 
@@ -62,9 +75,29 @@ class tcp_listener_t ZMQ_FINAL : public stream_listener_base_t
 
     int create_socket (const char *addr_);
 
+    //  Opens a socket listening on addr_ into *s_. On failure, *s_ may
+    //  still hold a socket, which the caller has to close.
+    int open_socket (const char *addr_, tcp_address_t *address_, fd_t *s_);
+
+    //  Opens a socket on the bound port for each of the other eligible
+    //  I/O threads, for the kernel to spread the connections over.
+    void open_shards ();
+
     //  Address to listen on.
     tcp_address_t _address;
 
+    //  I/O thread the listener runs in.
+    zmq::io_thread_t *const _io_thread;
+
+    //  Sockets opened for the shards, launched once plugged.
+    struct shard_t
+    {
+        zmq::io_thread_t *io_thread;
+        fd_t fd;
+    };
+    typedef std::vector<shard_t> shards_t;
+    shards_t _shards;
+
     ZMQ_NON_COPYABLE_NOR_MOVABLE (tcp_listener_t)
 };
 }
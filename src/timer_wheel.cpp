@@ -0,0 +1,332 @@
+/*
+    Copyright (c) 2007-2016 Contributors as noted in the AUTHORS file
+
+    This file is part of libzmq, the ZeroMQ core engine in C++.
+
+    libzmq is free software; you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    As a special exception, the Contributors give you permission to link
+    this library with independent modules to produce an executable,
+    regardless of the license terms of these independent modules, and to
+    copy and distribute the resulting executable under terms of your choice,
+    provided that you also meet, for each linked independent module, the
+    terms and conditions of the license of that module. An independent
+    module is a module which is not derived from or based on this library.
+    If you modify this library, you must extend this exception to your
+    version of the library.
+
+    libzmq is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "precompiled.hpp"
+#include "timer_wheel.hpp"
+#include "i_poll_events.hpp"
+#include "err.hpp"
+
+#include <algorithm>
+
+//  Returns the index of the lowest bit set in word_, which must not be 0.
+static int lowest_bit (uint64_t word_)
+{
+#if defined __GNUC__
+    return __builtin_ctzll (word_);
+#else
+    int bit = 0;
+    while (!(word_ & 1)) {
+        word_ >>= 1;
+        ++bit;
+    }
+    return bit;
+#endif
+}
+
+zmq::timer_wheel_t::timer_wheel_t () : _free (-1), _count (0), _time (0)
+{
+    for (int i = 0; i != levels * slots + 2; ++i)
+        _heads[i] = _tails[i] = -1;
+    for (int i = 0; i != levels * slots / 64; ++i)
+        _occupied[i] = 0;
+}
+
+void zmq::timer_wheel_t::add (uint64_t now_,
+                              int timeout_,
+                              i_poll_events *sink_,
+                              int id_)
+{
+    //  When the wheel is empty, move it to the present, so that it does
+    //  not have to catch up on milliseconds with nothing to do.
+    if (_count == 0 && now_ > _time)
+        _time = now_;
+
+    //  Make sure the index stays at most half full.
+    if ((_count + 1) * 2 > _index.size ()) {
+        std::vector<int> old;
+        old.swap (_index);
+        _index.resize (old.empty () ? 16 : old.size () * 2, -1);
+        for (size_t i = 0; i != old.size (); ++i)
+            if (old[i] != -1)
+                index (old[i]);
+    }
+
+    int node = _free;
+    if (node != -1)
+        _free = _nodes[node].next;
+    else {
+        node = static_cast<int> (_nodes.size ());
+        _nodes.push_back (node_t ());
+    }
+    _nodes[node].sink = sink_;
+    _nodes[node].id = id_;
+    _nodes[node].expiration = now_ + timeout_;
+    link (node);
+    index (node);
+    _count++;
+}
+
+bool zmq::timer_wheel_t::cancel (i_poll_events *sink_, int id_)
+{
+    if (_count == 0)
+        return false;
+
+    const size_t mask = _index.size () - 1;
+    for (size_t i = hash (sink_, id_) & mask; _index[i] != -1;
+         i = (i + 1) & mask) {
+        const node_t &node = _nodes[_index[i]];
+        if (node.sink == sink_ && node.id == id_) {
+            remove (_index[i]);
+            return true;
+        }
+    }
+    return false;
+}
+
+uint64_t zmq::timer_wheel_t::execute (uint64_t current_)
+{
+    if (_count == 0)
+        return 0;
+
+    if (_heads[due_slot] != -1)
+        fire (due_slot);
+
+    while (_time <= current_) {
+        const int slot = static_cast<int> (_time & slot_mask);
+        if (slot == 0)
+            cascade (1);
+
+        //  Skip the empty slots, up to the end of level 0.
+        const int next = find_slot (0, slot);
+        if (next == -1) {
+            _time = std::min (_time + (slots - slot), current_ + 1);
+            continue;
+        }
+        if (_time + (next - slot) > current_) {
+            _time = current_ + 1;
+            break;
+        }
+        _time += next - slot + 1;
+        fire (next);
+    }
+
+    if (_count == 0)
+        return 0;
+
+    //  Find the earliest point in time at which a timer is due, or a slot
+    //  has to be cascaded. Slots of level 0 are processed every
+    //  millisecond, those of the higher levels once their span starts.
+    uint64_t next = _heads[due_slot] != -1 ? _time : 0;
+    for (int level = 0; level != levels; ++level) {
+        const int shift = level * slot_bits;
+        const uint64_t span = static_cast<uint64_t> (1) << shift;
+        const uint64_t start = (_time + span - 1) & ~(span - 1);
+        const int d =
+          distance (level, static_cast<int> ((start >> shift) & slot_mask));
+        if (d == -1)
+            continue;
+        const uint64_t due = start + (static_cast<uint64_t> (d) << shift);
+        if (next == 0 || due < next)
+            next = due;
+    }
+    zmq_assert (next > current_);
+    return next - current_;
+}
+
+size_t zmq::timer_wheel_t::hash (const i_poll_events *sink_, int id_)
+{
+    size_t h = reinterpret_cast<size_t> (sink_) ^ (id_ * 0x9e3779b9U);
+    h ^= h >> 16;
+    h *= 0x45d9f3bU;
+    h ^= h >> 16;
+    return h;
+}
+
+void zmq::timer_wheel_t::link (int node_)
+{
+    node_t &node = _nodes[node_];
+
+    //  Timers that are already due are fired by the next call to execute.
+    int slot = due_slot;
+    if (node.expiration >= _time) {
+        uint64_t expiration = node.expiration;
+        const uint64_t limit = static_cast<uint64_t> (1)
+                               << (levels * slot_bits);
+        if (expiration - _time >= limit)
+            expiration = _time + limit - 1;
+        int level = 0;
+        while (level != levels - 1
+               && expiration - _time
+                    >= static_cast<uint64_t> (1) << ((level + 1) * slot_bits))
+            ++level;
+        slot = level * slots
+               + static_cast<int> ((expiration >> (level * slot_bits))
+                                   & slot_mask);
+    }
+
+    node.slot = slot;
+    node.prev = _tails[slot];
+    node.next = -1;
+    if (node.prev != -1)
+        _nodes[node.prev].next = node_;
+    else
+        _heads[slot] = node_;
+    _tails[slot] = node_;
+    if (slot < levels * slots)
+        _occupied[slot / 64] |= static_cast<uint64_t> (1) << (slot % 64);
+}
+
+void zmq::timer_wheel_t::unlink (int node_)
+{
+    const node_t &node = _nodes[node_];
+    if (node.prev != -1)
+        _nodes[node.prev].next = node.next;
+    else
+        _heads[node.slot] = node.next;
+    if (node.next != -1)
+        _nodes[node.next].prev = node.prev;
+    else
+        _tails[node.slot] = node.prev;
+    if (_heads[node.slot] == -1 && node.slot < levels * slots)
+        _occupied[node.slot / 64] &=
+          ~(static_cast<uint64_t> (1) << (node.slot % 64));
+}
+
+int zmq::timer_wheel_t::detach (int slot_)
+{
+    const int head = _heads[slot_];
+    _heads[slot_] = _tails[slot_] = -1;
+    if (slot_ < levels * slots)
+        _occupied[slot_ / 64] &=
+          ~(static_cast<uint64_t> (1) << (slot_ % 64));
+    return head;
+}
+
+void zmq::timer_wheel_t::cascade (int level_)
+{
+    const int shift = level_ * slot_bits;
+    const int index = static_cast<int> ((_time >> shift) & slot_mask);
+    const int slot = level_ * slots + index;
+
+    int node = detach (slot);
+    while (node != -1) {
+        const int next = _nodes[node].next;
+        link (node);
+        node = next;
+    }
+
+    //  The next level is due whenever this one wraps around.
+    if (index == 0 && level_ + 1 != levels)
+        cascade (level_ + 1);
+}
+
+void zmq::timer_wheel_t::fire (int slot_)
+{
+    //  Move the timers to the firing list first, so that the callbacks may
+    //  add timers to the slot or cancel any of the timers.
+    const int tail = _tails[slot_];
+    int node = detach (slot_);
+    _heads[firing_slot] = node;
+    _tails[firing_slot] = tail;
+    for (; node != -1; node = _nodes[node].next)
+        _nodes[node].slot = firing_slot;
+
+    while ((node = _heads[firing_slot]) != -1) {
+        i_poll_events *const sink = _nodes[node].sink;
+        const int id = _nodes[node].id;
+        remove (node);
+        sink->timer_event (id);
+    }
+}
+
+void zmq::timer_wheel_t::remove (int node_)
+{
+    unlink (node_);
+    unindex (node_);
+    _nodes[node_].slot = -1;
+    _nodes[node_].next = _free;
+    _free = node_;
+    _count--;
+}
+
+void zmq::timer_wheel_t::index (int node_)
+{
+    const size_t mask = _index.size () - 1;
+    size_t i = hash (_nodes[node_].sink, _nodes[node_].id) & mask;
+    while (_index[i] != -1)
+        i = (i + 1) & mask;
+    _index[i] = node_;
+}
+
+void zmq::timer_wheel_t::unindex (int node_)
+{
+    const size_t mask = _index.size () - 1;
+    size_t i = hash (_nodes[node_].sink, _nodes[node_].id) & mask;
+    while (_index[i] != node_)
+        i = (i + 1) & mask;
+
+    //  Shift back the entries following the removed one that would not
+    //  be found anymore otherwise.
+    size_t j = i;
+    while (true) {
+        j = (j + 1) & mask;
+        if (_index[j] == -1)
+            break;
+        const node_t &node = _nodes[_index[j]];
+        const size_t home = hash (node.sink, node.id) & mask;
+        const bool stays = i <= j ? (i < home && home <= j)
+                                  : (i < home || home <= j);
+        if (!stays) {
+            _index[i] = _index[j];
+            i = j;
+        }
+    }
+    _index[i] = -1;
+}
+
+int zmq::timer_wheel_t::find_slot (int level_, int from_) const
+{
+    const int end = (level_ + 1) * slots;
+    for (int slot = level_ * slots + from_; slot < end;) {
+        const uint64_t word = _occupied[slot / 64] >> (slot % 64);
+        if (word)
+            return slot + lowest_bit (word) - level_ * slots;
+        slot = (slot / 64 + 1) * 64;
+    }
+    return -1;
+}
+
+int zmq::timer_wheel_t::distance (int level_, int from_) const
+{
+    int slot = find_slot (level_, from_);
+    if (slot != -1)
+        return slot - from_;
+    slot = find_slot (level_, 0);
+    return slot != -1 ? slot + slots - from_ : -1;
+}
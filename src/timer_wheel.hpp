@@ -0,0 +1,158 @@
+/*
+    Copyright (c) 2007-2016 Contributors as noted in the AUTHORS file
+
+    This file is part of libzmq, the ZeroMQ core engine in C++.
+
+    libzmq is free software; you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    As a special exception, the Contributors give you permission to link
+    this library with independent modules to produce an executable,
+    regardless of the license terms of these independent modules, and to
+    copy and distribute the resulting executable under terms of your choice,
+    provided that you also meet, for each linked independent module, the
+    terms and conditions of the license of that module. An independent
+    module is a module which is not derived from or based on this library.
+    If you modify this library, you must extend this exception to your
+    version of the library.
+
+    libzmq is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __ZMQ_TIMER_WHEEL_HPP_INCLUDED__
+#define __ZMQ_TIMER_WHEEL_HPP_INCLUDED__
+
+#include <stddef.h>
+#include <vector>
+
+#include "macros.hpp"
+#include "stdint.hpp"
+
+namespace zmq
+{
+struct i_poll_events;
+
+//  Hierarchical timing wheel holding the timers of a poller, with a
+//  resolution of one millisecond. Adding and cancelling a timer take
+//  constant time; timers are kept in a pool of nodes that is reused, so
+//  no memory is allocated per timer once the pool has grown.
+//
+//  The wheel has 4 levels of 256 slots each. A timer expiring less than
+//  256 ms ahead goes to the slot of its millisecond in level 0. Timers
+//  further ahead go to level 1, 2 or 3, whose slots span 256^1, 256^2 and
+//  256^3 ms, and are moved down a level ("cascaded") when the wheel
+//  reaches the start of their slot. A pointer-keyed hash index finds the
+//  timer to cancel.
+class timer_wheel_t
+{
+  public:
+    timer_wheel_t ();
+
+    //  Adds a timer expiring timeout_ ms after now_. The first call to
+    //  execute at or after the expiration calls timer_event on sink_ with
+    //  argument set to id_.
+    void add (uint64_t now_, int timeout_, i_poll_events *sink_, int id_);
+
+    //  Cancels a timer added by sink_ with ID equal to id_. If there are
+    //  several such timers, one of them is cancelled. Returns false if
+    //  there is no such timer.
+    bool cancel (i_poll_events *sink_, int id_);
+
+    //  Executes the timers that are due at current_. Returns the number
+    //  of milliseconds to wait before calling it again, or 0 if there
+    //  are no timers. The wait may end before the next timer is due, if
+    //  timers have to be cascaded first.
+    uint64_t execute (uint64_t current_);
+
+    bool empty () const { return _count == 0; }
+
+  private:
+    enum
+    {
+        slot_bits = 8,
+        slots = 1 << slot_bits,
+        slot_mask = slots - 1,
+        levels = 4,
+        //  Index of the list of timers added when already due.
+        due_slot = levels * slots,
+        //  Index of the list timers are moved to while they are fired.
+        firing_slot = levels * slots + 1
+    };
+
+    struct node_t
+    {
+        i_poll_events *sink;
+        int id;
+        uint64_t expiration;
+        //  Neighbours in the list of the slot, or in the free list.
+        int prev;
+        int next;
+        //  Slot holding the node, or -1 if the node is free.
+        int slot;
+    };
+
+    static size_t hash (const i_poll_events *sink_, int id_);
+
+    //  Puts the node into the slot matching its expiration.
+    void link (int node_);
+    void unlink (int node_);
+
+    //  Empties the list of slot_ and returns its former head.
+    int detach (int slot_);
+
+    //  Moves the nodes of the current slot of level_ to lower levels.
+    void cascade (int level_);
+
+    //  Fires the timers in slot_.
+    void fire (int slot_);
+
+    //  Unlinks the node, drops it from the index and frees it.
+    void remove (int node_);
+
+    void index (int node_);
+    void unindex (int node_);
+
+    //  Returns the first occupied slot of level_ at or after from_, or -1.
+    int find_slot (int level_, int from_) const;
+
+    //  Returns the number of slots from from_ to the first occupied slot
+    //  of level_, wrapping around, or -1 if level_ is empty.
+    int distance (int level_, int from_) const;
+
+    //  Pool of timer nodes and head of the list of free ones.
+    std::vector<node_t> _nodes;
+    int _free;
+
+    //  Heads and tails of the lists of timers in each slot, followed by
+    //  the due and firing lists. Timers are appended, so that those in the
+    //  same slot fire in the order they were added.
+    int _heads[levels * slots + 2];
+    int _tails[levels * slots + 2];
+
+    //  One bit per slot, set if the slot holds timers.
+    uint64_t _occupied[levels * slots / 64];
+
+    //  Open-addressing hash table of nodes, keyed by sink and ID, with
+    //  linear probing. Its size is a power of 2, and -1 marks empty
+    //  entries.
+    std::vector<int> _index;
+
+    //  Number of timers in the wheel.
+    size_t _count;
+
+    //  Next millisecond to be processed.
+    uint64_t _time;
+
+    ZMQ_NON_COPYABLE_NOR_MOVABLE (timer_wheel_t)
+};
+}
+
+#endif
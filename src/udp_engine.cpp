@@ -64,6 +64,11 @@ zmq::udp_engine_t::udp_engine_t (const options_t &options_) :
     _options (options_),
     _send_enabled (false),
     _recv_enabled (false)
+#ifdef ZMQ_HAVE_UDP_BATCH
+    ,
+    _in_next (0),
+    _in_count (0)
+#endif
 {
 }
 
@@ -207,6 +212,11 @@ void zmq::udp_engine_t::plug (io_thread_t *io_thread_, session_base_t *session_)
     if (rc != 0) {
         error (protocol_error);
     } else {
+#ifdef ZMQ_HAVE_UDP_BATCH
+        if (_options.udp_batch_size > 1)
+            init_batch ();
+#endif
+
         if (_send_enabled) {
             set_pollout (_handle);
         }
@@ -389,9 +399,11 @@ void zmq::udp_engine_t::sockaddr_to_msg (zmq::msg_t *msg_,
     *address = 0;
 }
 
-int zmq::udp_engine_t::resolve_raw_address (const char *name_, size_t length_)
+int zmq::udp_engine_t::resolve_raw_address (const char *name_,
+                                             size_t length_,
+                                             sockaddr_in *raw_address_)
 {
-    memset (&_raw_address, 0, sizeof _raw_address);
+    memset (raw_address_, 0, sizeof (sockaddr_in));
 
     const char *delimiter = NULL;
 
@@ -422,11 +434,11 @@ int zmq::udp_engine_t::resolve_raw_address (const char *name_, size_t length_)
         return -1;
     }
 
-    _raw_address.sin_family = AF_INET;
-    _raw_address.sin_port = htons (port);
-    _raw_address.sin_addr.s_addr = inet_addr (addr_str.c_str ());
+    raw_address_->sin_family = AF_INET;
+    raw_address_->sin_port = htons (port);
+    raw_address_->sin_addr.s_addr = inet_addr (addr_str.c_str ());
 
-    if (_raw_address.sin_addr.s_addr == INADDR_NONE) {
+    if (raw_address_->sin_addr.s_addr == INADDR_NONE) {
         errno = EINVAL;
         return -1;
     }
@@ -436,6 +448,13 @@ int zmq::udp_engine_t::resolve_raw_address (const char *name_, size_t length_)
 
 void zmq::udp_engine_t::out_event ()
 {
+#ifdef ZMQ_HAVE_UDP_BATCH
+    if (_options.udp_batch_size > 1) {
+        out_event_batch ();
+        return;
+    }
+#endif
+
     msg_t group_msg;
     int rc = _session->pull_msg (&group_msg);
     errno_assert (rc == 0 || (rc == -1 && errno == EAGAIN));
@@ -452,7 +471,7 @@ void zmq::udp_engine_t::out_event ()
 
         if (_options.raw_socket) {
             rc = resolve_raw_address (static_cast<char *> (group_msg.data ()),
-                                      group_size);
+                                      group_size, &_raw_address);
 
             //  We discard the message if address is not valid
             if (rc != 0) {
@@ -530,6 +549,13 @@ void zmq::udp_engine_t::restart_output ()
 
 void zmq::udp_engine_t::in_event ()
 {
+#ifdef ZMQ_HAVE_UDP_BATCH
+    if (_options.udp_batch_size > 1) {
+        in_event_batch ();
+        return;
+    }
+#endif
+
     sockaddr_storage in_address;
     zmq_socklen_t in_addrlen =
       static_cast<zmq_socklen_t> (sizeof (sockaddr_storage));
@@ -553,33 +579,41 @@ void zmq::udp_engine_t::in_event ()
         return;
     }
 
+    if (push_datagram (_in_buffer, nbytes, &in_address))
+        _session->flush ();
+}
+
+bool zmq::udp_engine_t::push_datagram (const char *buffer_,
+                                       int nbytes_,
+                                       const sockaddr_storage *address_)
+{
     int rc;
     int body_size;
     int body_offset;
     msg_t msg;
 
     if (_options.raw_socket) {
-        zmq_assert (in_address.ss_family == AF_INET);
-        sockaddr_to_msg (&msg, reinterpret_cast<sockaddr_in *> (&in_address));
+        zmq_assert (address_->ss_family == AF_INET);
+        sockaddr_to_msg (&msg, reinterpret_cast<const sockaddr_in *> (address_));
 
-        body_size = nbytes;
+        body_size = nbytes_;
         body_offset = 0;
     } else {
         // TODO in out_event, the group size is an *unsigned* char. what is
         // the maximum value?
-        const char *group_buffer = _in_buffer + 1;
-        const int group_size = _in_buffer[0];
+        const char *group_buffer = buffer_ + 1;
+        const int group_size = buffer_[0];
+
+        //  This doesn't fit, just ingore
+        if (nbytes_ - 1 < group_size)
+            return true;
 
         rc = msg.init_size (group_size);
         errno_assert (rc == 0);
         msg.set_flags (msg_t::more);
         memcpy (msg.data (), group_buffer, group_size);
 
-        //  This doesn't fit, just ingore
-        if (nbytes - 1 < group_size)
-            return;
-
-        body_size = nbytes - 1 - group_size;
+        body_size = nbytes_ - 1 - group_size;
         body_offset = 1 + group_size;
     }
     // Push group description to session
@@ -592,14 +626,14 @@ void zmq::udp_engine_t::in_event ()
         errno_assert (rc == 0);
 
         reset_pollin (_handle);
-        return;
+        return false;
     }
 
     rc = msg.close ();
     errno_assert (rc == 0);
     rc = msg.init_size (body_size);
     errno_assert (rc == 0);
-    memcpy (msg.data (), _in_buffer + body_offset, body_size);
+    memcpy (msg.data (), buffer_ + body_offset, body_size);
 
     // Push message body to session
     rc = _session->push_msg (&msg);
@@ -608,16 +642,172 @@ void zmq::udp_engine_t::in_event ()
         rc = msg.close ();
         errno_assert (rc == 0);
 
+        //  Drop the group frame already written, so that the datagrams
+        //  pushed before this one can still be flushed.
+        _session->rollback ();
         _session->reset ();
         reset_pollin (_handle);
-        return;
+        return false;
     }
 
     rc = msg.close ();
     errno_assert (rc == 0);
+    return true;
+}
+
+#ifdef ZMQ_HAVE_UDP_BATCH
+void zmq::udp_engine_t::init_batch ()
+{
+    const size_t batch_size = static_cast<size_t> (_options.udp_batch_size);
+
+    if (_recv_enabled) {
+        _in_headers.resize (batch_size);
+        _in_datagrams.resize (batch_size);
+        memset (&_in_headers[0], 0, batch_size * sizeof (mmsghdr));
+        for (size_t i = 0; i != batch_size; i++) {
+            in_datagram_t &datagram = _in_datagrams[i];
+            datagram.iov.iov_base = datagram.buffer;
+            datagram.iov.iov_len = MAX_UDP_MSG;
+            _in_headers[i].msg_hdr.msg_name = &datagram.address;
+            _in_headers[i].msg_hdr.msg_iov = &datagram.iov;
+            _in_headers[i].msg_hdr.msg_iovlen = 1;
+        }
+    }
+
+    if (_send_enabled) {
+        _out_headers.resize (batch_size);
+        _out_datagrams.resize (batch_size);
+        memset (&_out_headers[0], 0, batch_size * sizeof (mmsghdr));
+        for (size_t i = 0; i != batch_size; i++)
+            _out_headers[i].msg_hdr.msg_iov = _out_datagrams[i].iov;
+    }
+}
+
+void zmq::udp_engine_t::in_event_batch ()
+{
+    //  The kernel has already handed over the whole batch, so datagrams
+    //  the session had no room for are kept until it has, and no more
+    //  are received before they are gone.
+    if (_in_next == _in_count) {
+        const unsigned int batch_size =
+          static_cast<unsigned int> (_in_headers.size ());
+        for (unsigned int i = 0; i != batch_size; i++)
+            _in_headers[i].msg_hdr.msg_namelen =
+              static_cast<socklen_t> (sizeof (sockaddr_storage));
+
+        const int count =
+          recvmmsg (_fd, &_in_headers[0], batch_size, 0, NULL);
+
+        if (count < 0) {
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+                assert_success_or_recoverable (_fd, count);
+                error (connection_error);
+            }
+            return;
+        }
+        _in_next = 0;
+        _in_count = static_cast<unsigned int> (count);
+    }
+
+    for (; _in_next != _in_count; _in_next++) {
+        if (!push_datagram (_in_datagrams[_in_next].buffer,
+                            static_cast<int> (_in_headers[_in_next].msg_len),
+                            &_in_datagrams[_in_next].address))
+            break;
+    }
     _session->flush ();
 }
 
+void zmq::udp_engine_t::out_event_batch ()
+{
+    const unsigned int batch_size =
+      static_cast<unsigned int> (_out_headers.size ());
+
+    //  Collect the messages to send. The iovecs refer straight to the
+    //  message data, so the messages are kept open until the whole batch
+    //  was handed to the kernel.
+    unsigned int count = 0;
+    while (count != batch_size) {
+        out_datagram_t &datagram = _out_datagrams[count];
+        msghdr &header = _out_headers[count].msg_hdr;
+
+        int rc = _session->pull_msg (&datagram.group);
+        errno_assert (rc == 0 || (rc == -1 && errno == EAGAIN));
+        if (rc != 0)
+            break;
+
+        rc = _session->pull_msg (&datagram.body);
+        //  If there's a group, there should also be a body
+        errno_assert (rc == 0);
+
+        if (_options.raw_socket) {
+            rc = resolve_raw_address (
+              static_cast<char *> (datagram.group.data ()),
+              datagram.group.size (), &datagram.raw_address);
+
+            //  We discard the message if address is not valid
+            if (rc != 0) {
+                rc = datagram.group.close ();
+                errno_assert (rc == 0);
+                rc = datagram.body.close ();
+                errno_assert (rc == 0);
+                continue;
+            }
+
+            datagram.iov[0].iov_base = datagram.body.data ();
+            datagram.iov[0].iov_len = datagram.body.size ();
+            header.msg_iovlen = 1;
+            header.msg_name = &datagram.raw_address;
+            header.msg_namelen = static_cast<socklen_t> (sizeof (sockaddr_in));
+        } else {
+            datagram.group_size =
+              static_cast<unsigned char> (datagram.group.size ());
+            datagram.iov[0].iov_base = &datagram.group_size;
+            datagram.iov[0].iov_len = 1;
+            datagram.iov[1].iov_base = datagram.group.data ();
+            datagram.iov[1].iov_len = datagram.group.size ();
+            datagram.iov[2].iov_base = datagram.body.data ();
+            datagram.iov[2].iov_len = datagram.body.size ();
+            header.msg_iovlen = 3;
+            header.msg_name = const_cast<sockaddr *> (_out_address);
+            header.msg_namelen = _out_address_len;
+        }
+        count++;
+    }
+
+    if (count == 0) {
+        reset_pollout (_handle);
+        return;
+    }
+
+    //  Datagrams the kernel cannot take right now are dropped, just like
+    //  in the non-batched case.
+    bool failed = false;
+    unsigned int sent = 0;
+    while (sent != count) {
+        const int rc = sendmmsg (_fd, &_out_headers[sent], count - sent, 0);
+        if (rc < 0) {
+            if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+                assert_success_or_recoverable (_fd, rc);
+                failed = true;
+            }
+            break;
+        }
+        sent += static_cast<unsigned int> (rc);
+    }
+
+    for (unsigned int i = 0; i != count; i++) {
+        int rc = _out_datagrams[i].group.close ();
+        errno_assert (rc == 0);
+        rc = _out_datagrams[i].body.close ();
+        errno_assert (rc == 0);
+    }
+
+    if (failed)
+        error (connection_error);
+}
+#endif
+
 bool zmq::udp_engine_t::restart_input ()
 {
     if (_recv_enabled) {
@@ -2,6 +2,8 @@
 #ifndef __ZMQ_UDP_ENGINE_HPP_INCLUDED__
 #define __ZMQ_UDP_ENGINE_HPP_INCLUDED__
 
+#include <vector>
+
 #include "io_object.hpp"
 #include "i_engine.hpp"
 #include "address.hpp"
@@ -9,6 +11,12 @@
 
 #define MAX_UDP_MSG 8192
 
+#if defined HAVE_RECVMMSG && defined HAVE_SENDMMSG
+#define ZMQ_HAVE_UDP_BATCH
+#include <sys/socket.h>
+#include <sys/uio.h>
+#endif
+
 namespace zmq
 {
 class io_thread_t;
@@ -45,9 +53,13 @@ class udp_engine_t ZMQ_FINAL : public io_object_t, public i_engine
     void out_event () ZMQ_FINAL;
 
     const endpoint_uri_pair_t &get_endpoint () const ZMQ_FINAL;
+    bool migrate_out () ZMQ_FINAL { return false; }
+    void migrate_in (zmq::io_thread_t *) ZMQ_FINAL {}
 
   private:
-    int resolve_raw_address (const char *name_, size_t length_);
+    static int resolve_raw_address (const char *name_,
+                                    size_t length_,
+                                    sockaddr_in *raw_address_);
     static void sockaddr_to_msg (zmq::msg_t *msg_, const sockaddr_in *addr_);
 
     static int set_udp_reuse_address (fd_t s_, bool on_);
@@ -66,6 +78,52 @@ class udp_engine_t ZMQ_FINAL : public io_object_t, public i_engine
     //  Function to handle network issues.
     void error (error_reason_t reason_);
 
+    //  Pushes the group and body of one received datagram to the session.
+    //  Returns false if the session cannot accept any more messages.
+    bool push_datagram (const char *buffer_,
+                        int nbytes_,
+                        const sockaddr_storage *address_);
+
+#ifdef ZMQ_HAVE_UDP_BATCH
+    //  Allocates the buffers used to receive and send datagrams in
+    //  batches of up to udp_batch_size.
+    void init_batch ();
+
+    //  Variants of in_event/out_event moving a whole batch of datagrams
+    //  with a single recvmmsg/sendmmsg system call.
+    void in_event_batch ();
+    void out_event_batch ();
+
+    struct in_datagram_t
+    {
+        sockaddr_storage address;
+        iovec iov;
+        char buffer[MAX_UDP_MSG];
+    };
+
+    struct out_datagram_t
+    {
+        msg_t group;
+        msg_t body;
+        unsigned char group_size;
+        sockaddr_in raw_address;
+        iovec iov[3];
+    };
+
+    //  The header arrays are passed to the kernel as they are, each header
+    //  referring to the datagram with the same index.
+    std::vector<mmsghdr> _in_headers;
+    std::vector<in_datagram_t> _in_datagrams;
+    std::vector<mmsghdr> _out_headers;
+    std::vector<out_datagram_t> _out_datagrams;
+
+    //  Index of the next received datagram to push to the session, and the
+    //  number of datagrams the last recvmmsg call returned. Those the
+    //  session could not take yet are pushed by restart_input.
+    unsigned int _in_next;
+    unsigned int _in_count;
+#endif
+
     const endpoint_uri_pair_t _empty_endpoint;
 
     bool _plugged;
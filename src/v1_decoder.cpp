@@ -39,8 +39,10 @@
 #include "wire.hpp"
 #include "err.hpp"
 
-zmq::v1_decoder_t::v1_decoder_t (size_t bufsize_, int64_t maxmsgsize_) :
-    decoder_base_t<v1_decoder_t> (bufsize_),
+zmq::v1_decoder_t::v1_decoder_t (size_t bufsize_,
+                                 int64_t maxmsgsize_,
+                                 allocator_t *allocator_) :
+    decoder_base_t<v1_decoder_t> (bufsize_, allocator_),
     _max_msg_size (maxmsgsize_)
 {
     int rc = _in_progress.init ();
@@ -78,7 +80,8 @@ int zmq::v1_decoder_t::one_byte_size_ready (unsigned char const *)
 
         int rc = _in_progress.close ();
         assert (rc == 0);
-        rc = _in_progress.init_size (*_tmpbuf - 1);
+        rc = _in_progress.init_size (*_tmpbuf - 1,
+                                     get_allocator ().allocator ());
         if (rc != 0) {
             errno_assert (errno == ENOMEM);
             rc = _in_progress.init ();
@@ -123,7 +126,7 @@ int zmq::v1_decoder_t::eight_byte_size_ready (unsigned char const *)
 
     int rc = _in_progress.close ();
     assert (rc == 0);
-    rc = _in_progress.init_size (msg_size);
+    rc = _in_progress.init_size (msg_size, get_allocator ().allocator ());
     if (rc != 0) {
         errno_assert (errno == ENOMEM);
         rc = _in_progress.init ();
@@ -39,7 +39,9 @@ namespace zmq
 class v1_decoder_t ZMQ_FINAL : public decoder_base_t<v1_decoder_t>
 {
   public:
-    v1_decoder_t (size_t bufsize_, int64_t maxmsgsize_);
+    v1_decoder_t (size_t bufsize_,
+                  int64_t maxmsgsize_,
+                  allocator_t *allocator_);
     ~v1_decoder_t () ZMQ_FINAL;
 
     msg_t *msg () ZMQ_FINAL { return &_in_progress; }
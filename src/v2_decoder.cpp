@@ -40,8 +40,10 @@
 
 zmq::v2_decoder_t::v2_decoder_t (size_t bufsize_,
                                  int64_t maxmsgsize_,
-                                 bool zero_copy_) :
-    decoder_base_t<v2_decoder_t, shared_message_memory_allocator> (bufsize_),
+                                 bool zero_copy_,
+                                 allocator_t *allocator_) :
+    decoder_base_t<v2_decoder_t, shared_message_memory_allocator> (bufsize_,
+                                                                   allocator_),
     _msg_flags (0),
     _zero_copy (zero_copy_),
     _max_msg_size (maxmsgsize_)
@@ -114,12 +116,13 @@ int zmq::v2_decoder_t::size_ready (uint64_t msg_size_,
     // data into a new message and complete it in the next receive.
 
     shared_message_memory_allocator &allocator = get_allocator ();
-    if (unlikely (!_zero_copy
+    if (unlikely (!_zero_copy || !allocator.buffer ()
                   || msg_size_ > static_cast<size_t> (
                        allocator.data () + allocator.size () - read_pos_))) {
         // a new message has started, but the size would exceed the pre-allocated arena
         // this happens every time when a message does not fit completely into the buffer
-        rc = _in_progress.init_size (static_cast<size_t> (msg_size_));
+        rc = _in_progress.init_size (static_cast<size_t> (msg_size_),
+                                     allocator.allocator ());
     } else {
         // construct message using n bytes from the buffer as storage
         // increase buffer ref count
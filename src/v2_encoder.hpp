@@ -39,7 +39,7 @@ namespace zmq
 class v2_encoder_t ZMQ_FINAL : public encoder_base_t<v2_encoder_t>
 {
   public:
-    v2_encoder_t (size_t bufsize_);
+    v2_encoder_t (size_t bufsize_, allocator_t *allocator_);
     ~v2_encoder_t () ZMQ_FINAL;
 
   private:
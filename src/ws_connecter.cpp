@@ -265,8 +265,9 @@ zmq::fd_t zmq::ws_connecter_t::connect ()
 
 bool zmq::ws_connecter_t::tune_socket (const fd_t fd_)
 {
-    const int rc =
-      tune_tcp_socket (fd_) | tune_tcp_maxrt (fd_, options.tcp_maxrt);
+    const int rc = tune_tcp_socket (fd_)
+                   | tune_tcp_maxrt (fd_, options.tcp_maxrt)
+                   | tune_tcp_busy_poll (fd_, options.tcp_busy_poll);
     return rc == 0;
 }
 
@@ -34,6 +34,7 @@
 
 #include "ws_protocol.hpp"
 #include "ws_decoder.hpp"
+#include "ws_mask.hpp"
 #include "likely.hpp"
 #include "wire.hpp"
 #include "err.hpp"
@@ -41,8 +42,10 @@
 zmq::ws_decoder_t::ws_decoder_t (size_t bufsize_,
                                  int64_t maxmsgsize_,
                                  bool zero_copy_,
-                                 bool must_mask_) :
-    decoder_base_t<ws_decoder_t, shared_message_memory_allocator> (bufsize_),
+                                 bool must_mask_,
+                                 allocator_t *allocator_) :
+    decoder_base_t<ws_decoder_t, shared_message_memory_allocator> (bufsize_,
+                                                                   allocator_),
     _msg_flags (0),
     _zero_copy (zero_copy_),
     _max_msg_size (maxmsgsize_),
@@ -212,12 +215,13 @@ int zmq::ws_decoder_t::size_ready (unsigned char const *read_pos_)
     // data into a new message and complete it in the next receive.
 
     shared_message_memory_allocator &allocator = get_allocator ();
-    if (unlikely (!_zero_copy
+    if (unlikely (!_zero_copy || !allocator.buffer ()
                   || _size > static_cast<size_t> (
                        allocator.data () + allocator.size () - read_pos_))) {
         // a new message has started, but the size would exceed the pre-allocated arena
         // this happens every time when a message does not fit completely into the buffer
-        rc = _in_progress.init_size (static_cast<size_t> (_size));
+        rc = _in_progress.init_size (static_cast<size_t> (_size),
+                                     allocator.allocator ());
     } else {
         // construct message using n bytes from the buffer as storage
         // increase buffer ref count
@@ -258,12 +262,14 @@ int zmq::ws_decoder_t::size_ready (unsigned char const *read_pos_)
 int zmq::ws_decoder_t::message_ready (unsigned char const *)
 {
     if (_must_mask) {
-        int mask_index = _opcode == ws_protocol_t::opcode_binary ? 1 : 0;
+        //  Unmask in place, in the message or in the decoder buffer the
+        //  message refers to. Binary frames start with the flags byte.
+        const size_t mask_index =
+          _opcode == ws_protocol_t::opcode_binary ? 1 : 0;
 
         unsigned char *data =
           static_cast<unsigned char *> (_in_progress.data ());
-        for (size_t i = 0; i < _size; ++i, mask_index++)
-            data[i] = data[i] ^ _mask[mask_index % 4];
+        ws_mask (data, data, _size, _mask, mask_index);
     }
 
     //  Message is completely read. Signal this to the caller
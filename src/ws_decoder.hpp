@@ -46,7 +46,8 @@ class ws_decoder_t ZMQ_FINAL
     ws_decoder_t (size_t bufsize_,
                   int64_t maxmsgsize_,
                   bool zero_copy_,
-                  bool must_mask_);
+                  bool must_mask_,
+                  allocator_t *allocator_);
     ~ws_decoder_t () ZMQ_FINAL;
 
     //  i_decoder interface.
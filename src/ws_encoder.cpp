@@ -30,6 +30,7 @@
 #include "precompiled.hpp"
 #include "ws_protocol.hpp"
 #include "ws_encoder.hpp"
+#include "ws_mask.hpp"
 #include "msg.hpp"
 #include "likely.hpp"
 #include "wire.hpp"
@@ -37,8 +38,10 @@
 
 #include <limits.h>
 
-zmq::ws_encoder_t::ws_encoder_t (size_t bufsize_, bool must_mask_) :
-    encoder_base_t<ws_encoder_t> (bufsize_),
+zmq::ws_encoder_t::ws_encoder_t (size_t bufsize_,
+                                 bool must_mask_,
+                                 allocator_t *allocator_) :
+    encoder_base_t<ws_encoder_t> (bufsize_, allocator_),
     _must_mask (must_mask_)
 {
     //  Write 0 bytes to the batch and go to message_ready state.
@@ -107,22 +110,28 @@ void zmq::ws_encoder_t::size_ready ()
 {
     if (_must_mask) {
         assert (in_progress () != &_masked_msg);
-        const size_t size = in_progress ()->size ();
-
-        _masked_msg.close ();
-        _masked_msg.init_size (size);
-
-        int mask_index = 1; // TODO: check if binary message
-        unsigned char *dest =
-          static_cast<unsigned char *> (_masked_msg.data ());
-        unsigned char *src =
-          static_cast<unsigned char *> (in_progress ()->data ());
-        for (size_t i = 0, size = in_progress ()->size (); i < size;
-             ++i, mask_index++)
-            dest[i] = src[i] ^ _mask[mask_index % 4];
-
-        next_step (_masked_msg.data (), _masked_msg.size (),
-                   &ws_encoder_t::message_ready, true);
+        msg_t *const msg = in_progress ();
+        unsigned char *const src = static_cast<unsigned char *> (msg->data ());
+        const size_t size = msg->size ();
+
+        //  The payload is masked from the second key byte on, as the
+        //  flags byte took the first one.
+        // TODO: check if binary message
+        if (msg->is_library_owned () && !(msg->flags () & msg_t::shared)) {
+            //  Nobody else sees this buffer, so mask it in place.
+            ws_mask (src, src, size, _mask, 1);
+            next_step (src, size, &ws_encoder_t::message_ready, true);
+        } else {
+            //  Constant, application-owned (zmq_msg_init_data with or
+            //  without a free function) or shared data is masked into
+            //  a copy instead.
+            _masked_msg.close ();
+            _masked_msg.init_size (size);
+            ws_mask (static_cast<unsigned char *> (_masked_msg.data ()), src,
+                     size, _mask, 1);
+            next_step (_masked_msg.data (), _masked_msg.size (),
+                       &ws_encoder_t::message_ready, true);
+        }
     } else {
         next_step (in_progress ()->data (), in_progress ()->size (),
                    &ws_encoder_t::message_ready, true);
@@ -39,9 +39,15 @@ namespace zmq
 class ws_encoder_t ZMQ_FINAL : public encoder_base_t<ws_encoder_t>
 {
   public:
-    ws_encoder_t (size_t bufsize_, bool must_mask_);
+    ws_encoder_t (size_t bufsize_, bool must_mask_, allocator_t *allocator_);
     ~ws_encoder_t () ZMQ_FINAL;
 
+#if defined ZMQ_HAVE_UIO
+    //  Payloads which cannot be masked in place are written from
+    //  _masked_msg, which is reused for the next message.
+    bool supports_gather () const ZMQ_FINAL { return false; }
+#endif
+
   private:
     void size_ready ();
     void message_ready ();
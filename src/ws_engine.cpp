@@ -290,13 +290,13 @@ bool zmq::ws_engine_t::handshake ()
         complete = server_handshake ();
 
     if (complete) {
-        _encoder =
-          new (std::nothrow) ws_encoder_t (_options.out_batch_size, _client);
+        _encoder = new (std::nothrow)
+          ws_encoder_t (_options.out_batch_size, _client, _options.allocator);
         alloc_assert (_encoder);
 
         _decoder = new (std::nothrow)
           ws_decoder_t (_options.in_batch_size, _options.maxmsgsize,
-                        _options.zero_copy, !_client);
+                        _options.zero_copy, !_client, _options.allocator);
         alloc_assert (_decoder);
 
         socket ()->event_handshake_succeeded (_endpoint_uri_pair, 0);
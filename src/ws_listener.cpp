@@ -111,6 +111,7 @@ void zmq::ws_listener_t::in_event ()
 
     int rc = tune_tcp_socket (fd);
     rc = rc | tune_tcp_maxrt (fd, options.tcp_maxrt);
+    rc = rc | tune_tcp_busy_poll (fd, options.tcp_busy_poll);
     if (rc != 0) {
         _socket->event_accept_failed (
           make_unconnected_bind_endpoint_pair (_endpoint), zmq_errno ());
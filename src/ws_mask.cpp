@@ -0,0 +1,106 @@
+/*
+    Copyright (c) 2007-2016 Contributors as noted in the AUTHORS file
+
+    This file is part of libzmq, the ZeroMQ core engine in C++.
+
+    libzmq is free software; you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    As a special exception, the Contributors give you permission to link
+    this library with independent modules to produce an executable,
+    regardless of the license terms of these independent modules, and to
+    copy and distribute the resulting executable under terms of your choice,
+    provided that you also meet, for each linked independent module, the
+    terms and conditions of the license of that module. An independent
+    module is a module which is not derived from or based on this library.
+    If you modify this library, you must extend this exception to your
+    version of the library.
+
+    libzmq is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "precompiled.hpp"
+#include "ws_mask.hpp"
+#include "stdint.hpp"
+
+#include <string.h>
+
+#if defined __AVX2__
+#include <immintrin.h>
+#define ZMQ_WS_MASK_AVX2
+#endif
+
+#if defined __SSE2__ || defined _M_X64                                         \
+  || (defined _M_IX86_FP && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define ZMQ_WS_MASK_SSE2
+#elif defined __ARM_NEON || defined __ARM_NEON__
+#include <arm_neon.h>
+#define ZMQ_WS_MASK_NEON
+#endif
+
+void zmq::ws_mask (unsigned char *dest_,
+                   const unsigned char *src_,
+                   size_t size_,
+                   const unsigned char *mask_,
+                   size_t offset_)
+{
+    //  The key rotated so that its first byte applies to src_[0]. All the
+    //  vector widths are multiples of 4, so it stays aligned with the
+    //  payload from one block to the next.
+    const size_t rotation = offset_ & 3;
+    unsigned char key[4];
+    key[0] = mask_[rotation];
+    key[1] = mask_[(rotation + 1) & 3];
+    key[2] = mask_[(rotation + 2) & 3];
+    key[3] = mask_[(rotation + 3) & 3];
+
+    uint32_t key32;
+    memcpy (&key32, key, sizeof key32);
+
+    size_t pos = 0;
+
+#if defined ZMQ_WS_MASK_AVX2
+    const __m256i key256 = _mm256_set1_epi32 (static_cast<int> (key32));
+    for (; pos + 32 <= size_; pos += 32) {
+        const __m256i data = _mm256_loadu_si256 (
+          reinterpret_cast<const __m256i *> (src_ + pos));
+        _mm256_storeu_si256 (reinterpret_cast<__m256i *> (dest_ + pos),
+                             _mm256_xor_si256 (data, key256));
+    }
+#endif
+
+#if defined ZMQ_WS_MASK_SSE2
+    const __m128i key128 = _mm_set1_epi32 (static_cast<int> (key32));
+    for (; pos + 16 <= size_; pos += 16) {
+        const __m128i data =
+          _mm_loadu_si128 (reinterpret_cast<const __m128i *> (src_ + pos));
+        _mm_storeu_si128 (reinterpret_cast<__m128i *> (dest_ + pos),
+                          _mm_xor_si128 (data, key128));
+    }
+#elif defined ZMQ_WS_MASK_NEON
+    const uint8x16_t key128 = vreinterpretq_u8_u32 (vdupq_n_u32 (key32));
+    for (; pos + 16 <= size_; pos += 16)
+        vst1q_u8 (dest_ + pos, veorq_u8 (vld1q_u8 (src_ + pos), key128));
+#endif
+
+    const uint64_t key64 = (static_cast<uint64_t> (key32) << 32) | key32;
+    for (; pos + 8 <= size_; pos += 8) {
+        uint64_t data;
+        memcpy (&data, src_ + pos, sizeof data);
+        data ^= key64;
+        memcpy (dest_ + pos, &data, sizeof data);
+    }
+
+    for (; pos < size_; ++pos)
+        dest_[pos] = src_[pos] ^ key[pos & 3];
+}
@@ -56,6 +56,9 @@ class wss_engine_t : public ws_engine_t
     void plug_internal ();
     int read (void *data, size_t size_);
     int write (const void *data_, size_t size_);
+#if defined ZMQ_IOTHREAD_POLLER_USE_IO_URING
+    bool use_ring_io () const { return false; }
+#endif
 
 
   private:
@@ -47,7 +47,8 @@ template <typename T, int N> class ypipe_t ZMQ_FINAL : public ypipe_base_t<T>
 {
   public:
     //  Initialises the pipe.
-    inline ypipe_t ()
+    inline explicit ypipe_t (allocator_t *allocator_ = allocator_t::heap ()) :
+        _queue (allocator_)
     {
         //  Insert terminator element into the queue.
         _queue.push ();
@@ -112,9 +113,11 @@ template <typename T, int N> class ypipe_t ZMQ_FINAL : public ypipe_base_t<T>
             //  This means that the reader is asleep. Therefore we don't
             //  care about thread-safeness and update c in non-atomic
             //  manner. We'll return false to let the caller know
-            //  that reader is sleeping.
+            //  that reader is sleeping. As the reader has caught up,
+            //  the queue starts growing from a small chunk again.
             _c.set (_f);
             _w = _f;
+            _queue.restart_growth ();
             return false;
         }
 
@@ -174,6 +177,13 @@ template <typename T, int N> class ypipe_t ZMQ_FINAL : public ypipe_base_t<T>
         return (*fn_) (_queue.front ());
     }
 
+    //  Returns the number of bytes held by the queue.
+    inline size_t memory () ZMQ_FINAL { return _queue.memory (); }
+
+    //  Frees the chunk the queue keeps for reuse. Can be called from any
+    //  thread.
+    inline void release_spare () ZMQ_FINAL { _queue.release_spare (); }
+
   protected:
     //  Allocation-efficient queue to store pipe items.
     //  Front of the queue points to the first prefetched item, back of
@@ -31,6 +31,8 @@
 #ifndef __ZMQ_YPIPE_BASE_HPP_INCLUDED__
 #define __ZMQ_YPIPE_BASE_HPP_INCLUDED__
 
+#include <stddef.h>
+
 #include "macros.hpp"
 
 namespace zmq
@@ -49,6 +51,8 @@ template <typename T> class ypipe_base_t
     virtual bool check_read () = 0;
     virtual bool read (T *value_) = 0;
     virtual bool probe (bool (*fn_) (const T &)) = 0;
+    virtual size_t memory () = 0;
+    virtual void release_spare () = 0;
 };
 }
 
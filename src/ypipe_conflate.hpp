@@ -105,6 +105,10 @@ template <typename T> class ypipe_conflate_t ZMQ_FINAL : public ypipe_base_t<T>
         return dbuffer.probe (fn_);
     }
 
+    //  The double buffer holds no memory beyond the pipe itself.
+    inline size_t memory () ZMQ_FINAL { return 0; }
+    inline void release_spare () ZMQ_FINAL {}
+
   protected:
     dbuffer_t<T> dbuffer;
     bool reader_awake;
@@ -34,6 +34,8 @@
 #include <stddef.h>
 
 #include "err.hpp"
+#include "allocator.hpp"
+#include "atomic_counter.hpp"
 #include "atomic_ptr.hpp"
 
 namespace zmq
@@ -49,7 +51,12 @@ namespace zmq
 //
 //  T is the type of the object in the queue.
 //  N is granularity of the queue (how many pushes have to be done till
-//  actual memory allocation is required).
+//  actual memory allocation is required). So that idle queues stay small,
+//  the first chunk only holds a few elements, and each chunk allocated
+//  after it holds twice as many as the previous one, up to N. Once the
+//  reader has caught up, growth starts over with a small chunk.
+//  Chunks come from the allocator passed to the constructor; only chunks
+//  from the heap are aligned to ALIGN.
 #ifdef HAVE_POSIX_MEMALIGN
 // ALIGN is the memory alignment size to use in the case where we have
 // posix_memalign available. Default value is 64, this alignment will
@@ -64,15 +71,19 @@ template <typename T, int N> class yqueue_t
 {
   public:
     //  Create the queue.
-    inline yqueue_t ()
+    inline explicit yqueue_t (allocator_t *allocator_ = allocator_t::heap ()) :
+        _allocator (allocator_),
+        _next_capacity (min_capacity)
     {
         _begin_chunk = allocate_chunk ();
         alloc_assert (_begin_chunk);
         _begin_pos = 0;
+        _begin_capacity = _begin_chunk->capacity;
         _back_chunk = NULL;
         _back_pos = 0;
         _end_chunk = _begin_chunk;
         _end_pos = 0;
+        _end_capacity = _end_chunk->capacity;
     }
 
     //  Destroy the queue.
@@ -80,16 +91,16 @@ template <typename T, int N> class yqueue_t
     {
         while (true) {
             if (_begin_chunk == _end_chunk) {
-                free (_begin_chunk);
+                deallocate_chunk (_begin_chunk);
                 break;
             }
             chunk_t *o = _begin_chunk;
             _begin_chunk = _begin_chunk->next;
-            free (o);
+            deallocate_chunk (o);
         }
 
         chunk_t *sc = _spare_chunk.xchg (NULL);
-        free (sc);
+        deallocate_chunk (sc);
     }
 
     //  Returns reference to the front element of the queue.
@@ -106,7 +117,7 @@ template <typename T, int N> class yqueue_t
         _back_chunk = _end_chunk;
         _back_pos = _end_pos;
 
-        if (++_end_pos != N)
+        if (++_end_pos != _end_capacity)
             return;
 
         chunk_t *sc = _spare_chunk.xchg (NULL);
@@ -120,6 +131,7 @@ template <typename T, int N> class yqueue_t
         }
         _end_chunk = _end_chunk->next;
         _end_pos = 0;
+        _end_capacity = _end_chunk->capacity;
     }
 
     //  Removes element from the back end of the queue. In other words
@@ -135,8 +147,8 @@ template <typename T, int N> class yqueue_t
         if (_back_pos)
             --_back_pos;
         else {
-            _back_pos = N - 1;
             _back_chunk = _back_chunk->prev;
+            _back_pos = _back_chunk->capacity - 1;
         }
 
         //  Now, move 'end' position backwards. Note that obsolete end chunk
@@ -146,9 +158,10 @@ template <typename T, int N> class yqueue_t
         if (_end_pos)
             --_end_pos;
         else {
-            _end_pos = N - 1;
             _end_chunk = _end_chunk->prev;
-            free (_end_chunk->next);
+            _end_capacity = _end_chunk->capacity;
+            _end_pos = _end_capacity - 1;
+            deallocate_chunk (_end_chunk->next);
             _end_chunk->next = NULL;
         }
     }
@@ -156,51 +169,118 @@ template <typename T, int N> class yqueue_t
     //  Removes an element from the front end of the queue.
     inline void pop ()
     {
-        if (++_begin_pos == N) {
+        if (++_begin_pos == _begin_capacity) {
             chunk_t *o = _begin_chunk;
             _begin_chunk = _begin_chunk->next;
             _begin_chunk->prev = NULL;
             _begin_pos = 0;
+            _begin_capacity = _begin_chunk->capacity;
 
             //  'o' has been more recently used than _spare_chunk,
             //  so for cache reasons we'll get rid of the spare and
             //  use 'o' as the spare.
             chunk_t *cs = _spare_chunk.xchg (o);
-            free (cs);
+            deallocate_chunk (cs);
         }
     }
 
+    //  Frees the spare chunk. Reader and writer only take the spare with
+    //  an atomic exchange, so this can be done from any thread, e.g. by a
+    //  timer once the queue has been idle for a while.
+    inline void release_spare ()
+    {
+        chunk_t *sc = _spare_chunk.xchg (NULL);
+        deallocate_chunk (sc);
+    }
+
+    //  Makes the next chunk allocated a small one again. Called by the
+    //  writer when it finds the reader has caught up.
+    inline void restart_growth () { _next_capacity = min_capacity; }
+
+    //  Bytes held in chunks. Can be called from any thread.
+    inline size_t memory () { return _memory.get (); }
+
   private:
-    //  Individual memory chunk to hold N elements.
+    enum
+    {
+        min_capacity = N < 8 ? N : 8
+    };
+
+    //  Individual memory chunk to hold up to N elements. Only the first
+    //  'capacity' values are allocated.
     struct chunk_t
     {
-        T values[N];
         chunk_t *prev;
         chunk_t *next;
+        int capacity;
+        T values[N];
     };
 
-    static inline chunk_t *allocate_chunk ()
+    static inline size_t chunk_size (int capacity_)
+    {
+        return sizeof (chunk_t) - (N - capacity_) * sizeof (T);
+    }
+
+    //  Allocates a chunk of _next_capacity elements and doubles the
+    //  capacity of the one after it.
+    inline chunk_t *allocate_chunk ()
     {
+        const int capacity = _next_capacity;
+        const size_t size = chunk_size (capacity);
+        chunk_t *chunk;
+        if (!_allocator->is_heap ())
+            chunk = static_cast<chunk_t *> (
+              _allocator->allocate (size, ZMQ_ALLOCATOR_PIPE));
+        else {
 #ifdef HAVE_POSIX_MEMALIGN
-        void *pv;
-        if (posix_memalign (&pv, ALIGN, sizeof (chunk_t)) == 0)
-            return (chunk_t *) pv;
-        return NULL;
+            void *pv;
+            chunk = posix_memalign (&pv, ALIGN, size) == 0
+                      ? static_cast<chunk_t *> (pv)
+                      : NULL;
 #else
-        return static_cast<chunk_t *> (malloc (sizeof (chunk_t)));
+            chunk = static_cast<chunk_t *> (malloc (size));
 #endif
+        }
+        if (chunk == NULL)
+            return NULL;
+
+        chunk->capacity = capacity;
+        _memory.add (static_cast<atomic_counter_t::integer_t> (size));
+        if (_next_capacity < N)
+            _next_capacity = _next_capacity < N / 2 ? _next_capacity * 2 : N;
+        return chunk;
+    }
+
+    inline void deallocate_chunk (chunk_t *chunk_)
+    {
+        if (chunk_ == NULL)
+            return;
+        const size_t size = chunk_size (chunk_->capacity);
+        _memory.sub (static_cast<atomic_counter_t::integer_t> (size));
+        _allocator->deallocate (chunk_, size, ZMQ_ALLOCATOR_PIPE);
     }
 
+    //  Where the chunks come from.
+    allocator_t *const _allocator;
+
+    //  Capacity of the next chunk to allocate, used by the writer only.
+    int _next_capacity;
+
+    //  Bytes held in chunks, including the spare one.
+    atomic_counter_t _memory;
+
     //  Back position may point to invalid memory if the queue is empty,
     //  while begin & end positions are always valid. Begin position is
     //  accessed exclusively be queue reader (front/pop), while back and
     //  end positions are accessed exclusively by queue writer (back/push).
     chunk_t *_begin_chunk;
     int _begin_pos;
+    int _begin_capacity;
     chunk_t *_back_chunk;
     int _back_pos;
     chunk_t *_end_chunk;
     int _end_pos;
+    int _end_capacity;
 
     //  People are likely to produce and consume at similar rates.  In
     //  this scenario holding onto the most recently freed chunk saves
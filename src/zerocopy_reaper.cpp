@@ -0,0 +1,115 @@
+/*
+    Copyright (c) 2007-2016 Contributors as noted in the AUTHORS file
+
+    This file is part of libzmq, the ZeroMQ core engine in C++.
+
+    libzmq is free software; you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    As a special exception, the Contributors give you permission to link
+    this library with independent modules to produce an executable,
+    regardless of the license terms of these independent modules, and to
+    copy and distribute the resulting executable under terms of your choice,
+    provided that you also meet, for each linked independent module, the
+    terms and conditions of the license of that module. An independent
+    module is a module which is not derived from or based on this library.
+    If you modify this library, you must extend this exception to your
+    version of the library.
+
+    libzmq is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "precompiled.hpp"
+
+#if defined ZMQ_HAVE_TCP_ZEROCOPY
+
+#include <new>
+#include <unistd.h>
+
+#include "zerocopy_reaper.hpp"
+#include "config.hpp"
+#include "err.hpp"
+#include "gather_buffer.hpp"
+#include "memory_counter.hpp"
+#include "tcp.hpp"
+
+void zmq::zerocopy_reaper_t::start (io_thread_t *io_thread_,
+                                    fd_t s_,
+                                    gather_buffer_t *gather_,
+                                    memory_counter_t *completed_)
+{
+    zerocopy_reaper_t *reaper = new (std::nothrow)
+      zerocopy_reaper_t (io_thread_, s_, gather_, completed_);
+    alloc_assert (reaper);
+
+    //  Completions may have been queued before the socket was registered.
+    reaper->in_event ();
+}
+
+zmq::zerocopy_reaper_t::zerocopy_reaper_t (io_thread_t *io_thread_,
+                                           fd_t s_,
+                                           gather_buffer_t *gather_,
+                                           memory_counter_t *completed_) :
+    io_object_t (io_thread_),
+    _s (s_),
+    _gather (gather_),
+    _completed (completed_)
+{
+    if (_completed)
+        _completed->add_ref ();
+
+    //  The poller reports queued completions as an error condition, which
+    //  needs no subscription to pollin or pollout.
+    _handle = add_fd (_s);
+    add_timer (zerocopy_drain_timeout, drain_timer_id);
+}
+
+zmq::zerocopy_reaper_t::~zerocopy_reaper_t ()
+{
+    //  Anything not completed by now is freed regardless.
+    LIBZMQ_DELETE (_gather);
+
+    const int rc = close (_s);
+    errno_assert (rc == 0);
+
+    if (_completed && _completed->drop_ref ())
+        LIBZMQ_DELETE (_completed);
+}
+
+void zmq::zerocopy_reaper_t::in_event ()
+{
+    uint32_t lo, hi;
+    while (tcp_zerocopy_completion (_s, &lo, &hi)) {
+        _gather->completed_zerocopy (lo, hi);
+        if (_completed)
+            _completed->add (hi - lo + 1);
+    }
+
+    if (!_gather->zerocopy_pending ()) {
+        cancel_timer (drain_timer_id);
+        finish ();
+    }
+}
+
+void zmq::zerocopy_reaper_t::timer_event (int id_)
+{
+    zmq_assert (id_ == drain_timer_id);
+    finish ();
+}
+
+void zmq::zerocopy_reaper_t::finish ()
+{
+    rm_fd (_handle);
+    unplug ();
+    delete this;
+}
+
+#endif
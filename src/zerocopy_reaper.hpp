@@ -0,0 +1,90 @@
+/*
+    Copyright (c) 2007-2016 Contributors as noted in the AUTHORS file
+
+    This file is part of libzmq, the ZeroMQ core engine in C++.
+
+    libzmq is free software; you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    As a special exception, the Contributors give you permission to link
+    this library with independent modules to produce an executable,
+    regardless of the license terms of these independent modules, and to
+    copy and distribute the resulting executable under terms of your choice,
+    provided that you also meet, for each linked independent module, the
+    terms and conditions of the license of that module. An independent
+    module is a module which is not derived from or based on this library.
+    If you modify this library, you must extend this exception to your
+    version of the library.
+
+    libzmq is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __ZMQ_ZEROCOPY_REAPER_HPP_INCLUDED__
+#define __ZMQ_ZEROCOPY_REAPER_HPP_INCLUDED__
+
+#if defined ZMQ_HAVE_TCP_ZEROCOPY
+
+#include "fd.hpp"
+#include "io_object.hpp"
+#include "macros.hpp"
+
+namespace zmq
+{
+class gather_buffer_t;
+class io_thread_t;
+class memory_counter_t;
+
+//  Outlives a TCP engine whose zero-copy sends have not all completed yet.
+//  It holds on to the socket, which the completions are reported on, and
+//  to the messages the kernel may still be reading from, until either the
+//  sends complete or zerocopy_drain_timeout expires. Then it frees both
+//  and deletes itself.
+
+class zerocopy_reaper_t ZMQ_FINAL : public io_object_t
+{
+  public:
+    //  Takes ownership of s_ and gather_. completed_ may be NULL.
+    static void start (zmq::io_thread_t *io_thread_,
+                       fd_t s_,
+                       gather_buffer_t *gather_,
+                       memory_counter_t *completed_);
+
+  private:
+    zerocopy_reaper_t (zmq::io_thread_t *io_thread_,
+                       fd_t s_,
+                       gather_buffer_t *gather_,
+                       memory_counter_t *completed_);
+    ~zerocopy_reaper_t ();
+
+    //  i_poll_events interface implementation.
+    void in_event () ZMQ_FINAL;
+    void timer_event (int id_) ZMQ_FINAL;
+
+    //  Unregisters from the poller and deletes the reaper.
+    void finish ();
+
+    enum
+    {
+        drain_timer_id = 0x40
+    };
+
+    fd_t _s;
+    handle_t _handle;
+    gather_buffer_t *_gather;
+    memory_counter_t *_completed;
+
+    ZMQ_NON_COPYABLE_NOR_MOVABLE (zerocopy_reaper_t)
+};
+}
+
+#endif
+
+#endif
@@ -470,6 +470,90 @@ int zmq_sendiov (void *s_, iovec *a_, size_t count_, int flags_)
     return rc;
 }
 
+// Send multiple messages without copying their content.
+//
+// Works like zmq_sendiov, except that each iovec is wrapped into a message
+// referring to the caller's buffer. Once the library is done with a part,
+// ffn_ is called with the part's iov_base and hint_, in the same way as for
+// zmq_msg_init_data; for parts that were sent, that may be well after this
+// function returns.
+//
+// If -1 is returned, part i failed, either to be wrapped (ENOMEM) or to be
+// sent. Parts before i were sent and belong to the library, which calls
+// ffn_ for them when it releases them. ffn_ has been called for part i
+// before returning. Parts after i still belong to the caller and ffn_ is
+// not called for them. If i is not the first part, the parts before it
+// remain queued on the socket as an unfinished multipart message: the next
+// part sent completes it, and closing the socket discards it.
+//
+int zmq_sendiov_zc (void *s_,
+                    iovec *a_,
+                    size_t count_,
+                    int flags_,
+                    zmq_free_fn *ffn_,
+                    void *hint_)
+{
+    zmq::socket_base_t *s = as_socket_base_t (s_);
+    if (!s)
+        return -1;
+    if (unlikely (count_ <= 0 || !a_)) {
+        errno = EINVAL;
+        return -1;
+    }
+
+    int rc = 0;
+    zmq_msg_t msg;
+
+    for (size_t i = 0; i < count_; ++i) {
+        rc = zmq_msg_init_data (&msg, a_[i].iov_base, a_[i].iov_len, ffn_,
+                                hint_);
+        if (rc != 0) {
+            //  The buffer was handed over all the same.
+            const int err = errno;
+            if (ffn_)
+                ffn_ (a_[i].iov_base, hint_);
+            errno = err;
+            rc = -1;
+            break;
+        }
+        if (i == count_ - 1)
+            flags_ = flags_ & ~ZMQ_SNDMORE;
+        rc = s_sendmsg (s, &msg, flags_);
+        if (unlikely (rc < 0)) {
+            const int err = errno;
+            const int rc2 = zmq_msg_close (&msg);
+            errno_assert (rc2 == 0);
+            errno = err;
+            rc = -1;
+            break;
+        }
+    }
+    return rc;
+}
+
+// Send a batch of messages
+//
+// Works like calling zmq_msg_send with flags_ on each of the count_
+// messages in turn, except that the socket is locked and its pending
+// commands are processed only once. Returns the number of messages sent,
+// which the library now owns as with zmq_msg_send; the others are left to
+// the caller. Sending stops at the first message that cannot be sent, e.g.
+// on EAGAIN with ZMQ_DONTWAIT or once ZMQ_SNDTIMEO expires for it; -1 is
+// returned only if that is the first one.
+//
+int zmq_send_batch (void *s_, zmq_msg_t *msgs_, size_t count_, int flags_)
+{
+    zmq::socket_base_t *s = as_socket_base_t (s_);
+    if (!s)
+        return -1;
+    if (unlikely (count_ <= 0 || count_ > INT_MAX || !msgs_)) {
+        errno = EINVAL;
+        return -1;
+    }
+    return s->send_batch (reinterpret_cast<zmq::msg_t *> (msgs_), count_,
+                          flags_);
+}
+
 // Receiving functions.
 
 static int s_recvmsg (zmq::socket_base_t *s_, zmq_msg_t *msg_, int flags_)
@@ -588,6 +672,79 @@ int zmq_recviov (void *s_, iovec *a_, size_t *count_, int flags_)
     return nread;
 }
 
+// Receive a multi-part message without copying its content
+//
+// Works like zmq_recviov, except that the parts are received into the
+// caller-provided messages msgs_ and the iovecs point into their data
+// rather than into malloc'ed copies. The data stays valid until the
+// caller closes the corresponding message with zmq_msg_close, which it
+// must do for all *count_ parts read, even if -1 is returned. The
+// messages must not be moved in memory while the iovecs are in use.
+//
+int zmq_recviov_zc (
+  void *s_, iovec *a_, zmq_msg_t *msgs_, size_t *count_, int flags_)
+{
+    zmq::socket_base_t *s = as_socket_base_t (s_);
+    if (!s)
+        return -1;
+    if (unlikely (!count_ || *count_ <= 0 || !a_ || !msgs_)) {
+        errno = EINVAL;
+        return -1;
+    }
+
+    const size_t count = *count_;
+    int nread = 0;
+    bool recvmore = true;
+
+    *count_ = 0;
+
+    for (size_t i = 0; recvmore && i < count; ++i) {
+        int rc = zmq_msg_init (&msgs_[i]);
+        errno_assert (rc == 0);
+
+        const int nbytes = s_recvmsg (s, &msgs_[i], flags_);
+        if (unlikely (nbytes < 0)) {
+            const int err = errno;
+            rc = zmq_msg_close (&msgs_[i]);
+            errno_assert (rc == 0);
+            errno = err;
+            nread = -1;
+            break;
+        }
+
+        a_[i].iov_base = zmq_msg_data (&msgs_[i]);
+        a_[i].iov_len = zmq_msg_size (&msgs_[i]);
+        // Assume zmq_socket ZMQ_RVCMORE is properly set.
+        const zmq::msg_t *p_msg =
+          reinterpret_cast<const zmq::msg_t *> (&msgs_[i]);
+        recvmore = p_msg->flags () & zmq::msg_t::more;
+        ++*count_;
+        ++nread;
+    }
+    return nread;
+}
+
+// Receive a batch of messages
+//
+// Receives the first message like zmq_msg_recv with flags_, then up to
+// count_ - 1 more messages that are already available, without waiting.
+// The messages must have been initialised; each part of a multi-part
+// message takes one of them, zmq_msg_more telling them apart. Returns the
+// number of messages received, or -1 if there was none.
+//
+int zmq_recv_batch (void *s_, zmq_msg_t *msgs_, size_t count_, int flags_)
+{
+    zmq::socket_base_t *s = as_socket_base_t (s_);
+    if (!s)
+        return -1;
+    if (unlikely (count_ <= 0 || count_ > INT_MAX || !msgs_)) {
+        errno = EINVAL;
+        return -1;
+    }
+    return s->recv_batch (reinterpret_cast<zmq::msg_t *> (msgs_), count_,
+                          flags_);
+}
+
 // Message manipulators.
 
 int zmq_msg_init (zmq_msg_t *msg_)
@@ -1452,6 +1609,10 @@ int zmq_has (const char *capability_)
     if (strcmp (capability_, zmq::protocol_name::ipc) == 0)
         return true;
 #endif
+#if defined(ZMQ_HAVE_SHM)
+    if (strcmp (capability_, zmq::protocol_name::shm) == 0)
+        return true;
+#endif
 #if defined(ZMQ_HAVE_OPENPGM)
     if (strcmp (capability_, "pgm") == 0)
         return true;
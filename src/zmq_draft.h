@@ -63,10 +63,56 @@
 #define ZMQ_WSS_HOSTNAME 106
 #define ZMQ_WSS_TRUST_SYSTEM 107
 #define ZMQ_ONLY_FIRST_SUBSCRIBE 108
+#define ZMQ_UDP_BATCH_SIZE 109
+#define ZMQ_TCP_ZEROCOPY_THRESHOLD 110
+#define ZMQ_IPC_MEMFD_THRESHOLD 111
+#define ZMQ_QUEUE_MEMORY 112
+#define ZMQ_BUFFER_MEMORY 113
+#define ZMQ_SNDHWM_BYTES 114
+#define ZMQ_RCVHWM_BYTES 115
+#define ZMQ_TCP_BUSY_POLL 116
+#define ZMQ_TCP_SHARDED_BIND 117
+#define ZMQ_IO_WEIGHT 118
+#define ZMQ_TCP_ZEROCOPY_COMPLETED 119
+#define ZMQ_CURVE_CIPHERS 120
 
 
 /*  DRAFT Context options                                                     */
 #define ZMQ_ZERO_COPY_RECV 10
+#define ZMQ_MSG_POOL 11
+#define ZMQ_ALLOCATOR 12
+#define ZMQ_BUSY_POLL 13
+#define ZMQ_BUSY_POLL_THREADS 14
+#define ZMQ_IO_LOAD_IVL 15
+#define ZMQ_IO_REBALANCE 16
+#define ZMQ_IO_THREAD_LOADS 17
+#define ZMQ_NUMA 18
+
+/*  DRAFT Context allocator                                                   */
+/*  Tags telling the allocator which part of the library allocates.           */
+#define ZMQ_ALLOCATOR_MSG 1
+#define ZMQ_ALLOCATOR_PIPE 2
+#define ZMQ_ALLOCATOR_ENCODER 3
+#define ZMQ_ALLOCATOR_DECODER 4
+
+typedef struct zmq_allocator_t
+{
+    void *(*allocate_fn) (void *hint_, size_t size_, int tag_);
+    void *(*reallocate_fn) (
+      void *hint_, void *ptr_, size_t old_size_, size_t new_size_, int tag_);
+    void (*deallocate_fn) (void *hint_, void *ptr_, size_t size_, int tag_);
+    void *hint;
+} zmq_allocator_t;
+
+/*  DRAFT I/O thread load, as reported for ZMQ_IO_THREAD_LOADS.               */
+typedef struct zmq_io_thread_load_t
+{
+    int fds;        /*  File descriptors polled by the thread.                */
+    int busy;       /*  Share of the last interval spent busy, in permille.   */
+    int traffic;    /*  KiB/s sent and received in the last interval.         */
+    int migrations; /*  Sessions the thread passed to another one so far.     */
+    int cost;       /*  Decayed cost used to place new connections.           */
+} zmq_io_thread_load_t;
 
 /*  DRAFT Context methods.                                                    */
 int zmq_ctx_set_ext (void *context_,
@@ -81,6 +127,20 @@ int zmq_ctx_get_ext (void *context_,
 /*  DRAFT Socket methods.                                                     */
 int zmq_join (void *s_, const char *group_);
 int zmq_leave (void *s_, const char *group_);
+struct iovec;
+int zmq_sendiov_zc (void *s_,
+                    struct iovec *iov_,
+                    size_t count_,
+                    int flags_,
+                    zmq_free_fn *ffn_,
+                    void *hint_);
+int zmq_recviov_zc (void *s_,
+                    struct iovec *iov_,
+                    zmq_msg_t *msgs_,
+                    size_t *count_,
+                    int flags_);
+int zmq_send_batch (void *s_, zmq_msg_t *msgs_, size_t count_, int flags_);
+int zmq_recv_batch (void *s_, zmq_msg_t *msgs_, size_t count_, int flags_);
 
 /*  DRAFT Msg methods.                                                        */
 int zmq_msg_set_routing_id (zmq_msg_t *msg_, uint32_t routing_id_);
@@ -255,11 +255,12 @@ bool zmq::zmtp_engine_t::handshake_v1_0_unversioned ()
         return false;
     }
 
-    _encoder = new (std::nothrow) v1_encoder_t (_options.out_batch_size);
+    _encoder = new (std::nothrow)
+      v1_encoder_t (_options.out_batch_size, _options.allocator);
     alloc_assert (_encoder);
 
-    _decoder = new (std::nothrow)
-      v1_decoder_t (_options.in_batch_size, _options.maxmsgsize);
+    _decoder = new (std::nothrow) v1_decoder_t (
+      _options.in_batch_size, _options.maxmsgsize, _options.allocator);
     alloc_assert (_decoder);
 
     //  We have already sent the message header.
@@ -311,11 +312,12 @@ bool zmq::zmtp_engine_t::handshake_v1_0 ()
         return false;
     }
 
-    _encoder = new (std::nothrow) v1_encoder_t (_options.out_batch_size);
+    _encoder = new (std::nothrow)
+      v1_encoder_t (_options.out_batch_size, _options.allocator);
     alloc_assert (_encoder);
 
-    _decoder = new (std::nothrow)
-      v1_decoder_t (_options.in_batch_size, _options.maxmsgsize);
+    _decoder = new (std::nothrow) v1_decoder_t (
+      _options.in_batch_size, _options.maxmsgsize, _options.allocator);
     alloc_assert (_decoder);
 
     return true;
@@ -329,11 +331,13 @@ bool zmq::zmtp_engine_t::handshake_v2_0 ()
         return false;
     }
 
-    _encoder = new (std::nothrow) v2_encoder_t (_options.out_batch_size);
+    _encoder = new (std::nothrow)
+      v2_encoder_t (_options.out_batch_size, _options.allocator);
     alloc_assert (_encoder);
 
-    _decoder = new (std::nothrow) v2_decoder_t (
-      _options.in_batch_size, _options.maxmsgsize, _options.zero_copy);
+    _decoder = new (std::nothrow)
+      v2_decoder_t (_options.in_batch_size, _options.maxmsgsize,
+                    _options.zero_copy, _options.allocator);
     alloc_assert (_decoder);
 
     return true;
@@ -341,11 +345,13 @@ bool zmq::zmtp_engine_t::handshake_v2_0 ()
 
 bool zmq::zmtp_engine_t::handshake_v3_0 ()
 {
-    _encoder = new (std::nothrow) v2_encoder_t (_options.out_batch_size);
+    _encoder = new (std::nothrow)
+      v2_encoder_t (_options.out_batch_size, _options.allocator);
     alloc_assert (_encoder);
 
-    _decoder = new (std::nothrow) v2_decoder_t (
-      _options.in_batch_size, _options.maxmsgsize, _options.zero_copy);
+    _decoder = new (std::nothrow)
+      v2_decoder_t (_options.in_batch_size, _options.maxmsgsize,
+                    _options.zero_copy, _options.allocator);
     alloc_assert (_decoder);
 
     if (_options.mechanism == ZMQ_NULL
@@ -402,6 +408,10 @@ bool zmq::zmtp_engine_t::handshake_v3_0 ()
         error (protocol_error);
         return false;
     }
+#if defined ZMQ_HAVE_MEMFD
+    if (_accept_memfd)
+        _mechanism->advertise_memfd ();
+#endif
     _next_msg = &zmtp_engine_t::next_handshake_command;
     _process_msg = &zmtp_engine_t::process_handshake_command;
 
@@ -0,0 +1,165 @@
+/*
+    Copyright (c) 2007-2016 Contributors as noted in the AUTHORS file
+
+    This file is part of libzmq, the ZeroMQ core engine in C++.
+
+    libzmq is free software; you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    As a special exception, the Contributors give you permission to link
+    this library with independent modules to produce an executable,
+    regardless of the license terms of these independent modules, and to
+    copy and distribute the resulting executable under terms of your choice,
+    provided that you also meet, for each linked independent module, the
+    terms and conditions of the license of that module. An independent
+    module is a module which is not derived from or based on this library.
+    If you modify this library, you must extend this exception to your
+    version of the library.
+
+    libzmq is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "testutil.hpp"
+#include "testutil_unity.hpp"
+
+#include <string.h>
+
+SETUP_TEARDOWN_TESTCONTEXT
+
+static const int batch = 10;
+
+static void init_batch (zmq_msg_t *msgs_, int count_)
+{
+    for (int i = 0; i < count_; i++) {
+        TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_init_size (&msgs_[i], 1));
+        *static_cast<char *> (zmq_msg_data (&msgs_[i])) = 'a' + i;
+    }
+}
+
+static void close_batch (zmq_msg_t *msgs_, int count_)
+{
+    for (int i = 0; i < count_; i++)
+        TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_close (&msgs_[i]));
+}
+
+static void bind_and_connect (void **pull_, void **push_)
+{
+    *pull_ = test_context_socket (ZMQ_PULL);
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_bind (*pull_, "inproc://batch"));
+    *push_ = test_context_socket (ZMQ_PUSH);
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_connect (*push_, "inproc://batch"));
+}
+
+void test_send_recv_batch ()
+{
+    void *pull, *push;
+    bind_and_connect (&pull, &push);
+
+    zmq_msg_t msgs[batch];
+    init_batch (msgs, batch);
+    TEST_ASSERT_EQUAL_INT (batch,
+                           TEST_ASSERT_SUCCESS_ERRNO (
+                             zmq_send_batch (push, msgs, batch, 0)));
+    close_batch (msgs, batch);
+
+    //  More room than messages: the call returns what is there.
+    zmq_msg_t received[batch * 2];
+    for (int i = 0; i < batch * 2; i++)
+        TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_init (&received[i]));
+    TEST_ASSERT_EQUAL_INT (batch,
+                           TEST_ASSERT_SUCCESS_ERRNO (
+                             zmq_recv_batch (pull, received, batch * 2, 0)));
+    for (int i = 0; i < batch; i++) {
+        TEST_ASSERT_EQUAL_INT (1, zmq_msg_size (&received[i]));
+        TEST_ASSERT_EQUAL_INT ('a' + i, *static_cast<char *> (
+                                          zmq_msg_data (&received[i])));
+        TEST_ASSERT_FALSE (zmq_msg_more (&received[i]));
+    }
+
+    //  Nothing left.
+    TEST_ASSERT_FAILURE_ERRNO (
+      EAGAIN, zmq_recv_batch (pull, received, batch * 2, ZMQ_DONTWAIT));
+    close_batch (received, batch * 2);
+
+    test_context_socket_close (push);
+    test_context_socket_close (pull);
+}
+
+void test_send_batch_hwm ()
+{
+    void *pull = test_context_socket (ZMQ_PULL);
+    void *push = test_context_socket (ZMQ_PUSH);
+    const int hwm = 2;
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_setsockopt (pull, ZMQ_RCVHWM, &hwm, sizeof hwm));
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_setsockopt (push, ZMQ_SNDHWM, &hwm, sizeof hwm));
+
+    //  Without a peer, not even the first message can go.
+    zmq_msg_t msgs[batch];
+    init_batch (msgs, batch);
+    TEST_ASSERT_FAILURE_ERRNO (
+      EAGAIN, zmq_send_batch (push, msgs, batch, ZMQ_DONTWAIT));
+
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_bind (pull, "inproc://batch"));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_connect (push, "inproc://batch"));
+
+    //  The batch stops at the high water mark. The unsent messages are
+    //  still the caller's.
+    const int sent = TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_send_batch (push, msgs, batch, ZMQ_DONTWAIT));
+    TEST_ASSERT_GREATER_THAN_INT (0, sent);
+    TEST_ASSERT_LESS_THAN_INT (batch, sent);
+    for (int i = sent; i < batch; i++)
+        TEST_ASSERT_EQUAL_INT ('a' + i,
+                               *static_cast<char *> (zmq_msg_data (&msgs[i])));
+    TEST_ASSERT_FAILURE_ERRNO (
+      EAGAIN, zmq_send_batch (push, msgs + sent, batch - sent, ZMQ_DONTWAIT));
+
+    zmq_msg_t received[batch];
+    for (int i = 0; i < batch; i++)
+        TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_init (&received[i]));
+    TEST_ASSERT_EQUAL_INT (sent, TEST_ASSERT_SUCCESS_ERRNO (zmq_recv_batch (
+                                   pull, received, batch, ZMQ_DONTWAIT)));
+    close_batch (received, batch);
+    close_batch (msgs, batch);
+
+    test_context_socket_close (push);
+    test_context_socket_close (pull);
+}
+
+void test_batch_invalid ()
+{
+    void *pull, *push;
+    bind_and_connect (&pull, &push);
+
+    zmq_msg_t msg;
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_init (&msg));
+    TEST_ASSERT_FAILURE_ERRNO (EINVAL, zmq_send_batch (push, NULL, 1, 0));
+    TEST_ASSERT_FAILURE_ERRNO (EINVAL, zmq_send_batch (push, &msg, 0, 0));
+    TEST_ASSERT_FAILURE_ERRNO (EINVAL, zmq_recv_batch (pull, NULL, 1, 0));
+    TEST_ASSERT_FAILURE_ERRNO (EINVAL, zmq_recv_batch (pull, &msg, 0, 0));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_close (&msg));
+
+    test_context_socket_close (push);
+    test_context_socket_close (pull);
+}
+
+int main ()
+{
+    setup_test_environment ();
+
+    UNITY_BEGIN ();
+    RUN_TEST (test_send_recv_batch);
+    RUN_TEST (test_send_batch_hwm);
+    RUN_TEST (test_batch_invalid);
+    return UNITY_END ();
+}
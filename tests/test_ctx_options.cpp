@@ -28,6 +28,9 @@
 */
 
 #include <limits>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
 #include "testutil.hpp"
 #include "testutil_unity.hpp"
 
@@ -205,6 +208,453 @@ void test_ctx_zero_copy ()
 #endif
 }
 
+void test_ctx_msg_pool ()
+{
+#ifdef ZMQ_MSG_POOL
+    //  Disabled by default.
+    TEST_ASSERT_EQUAL_INT (0, zmq_ctx_get (get_test_context (), ZMQ_MSG_POOL));
+
+    //  A message allocated before the pools are enabled is closed after.
+    zmq_msg_t early;
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_init_size (&early, 1000));
+
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_ctx_set (get_test_context (), ZMQ_MSG_POOL, 1));
+    TEST_ASSERT_EQUAL_INT (1, zmq_ctx_get (get_test_context (), ZMQ_MSG_POOL));
+
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_close (&early));
+
+    //  Messages allocated by the I/O thread's decoder are freed by this
+    //  thread and the other way round, and some sizes are too large to
+    //  be pooled.
+    void *pull = zmq_socket (get_test_context (), ZMQ_PULL);
+    char endpoint[MAX_SOCKET_STRING];
+    bind_loopback_ipv4 (pull, endpoint, sizeof endpoint);
+
+    void *push = zmq_socket (get_test_context (), ZMQ_PUSH);
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_connect (push, endpoint));
+
+    const size_t sizes[] = {0, 40, 100, 1000, 5000, 8100, 20000};
+    const int size_count = sizeof sizes / sizeof sizes[0];
+    const int rounds = 100;
+    char *buffer = static_cast<char *> (malloc (sizes[size_count - 1]));
+    for (int i = 0; i < rounds; i++)
+        for (int j = 0; j < size_count; j++) {
+            memset (buffer, 'a' + (i + j) % 26, sizes[j]);
+            TEST_ASSERT_EQUAL_INT (
+              sizes[j], zmq_send (push, buffer, sizes[j], 0));
+        }
+    for (int i = 0; i < rounds; i++)
+        for (int j = 0; j < size_count; j++) {
+            zmq_msg_t msg;
+            TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_init (&msg));
+            TEST_ASSERT_EQUAL_INT (
+              sizes[j], TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_recv (&msg, pull, 0)));
+            memset (buffer, 'a' + (i + j) % 26, sizes[j]);
+            if (sizes[j] > 0)
+                TEST_ASSERT_EQUAL_MEMORY (buffer, zmq_msg_data (&msg),
+                                          sizes[j]);
+            TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_close (&msg));
+        }
+    free (buffer);
+
+    //  A message allocated while the pools are enabled is closed after.
+    zmq_msg_t late;
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_init_size (&late, 1000));
+
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_close (push));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_close (pull));
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_ctx_set (get_test_context (), ZMQ_MSG_POOL, 0));
+    TEST_ASSERT_EQUAL_INT (0, zmq_ctx_get (get_test_context (), ZMQ_MSG_POOL));
+
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_close (&late));
+#endif
+}
+
+#ifdef ZMQ_ALLOCATOR
+//  Blocks allocated and currently live, per tag.
+static void *allocated[ZMQ_ALLOCATOR_DECODER + 1];
+static void *live[ZMQ_ALLOCATOR_DECODER + 1];
+
+static void *counting_allocate (void *hint_, size_t size_, int tag_)
+{
+    TEST_ASSERT_EQUAL_PTR (allocated, hint_);
+    TEST_ASSERT_TRUE (tag_ >= ZMQ_ALLOCATOR_MSG
+                      && tag_ <= ZMQ_ALLOCATOR_DECODER);
+    zmq_atomic_counter_inc (allocated[tag_]);
+    zmq_atomic_counter_inc (live[tag_]);
+    return malloc (size_);
+}
+
+static void counting_deallocate (void *hint_, void *ptr_, size_t, int tag_)
+{
+    TEST_ASSERT_EQUAL_PTR (allocated, hint_);
+    zmq_atomic_counter_dec (live[tag_]);
+    free (ptr_);
+}
+#endif
+
+void test_ctx_allocator ()
+{
+#ifdef ZMQ_ALLOCATOR
+    for (int i = ZMQ_ALLOCATOR_MSG; i <= ZMQ_ALLOCATOR_DECODER; i++) {
+        allocated[i] = zmq_atomic_counter_new ();
+        live[i] = zmq_atomic_counter_new ();
+    }
+
+    void *ctx = zmq_ctx_new ();
+    TEST_ASSERT_NOT_NULL (ctx);
+
+    //  The heap by default.
+    zmq_allocator_t allocator;
+    size_t allocator_size = sizeof allocator;
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_ctx_get_ext (ctx, ZMQ_ALLOCATOR, &allocator, &allocator_size));
+    TEST_ASSERT_NULL (allocator.allocate_fn);
+
+    //  Allocating and deallocating go together.
+    allocator.allocate_fn = counting_allocate;
+    allocator.reallocate_fn = NULL;
+    allocator.deallocate_fn = NULL;
+    allocator.hint = allocated;
+    TEST_ASSERT_FAILURE_ERRNO (EINVAL, zmq_ctx_set_ext (ctx, ZMQ_ALLOCATOR,
+                                                        &allocator,
+                                                        sizeof allocator));
+
+    allocator.deallocate_fn = counting_deallocate;
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_ctx_set_ext (ctx, ZMQ_ALLOCATOR, &allocator, sizeof allocator));
+    zmq_allocator_t current;
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_ctx_get_ext (ctx, ZMQ_ALLOCATOR, &current, &allocator_size));
+    TEST_ASSERT_EQUAL_PTR (allocated, current.hint);
+
+    void *pull = zmq_socket (ctx, ZMQ_PULL);
+    char endpoint[MAX_SOCKET_STRING];
+    bind_loopback_ipv4 (pull, endpoint, sizeof endpoint);
+    void *push = zmq_socket (ctx, ZMQ_PUSH);
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_connect (push, endpoint));
+
+    //  Too late once there are sockets.
+    TEST_ASSERT_FAILURE_ERRNO (EINVAL, zmq_ctx_set_ext (ctx, ZMQ_ALLOCATOR,
+                                                        &allocator,
+                                                        sizeof allocator));
+
+    //  Larger than the decoder's buffer, so it allocates the message.
+    const size_t size = 20000;
+    char *buffer = static_cast<char *> (malloc (size));
+    memset (buffer, 'x', size);
+    TEST_ASSERT_EQUAL_INT (size, zmq_send (push, buffer, size, 0));
+    send_string_expect_success (push, "small", 0);
+
+    zmq_msg_t msg;
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_init (&msg));
+    TEST_ASSERT_EQUAL_INT (size, TEST_ASSERT_SUCCESS_ERRNO (
+                                   zmq_msg_recv (&msg, pull, 0)));
+    TEST_ASSERT_EQUAL_MEMORY (buffer, zmq_msg_data (&msg), size);
+    recv_string_expect_success (pull, "small", 0);
+    free (buffer);
+
+    //  Encoders allocate their buffer on first use only, which gather
+    //  writes never get to.
+    for (int i = ZMQ_ALLOCATOR_MSG; i <= ZMQ_ALLOCATOR_DECODER; i++)
+        if (i != ZMQ_ALLOCATOR_ENCODER)
+            TEST_ASSERT_GREATER_THAN_INT (
+              0, zmq_atomic_counter_value (allocated[i]));
+
+    //  The received message outlives the context.
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_close (push));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_close (pull));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_ctx_term (ctx));
+    TEST_ASSERT_EQUAL_INT (1,
+                           zmq_atomic_counter_value (live[ZMQ_ALLOCATOR_MSG]));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_close (&msg));
+
+    for (int i = ZMQ_ALLOCATOR_MSG; i <= ZMQ_ALLOCATOR_DECODER; i++) {
+        TEST_ASSERT_EQUAL_INT (0, zmq_atomic_counter_value (live[i]));
+        zmq_atomic_counter_destroy (&allocated[i]);
+        zmq_atomic_counter_destroy (&live[i]);
+    }
+#endif
+}
+
+void test_ctx_busy_poll ()
+{
+#ifdef ZMQ_BUSY_POLL
+    void *ctx = zmq_ctx_new ();
+    TEST_ASSERT_NOT_NULL (ctx);
+
+    //  Disabled by default.
+    TEST_ASSERT_EQUAL_INT (0, zmq_ctx_get (ctx, ZMQ_BUSY_POLL));
+    TEST_ASSERT_EQUAL_INT (0, zmq_ctx_get (ctx, ZMQ_BUSY_POLL_THREADS));
+    TEST_ASSERT_FAILURE_ERRNO (EINVAL, zmq_ctx_set (ctx, ZMQ_BUSY_POLL, -1));
+
+    //  Only the first of two I/O threads spins.
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_ctx_set (ctx, ZMQ_IO_THREADS, 2));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_ctx_set (ctx, ZMQ_BUSY_POLL, 200));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_ctx_set (ctx, ZMQ_BUSY_POLL_THREADS, 1));
+    TEST_ASSERT_EQUAL_INT (200, zmq_ctx_get (ctx, ZMQ_BUSY_POLL));
+    TEST_ASSERT_EQUAL_INT (1, zmq_ctx_get (ctx, ZMQ_BUSY_POLL_THREADS));
+
+    //  The sockets may ask the kernel to busy poll too, which it is free
+    //  to refuse.
+    void *rep = zmq_socket (ctx, ZMQ_REP);
+    int busy_poll = 50;
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_setsockopt (rep, ZMQ_TCP_BUSY_POLL, &busy_poll, sizeof busy_poll));
+    busy_poll = 0;
+    size_t size = sizeof busy_poll;
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_getsockopt (rep, ZMQ_TCP_BUSY_POLL, &busy_poll, &size));
+    TEST_ASSERT_EQUAL_INT (50, busy_poll);
+    char endpoint[MAX_SOCKET_STRING];
+    bind_loopback_ipv4 (rep, endpoint, sizeof endpoint);
+    void *req = zmq_socket (ctx, ZMQ_REQ);
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_connect (req, endpoint));
+
+    for (int i = 0; i < 100; i++) {
+        send_string_expect_success (req, "ping", 0);
+        recv_string_expect_success (rep, "ping", 0);
+        send_string_expect_success (rep, "pong", 0);
+        recv_string_expect_success (req, "pong", 0);
+    }
+
+    //  Waits that time out still time out while spinning.
+    const int timeout = 10;
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_setsockopt (rep, ZMQ_RCVTIMEO, &timeout, sizeof timeout));
+    char buffer[8];
+    for (int i = 0; i < 3; i++)
+        TEST_ASSERT_FAILURE_ERRNO (EAGAIN,
+                                   zmq_recv (rep, buffer, sizeof buffer, 0));
+
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_close (req));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_close (rep));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_ctx_term (ctx));
+#endif
+}
+
+#ifdef ZMQ_IO_REBALANCE
+//  Sends a burst of numbered messages each way and checks they arrive in
+//  the order they were sent.
+static void
+exchange_in_order (void *bind_, void *connect_, int count_, int *seq_)
+{
+    char buffer[16];
+    char expected[16];
+    for (int i = 0; i < count_; i++) {
+        snprintf (buffer, sizeof buffer, "%d", *seq_ + i);
+        send_string_expect_success (bind_, buffer, 0);
+        send_string_expect_success (connect_, buffer, 0);
+    }
+    for (int i = 0; i < count_; i++) {
+        snprintf (expected, sizeof expected, "%d", *seq_ + i);
+        recv_string_expect_success (connect_, expected, 0);
+        recv_string_expect_success (bind_, expected, 0);
+    }
+    *seq_ += count_;
+}
+#endif
+
+void test_ctx_io_rebalance ()
+{
+#ifdef ZMQ_IO_REBALANCE
+    void *ctx = zmq_ctx_new ();
+    TEST_ASSERT_NOT_NULL (ctx);
+
+    //  Disabled by default.
+    TEST_ASSERT_EQUAL_INT (0, zmq_ctx_get (ctx, ZMQ_IO_LOAD_IVL));
+    TEST_ASSERT_EQUAL_INT (0, zmq_ctx_get (ctx, ZMQ_IO_REBALANCE));
+    TEST_ASSERT_FAILURE_ERRNO (EINVAL, zmq_ctx_set (ctx, ZMQ_IO_LOAD_IVL, -1));
+    TEST_ASSERT_FAILURE_ERRNO (EINVAL,
+                               zmq_ctx_set (ctx, ZMQ_IO_REBALANCE, 1001));
+
+    //  Sample over windows long enough to see the load, and move sessions
+    //  on the slightest imbalance.
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_ctx_set (ctx, ZMQ_IO_THREADS, 2));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_ctx_set (ctx, ZMQ_IO_LOAD_IVL, 50));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_ctx_set (ctx, ZMQ_IO_REBALANCE, 1));
+    TEST_ASSERT_EQUAL_INT (50, zmq_ctx_get (ctx, ZMQ_IO_LOAD_IVL));
+    TEST_ASSERT_EQUAL_INT (1, zmq_ctx_get (ctx, ZMQ_IO_REBALANCE));
+
+    //  One entry per I/O thread, empty before they start.
+    zmq_io_thread_load_t loads[2];
+    size_t size = sizeof loads[0];
+    TEST_ASSERT_FAILURE_ERRNO (
+      EINVAL, zmq_ctx_get_ext (ctx, ZMQ_IO_THREAD_LOADS, loads, &size));
+    size = sizeof loads;
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_ctx_get_ext (ctx, ZMQ_IO_THREAD_LOADS, loads, &size));
+    TEST_ASSERT_EQUAL_INT (0, loads[0].fds + loads[1].fds);
+
+    //  Connections with uneven traffic keep their messages in order while
+    //  sessions move between the threads.
+    const int pairs = 4;
+    void *binds[pairs];
+    void *connects[pairs];
+    for (int i = 0; i < pairs; i++) {
+        binds[i] = zmq_socket (ctx, ZMQ_DEALER);
+        connects[i] = zmq_socket (ctx, ZMQ_DEALER);
+        char endpoint[MAX_SOCKET_STRING];
+        bind_loopback_ipv4 (binds[i], endpoint, sizeof endpoint);
+        TEST_ASSERT_SUCCESS_ERRNO (zmq_connect (connects[i], endpoint));
+    }
+
+    //  Keep the first pair far busier than the others until a session has
+    //  moved, then for as long again to see the moved ones carry on.
+    int seq[pairs] = {0};
+    int migrations = 0;
+    int after = -1;
+    void *watch = zmq_stopwatch_start ();
+    while (after != 0) {
+        for (int i = 0; i < pairs; i++)
+            exchange_in_order (binds[i], connects[i], i == 0 ? 40 : 1,
+                               &seq[i]);
+        TEST_ASSERT_SUCCESS_ERRNO (
+          zmq_ctx_get_ext (ctx, ZMQ_IO_THREAD_LOADS, loads, &size));
+        migrations = loads[0].migrations + loads[1].migrations;
+        if (after > 0)
+            after--;
+        else if (after < 0 && migrations > 0)
+            after = 200;
+        else if (after < 0 && zmq_stopwatch_intermediate (watch) > 20000000)
+            break;
+    }
+    zmq_stopwatch_stop (watch);
+    TEST_ASSERT_GREATER_THAN_INT (0, migrations);
+    //  The mailboxes, listeners and connections.
+    TEST_ASSERT_EQUAL_INT (2 + 3 * pairs, loads[0].fds + loads[1].fds);
+    for (int i = 0; i < 2; i++)
+        TEST_ASSERT_TRUE (loads[i].busy >= 0 && loads[i].busy <= 1000);
+
+    //  Closing one end terminates the sessions wherever they now live,
+    //  while the other connections keep working.
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_close (connects[0]));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_close (binds[0]));
+    for (int i = 1; i < pairs; i++)
+        exchange_in_order (binds[i], connects[i], 10, &seq[i]);
+    for (int i = 1; i < pairs; i++) {
+        TEST_ASSERT_SUCCESS_ERRNO (zmq_close (connects[i]));
+        TEST_ASSERT_SUCCESS_ERRNO (zmq_close (binds[i]));
+    }
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_ctx_term (ctx));
+#endif
+}
+
+void test_ctx_io_cost_baseline ()
+{
+#ifdef ZMQ_IO_LOAD_IVL
+    //  Burn CPU time on this thread before the I/O thread starts. Only the
+    //  I/O thread's own CPU time may count towards its cost.
+    const clock_t start = clock ();
+    volatile uint64_t spin = 0;
+    while (clock () - start < CLOCKS_PER_SEC * 3 / 10)
+        spin++;
+
+    void *ctx = zmq_ctx_new ();
+    TEST_ASSERT_NOT_NULL (ctx);
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_ctx_set (ctx, ZMQ_IO_LOAD_IVL, 10));
+    void *socket = zmq_socket (ctx, ZMQ_PAIR);
+    TEST_ASSERT_NOT_NULL (socket);
+    msleep (SETTLE_TIME);
+
+    //  An idle thread uses next to no CPU time.
+    zmq_io_thread_load_t load;
+    size_t size = sizeof load;
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_ctx_get_ext (ctx, ZMQ_IO_THREAD_LOADS, &load, &size));
+    TEST_ASSERT_LESS_THAN_INT (100, load.cost);
+
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_close (socket));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_ctx_term (ctx));
+#endif
+}
+
+void test_ctx_io_weight ()
+{
+#ifdef ZMQ_IO_WEIGHT
+    void *ctx = zmq_ctx_new ();
+    TEST_ASSERT_NOT_NULL (ctx);
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_ctx_set (ctx, ZMQ_IO_THREADS, 2));
+
+    //  The listener goes to the first I/O thread.
+    void *bind = zmq_socket (ctx, ZMQ_PULL);
+    char endpoint[MAX_SOCKET_STRING];
+    bind_loopback_ipv4 (bind, endpoint, sizeof endpoint);
+    msleep (SETTLE_TIME);
+
+    //  A heavy connection gets the second I/O thread to itself.
+    void *heavy = zmq_socket (ctx, ZMQ_PUSH);
+    int weight = -1;
+    TEST_ASSERT_FAILURE_ERRNO (
+      EINVAL, zmq_setsockopt (heavy, ZMQ_IO_WEIGHT, &weight, sizeof weight));
+    weight = 100;
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_setsockopt (heavy, ZMQ_IO_WEIGHT, &weight, sizeof weight));
+    weight = 0;
+    size_t size = sizeof weight;
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_getsockopt (heavy, ZMQ_IO_WEIGHT, &weight, &size));
+    TEST_ASSERT_EQUAL_INT (100, weight);
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_connect (heavy, endpoint));
+    send_string_expect_success (heavy, "heavy", 0);
+    recv_string_expect_success (bind, "heavy", 0);
+
+    const int lights = 2;
+    void *light[lights];
+    for (int i = 0; i < lights; i++) {
+        light[i] = zmq_socket (ctx, ZMQ_PUSH);
+        TEST_ASSERT_SUCCESS_ERRNO (zmq_connect (light[i], endpoint));
+        send_string_expect_success (light[i], "light", 0);
+        recv_string_expect_success (bind, "light", 0);
+    }
+    msleep (SETTLE_TIME);
+
+    zmq_io_thread_load_t loads[2];
+    size = sizeof loads;
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_ctx_get_ext (ctx, ZMQ_IO_THREAD_LOADS, loads, &size));
+    //  The mailbox, listener, the heavy connection's accepted end and
+    //  both ends of the light ones.
+    TEST_ASSERT_EQUAL_INT (3 + 2 * lights, loads[0].fds);
+    //  The mailbox and the heavy connection's connected end.
+    TEST_ASSERT_EQUAL_INT (2, loads[1].fds);
+
+    for (int i = 0; i < lights; i++)
+        TEST_ASSERT_SUCCESS_ERRNO (zmq_close (light[i]));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_close (heavy));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_close (bind));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_ctx_term (ctx));
+#endif
+}
+
+void test_ctx_numa ()
+{
+#ifdef ZMQ_NUMA
+    void *ctx = zmq_ctx_new ();
+    TEST_ASSERT_NOT_NULL (ctx);
+    TEST_ASSERT_EQUAL_INT (0, zmq_ctx_get (ctx, ZMQ_NUMA));
+    TEST_ASSERT_FAILURE_ERRNO (EINVAL, zmq_ctx_set (ctx, ZMQ_NUMA, -1));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_ctx_set (ctx, ZMQ_NUMA, 1));
+    TEST_ASSERT_EQUAL_INT (1, zmq_ctx_get (ctx, ZMQ_NUMA));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_ctx_set (ctx, ZMQ_IO_THREADS, 2));
+
+    //  Whatever the topology, connections still go to some I/O thread.
+    void *bind = zmq_socket (ctx, ZMQ_PULL);
+    char endpoint[MAX_SOCKET_STRING];
+    bind_loopback_ipv4 (bind, endpoint, sizeof endpoint);
+    void *connect = zmq_socket (ctx, ZMQ_PUSH);
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_connect (connect, endpoint));
+    send_string_expect_success (connect, "numa", 0);
+    recv_string_expect_success (bind, "numa", 0);
+
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_close (connect));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_close (bind));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_ctx_term (ctx));
+#endif
+}
+
 void test_ctx_option_max_sockets ()
 {
     TEST_ASSERT_EQUAL_INT (ZMQ_MAX_SOCKETS_DFLT,
@@ -296,6 +746,13 @@ int main (void)
     RUN_TEST (test_ctx_option_ipv6_set);
     RUN_TEST (test_ctx_thread_opts);
     RUN_TEST (test_ctx_zero_copy);
+    RUN_TEST (test_ctx_msg_pool);
+    RUN_TEST (test_ctx_allocator);
+    RUN_TEST (test_ctx_busy_poll);
+    RUN_TEST (test_ctx_io_rebalance);
+    RUN_TEST (test_ctx_io_cost_baseline);
+    RUN_TEST (test_ctx_io_weight);
+    RUN_TEST (test_ctx_numa);
     RUN_TEST (test_ctx_option_blocky);
     return UNITY_END ();
 }
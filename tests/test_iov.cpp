@@ -144,11 +144,114 @@ void test_iov ()
     test_context_socket_close (sb);
 }
 
+#ifdef ZMQ_BUILD_DRAFT_API
+static void count_free (void *data_, void *hint_)
+{
+    LIBZMQ_UNUSED (data_);
+    ++*static_cast<int *> (hint_);
+}
+
+void test_iov_zc ()
+{
+    void *sb = test_context_socket (ZMQ_PULL);
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_bind (sb, "inproc://a"));
+
+    void *sc = test_context_socket (ZMQ_PUSH);
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_connect (sc, "inproc://a"));
+
+    const int num_messages = 10;
+    const size_t msg_size = 100;
+    char buf[num_messages][msg_size];
+    struct iovec send_iov[num_messages];
+    for (int i = 0; i < num_messages; i++) {
+        memset (buf[i], 'a' + i, msg_size);
+        send_iov[i].iov_base = buf[i];
+        send_iov[i].iov_len = msg_size;
+    }
+
+    int freed = 0;
+    TEST_ASSERT_FAILURE_ERRNO (
+      EINVAL, zmq_sendiov_zc (sc, NULL, num_messages, 0, count_free, &freed));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_sendiov_zc (
+      sc, send_iov, num_messages, ZMQ_SNDMORE, count_free, &freed));
+
+    struct iovec recv_iov[num_messages];
+    zmq_msg_t recv_msgs[num_messages];
+    size_t recv_count = num_messages;
+    TEST_ASSERT_FAILURE_ERRNO (
+      EINVAL, zmq_recviov_zc (sb, recv_iov, NULL, &recv_count, 0));
+    TEST_ASSERT_EQUAL_INT (num_messages,
+                           TEST_ASSERT_SUCCESS_ERRNO (zmq_recviov_zc (
+                             sb, recv_iov, recv_msgs, &recv_count, 0)));
+    TEST_ASSERT_EQUAL_INT (num_messages, recv_count);
+
+    //  Over inproc the received parts refer to the very buffers sent
+    for (int i = 0; i < num_messages; i++) {
+        TEST_ASSERT_EQUAL_PTR (buf[i], recv_iov[i].iov_base);
+        TEST_ASSERT_EQUAL_INT (msg_size, recv_iov[i].iov_len);
+    }
+    TEST_ASSERT_EQUAL_INT (0, freed);
+
+    for (int i = 0; i < num_messages; i++)
+        TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_close (&recv_msgs[i]));
+    TEST_ASSERT_EQUAL_INT (num_messages, freed);
+
+    test_context_socket_close (sc);
+    test_context_socket_close (sb);
+}
+
+void test_iov_zc_send_failure ()
+{
+    //  Without a peer the first part cannot be sent.
+    void *sc = test_context_socket (ZMQ_PUSH);
+
+    const int num_messages = 3;
+    char buf[num_messages][10];
+    struct iovec send_iov[num_messages];
+    for (int i = 0; i < num_messages; i++) {
+        memset (buf[i], 'a' + i, sizeof buf[i]);
+        send_iov[i].iov_base = buf[i];
+        send_iov[i].iov_len = sizeof buf[i];
+    }
+
+    //  The failed part is released before returning, the others still
+    //  belong to the caller.
+    int freed = 0;
+    TEST_ASSERT_FAILURE_ERRNO (EAGAIN,
+                               zmq_sendiov_zc (sc, send_iov, num_messages,
+                                               ZMQ_DONTWAIT, count_free,
+                                               &freed));
+    TEST_ASSERT_EQUAL_INT (1, freed);
+
+    //  Nothing of it was left queued on the socket.
+    void *sb = test_context_socket (ZMQ_PULL);
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_bind (sb, "inproc://b"));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_connect (sc, "inproc://b"));
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_sendiov_zc (sc, send_iov + 1, 1, 0, count_free, &freed));
+    zmq_msg_t msg;
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_init (&msg));
+    TEST_ASSERT_EQUAL_INT (
+      sizeof buf[1], TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_recv (&msg, sb, 0)));
+    TEST_ASSERT_EQUAL_PTR (buf[1], zmq_msg_data (&msg));
+    TEST_ASSERT_FALSE (zmq_msg_more (&msg));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_close (&msg));
+    TEST_ASSERT_EQUAL_INT (2, freed);
+
+    test_context_socket_close (sc);
+    test_context_socket_close (sb);
+}
+#endif
+
 int main ()
 {
     setup_test_environment ();
 
     UNITY_BEGIN ();
     RUN_TEST (test_iov);
+#ifdef ZMQ_BUILD_DRAFT_API
+    RUN_TEST (test_iov_zc);
+    RUN_TEST (test_iov_zc_send_failure);
+#endif
     return UNITY_END ();
 }
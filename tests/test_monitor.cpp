@@ -384,7 +384,7 @@ void test_monitor_versioned_stats (bind_function_t bind_function_,
     for (int i = 0; i < pulls_count; ++i) {
         char *push_local_address = NULL;
         char *push_remote_address = NULL;
-        uint64_t queue_stat[2];
+        uint64_t queue_stat[4];
         int64_t event = get_monitor_event_v2 (
           push_mon, queue_stat, &push_local_address, &push_remote_address);
         TEST_ASSERT_EQUAL_STRING (server_endpoint, push_local_address);
@@ -393,6 +393,9 @@ void test_monitor_versioned_stats (bind_function_t bind_function_,
         TEST_ASSERT_EQUAL_INT (ZMQ_EVENT_PIPES_STATS, event);
         TEST_ASSERT_EQUAL_INT (i == 0 ? 0 : send_hwm, queue_stat[0]);
         TEST_ASSERT_EQUAL_INT (0, queue_stat[1]);
+        TEST_ASSERT_EQUAL_INT (i == 0 ? 0 : send_hwm * sizeof (data),
+                               queue_stat[2]);
+        TEST_ASSERT_EQUAL_INT (0, queue_stat[3]);
         free (push_local_address);
         free (push_remote_address);
     }
@@ -30,6 +30,15 @@
 #include "testutil.hpp"
 #include "testutil_unity.hpp"
 
+#include <string.h>
+
+#if defined __linux__
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#endif
+
 SETUP_TEARDOWN_TESTCONTEXT
 
 void test_roundtrip ()
@@ -48,11 +57,202 @@ void test_roundtrip ()
     test_context_socket_close (sb);
 }
 
+#ifdef ZMQ_BUILD_DRAFT_API
+void set_sockopt_memfd (void *socket_)
+{
+    const int threshold = 64 * 1024;
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_setsockopt (
+      socket_, ZMQ_IPC_MEMFD_THRESHOLD, &threshold, sizeof threshold));
+}
+
+void send_pattern (void *socket_, size_t size_, int seed_, int flags_)
+{
+    zmq_msg_t msg;
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_init_size (&msg, size_));
+    unsigned char *data = static_cast<unsigned char *> (zmq_msg_data (&msg));
+    for (size_t i = 0; i < size_; i++)
+        data[i] = static_cast<unsigned char> (seed_ + i * 7);
+    TEST_ASSERT_EQUAL_INT (size_, TEST_ASSERT_SUCCESS_ERRNO (
+                                    zmq_msg_send (&msg, socket_, flags_)));
+}
+
+void recv_pattern (void *socket_, size_t size_, int seed_, bool more_)
+{
+    zmq_msg_t msg;
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_init (&msg));
+    TEST_ASSERT_EQUAL_INT (
+      size_, TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_recv (&msg, socket_, 0)));
+    unsigned char *data = static_cast<unsigned char *> (zmq_msg_data (&msg));
+    size_t i = 0;
+    while (i < size_ && data[i] == static_cast<unsigned char> (seed_ + i * 7))
+        i++;
+    TEST_ASSERT_EQUAL_INT (size_, i);
+    TEST_ASSERT_EQUAL_INT (more_, zmq_msg_more (&msg));
+
+    //  Received data belongs to the application, whatever it came in.
+    if (size_ > 0)
+        data[size_ - 1] = 0;
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_close (&msg));
+}
+
+void test_memfd_transfer (bool sender_opts_in_, bool receiver_opts_in_)
+{
+    char my_endpoint[256];
+
+    void *sb = test_context_socket (ZMQ_PAIR);
+    if (receiver_opts_in_)
+        set_sockopt_memfd (sb);
+    bind_loopback_ipc (sb, my_endpoint, sizeof my_endpoint);
+
+    void *sc = test_context_socket (ZMQ_PAIR);
+    if (sender_opts_in_)
+        set_sockopt_memfd (sc);
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_connect (sc, my_endpoint));
+
+    const size_t sizes[] = {0, 100, 64 * 1024 - 1, 64 * 1024, 3 * 1000 * 1000};
+    const int size_count = sizeof sizes / sizeof sizes[0];
+    for (int i = 0; i < size_count; i++)
+        send_pattern (sc, sizes[i], i, 0);
+
+    //  Large frames in the middle of a multipart message.
+    send_pattern (sc, 10, 1, ZMQ_SNDMORE);
+    send_pattern (sc, 100 * 1000, 2, ZMQ_SNDMORE);
+    send_pattern (sc, 100 * 1000, 3, ZMQ_SNDMORE);
+    send_pattern (sc, 10, 4, 0);
+
+    //  More large frames than fit in a single write's ancillary data.
+    const int burst = 50;
+    for (int i = 0; i < burst; i++)
+        send_pattern (sc, 70 * 1000, i, 0);
+
+    for (int i = 0; i < size_count; i++)
+        recv_pattern (sb, sizes[i], i, false);
+    recv_pattern (sb, 10, 1, true);
+    recv_pattern (sb, 100 * 1000, 2, true);
+    recv_pattern (sb, 100 * 1000, 3, true);
+    recv_pattern (sb, 10, 4, false);
+    for (int i = 0; i < burst; i++)
+        recv_pattern (sb, 70 * 1000, i, false);
+
+    bounce (sb, sc);
+
+    test_context_socket_close (sc);
+    test_context_socket_close (sb);
+}
+
+void test_memfd ()
+{
+    test_memfd_transfer (true, true);
+}
+
+void test_memfd_sender_only ()
+{
+    test_memfd_transfer (true, false);
+}
+
+void test_memfd_receiver_only ()
+{
+    test_memfd_transfer (false, true);
+}
+
+#if defined __linux__
+//  Writes 'size_' bytes with 'fd_count_' copies of 'fd_' passed along.
+static void
+send_with_fds (int s_, const void *data_, size_t size_, int fd_, int fd_count_)
+{
+    int fds[16];
+    for (int i = 0; i < fd_count_; i++)
+        fds[i] = fd_;
+    union
+    {
+        struct cmsghdr align;
+        char buf[CMSG_SPACE (sizeof fds)];
+    } control;
+    memset (&control, 0, sizeof control);
+
+    iovec iov;
+    iov.iov_base = const_cast<void *> (data_);
+    iov.iov_len = size_;
+    msghdr msg;
+    memset (&msg, 0, sizeof msg);
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control.buf;
+    msg.msg_controllen = CMSG_SPACE (fd_count_ * sizeof (int));
+    cmsghdr *cmsg = CMSG_FIRSTHDR (&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN (fd_count_ * sizeof (int));
+    memcpy (CMSG_DATA (cmsg), fds, fd_count_ * sizeof (int));
+    TEST_ASSERT_EQUAL_INT (static_cast<int> (size_),
+                           static_cast<int> (sendmsg (s_, &msg, 0)));
+}
+
+void test_memfd_unclaimed_fds ()
+{
+    //  Unlike a PAIR socket, which turns the next peer away until it has
+    //  noticed the first one is gone, a DEALER takes both.
+    char my_endpoint[256];
+    void *sb = test_context_socket (ZMQ_DEALER);
+    set_sockopt_memfd (sb);
+    bind_loopback_ipc (sb, my_endpoint, sizeof my_endpoint);
+
+    const int s = socket (AF_UNIX, SOCK_STREAM, 0);
+    TEST_ASSERT_NOT_EQUAL (-1, s);
+    struct sockaddr_un addr;
+    memset (&addr, 0, sizeof addr);
+    addr.sun_family = AF_UNIX;
+    strcpy (addr.sun_path, my_endpoint + strlen ("ipc://"));
+    TEST_ASSERT_SUCCESS_RAW_ERRNO (
+      connect (s, reinterpret_cast<struct sockaddr *> (&addr), sizeof addr));
+
+    //  Pass descriptors along with the start of a valid greeting, but no
+    //  frames that would claim them. The second batch overflows what the
+    //  receiver holds on to, and it drops the connection.
+    const int fd = open ("/dev/null", O_RDONLY);
+    TEST_ASSERT_NOT_EQUAL (-1, fd);
+    const unsigned char signature[] = {0xff, 0, 0, 0, 0, 0, 0, 0, 1, 0x7f};
+    send_with_fds (s, signature, 1, fd, 16);
+    msleep (SETTLE_TIME);
+    send_with_fds (s, signature + 1, 1, fd, 16);
+    close (fd);
+
+    //  Read the peer's greeting until the connection is closed.
+    struct timeval timeout = {5, 0};
+    TEST_ASSERT_SUCCESS_RAW_ERRNO (
+      setsockopt (s, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof timeout));
+    char buffer[64];
+    ssize_t rc;
+    do
+        rc = recv (s, buffer, sizeof buffer, 0);
+    while (rc > 0);
+    TEST_ASSERT_TRUE (rc == 0 || errno == ECONNRESET);
+    close (s);
+
+    //  The socket keeps working.
+    void *sc = test_context_socket (ZMQ_DEALER);
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_connect (sc, my_endpoint));
+    bounce (sb, sc);
+
+    test_context_socket_close (sc);
+    test_context_socket_close (sb);
+}
+#endif
+#endif
+
 int main (void)
 {
     setup_test_environment ();
 
     UNITY_BEGIN ();
     RUN_TEST (test_roundtrip);
+#ifdef ZMQ_BUILD_DRAFT_API
+    RUN_TEST (test_memfd);
+    RUN_TEST (test_memfd_sender_only);
+    RUN_TEST (test_memfd_receiver_only);
+#if defined __linux__
+    RUN_TEST (test_memfd_unclaimed_fds);
+#endif
+#endif
     return UNITY_END ();
 }
@@ -0,0 +1,185 @@
+/*
+    Copyright (c) 2007-2016 Contributors as noted in the AUTHORS file
+
+    This file is part of libzmq, the ZeroMQ core engine in C++.
+
+    libzmq is free software; you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    As a special exception, the Contributors give you permission to link
+    this library with independent modules to produce an executable,
+    regardless of the license terms of these independent modules, and to
+    copy and distribute the resulting executable under terms of your choice,
+    provided that you also meet, for each linked independent module, the
+    terms and conditions of the license of that module. An independent
+    module is a module which is not derived from or based on this library.
+    If you modify this library, you must extend this exception to your
+    version of the library.
+
+    libzmq is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "testutil.hpp"
+#include "testutil_unity.hpp"
+
+#include <stdlib.h>
+#include <string.h>
+
+SETUP_TEARDOWN_TESTCONTEXT
+
+static void bind_loopback_shm (void *socket_, char *my_endpoint_, size_t len_)
+{
+    if (!zmq_has ("shm")) {
+        TEST_IGNORE_MESSAGE ("shm is not available");
+    }
+
+    test_bind (socket_, "shm://*", my_endpoint_, len_);
+}
+
+void test_roundtrip ()
+{
+    char my_endpoint[256];
+
+    void *sb = test_context_socket (ZMQ_PAIR);
+    bind_loopback_shm (sb, my_endpoint, sizeof my_endpoint);
+    TEST_ASSERT_EQUAL_STRING_LEN ("shm://", my_endpoint, 6);
+
+    void *sc = test_context_socket (ZMQ_PAIR);
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_connect (sc, my_endpoint));
+
+    bounce (sb, sc);
+
+    test_context_socket_close (sc);
+    test_context_socket_close (sb);
+}
+
+//  Messages of all sizes, including ones larger than the rings, must
+//  arrive intact and in order while the rings wrap around.
+void test_message_sizes ()
+{
+    char my_endpoint[256];
+
+    void *pull = test_context_socket (ZMQ_PULL);
+    bind_loopback_shm (pull, my_endpoint, sizeof my_endpoint);
+
+    void *push = test_context_socket (ZMQ_PUSH);
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_connect (push, my_endpoint));
+
+    const size_t sizes[] = {0, 1, 7, 8, 9, 255, 4096, 70000, 1000000};
+    const int count = 200;
+    const size_t max_size = sizes[sizeof sizes / sizeof sizes[0] - 1];
+    unsigned char *buf = static_cast<unsigned char *> (malloc (max_size));
+    TEST_ASSERT_NOT_NULL (buf);
+
+    for (int i = 0; i < count; i++) {
+        const size_t size = sizes[i % (sizeof sizes / sizeof sizes[0])];
+        for (size_t j = 0; j < size; j++)
+            buf[j] = static_cast<unsigned char> (i + j);
+        TEST_ASSERT_EQUAL_INT (
+          static_cast<int> (size),
+          TEST_ASSERT_SUCCESS_ERRNO (zmq_send (push, buf, size, 0)));
+    }
+
+    zmq_msg_t msg;
+    for (int i = 0; i < count; i++) {
+        const size_t size = sizes[i % (sizeof sizes / sizeof sizes[0])];
+        TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_init (&msg));
+        TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_recv (&msg, pull, 0));
+        TEST_ASSERT_EQUAL_UINT (size, zmq_msg_size (&msg));
+        const unsigned char *data =
+          static_cast<const unsigned char *> (zmq_msg_data (&msg));
+        for (size_t j = 0; j < size; j++)
+            if (data[j] != static_cast<unsigned char> (i + j))
+                TEST_FAIL_MESSAGE ("message corrupted");
+        TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_close (&msg));
+    }
+
+    free (buf);
+    test_context_socket_close (push);
+    test_context_socket_close (pull);
+}
+
+void test_routing_id ()
+{
+    char my_endpoint[256];
+
+    void *router = test_context_socket (ZMQ_ROUTER);
+    bind_loopback_shm (router, my_endpoint, sizeof my_endpoint);
+
+    void *dealer = test_context_socket (ZMQ_DEALER);
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_setsockopt (dealer, ZMQ_ROUTING_ID, "X", 2));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_connect (dealer, my_endpoint));
+
+    s_send_seq (dealer, "A", "B", SEQ_END);
+    s_recv_seq (router, "X", "A", "B", SEQ_END);
+
+    s_send_seq (router, "X", "C", SEQ_END);
+    s_recv_seq (dealer, "C", SEQ_END);
+
+    test_context_socket_close (dealer);
+    test_context_socket_close (router);
+}
+
+void test_stream_not_supported ()
+{
+    if (!zmq_has ("shm")) {
+        TEST_IGNORE_MESSAGE ("shm is not available");
+    }
+
+    void *stream = test_context_socket (ZMQ_STREAM);
+    TEST_ASSERT_FAILURE_ERRNO (ENOCOMPATPROTO,
+                               zmq_bind (stream, "shm://*"));
+    test_context_socket_close (stream);
+}
+
+void test_security_not_supported ()
+{
+    if (!zmq_has ("shm")) {
+        TEST_IGNORE_MESSAGE ("shm is not available");
+    }
+
+    //  A security mechanism is refused on either side.
+    void *server = test_context_socket (ZMQ_PAIR);
+    const int as_server = 1;
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_setsockopt (
+      server, ZMQ_PLAIN_SERVER, &as_server, sizeof (as_server)));
+    TEST_ASSERT_FAILURE_ERRNO (ENOCOMPATPROTO,
+                               zmq_bind (server, "shm://*"));
+    test_context_socket_close (server);
+
+    void *client = test_context_socket (ZMQ_PAIR);
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_setsockopt (client, ZMQ_PLAIN_USERNAME, "admin", 5));
+    TEST_ASSERT_FAILURE_ERRNO (ENOCOMPATPROTO,
+                               zmq_connect (client, "shm://zmq-test"));
+    test_context_socket_close (client);
+
+    //  So is a ZAP domain, even with the NULL mechanism.
+    void *zap = test_context_socket (ZMQ_PAIR);
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_setsockopt (zap, ZMQ_ZAP_DOMAIN, "test", 4));
+    TEST_ASSERT_FAILURE_ERRNO (ENOCOMPATPROTO, zmq_bind (zap, "shm://*"));
+    test_context_socket_close (zap);
+}
+
+int main (void)
+{
+    setup_test_environment ();
+
+    UNITY_BEGIN ();
+    RUN_TEST (test_roundtrip);
+    RUN_TEST (test_message_sizes);
+    RUN_TEST (test_routing_id);
+    RUN_TEST (test_stream_not_supported);
+    RUN_TEST (test_security_not_supported);
+    return UNITY_END ();
+}
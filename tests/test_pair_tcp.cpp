@@ -106,6 +106,41 @@ void test_pair_tcp_connect_by_name ()
     test_context_socket_close (sb);
 }
 
+void test_pair_tcp_close_after_burst ()
+{
+    //  Closing a socket right after a burst of messages that fill the
+    //  socket buffer must not lose the last batch the engine encoded.
+    void *sb = test_context_socket (ZMQ_PAIR);
+    char my_endpoint[MAX_SOCKET_STRING];
+    bind_loopback_ipv4 (sb, my_endpoint, sizeof my_endpoint);
+
+    void *sc = test_context_socket (ZMQ_PAIR);
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_connect (sc, my_endpoint));
+    bounce (sb, sc);
+
+    const int count = 100000;
+    uint8_t buffer[8];
+    memset (buffer, 0, sizeof buffer);
+    for (int i = 0; i < count; i++) {
+        memcpy (buffer, &i, sizeof i);
+        send_array_expect_success (sc, buffer, 0);
+    }
+    test_context_socket_close (sc);
+
+    const int timeout = 5000;
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_setsockopt (sb, ZMQ_RCVTIMEO, &timeout, sizeof timeout));
+    for (int i = 0; i < count; i++) {
+        TEST_ASSERT_EQUAL_INT (
+          static_cast<int> (sizeof buffer),
+          TEST_ASSERT_SUCCESS_ERRNO (zmq_recv (sb, buffer, sizeof buffer, 0)));
+        int seq;
+        memcpy (&seq, buffer, sizeof seq);
+        TEST_ASSERT_EQUAL_INT (i, seq);
+    }
+
+    test_context_socket_close (sb);
+}
 
 #ifdef ZMQ_BUILD_DRAFT
 void test_pair_tcp_fastpath ()
@@ -114,6 +149,144 @@ void test_pair_tcp_fastpath ()
 }
 #endif
 
+#ifdef ZMQ_BUILD_DRAFT_API
+void set_sockopt_zerocopy (void *socket_)
+{
+    const int threshold = 1024;
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_setsockopt (
+      socket_, ZMQ_TCP_ZEROCOPY_THRESHOLD, &threshold, sizeof threshold));
+}
+
+const int zerocopy_message_count = 64;
+const size_t zerocopy_message_size = 128 * 1024;
+
+void send_zerocopy_messages (void *socket_)
+{
+    const int message_count = zerocopy_message_count;
+    const size_t message_size = zerocopy_message_size;
+    for (int i = 0; i < message_count; i++) {
+        zmq_msg_t msg;
+        TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_init_size (&msg, message_size));
+        memset (zmq_msg_data (&msg), 'a' + i % 26, message_size);
+        TEST_ASSERT_EQUAL_INT (message_size,
+                               TEST_ASSERT_SUCCESS_ERRNO (
+                                 zmq_msg_send (&msg, socket_, 0)));
+    }
+}
+
+void recv_zerocopy_messages (void *socket_)
+{
+    const int message_count = zerocopy_message_count;
+    const size_t message_size = zerocopy_message_size;
+    char *expected = static_cast<char *> (malloc (message_size));
+    for (int i = 0; i < message_count; i++) {
+        zmq_msg_t msg;
+        TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_init (&msg));
+        TEST_ASSERT_EQUAL_INT (
+          message_size,
+          TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_recv (&msg, socket_, 0)));
+        memset (expected, 'a' + i % 26, message_size);
+        TEST_ASSERT_EQUAL_MEMORY (expected, zmq_msg_data (&msg),
+                                  message_size);
+        TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_close (&msg));
+    }
+    free (expected);
+}
+
+uint64_t get_zerocopy_completed (void *socket_)
+{
+    uint64_t completed;
+    size_t completed_size = sizeof completed;
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_getsockopt (
+      socket_, ZMQ_TCP_ZEROCOPY_COMPLETED, &completed, &completed_size));
+    return completed;
+}
+
+void test_pair_tcp_zerocopy ()
+{
+    void *sb = test_context_socket (ZMQ_PAIR);
+    set_sockopt_zerocopy (sb);
+
+    char my_endpoint[MAX_SOCKET_STRING];
+    bind_loopback_ipv4 (sb, my_endpoint, sizeof my_endpoint);
+
+    void *sc = test_context_socket (ZMQ_PAIR);
+    set_sockopt_zerocopy (sc);
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_connect (sc, my_endpoint));
+
+    bounce (sb, sc);
+    TEST_ASSERT_EQUAL_UINT64 (0, get_zerocopy_completed (sc));
+
+    //  Messages above the threshold must arrive intact, even though
+    //  their buffers are only referred to by the kernel when sent.
+    send_zerocopy_messages (sc);
+    recv_zerocopy_messages (sb);
+
+    //  The kernel reports zero-copy sends only, so completions prove
+    //  that path was taken. They may trail the data a little.
+    void *watch = zmq_stopwatch_start ();
+    while (get_zerocopy_completed (sc) == 0
+           && zmq_stopwatch_intermediate (watch) < 5000000)
+        msleep (SETTLE_TIME / 10);
+    zmq_stopwatch_stop (watch);
+    TEST_ASSERT_GREATER_THAN_UINT64 (0, get_zerocopy_completed (sc));
+
+    //  Closing the sender right away tears its connection down while
+    //  sends are still in flight; the data must not be freed under the
+    //  kernel before it has been delivered.
+    send_zerocopy_messages (sc);
+    test_context_socket_close (sc);
+    recv_zerocopy_messages (sb);
+
+    test_context_socket_close (sb);
+}
+
+uint64_t get_memory (void *socket_, int option_)
+{
+    uint64_t memory;
+    size_t memory_size = sizeof memory;
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_getsockopt (socket_, option_, &memory, &memory_size));
+    return memory;
+}
+
+void test_pair_tcp_memory ()
+{
+    void *sb = test_context_socket (ZMQ_PAIR);
+    char my_endpoint[MAX_SOCKET_STRING];
+    bind_loopback_ipv4 (sb, my_endpoint, sizeof my_endpoint);
+
+    void *sc = test_context_socket (ZMQ_PAIR);
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_connect (sc, my_endpoint));
+
+    bounce (sb, sc);
+
+    //  Idle queues hold a small chunk only.
+    const uint64_t queue_memory = get_memory (sb, ZMQ_QUEUE_MEMORY);
+    TEST_ASSERT_GREATER_THAN_UINT64 (0, queue_memory);
+    TEST_ASSERT_LESS_THAN_UINT64 (256 * sizeof (zmq_msg_t), queue_memory);
+
+    //  Buffers are held while there is traffic, and given back once
+    //  the connection has been idle for a while. How long that takes
+    //  depends on when the release timers fire, so wait for it.
+    TEST_ASSERT_GREATER_THAN_UINT64 (0, get_memory (sb, ZMQ_BUFFER_MEMORY));
+    void *watch = zmq_stopwatch_start ();
+    while ((get_memory (sb, ZMQ_BUFFER_MEMORY) != 0
+            || get_memory (sc, ZMQ_BUFFER_MEMORY) != 0)
+           && zmq_stopwatch_intermediate (watch) < 10000000)
+        msleep (SETTLE_TIME / 10);
+    zmq_stopwatch_stop (watch);
+    TEST_ASSERT_EQUAL_UINT64 (0, get_memory (sb, ZMQ_BUFFER_MEMORY));
+    TEST_ASSERT_EQUAL_UINT64 (0, get_memory (sc, ZMQ_BUFFER_MEMORY));
+
+    //  They come back when needed.
+    bounce (sb, sc);
+
+    test_context_socket_close (sc);
+    test_context_socket_close (sb);
+}
+#endif
+
 #ifdef _WIN32
 void test_io_completion_port ()
 {
@@ -150,9 +323,14 @@ int main ()
     UNITY_BEGIN ();
     RUN_TEST (test_pair_tcp_regular);
     RUN_TEST (test_pair_tcp_connect_by_name);
+    RUN_TEST (test_pair_tcp_close_after_burst);
 #ifdef ZMQ_BUILD_DRAFT
     RUN_TEST (test_pair_tcp_fastpath);
 #endif
+#ifdef ZMQ_BUILD_DRAFT_API
+    RUN_TEST (test_pair_tcp_zerocopy);
+    RUN_TEST (test_pair_tcp_memory);
+#endif
 #ifdef _WIN32
     RUN_TEST (test_io_completion_port);
 #endif
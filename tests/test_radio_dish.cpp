@@ -250,6 +250,104 @@ void test_radio_dish_udp (int ipv6_)
 }
 MAKE_TEST_V4V6 (test_radio_dish_udp)
 
+void test_radio_dish_udp_batch (int ipv6_)
+{
+    void *radio = test_context_socket (ZMQ_RADIO);
+    void *dish = test_context_socket (ZMQ_DISH);
+
+    int batch_size = 0;
+    TEST_ASSERT_FAILURE_ERRNO (
+      EINVAL,
+      zmq_setsockopt (dish, ZMQ_UDP_BATCH_SIZE, &batch_size, sizeof (int)));
+
+    batch_size = 16;
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_setsockopt (radio, ZMQ_UDP_BATCH_SIZE, &batch_size, sizeof (int)));
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_setsockopt (dish, ZMQ_UDP_BATCH_SIZE, &batch_size, sizeof (int)));
+
+    batch_size = 0;
+    size_t size = sizeof (int);
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_getsockopt (dish, ZMQ_UDP_BATCH_SIZE, &batch_size, &size));
+    TEST_ASSERT_EQUAL_INT (16, batch_size);
+
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_setsockopt (radio, ZMQ_IPV6, &ipv6_, sizeof (int)));
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_setsockopt (dish, ZMQ_IPV6, &ipv6_, sizeof (int)));
+
+    const char *radio_url = ipv6_ ? "udp://[::1]:5556" : "udp://127.0.0.1:5556";
+
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_bind (dish, "udp://*:5556"));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_connect (radio, radio_url));
+
+    msleep (SETTLE_TIME);
+
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_join (dish, "TV"));
+
+    //  More messages than fit into a single batch
+    const int message_count = 40;
+    char body[16];
+    for (int i = 0; i < message_count; i++) {
+        sprintf (body, "Episode %d", i);
+        msg_send_expect_success (radio, "TV", body);
+    }
+    for (int i = 0; i < message_count; i++) {
+        sprintf (body, "Episode %d", i);
+        msg_recv_cmp (dish, "TV", body);
+    }
+
+    test_context_socket_close (dish);
+    test_context_socket_close (radio);
+}
+MAKE_TEST_V4V6 (test_radio_dish_udp_batch)
+
+void test_radio_dish_udp_batch_hwm (int ipv6_)
+{
+    void *radio = test_context_socket (ZMQ_RADIO);
+    void *dish = test_context_socket (ZMQ_DISH);
+
+    //  The dish's pipe fills up in the middle of a batch; the datagrams
+    //  received with it must not be dropped.
+    int batch_size = 16;
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_setsockopt (dish, ZMQ_UDP_BATCH_SIZE, &batch_size, sizeof (int)));
+    int hwm = 4;
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_setsockopt (dish, ZMQ_RCVHWM, &hwm, sizeof (int)));
+
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_setsockopt (radio, ZMQ_IPV6, &ipv6_, sizeof (int)));
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_setsockopt (dish, ZMQ_IPV6, &ipv6_, sizeof (int)));
+
+    const char *radio_url = ipv6_ ? "udp://[::1]:5556" : "udp://127.0.0.1:5556";
+
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_bind (dish, "udp://*:5556"));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_connect (radio, radio_url));
+
+    msleep (SETTLE_TIME);
+
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_join (dish, "TV"));
+
+    const int message_count = 12;
+    char body[16];
+    for (int i = 0; i < message_count; i++) {
+        sprintf (body, "Episode %d", i);
+        msg_send_expect_success (radio, "TV", body);
+    }
+    msleep (SETTLE_TIME);
+    for (int i = 0; i < message_count; i++) {
+        sprintf (body, "Episode %d", i);
+        msg_recv_cmp (dish, "TV", body);
+    }
+
+    test_context_socket_close (dish);
+    test_context_socket_close (radio);
+}
+MAKE_TEST_V4V6 (test_radio_dish_udp_batch_hwm)
+
 #define MCAST_IPV4 "226.8.5.5"
 #define MCAST_IPV6 "ff02::7a65:726f:6df1:0a01"
 
@@ -514,6 +612,10 @@ int main (void)
     RUN_TEST (test_radio_dish_tcp_poll_ipv6);
     RUN_TEST (test_radio_dish_udp_ipv4);
     RUN_TEST (test_radio_dish_udp_ipv6);
+    RUN_TEST (test_radio_dish_udp_batch_ipv4);
+    RUN_TEST (test_radio_dish_udp_batch_ipv6);
+    RUN_TEST (test_radio_dish_udp_batch_hwm_ipv4);
+    RUN_TEST (test_radio_dish_udp_batch_hwm_ipv6);
 
     RUN_TEST (test_radio_dish_mcast_ipv4);
     RUN_TEST (test_radio_dish_no_loop_ipv4);
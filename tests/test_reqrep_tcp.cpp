@@ -204,6 +204,58 @@ void test_multi_connect_same_port_ipv6 ()
     test_multi_connect_same_port (true);
 }
 
+void test_sharded_bind ()
+{
+#ifdef ZMQ_TCP_SHARDED_BIND
+    void *ctx = zmq_ctx_new ();
+    TEST_ASSERT_NOT_NULL (ctx);
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_ctx_set (ctx, ZMQ_IO_THREADS, 4));
+
+    void *sb = zmq_socket (ctx, ZMQ_ROUTER);
+    int sharded = 0;
+    size_t size = sizeof sharded;
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_getsockopt (sb, ZMQ_TCP_SHARDED_BIND, &sharded, &size));
+    TEST_ASSERT_EQUAL_INT (0, sharded);
+    sharded = 1;
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_setsockopt (sb, ZMQ_TCP_SHARDED_BIND, &sharded, sizeof sharded));
+    char my_endpoint[MAX_SOCKET_STRING];
+    bind_loopback_ipv4 (sb, my_endpoint, sizeof my_endpoint);
+
+    //  Whichever shard accepts a connection, it reaches the same socket.
+    const int client_count = 16;
+    void *clients[client_count];
+    for (int i = 0; i < client_count; i++) {
+        clients[i] = zmq_socket (ctx, ZMQ_DEALER);
+        TEST_ASSERT_SUCCESS_ERRNO (zmq_connect (clients[i], my_endpoint));
+        send_string_expect_success (clients[i], "ping", 0);
+    }
+    for (int i = 0; i < client_count; i++) {
+        zmq_msg_t routing_id;
+        TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_init (&routing_id));
+        TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_recv (&routing_id, sb, 0));
+        recv_string_expect_success (sb, "ping", 0);
+        TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_send (&routing_id, sb, ZMQ_SNDMORE));
+        send_string_expect_success (sb, "pong", 0);
+    }
+    for (int i = 0; i < client_count; i++) {
+        recv_string_expect_success (clients[i], "pong", 0);
+        TEST_ASSERT_SUCCESS_ERRNO (zmq_close (clients[i]));
+    }
+
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_unbind (sb, my_endpoint));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_close (sb));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_ctx_term (ctx));
+
+    //  All the shards are closed with the context, freeing the port for
+    //  a plain bind.
+    sb = test_context_socket (ZMQ_ROUTER);
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_bind (sb, my_endpoint));
+    test_context_socket_close (sb);
+#endif
+}
+
 int main (void)
 {
     setup_test_environment ();
@@ -215,6 +267,7 @@ int main (void)
     RUN_TEST (test_single_connect_ipv6);
     RUN_TEST (test_multi_connect_ipv6);
     RUN_TEST (test_multi_connect_same_port_ipv6);
+    RUN_TEST (test_sharded_bind);
 
     return UNITY_END ();
 }
@@ -591,6 +591,228 @@ void test_null_client_secret_key ()
                    valid_client_public, null_key);
 }
 
+#ifdef ZMQ_BUILD_DRAFT_API
+//  Restricts the data phase ciphers of socket_ to ciphers_, skipping the
+//  test where they are not available in this build or on this CPU.
+static void set_curve_ciphers_or_ignore (void *socket_, const char *ciphers_)
+{
+    if (zmq_setsockopt (socket_, ZMQ_CURVE_CIPHERS, ciphers_,
+                        strlen (ciphers_))
+        != 0) {
+        TEST_ASSERT_EQUAL_INT (EINVAL, zmq_errno ());
+        test_context_socket_close (socket_);
+        TEST_IGNORE_MESSAGE ("data phase cipher not available");
+    }
+}
+
+static void *create_curve_client ()
+{
+    void *client = test_context_socket (ZMQ_DEALER);
+    curve_client_data_t curve_client_data = {
+      valid_server_public, valid_client_public, valid_client_secret};
+    socket_config_curve_client (client, &curve_client_data);
+    return client;
+}
+
+//  Sends a message from server_ to client_ and returns the cipher the
+//  server confirmed to the client, or NULL if it did not confirm any.
+static const char *bounce_and_get_cipher (void *server_, void *client_)
+{
+    bounce (server_, client_);
+
+    send_string_expect_success (server_, "cipher", 0);
+    zmq_msg_t msg;
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_init (&msg));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_recv (&msg, client_, 0));
+    const char *cipher = zmq_msg_gets (&msg, "CurveZMQ-Cipher");
+    static char cipher_buf[64];
+    if (cipher) {
+        TEST_ASSERT_LESS_THAN (sizeof cipher_buf, strlen (cipher));
+        strcpy (cipher_buf, cipher);
+    }
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_close (&msg));
+    return cipher ? cipher_buf : NULL;
+}
+
+static void test_curve_data_cipher (const char *cipher_)
+{
+    void *client = create_curve_client ();
+    set_curve_ciphers_or_ignore (client, cipher_);
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_connect (client, my_endpoint));
+
+    TEST_ASSERT_EQUAL_STRING (cipher_, bounce_and_get_cipher (server, client));
+
+    //  Frames of all sizes survive the round trip.
+    const size_t sizes[] = {0, 1, 255, 256, 65536};
+    for (size_t i = 0; i < sizeof sizes / sizeof sizes[0]; i++) {
+        char *data = static_cast<char *> (malloc (sizes[i] + 1));
+        for (size_t j = 0; j < sizes[i]; j++)
+            data[j] = static_cast<char> (j % 251);
+        TEST_ASSERT_EQUAL_INT (
+          static_cast<int> (sizes[i]),
+          TEST_ASSERT_SUCCESS_ERRNO (
+            zmq_send (client, data, sizes[i], ZMQ_SNDMORE)));
+        send_string_expect_success (client, "end", 0);
+
+        zmq_msg_t msg;
+        TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_init (&msg));
+        TEST_ASSERT_EQUAL_INT (
+          static_cast<int> (sizes[i]),
+          TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_recv (&msg, server, 0)));
+        TEST_ASSERT_TRUE (zmq_msg_more (&msg));
+        if (sizes[i] > 0)
+            TEST_ASSERT_EQUAL_MEMORY (data, zmq_msg_data (&msg), sizes[i]);
+        TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_close (&msg));
+        recv_string_expect_success (server, "end", 0);
+        free (data);
+    }
+
+    test_context_socket_close (client);
+}
+
+void test_curve_data_cipher_aes256gcm ()
+{
+    test_curve_data_cipher ("AES-256-GCM");
+}
+
+void test_curve_data_cipher_chacha20poly1305 ()
+{
+    test_curve_data_cipher ("ChaCha20-Poly1305");
+}
+
+void test_curve_data_cipher_fallback ()
+{
+    void *client = create_curve_client ();
+    TEST_ASSERT_FAILURE_ERRNO (
+      EINVAL, zmq_setsockopt (client, ZMQ_CURVE_CIPHERS, "ROT13", 5));
+
+    //  A client offering no cipher falls back to crypto_box.
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_setsockopt (client, ZMQ_CURVE_CIPHERS, NULL, 0));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_connect (client, my_endpoint));
+    TEST_ASSERT_NULL (bounce_and_get_cipher (server, client));
+    test_context_socket_close (client);
+
+    //  So does a server accepting none.
+    void *plain_server = test_context_socket (ZMQ_DEALER);
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_setsockopt (plain_server, ZMQ_ROUTING_ID, "IDENT", 5));
+    socket_config_curve_server (plain_server, valid_server_secret);
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_setsockopt (plain_server, ZMQ_CURVE_CIPHERS, NULL, 0));
+    char plain_endpoint[MAX_SOCKET_STRING];
+    bind_loopback_ipv4 (plain_server, plain_endpoint, sizeof plain_endpoint);
+
+    client = create_curve_client ();
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_connect (client, plain_endpoint));
+    TEST_ASSERT_NULL (bounce_and_get_cipher (plain_server, client));
+    test_context_socket_close (client);
+    test_context_socket_close (plain_server);
+}
+
+//  Relays a single TCP connection to the server and, once asked to, flips
+//  the last byte of the next chunk of data the client sends.
+struct tamper_relay_t
+{
+    fd_t listener;
+    fd_t server;
+    void *tamper;
+};
+
+static bool relay_chunk (fd_t from_, fd_t to_, void *tamper_)
+{
+    char buf[8192];
+    const int n = recv (from_, buf, sizeof buf, 0);
+    if (n <= 0)
+        return false;
+    if (tamper_ && zmq_atomic_counter_value (tamper_) > 0) {
+        buf[n - 1] ^= 0x01;
+        zmq_atomic_counter_set (tamper_, 0);
+    }
+    for (int sent = 0; sent < n;) {
+        const int rc = send (to_, buf + sent, n - sent, 0);
+        if (rc <= 0)
+            return false;
+        sent += rc;
+    }
+    return true;
+}
+
+static void tamper_relay (void *arg_)
+{
+    tamper_relay_t *relay = static_cast<tamper_relay_t *> (arg_);
+    const fd_t client = accept (relay->listener, NULL, NULL);
+    if (client == retired_fd)
+        return;
+
+    while (true) {
+        fd_set fds;
+        FD_ZERO (&fds);
+        FD_SET (client, &fds);
+        FD_SET (relay->server, &fds);
+        const fd_t max_fd = client > relay->server ? client : relay->server;
+        if (select (static_cast<int> (max_fd) + 1, &fds, NULL, NULL, NULL)
+            <= 0)
+            break;
+        if (FD_ISSET (client, &fds)
+            && !relay_chunk (client, relay->server, relay->tamper))
+            break;
+        if (FD_ISSET (relay->server, &fds)
+            && !relay_chunk (relay->server, client, NULL))
+            break;
+    }
+    close (client);
+}
+
+void test_curve_data_cipher_tampered_frame ()
+{
+    void *client = create_curve_client ();
+    set_curve_ciphers_or_ignore (client, "ChaCha20-Poly1305");
+
+    tamper_relay_t relay;
+    relay.listener = socket (AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    TEST_ASSERT_NOT_EQUAL (retired_fd, relay.listener);
+    struct sockaddr_in addr;
+    memset (&addr, 0, sizeof addr);
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl (INADDR_LOOPBACK);
+    TEST_ASSERT_SUCCESS_RAW_ERRNO (bind (
+      relay.listener, reinterpret_cast<struct sockaddr *> (&addr), sizeof addr));
+    TEST_ASSERT_SUCCESS_RAW_ERRNO (listen (relay.listener, 1));
+    socklen_t addr_len = sizeof addr;
+    TEST_ASSERT_SUCCESS_RAW_ERRNO (getsockname (
+      relay.listener, reinterpret_cast<struct sockaddr *> (&addr), &addr_len));
+    relay.server = connect_vanilla_socket (my_endpoint);
+    relay.tamper = zmq_atomic_counter_new ();
+    void *relay_thread = zmq_threadstart (&tamper_relay, &relay);
+
+    char relay_endpoint[MAX_SOCKET_STRING];
+    snprintf (relay_endpoint, sizeof relay_endpoint, "tcp://127.0.0.1:%u",
+              ntohs (addr.sin_port));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_connect (client, relay_endpoint));
+
+    TEST_ASSERT_EQUAL_STRING ("ChaCha20-Poly1305",
+                              bounce_and_get_cipher (server, client));
+    TEST_ASSERT_EQUAL_INT (ZMQ_EVENT_HANDSHAKE_SUCCEEDED,
+                           get_monitor_event_with_timeout (server_mon, NULL,
+                                                           NULL, -1));
+
+    //  The altered frame fails authentication and the server drops the
+    //  connection instead of delivering it.
+    zmq_atomic_counter_set (relay.tamper, 1);
+    send_string_expect_success (client, "tampered", 0);
+    zmq_setsockopt (server, ZMQ_RCVTIMEO, &timeout, sizeof (timeout));
+    TEST_ASSERT_FAILURE_ERRNO (EAGAIN, zmq_recv (server, NULL, 0, 0));
+    expect_monitor_event_multiple (server_mon,
+                                   ZMQ_EVENT_HANDSHAKE_FAILED_PROTOCOL,
+                                   ZMQ_PROTOCOL_ERROR_ZMTP_CRYPTOGRAPHIC);
+
+    test_context_socket_close_zero_linger (client);
+    zmq_threadclose (relay_thread);
+    close (relay.listener);
+    zmq_atomic_counter_destroy (&relay.tamper);
+}
+#endif
 
 int main (void)
 {
@@ -625,6 +847,14 @@ int main (void)
     RUN_TEST (test_curve_security_invalid_initiate_command_encrypted_cookie);
     RUN_TEST (test_curve_security_invalid_initiate_command_encrypted_content);
 
+#ifdef ZMQ_BUILD_DRAFT_API
+    //  tests of the data phase cipher negotiation
+    RUN_TEST (test_curve_data_cipher_aes256gcm);
+    RUN_TEST (test_curve_data_cipher_chacha20poly1305);
+    RUN_TEST (test_curve_data_cipher_fallback);
+    RUN_TEST (test_curve_data_cipher_tampered_frame);
+#endif
+
     // TODO this requires a deviating test setup, must be moved to a separate executable/fixture
     //  test with a large routing id (resulting in large metadata)
     fprintf (stderr,
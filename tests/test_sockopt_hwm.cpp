@@ -30,6 +30,8 @@
 #include "testutil.hpp"
 #include "testutil_unity.hpp"
 
+#include <string.h>
+
 SETUP_TEARDOWN_TESTCONTEXT
 
 const int MAX_SENDS = 10000;
@@ -104,6 +106,66 @@ void test_change_after_connected ()
     test_context_socket_close (connect_socket);
 }
 
+#ifdef ZMQ_BUILD_DRAFT_API
+void test_bytes_before_connected ()
+{
+    void *bind_socket = test_context_socket (ZMQ_PUSH);
+    void *connect_socket = test_context_socket (ZMQ_PULL);
+
+    int64_t val = 1000;
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_setsockopt (connect_socket, ZMQ_RCVHWM_BYTES, &val, sizeof (val)));
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_setsockopt (bind_socket, ZMQ_SNDHWM_BYTES, &val, sizeof (val)));
+
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_connect (connect_socket, "inproc://a"));
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_bind (bind_socket, "inproc://a"));
+
+    size_t placeholder = sizeof (val);
+    val = 0;
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_getsockopt (bind_socket, ZMQ_SNDHWM_BYTES, &val, &placeholder));
+    TEST_ASSERT_EQUAL_INT (1000, val);
+
+    //  Like message HWMs, the byte HWMs of both inproc peers add up; the
+    //  message that crosses the limit is still queued.
+    char data[100];
+    memset (data, 0, sizeof (data));
+    int send_count = 0;
+    while (send_count < MAX_SENDS
+           && zmq_send (bind_socket, data, sizeof (data), ZMQ_DONTWAIT)
+                == sizeof (data))
+        ++send_count;
+
+    TEST_ASSERT_EQUAL_INT (20, send_count);
+
+    //  Reading half of the bytes lets the writer resume.
+    for (int i = 0; i < 10; ++i)
+        TEST_ASSERT_EQUAL_INT (sizeof (data),
+                               zmq_recv (connect_socket, data, sizeof (data), 0));
+    TEST_ASSERT_EQUAL_INT (sizeof (data),
+                           zmq_send (bind_socket, data, sizeof (data), 0));
+
+    test_context_socket_close (bind_socket);
+    test_context_socket_close (connect_socket);
+}
+
+void test_bytes_invalid ()
+{
+    void *socket = test_context_socket (ZMQ_PUSH);
+
+    int64_t val = -1;
+    TEST_ASSERT_FAILURE_ERRNO (
+      EINVAL, zmq_setsockopt (socket, ZMQ_SNDHWM_BYTES, &val, sizeof (val)));
+    int short_val = 1000;
+    TEST_ASSERT_FAILURE_ERRNO (
+      EINVAL, zmq_setsockopt (socket, ZMQ_RCVHWM_BYTES, &short_val,
+                              sizeof (short_val)));
+
+    test_context_socket_close (socket);
+}
+#endif
+
 int send_until_wouldblock (void *socket_)
 {
     int send_count = 0;
@@ -195,6 +257,10 @@ int main ()
     RUN_TEST (test_change_before_connected);
     RUN_TEST (test_change_after_connected);
     RUN_TEST (test_decrease_when_full);
+#ifdef ZMQ_BUILD_DRAFT_API
+    RUN_TEST (test_bytes_before_connected);
+    RUN_TEST (test_bytes_invalid);
+#endif
 
     return UNITY_END ();
 }
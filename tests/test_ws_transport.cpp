@@ -174,6 +174,94 @@ void test_large_message ()
     test_context_socket_close (sb);
 }
 
+void test_user_data_message ()
+{
+    char connect_address[MAX_SOCKET_STRING + strlen ("/user")];
+    size_t addr_length = sizeof (connect_address);
+    void *sb = test_context_socket (ZMQ_REP);
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_bind (sb, "ws://*:*/user"));
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_getsockopt (sb, ZMQ_LAST_ENDPOINT, connect_address, &addr_length));
+    strcat (connect_address, "/user");
+
+    void *sc = test_context_socket (ZMQ_REQ);
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_connect (sc, connect_address));
+
+    //  The client must mask the payload without touching the buffer
+    //  it does not own.
+    static unsigned char data[1027];
+    for (int i = 0; i < 1027; ++i)
+        data[i] = i % 251;
+
+    zmq_msg_t msg;
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_msg_init_data (&msg, data, sizeof data, NULL, NULL));
+
+    int rc = zmq_msg_send (&msg, sc, 0);
+    TEST_ASSERT_EQUAL_INT (1027, rc);
+
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_init (&msg));
+    rc = zmq_msg_recv (&msg, sb, 0);
+    TEST_ASSERT_EQUAL_INT (1027, rc);
+
+    for (int i = 0; i < 1027; ++i) {
+        TEST_ASSERT_EQUAL_INT (i % 251,
+                               ((unsigned char *) zmq_msg_data (&msg))[i]);
+        TEST_ASSERT_EQUAL_INT (i % 251, data[i]);
+    }
+
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_close (&msg));
+
+    test_context_socket_close (sc);
+    test_context_socket_close (sb);
+}
+
+static void noop_free (void *, void *)
+{
+}
+
+void test_user_data_message_with_free_fn ()
+{
+    char connect_address[MAX_SOCKET_STRING + strlen ("/userfree")];
+    size_t addr_length = sizeof (connect_address);
+    void *sb = test_context_socket (ZMQ_REP);
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_bind (sb, "ws://*:*/userfree"));
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_getsockopt (sb, ZMQ_LAST_ENDPOINT, connect_address, &addr_length));
+    strcat (connect_address, "/userfree");
+
+    void *sc = test_context_socket (ZMQ_REQ);
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_connect (sc, connect_address));
+
+    //  A free function makes this an lmsg, but the buffer is still the
+    //  application's and must not be masked in place.
+    static unsigned char data[1027];
+    for (int i = 0; i < 1027; ++i)
+        data[i] = i % 251;
+
+    zmq_msg_t msg;
+    TEST_ASSERT_SUCCESS_ERRNO (
+      zmq_msg_init_data (&msg, data, sizeof data, noop_free, NULL));
+
+    int rc = zmq_msg_send (&msg, sc, 0);
+    TEST_ASSERT_EQUAL_INT (1027, rc);
+
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_init (&msg));
+    rc = zmq_msg_recv (&msg, sb, 0);
+    TEST_ASSERT_EQUAL_INT (1027, rc);
+
+    for (int i = 0; i < 1027; ++i) {
+        TEST_ASSERT_EQUAL_INT (i % 251,
+                               ((unsigned char *) zmq_msg_data (&msg))[i]);
+        TEST_ASSERT_EQUAL_INT (i % 251, data[i]);
+    }
+
+    TEST_ASSERT_SUCCESS_ERRNO (zmq_msg_close (&msg));
+
+    test_context_socket_close (sc);
+    test_context_socket_close (sb);
+}
+
 void test_curve ()
 {
     char connect_address[MAX_SOCKET_STRING + strlen ("/roundtrip")];
@@ -224,6 +312,8 @@ int main ()
     RUN_TEST (test_roundtrip_without_path);
     RUN_TEST (test_short_message);
     RUN_TEST (test_large_message);
+    RUN_TEST (test_user_data_message);
+    RUN_TEST (test_user_data_message_with_free_fn);
     RUN_TEST (test_heartbeat);
 
     if (zmq_has ("curve"))
@@ -0,0 +1,128 @@
+/*
+    Copyright (c) 2007-2016 Contributors as noted in the AUTHORS file
+
+    This file is part of libzmq, the ZeroMQ core engine in C++.
+
+    libzmq is free software; you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    As a special exception, the Contributors give you permission to link
+    this library with independent modules to produce an executable,
+    regardless of the license terms of these independent modules, and to
+    copy and distribute the resulting executable under terms of your choice,
+    provided that you also meet, for each linked independent module, the
+    terms and conditions of the license of that module. An independent
+    module is a module which is not derived from or based on this library.
+    If you modify this library, you must extend this exception to your
+    version of the library.
+
+    libzmq is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../tests/testutil.hpp"
+
+#include <mpsc_queue.hpp>
+
+#include <unity.h>
+
+void setUp ()
+{
+}
+void tearDown ()
+{
+}
+
+void test_pop_empty ()
+{
+    zmq::mpsc_queue_t<int> queue;
+    int value = -1;
+    TEST_ASSERT_FALSE (queue.pop (&value));
+    TEST_ASSERT_EQUAL_INT (-1, value);
+}
+
+void test_push_and_pop_in_order ()
+{
+    zmq::mpsc_queue_t<int> queue;
+    for (int i = 0; i < 10; i++)
+        queue.push (i);
+    int value = -1;
+    for (int i = 0; i < 10; i++) {
+        TEST_ASSERT_TRUE (queue.pop (&value));
+        TEST_ASSERT_EQUAL_INT (i, value);
+    }
+    TEST_ASSERT_FALSE (queue.pop (&value));
+}
+
+void test_destroy_non_empty ()
+{
+    zmq::mpsc_queue_t<int> queue;
+    queue.push (1);
+    queue.push (2);
+}
+
+const int producers = 4;
+const int per_producer = 10000;
+
+struct producer_t
+{
+    zmq::mpsc_queue_t<int> *queue;
+    int id;
+};
+
+void producer_thread (void *arg_)
+{
+    const producer_t *producer = static_cast<producer_t *> (arg_);
+    for (int i = 0; i < per_producer; i++)
+        producer->queue->push (producer->id * per_producer + i);
+}
+
+void test_concurrent_producers ()
+{
+    zmq::mpsc_queue_t<int> queue;
+    producer_t args[producers];
+    void *threads[producers];
+    for (int i = 0; i < producers; i++) {
+        args[i].queue = &queue;
+        args[i].id = i;
+        threads[i] = zmq_threadstart (producer_thread, &args[i]);
+    }
+
+    //  Each producer's elements come out in the order it pushed them.
+    int next[producers] = {0};
+    int received = 0;
+    while (received < producers * per_producer) {
+        int value;
+        if (!queue.pop (&value))
+            continue;
+        const int id = value / per_producer;
+        TEST_ASSERT_EQUAL_INT (next[id], value % per_producer);
+        next[id]++;
+        received++;
+    }
+
+    for (int i = 0; i < producers; i++)
+        zmq_threadclose (threads[i]);
+    int value;
+    TEST_ASSERT_FALSE (queue.pop (&value));
+}
+
+int main (void)
+{
+    setup_test_environment ();
+
+    UNITY_BEGIN ();
+    RUN_TEST (test_pop_empty);
+    RUN_TEST (test_push_and_pop_in_order);
+    RUN_TEST (test_destroy_non_empty);
+    RUN_TEST (test_concurrent_producers);
+
+    return UNITY_END ();
+}
@@ -0,0 +1,249 @@
+/*
+    Copyright (c) 2007-2016 Contributors as noted in the AUTHORS file
+
+    This file is part of libzmq, the ZeroMQ core engine in C++.
+
+    libzmq is free software; you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    As a special exception, the Contributors give you permission to link
+    this library with independent modules to produce an executable,
+    regardless of the license terms of these independent modules, and to
+    copy and distribute the resulting executable under terms of your choice,
+    provided that you also meet, for each linked independent module, the
+    terms and conditions of the license of that module. An independent
+    module is a module which is not derived from or based on this library.
+    If you modify this library, you must extend this exception to your
+    version of the library.
+
+    libzmq is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public
+    License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "../tests/testutil.hpp"
+
+#include <timer_wheel.hpp>
+#include <i_poll_events.hpp>
+
+#include <stdlib.h>
+#include <vector>
+
+#include <unity.h>
+
+void setUp ()
+{
+}
+void tearDown ()
+{
+}
+
+//  Records the time each of its timers fired at.
+struct test_sink_t : zmq::i_poll_events
+{
+    test_sink_t (const uint64_t &now_) : now (now_) {}
+
+    void in_event () ZMQ_OVERRIDE {}
+
+    void out_event () ZMQ_OVERRIDE {}
+
+    void timer_event (int id_) ZMQ_OVERRIDE
+    {
+        if (static_cast<size_t> (id_) >= fired.size ())
+            fired.resize (id_ + 1, 0);
+        fired[id_] = now;
+    }
+
+    const uint64_t &now;
+    std::vector<uint64_t> fired;
+};
+
+//  Executes the timers, always waiting for as long as the wheel says,
+//  until there are no timers left.
+void run (zmq::timer_wheel_t &wheel_, uint64_t &now_)
+{
+    uint64_t wait;
+    while ((wait = wheel_.execute (now_)) != 0)
+        now_ += wait;
+}
+
+void test_empty ()
+{
+    zmq::timer_wheel_t wheel;
+    TEST_ASSERT_TRUE (wheel.empty ());
+    TEST_ASSERT_EQUAL_UINT64 (0, wheel.execute (1000));
+
+    test_sink_t sink (0);
+    TEST_ASSERT_FALSE (wheel.cancel (&sink, 1));
+}
+
+void test_fire ()
+{
+    zmq::timer_wheel_t wheel;
+    uint64_t now = 1000;
+    test_sink_t sink (now);
+
+    wheel.add (now, 10, &sink, 0);
+    TEST_ASSERT_FALSE (wheel.empty ());
+
+    now = 1005;
+    TEST_ASSERT_EQUAL_UINT64 (5, wheel.execute (now));
+    TEST_ASSERT_TRUE (sink.fired.empty ());
+
+    now = 1010;
+    TEST_ASSERT_EQUAL_UINT64 (0, wheel.execute (now));
+    TEST_ASSERT_EQUAL_UINT64 (1010, sink.fired[0]);
+    TEST_ASSERT_TRUE (wheel.empty ());
+}
+
+void test_fire_late ()
+{
+    zmq::timer_wheel_t wheel;
+    uint64_t now = 0;
+    test_sink_t sink (now);
+
+    wheel.add (now, 0, &sink, 0);
+    wheel.add (now, 100000, &sink, 1);
+
+    //  Timers due long ago fire on the next call.
+    now = 1000000;
+    TEST_ASSERT_EQUAL_UINT64 (0, wheel.execute (now));
+    TEST_ASSERT_EQUAL_UINT64 (1000000, sink.fired[0]);
+    TEST_ASSERT_EQUAL_UINT64 (1000000, sink.fired[1]);
+}
+
+void test_cancel ()
+{
+    zmq::timer_wheel_t wheel;
+    uint64_t now = 0;
+    test_sink_t sink (now);
+    test_sink_t other_sink (now);
+
+    wheel.add (now, 10, &sink, 0);
+    wheel.add (now, 10, &sink, 1);
+    wheel.add (now, 10, &other_sink, 0);
+    TEST_ASSERT_TRUE (wheel.cancel (&sink, 0));
+    TEST_ASSERT_FALSE (wheel.cancel (&sink, 0));
+
+    run (wheel, now);
+    TEST_ASSERT_EQUAL_UINT64 (0, sink.fired[0]);
+    TEST_ASSERT_EQUAL_UINT64 (10, sink.fired[1]);
+    TEST_ASSERT_EQUAL_UINT64 (10, other_sink.fired[0]);
+}
+
+void test_levels ()
+{
+    const int timeouts[] = {1,     255,   256,      257,      65535,
+                            65536, 70000, 16777215, 16777216, 16777217,
+                            2147483647};
+    const int count = sizeof timeouts / sizeof timeouts[0];
+
+    zmq::timer_wheel_t wheel;
+    uint64_t now = 123;
+    test_sink_t sink (now);
+    for (int i = 0; i != count; ++i)
+        wheel.add (now, timeouts[i], &sink, i);
+
+    //  Every timer must fire when it is due, not earlier nor later.
+    run (wheel, now);
+    for (int i = 0; i != count; ++i)
+        TEST_ASSERT_EQUAL_UINT64 (123 + static_cast<uint64_t> (timeouts[i]),
+                                  sink.fired[i]);
+}
+
+void test_random ()
+{
+    const int count = 10000;
+
+    zmq::timer_wheel_t wheel;
+    uint64_t now = 0;
+    test_sink_t sink (now);
+    std::vector<uint64_t> expected (count, 0);
+
+    srand (42);
+    for (int i = 0; i != count; ++i) {
+        //  Add timers at various points in time, and cancel some.
+        if (i % 100 == 0)
+            now += wheel.execute (now) / 2;
+        const int timeout = rand () % (i % 3 == 0 ? 300 : 300000);
+        wheel.add (now, timeout, &sink, i);
+        expected[i] = now + timeout;
+        if (i % 7 == 0) {
+            TEST_ASSERT_TRUE (wheel.cancel (&sink, i));
+            expected[i] = 0;
+        }
+    }
+
+    run (wheel, now);
+    sink.fired.resize (count, 0);
+    for (int i = 0; i != count; ++i)
+        TEST_ASSERT_EQUAL_UINT64 (expected[i], sink.fired[i]);
+}
+
+//  Re-adds its timer when it fires, and cancels its other timer, as
+//  heartbeating engines do.
+struct rearm_sink_t : zmq::i_poll_events
+{
+    rearm_sink_t (zmq::timer_wheel_t &wheel_, const uint64_t &now_) :
+        wheel (wheel_),
+        now (now_),
+        count (0)
+    {
+    }
+
+    void in_event () ZMQ_OVERRIDE {}
+
+    void out_event () ZMQ_OVERRIDE {}
+
+    void timer_event (int id_) ZMQ_OVERRIDE
+    {
+        TEST_ASSERT_EQUAL_INT (0, id_);
+        TEST_ASSERT_EQUAL_UINT64 (count * 100, now);
+        TEST_ASSERT_TRUE (wheel.cancel (this, 1));
+        if (++count < 5) {
+            wheel.add (now, 100, this, 0);
+            wheel.add (now, 100, this, 1);
+        }
+    }
+
+    zmq::timer_wheel_t &wheel;
+    const uint64_t &now;
+    int count;
+};
+
+void test_rearm ()
+{
+    zmq::timer_wheel_t wheel;
+    uint64_t now = 0;
+    rearm_sink_t sink (wheel, now);
+
+    //  Timer 1 is due at the same time as timer 0, and is cancelled by
+    //  it before it fires.
+    wheel.add (now, 0, &sink, 0);
+    wheel.add (now, 0, &sink, 1);
+    run (wheel, now);
+    TEST_ASSERT_EQUAL_INT (5, sink.count);
+    TEST_ASSERT_TRUE (wheel.empty ());
+}
+
+int main (void)
+{
+    setup_test_environment ();
+
+    UNITY_BEGIN ();
+    RUN_TEST (test_empty);
+    RUN_TEST (test_fire);
+    RUN_TEST (test_fire_late);
+    RUN_TEST (test_cancel);
+    RUN_TEST (test_levels);
+    RUN_TEST (test_random);
+    RUN_TEST (test_rearm);
+
+    return UNITY_END ();
+}